@@ -7,12 +7,19 @@
 
 #include "types/Array.hpp"
 #include "types/Text.h"
+#include "types/TextLayout.h"
 #include "types/Rect2.hpp"
 #include "types/Transform.h"
 #include "types/Color.hpp"
 #include "types/MeshPrimitives.hpp"
 #include "types/Mesh.h"
 #include "types/Multisamples.h"
+#include "types/MipmapFilter.h"
+#include "types/GlyphAtlasType.h"
+#include "types/TextureFormat.h"
+#include "types/SignedDistanceFieldEffects.h"
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
 #include "types/RenderCoordinateSpace.hpp"
 #include "types/StreamOps.h"
 
@@ -20,6 +27,7 @@
 #include "interface/Window.h"
 #include "interface/RenderTargetTexture.h"
 #include "interface/Sampler.h"
+#include "interface/ParticleSystem.h"
 #include "interface/Texture.h"
 
 #include "interface/resources/ResourceManager.h"
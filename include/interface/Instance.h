@@ -8,6 +8,7 @@
 #include "interface/Window.h"
 #include "interface/RenderTargetTexture.h"
 #include "interface/Sampler.h"
+#include "interface/ParticleSystem.h"
 
 #include <string>
 #include <memory>
@@ -581,6 +582,35 @@ public:
 	VK2D_API void									DestroySampler(
 		Sampler									*	sampler );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Create a particle system.
+	///
+	///				Particle systems are simulated on the GPU and can be drawn into any window or render target texture.
+	/// 
+	/// @note		Multithreading: Main thread only.
+	/// 
+	///	@see		ParticleSystem
+	/// 
+	/// @param[in]	particle_system_create_info
+	///				Particle system creation parameters struct object. This is handy as creating some objects can require a lot
+	///				of parameters.
+	/// 
+	/// @return		Handle to newly created particle system.
+	VK2D_API ParticleSystem						*	CreateParticleSystem(
+		const ParticleSystemCreateInfo			&	particle_system_create_info );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Destroy particle system.
+	/// 
+	/// @note		Multithreading: Main thread only.
+	/// 
+	/// @param[in]	particle_system
+	///				Handle to ParticleSystem to destroy. Note that this handle cannot be used for anything afterwards, if you
+	///				try, you'll crash your application. If nullptr, then this function does nothing. Must not be called between
+	///				drawing the particle system and ending the render it was drawn in.
+	VK2D_API void									DestroyParticleSystem(
+		ParticleSystem							*	particle_system );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Get GPU's maximum supported multisampling.
 	///
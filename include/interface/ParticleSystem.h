@@ -0,0 +1,239 @@
+#pragma once
+
+#include "core/Common.h"
+
+#include "types/Color.hpp"
+
+#include <memory>
+
+namespace vk2d {
+
+namespace vk2d_internal {
+class InstanceImpl;
+class WindowImpl;
+class RenderTargetTextureImpl;
+class ParticleSystemImpl;
+} // vk2d_internal
+
+class Instance;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Tells where new particles appear and what they look like.
+///
+///				Values given as a minimum and a maximum are randomized per particle between the two.
+struct ParticleEmitterSettings
+{
+	/// @brief		Center of the emitter.
+	glm::vec2										position						= {};
+
+	/// @brief		Particles appear at random locations inside a circle of this radius around position.
+	float											radius							= 0.0f;
+
+	/// @brief		Direction of the initial velocity in radians, 0.0 points to positive x.
+	float											direction						= 0.0f;
+
+	/// @brief		Full angle in radians the initial velocity can deviate around direction, RAD emits in every direction.
+	float											spread							= float( RAD );
+
+	/// @brief		Minimum initial speed in units per second.
+	float											speed_min						= 50.0f;
+
+	/// @brief		Maximum initial speed in units per second.
+	float											speed_max						= 100.0f;
+
+	/// @brief		Minimum lifetime in seconds.
+	float											lifetime_min					= 1.0f;
+
+	/// @brief		Maximum lifetime in seconds.
+	float											lifetime_max					= 2.0f;
+
+	/// @brief		Width and height of a particle when it appears.
+	float											size_begin						= 8.0f;
+
+	/// @brief		Width and height of a particle when it dies, size is interpolated over the lifetime.
+	float											size_end						= 8.0f;
+
+	/// @brief		Minimum rotation speed in radians per second.
+	float											angular_velocity_min			= 0.0f;
+
+	/// @brief		Maximum rotation speed in radians per second.
+	float											angular_velocity_max			= 0.0f;
+
+	/// @brief		Color of a particle when it appears.
+	Colorf											color_begin						= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+
+	/// @brief		Color of a particle when it dies, color is interpolated over the lifetime.
+	Colorf											color_end						= Colorf( 1.0f, 1.0f, 1.0f, 0.0f );
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Parameters to construct a ParticleSystem.
+struct ParticleSystemCreateInfo
+{
+	/// @brief		Maximum amount of particles alive at the same time.
+	///
+	///				GPU memory for every particle is allocated up front. When more particles are emitted than fit, the
+	///				oldest emitted particles are replaced even if they are still alive.
+	uint32_t										capacity						= 16384;
+
+	/// @brief		Initial emitter settings, see ParticleSystem::SetEmitter().
+	ParticleEmitterSettings							emitter							= {};
+
+	/// @brief		Particles emitted per second by ParticleSystem::Update(), 0.0 emits only with ParticleSystem::Emit().
+	float											emission_rate					= 0.0f;
+
+	/// @brief		Acceleration applied to every particle in units per second squared.
+	glm::vec2										gravity							= {};
+
+	/// @brief		Air resistance, velocity falls off by exp( -drag * delta_time ) every update. 0.0 is no resistance.
+	float											drag							= 0.0f;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Particles simulated and drawn entirely on the GPU.
+///
+///				Particle state lives in GPU memory, compute shaders emit and move the particles and the draw reads the
+///				results directly. The CPU only records how much time passed and how many particles to emit, no particle data
+///				is ever transferred between the CPU and the GPU, so tens of thousands of particles cost about the same on the
+///				CPU as a single one.
+///
+///				Update() and Emit() only queue work, it is recorded by the first Window or RenderTargetTexture that draws the
+///				particle system afterwards and executed before anything is drawn in that frame. Updates queued between draws
+///				are combined into a single simulation step.
+///
+/// @note		Particle system must not be drawn into more than one Window or RenderTargetTexture in the same frame, unless
+///				they render one after another, for example when the render target texture is drawn into the window.
+class ParticleSystem {
+	friend class vk2d_internal::InstanceImpl;
+	friend class vk2d_internal::WindowImpl;
+	friend class vk2d_internal::RenderTargetTextureImpl;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Constructor. This object should not be directly constructed.
+	///
+	///				This object is created by Instance::CreateParticleSystem().
+	///
+	/// @param[in]	instance
+	///				Pointer to instance that owns this object.
+	///
+	/// @param[in]	create_info
+	///				Reference to ParticleSystemCreateInfo object defining parameters for this particle system.
+	VK2D_API										ParticleSystem(
+		vk2d_internal::InstanceImpl				*	instance,
+		const ParticleSystemCreateInfo			&	create_info );
+
+public:
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	VK2D_API										~ParticleSystem();
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Advance the simulation and emit particles according to the emission rate.
+	///
+	///				Should be called once per frame before drawing the particle system.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	delta_time
+	///				Time in seconds since the previous update.
+	VK2D_API void									Update(
+		float										delta_time );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Emit a burst of particles.
+	///
+	///				Particles are emitted with the emitter settings at the time of this call, calling SetEmitter() afterwards
+	///				does not affect them. This makes it possible to emit bursts at several places in the same frame.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	count
+	///				Amount of particles to emit.
+	VK2D_API void									Emit(
+		uint32_t									count );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Remove all particles.
+	///
+	///				Particles emitted before this call are removed as well, even if they were not drawn yet.
+	///
+	/// @note		Multithreading: Main thread only.
+	VK2D_API void									Clear();
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Set emitter settings used by all following emissions.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	emitter
+	///				New emitter settings.
+	VK2D_API void									SetEmitter(
+		const ParticleEmitterSettings			&	emitter );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get current emitter settings.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @return		Emitter settings.
+	VK2D_API const ParticleEmitterSettings		&	GetEmitter() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Set how many particles Update() emits per second.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	particles_per_second
+	///				Emission rate, 0.0 stops continuous emission.
+	VK2D_API void									SetEmissionRate(
+		float										particles_per_second );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Set acceleration applied to every particle.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	gravity
+	///				Acceleration in units per second squared.
+	VK2D_API void									SetGravity(
+		glm::vec2									gravity );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Set air resistance.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	drag
+	///				Velocity falls off by exp( -drag * delta_time ) every update. 0.0 is no resistance.
+	VK2D_API void									SetDrag(
+		float										drag );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get maximum amount of particles alive at the same time.
+	///
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Particle capacity.
+	VK2D_API uint32_t								GetCapacity() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Checks if the object is good to be used or if a failure occurred in it's creation.
+	///
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		true if class object was created successfully, false if something went wrong
+	VK2D_API bool									IsGood() const;
+
+private:
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	std::unique_ptr<vk2d_internal::ParticleSystemImpl>	impl;
+};
+
+
+
+} // vk2d
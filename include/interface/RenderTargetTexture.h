@@ -7,7 +7,11 @@
 #include "types/Transform.h"
 #include "types/Color.hpp"
 #include "types/Multisamples.h"
+#include "types/MipmapFilter.h"
 #include "types/RenderCoordinateSpace.hpp"
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
+#include "types/Text.h"
 
 #include "interface/Texture.h"
 
@@ -17,6 +21,8 @@ namespace vk2d {
 
 class Sampler;
 class Mesh;
+class FontResource;
+class ParticleSystem;
 
 namespace vk2d_internal {
 
@@ -26,6 +32,34 @@ class RenderTargetTextureImpl;
 } // vk2d_internal
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Tells when mipmaps of a render target texture are generated.
+///
+///				Mipmaps are only needed when the render target texture is drawn smaller than its own size. If it's always drawn
+///				at its own size or larger, for example a UI layer composited 1:1 onto a window, generating mipmaps after every
+///				render is wasted work.
+enum class RenderTargetTextureMipmapMode : uint32_t
+{
+	/// @brief		Generate all mip levels at the end of every render.
+	ALWAYS,
+
+	/// @brief		Render target texture has a single mip level and mipmaps are never generated.
+	///
+	///				Samplers always read mip level 0, drawing the render target texture much smaller than its own size will
+	///				look grainy. BlurType::DUAL_KAWASE needs mip levels and falls back to BlurType::GAUSSIAN.
+	NEVER,
+
+	/// @brief		Generate mip levels only for renders that are drawn smaller than their own size.
+	///
+	///				Mip levels are allocated but generated only if the render target texture is drawn with a sampler that can
+	///				read them, and the draw is estimated to shrink the texture. Mipmaps are decided when the render is
+	///				submitted, so all draws using the render target texture should be recorded before the window or render
+	///				target texture drawing it ends its render. If a draw shrinking the texture is recorded after that, for
+	///				example when the same render is drawn again in a later frame, mipmaps are generated for every render from
+	///				then on.
+	ON_DEMAND,
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief		Parameters to construct a RenderTargetTexture.
 struct RenderTargetTextureCreateInfo
@@ -42,6 +76,12 @@ struct RenderTargetTextureCreateInfo
 	/// @brief		Enable ability to blur the render target texture at the end of the render. Uses more GPU resources if
 	///				enabled.
 	bool									enable_blur					= false;
+
+	/// @brief		Filter used to generate mipmaps for the render target texture at the end of the render, see MipmapFilter.
+	MipmapFilter							mipmap_filter				= MipmapFilter::BOX;
+
+	/// @brief		When mipmaps are generated, see RenderTargetTextureMipmapMode.
+	RenderTargetTextureMipmapMode			mipmap_mode					= RenderTargetTextureMipmapMode::ALWAYS;
 };
 
 
@@ -553,6 +593,142 @@ public:
 		const Mesh										&	mesh,
 		const std::vector<glm::mat4>					&	transformations );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws text directly without generating a Mesh first.
+	///
+	///				Each glyph is sent to the GPU as a single 16 byte instance and expanded into a quad in the vertex shader, so
+	///				nothing is allocated per call and large amounts of text, like terminal style views, are cheap to draw every
+	///				frame. For static text a Mesh from GenerateTextMesh() can be reused instead. Signed distance field effects
+	///				are not available here, use GenerateTextMesh() and Mesh::SetSignedDistanceFieldEffects() for those.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	font
+	///				A pointer to font resource to use.
+	///
+	/// @param[in]	origin
+	///				Left or top coordinate of what is considered the starting point for the text, see GenerateTextMesh().
+	///
+	/// @param[in]	text
+	///				Text characters to draw. <tt>std::string</tt> and <tt>const char*</tt> are decoded as UTF-8, see Text.
+	///
+	/// @param[in]	kerning
+	///				Spacing between letters. Positive values are farther apart. Value is based on size of the font texel size.
+	///
+	/// @param[in]	scale
+	///				Scale of the text. Value {1.0, 1.0} will map 1:1 to the font size in texel coordinate spaces.
+	///
+	/// @param[in]	vertical
+	///				true if text is drawn vertically, false if horisontally.
+	///
+	/// @param[in]	font_face
+	///				Certain fonts may contain multiple font faces, this allows you to select which one to use.
+	///
+	/// @param[in]	color
+	///				Color of the text.
+	///
+	/// @param[in]	wait_for_resource_load
+	///				true to wait for the font to load if it's not loaded yet, false to skip drawing until it is.
+	VK2D_API void											DrawText(
+		FontResource									*	font,
+		glm::vec2											origin,
+		const Text										&	text,
+		float												kerning						= 0.0f,
+		glm::vec2											scale						= glm::vec2( 1.0f, 1.0f ),
+		bool												vertical					= false,
+		uint32_t											font_face					= 0,
+		Colorf												color						= { 1.0f, 1.0f, 1.0f, 1.0f },
+		bool												wait_for_resource_load		= true );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws circles directly without generating a Mesh first.
+	///
+	///				Each shape is sent to the GPU as a single 24 byte instance and drawn as one quad. The edge is calculated per
+	///				pixel from a signed distance function so shapes stay smooth and antialiased at any size, multisampling is not
+	///				needed. Each call is one draw command, draw as many shapes per call as possible. Compared to a Mesh from
+	///				GenerateEllipseMesh() this needs no tessellation and the shape never shows edges between segments.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	circles
+	///				Circles to draw.
+	VK2D_API void											DrawCircles(
+		const std::vector<CirclePrimitive>				&	circles );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws rounded rectangles directly without generating a Mesh first.
+	///
+	///				Drawn the same way as DrawCircles(), one quad per rectangle with the rounded edge calculated per pixel.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	rounded_rects
+	///				Rounded rectangles to draw.
+	VK2D_API void											DrawRoundedRects(
+		const std::vector<RoundedRectPrimitive>			&	rounded_rects );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws rings directly without generating a Mesh first.
+	///
+	///				Drawn the same way as DrawCircles(), one quad per ring with both edges calculated per pixel.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	rings
+	///				Rings to draw.
+	VK2D_API void											DrawRings(
+		const std::vector<RingPrimitive>				&	rings );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws thick polylines directly without generating a Mesh first.
+	///
+	///				Each segment is sent to the GPU as a point and expanded into a quad in the vertex shader, edges, joins and
+	///				caps are antialiased per pixel. Unlike DrawLineList() this does not depend on line rasterization, any line
+	///				width works on every device and polylines of different widths are drawn with a single draw command. Width
+	///				and color can change per point. Lines thinner than a pixel are drawn one pixel wide and faded out.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	polylines
+	///				Polylines to draw.
+	///
+	/// @param[in]	join
+	///				How segments are connected to each other.
+	///
+	/// @param[in]	cap
+	///				How the ends of open polylines are drawn.
+	///
+	/// @param[in]	miter_limit
+	///				Only used with PolylineJoin::MITER. Longest allowed miter relative to half of the line width, sharper corners
+	///				are drawn with PolylineJoin::BEVEL.
+	VK2D_API void											DrawPolylines(
+		const std::vector<Polyline>						&	polylines,
+		PolylineJoin										join						= PolylineJoin::MITER,
+		PolylineCap											cap							= PolylineCap::BUTT,
+		float												miter_limit					= 4.0f );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws a particle system.
+	///
+	///				Every particle is drawn as a textured quad straight from GPU memory. Pending updates of the particle system
+	///				are recorded here and run before anything else is drawn into this render target texture, see
+	///				ParticleSystem.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	particle_system
+	///				Particle system to draw.
+	///
+	/// @param[in]	texture
+	///				Texture drawn on every particle, the first layer is used. If nullptr, particles are drawn as solid squares.
+	///
+	/// @param[in]	sampler
+	///				Sampler used to sample the texture. If nullptr, the default sampler is used.
+	VK2D_API void											DrawParticleSystem(
+		ParticleSystem									*	particle_system,
+		Texture											*	texture						= nullptr,
+		Sampler											*	sampler						= nullptr );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Checks if the object is good to be used or if a failure occurred in it's creation.
 	/// 
@@ -6,8 +6,11 @@
 #include "types/Transform.h"
 #include "types/Color.hpp"
 #include "types/MeshPrimitives.hpp"
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
 #include "types/Multisamples.h"
 #include "types/RenderCoordinateSpace.hpp"
+#include "types/Text.h"
 
 #include <memory>
 #include <string>
@@ -32,11 +35,13 @@ void UpdateMonitorLists( bool globals_locked );
 class Instance;
 class Texture;
 class Mesh;
+class FontResource;
 class WindowEventHandler;
 class Window;
 class Cursor;
 class Monitor;
 class Sampler;
+class ParticleSystem;
 
 
 
@@ -1070,6 +1075,7 @@ public:
 	/// @brief		Draws lines directly.
 	/// 
 	///				Best used if you want to manipulate and draw vertices directly.
+	///				Line widths other than 1.0 depend on the wideLines device feature, use DrawPolylines() for thick lines.
 	/// 
 	/// @note		Multithreading: Main thread only.
 	/// 
@@ -1355,6 +1361,141 @@ public:
 		const Mesh								&	mesh,
 		const std::vector<glm::mat4>			&	transformations );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws text directly without generating a Mesh first.
+	///
+	///				Each glyph is sent to the GPU as a single 16 byte instance and expanded into a quad in the vertex shader, so
+	///				nothing is allocated per call and large amounts of text, like terminal style views, are cheap to draw every
+	///				frame. For static text a Mesh from GenerateTextMesh() can be reused instead. Signed distance field effects
+	///				are not available here, use GenerateTextMesh() and Mesh::SetSignedDistanceFieldEffects() for those.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	font
+	///				A pointer to font resource to use.
+	///
+	/// @param[in]	origin
+	///				Left or top coordinate of what is considered the starting point for the text, see GenerateTextMesh().
+	///
+	/// @param[in]	text
+	///				Text characters to draw. <tt>std::string</tt> and <tt>const char*</tt> are decoded as UTF-8, see Text.
+	///
+	/// @param[in]	kerning
+	///				Spacing between letters. Positive values are farther apart. Value is based on size of the font texel size.
+	///
+	/// @param[in]	scale
+	///				Scale of the text. Value {1.0, 1.0} will map 1:1 to the font size in texel coordinate spaces.
+	///
+	/// @param[in]	vertical
+	///				true if text is drawn vertically, false if horisontally.
+	///
+	/// @param[in]	font_face
+	///				Certain fonts may contain multiple font faces, this allows you to select which one to use.
+	///
+	/// @param[in]	color
+	///				Color of the text.
+	///
+	/// @param[in]	wait_for_resource_load
+	///				true to wait for the font to load if it's not loaded yet, false to skip drawing until it is.
+	VK2D_API void									DrawText(
+		FontResource							*	font,
+		glm::vec2									origin,
+		const Text								&	text,
+		float										kerning						= 0.0f,
+		glm::vec2									scale						= glm::vec2( 1.0f, 1.0f ),
+		bool										vertical					= false,
+		uint32_t									font_face					= 0,
+		Colorf										color						= { 1.0f, 1.0f, 1.0f, 1.0f },
+		bool										wait_for_resource_load		= true );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws circles directly without generating a Mesh first.
+	///
+	///				Each shape is sent to the GPU as a single 24 byte instance and drawn as one quad. The edge is calculated per
+	///				pixel from a signed distance function so shapes stay smooth and antialiased at any size, multisampling is not
+	///				needed. Each call is one draw command, draw as many shapes per call as possible. Compared to a Mesh from
+	///				GenerateEllipseMesh() this needs no tessellation and the shape never shows edges between segments.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	circles
+	///				Circles to draw.
+	VK2D_API void									DrawCircles(
+		const std::vector<CirclePrimitive>		&	circles );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws rounded rectangles directly without generating a Mesh first.
+	///
+	///				Drawn the same way as DrawCircles(), one quad per rectangle with the rounded edge calculated per pixel.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	rounded_rects
+	///				Rounded rectangles to draw.
+	VK2D_API void									DrawRoundedRects(
+		const std::vector<RoundedRectPrimitive>	&	rounded_rects );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws rings directly without generating a Mesh first.
+	///
+	///				Drawn the same way as DrawCircles(), one quad per ring with both edges calculated per pixel.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	rings
+	///				Rings to draw.
+	VK2D_API void									DrawRings(
+		const std::vector<RingPrimitive>		&	rings );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws thick polylines directly without generating a Mesh first.
+	///
+	///				Each segment is sent to the GPU as a point and expanded into a quad in the vertex shader, edges, joins and
+	///				caps are antialiased per pixel. Unlike DrawLineList() this does not depend on line rasterization, any line
+	///				width works on every device and polylines of different widths are drawn with a single draw command. Width
+	///				and color can change per point. Lines thinner than a pixel are drawn one pixel wide and faded out.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	polylines
+	///				Polylines to draw.
+	///
+	/// @param[in]	join
+	///				How segments are connected to each other.
+	///
+	/// @param[in]	cap
+	///				How the ends of open polylines are drawn.
+	///
+	/// @param[in]	miter_limit
+	///				Only used with PolylineJoin::MITER. Longest allowed miter relative to half of the line width, sharper corners
+	///				are drawn with PolylineJoin::BEVEL.
+	VK2D_API void									DrawPolylines(
+		const std::vector<Polyline>				&	polylines,
+		PolylineJoin								join						= PolylineJoin::MITER,
+		PolylineCap									cap							= PolylineCap::BUTT,
+		float										miter_limit					= 4.0f );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Draws a particle system.
+	///
+	///				Every particle is drawn as a textured quad straight from GPU memory. If the particle system has pending
+	///				updates they are recorded here and run before anything in this frame is drawn, see ParticleSystem.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	particle_system
+	///				Particle system to draw.
+	///
+	/// @param[in]	texture
+	///				Texture drawn on every particle, the first layer is used. If nullptr, particles are drawn as solid squares.
+	///
+	/// @param[in]	sampler
+	///				Sampler used to sample the texture. If nullptr, the default sampler is used.
+	VK2D_API void									DrawParticleSystem(
+		ParticleSystem							*	particle_system,
+		Texture									*	texture						= nullptr,
+		Sampler									*	sampler						= nullptr );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Checks if the object is good to be used or if a failure occurred in it's creation.
 	/// 
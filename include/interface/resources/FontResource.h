@@ -2,6 +2,10 @@
 
 #include "core/Common.h"
 
+#include "types/GlyphAtlasType.h"
+#include "types/Text.h"
+#include "types/TextLayout.h"
+
 #include "interface/resources/ResourceBase.h"
 
 #include <filesystem>
@@ -18,7 +22,7 @@ class FontResource;
 VK2D_API Mesh					GenerateTextMesh(
 	FontResource			*	font,
 	glm::vec2					origin,
-	std::string					text,
+	const Text				&	text,
 	float						kerning,
 	glm::vec2					scale,
 	bool						vertical,
@@ -32,11 +36,40 @@ namespace vk2d_internal {
 
 class ResourceManagerImpl;
 class FontResourceImpl;
+class WindowImpl;
+class RenderTargetTextureImpl;
 
 } // vk2d_internal
 
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Information about how well glyphs are packed into the font texture atlas.
+///
+///				See FontResource::GetAtlasStatistics().
+struct FontAtlasStatistics
+{
+	/// @brief		Width and height of a single atlas layer in texels.
+	uint32_t												atlas_size							= {};
+
+	/// @brief		Amount of atlas layers in use.
+	uint32_t												atlas_layer_count					= {};
+
+	/// @brief		Amount of glyphs stored in the atlas.
+	uint64_t												glyph_count							= {};
+
+	/// @brief		Amount of texels covered by glyph bitmaps, padding not included.
+	uint64_t												glyph_texel_count					= {};
+
+	/// @brief		Total amount of texels in all atlas layers.
+	uint64_t												total_texel_count					= {};
+
+	/// @brief		Ratio of glyph texels to total texels, 0.0 to 1.0.
+	float													occupancy							= {};
+};
+
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// @brief		FontResource is a resource that contains a font which is used to draw text.
 ///
@@ -51,16 +84,26 @@ class FontResource
 {
 	friend class vk2d_internal::ResourceManagerImpl;
 	friend class vk2d_internal::FontResourceImpl;
+	friend class vk2d_internal::WindowImpl;
+	friend class vk2d_internal::RenderTargetTextureImpl;
 	friend VK2D_API Mesh									GenerateTextMesh(
 		FontResource									*	font,
 		glm::vec2											origin,
-		std::string											text,
+		const Text										&	text,
 		float												kerning,
 		glm::vec2											scale,
 		bool												vertical,
 		uint32_t											font_face,
 		bool												wait_for_resource
 	);
+	friend VK2D_API Mesh									GenerateTextLayoutMesh(
+		FontResource									*	font,
+		glm::vec2											origin,
+		const Text										&	text,
+		const TextLayoutSettings						&	settings,
+		std::vector<TextLineMetrics>					*	out_line_metrics,
+		bool												wait_for_resource_load
+	);
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		This constructor is meant for internal use only.
@@ -106,6 +149,20 @@ class FontResource
 	///				used to make text appear less grainy. However if mipmapping is used, then the glyphs may eventually start to
 	///				mix together in the final render, to decrease the amount of this "UV bleeding" you can increase the gap
 	///				between glyphs in the texture atlas here.
+	/// 
+	/// @param[in]	use_dynamic_glyph_cache
+	///				If true, glyphs are rasterized when they're first used instead of rasterizing every glyph at load time. See
+	///				ResourceManager::LoadFontResource() for more info.
+	/// 
+	/// @param[in]	preload_characters
+	///				Characters rasterized at load time when dynamic glyph cache is used, ignored otherwise.
+	/// 
+	/// @param[in]	glyph_atlas_type
+	///				How glyphs are stored in the font texture atlas.
+	/// 
+	/// @param[in]	atlas_cache_directory
+	///				Directory where glyph atlases are cached between runs, empty disables caching. See
+	///				ResourceManager::LoadFontResource() for more info.
 	VK2D_API												FontResource(
 		vk2d_internal::ResourceManagerImpl				*	resource_manager,
 		uint32_t											loader_thread_index,
@@ -114,7 +171,11 @@ class FontResource
 		uint32_t											glyph_texel_size,
 		bool												use_alpha,
 		uint32_t											fallback_character,
-		uint32_t											glyph_atlas_padding
+		uint32_t											glyph_atlas_padding,
+		bool												use_dynamic_glyph_cache,
+		const std::vector<uint32_t>						&	preload_characters,
+		GlyphAtlasType										glyph_atlas_type,
+		const std::filesystem::path						&	atlas_cache_directory
 	);
 
 public:
@@ -173,7 +234,7 @@ public:
 	/// @note		Multithreading: Any thread.
 	/// 
 	/// @param[in]	text
-	///				Text to get area size for.
+	///				Text to get area size for. <tt>std::string</tt> and <tt>const char*</tt> are decoded as UTF-8, see Text.
 	/// 
 	/// @param[in]	kerning
 	///				Spacing between letters. Positive values are farther apart. Value is based on size of the font texel size.
@@ -195,13 +256,24 @@ public:
 	/// 
 	/// @return		Area the text would occupy if rendered.
 	VK2D_API Rect2f											CalculateRenderedSize(
-		std::string_view									text,
+		const Text										&	text,
 		float												kerning								= 0.0f,
 		glm::vec2											scale								= glm::vec2( 1.0f, 1.0f ),
 		bool												vertical							= false,
 		uint32_t											font_face							= 0,
 		bool												wait_for_resource_load				= true );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get glyph atlas packing statistics.
+	///
+	///				Useful for tuning glyph texel size and padding against texture memory use. If dynamic glyph cache is used the
+	///				statistics change as new glyphs are rasterized.
+	/// 
+	/// @note		Multithreading: Any thread.
+	/// 
+	/// @return		Atlas statistics or empty statistics {} if the font has not been loaded.
+	VK2D_API FontAtlasStatistics							GetAtlasStatistics();
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		VK2D class object checker function.
 	/// 
@@ -3,6 +3,8 @@
 #include "core/Common.h"
 
 #include "types/Color.hpp"
+#include "types/GlyphAtlasType.h"
+#include "types/TextureFormat.h"
 
 #include <memory>
 #include <filesystem>
@@ -130,6 +132,34 @@ public:
 		glm::uvec2												size,
 		const std::vector<const std::vector<Color8>*>		&	texels_listing );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Create a multi-layer texture resource from raw texel data in given format.
+	///
+	///				Use this to create textures with less than 4 channels, eg. masks with TextureFormat::R8_UNORM use a quarter of
+	///				the memory of a regular texture.
+	/// 
+	/// @note		Multithreading: Any thread.
+	/// 
+	/// @param[in]	size
+	///				Size of the texture in texels.
+	/// 
+	/// @param[in]	format
+	///				Format of the texel data and the texture, see TextureFormat.
+	/// 
+	/// @param[in]	texels_listing
+	///				Raw texel data to use to construct the texture, tightly packed rows of texels in given format.
+	///				<br>
+	///				- Each texel data vector must be big enough to contain all texel data at given size. ( must be at least:
+	///				size.x * size.y * bytes per texel ).
+	///				- Lenght of the top vector determines the number of arrays the texture has.
+	///				- This data is copied over to internal memory before returning so you do not need to keep the vector around.
+	/// 
+	/// @return		Handle to newly created texture resource you can use when rendering.
+	VK2D_API TextureResource								*	CreateArrayTextureResource(
+		glm::uvec2												size,
+		TextureFormat											format,
+		const std::vector<const std::vector<uint8_t>*>		&	texels_listing );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Load a multi-layer texture resource from files.
 	/// 
@@ -198,13 +228,42 @@ public:
 	///				mix together in the final render, to decrease the amount of this "UV bleeding" you can increase the gap
 	///				between glyphs in the texture atlas here.
 	/// 
+	/// @param[in]	use_dynamic_glyph_cache
+	///				By default every glyph in the font is rasterized when the font is loaded, which can take a long time and a lot
+	///				of memory with fonts that contain thousands of glyphs, for example CJK fonts. If this is true, only the fallback
+	///				character and characters in preload_characters are rasterized at load time, other glyphs are rasterized the
+	///				first time they are used by GenerateTextMesh() or FontResource::CalculateRenderedSize(). Newly rasterized
+	///				glyphs are uploaded to the GPU in batches at the beginning of the next frame and will not be visible until
+	///				the upload has finished, text meshes should be regenerated to show them. When the glyph atlas grows, the font
+	///				texture is replaced and the previous version is destroyed once the GPU has finished using it, text meshes
+	///				generated before that refer to the previous version and must be regenerated.
+	/// 
+	/// @param[in]	preload_characters
+	///				Unicode code points of the characters to rasterize at load time when dynamic glyph cache is used, for example
+	///				all printable ASCII characters. Ignored if use_dynamic_glyph_cache is false.
+	/// 
+	/// @param[in]	glyph_atlas_type
+	///				How glyphs are stored in the font texture atlas. GlyphAtlasType::SIGNED_DISTANCE_FIELD allows rendering
+	///				sharp text at any scale from a single font resource, in which case glyph_texel_size can usually be kept small,
+	///				for example 32 to 48 texels. See GlyphAtlasType for more info.
+	/// 
+	/// @param[in]	atlas_cache_directory
+	///				Directory where rasterized glyph atlases are cached between runs. If a cache file for the same font file and
+	///				settings is found, glyphs are loaded from it directly instead of rasterizing them again, which makes loading
+	///				large fonts much faster. Cache file is written after the font has been rasterized the first time. Directory is
+	///				created if it does not exist. Empty path disables caching. Ignored if use_dynamic_glyph_cache is true.
+	/// 
 	/// @return		Handle to newly created font resource you can use when rendering text.
 	VK2D_API FontResource									*	LoadFontResource(
 		const std::filesystem::path							&	file_path,
 		uint32_t												glyph_texel_size			= 32,
 		bool													use_alpha					= true,
 		uint32_t												fallback_character			= '*',
-		uint32_t												glyph_atlas_padding			= 8 );
+		uint32_t												glyph_atlas_padding			= 8,
+		bool													use_dynamic_glyph_cache		= false,
+		const std::vector<uint32_t>							&	preload_characters			= {},
+		GlyphAtlasType											glyph_atlas_type			= GlyphAtlasType::BITMAP,
+		const std::filesystem::path							&	atlas_cache_directory		= {} );
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Destroy a resource.
@@ -3,6 +3,7 @@
 #include "core/Common.h"
 
 #include "types/Color.hpp"
+#include "types/TextureFormat.h"
 
 #include "interface/resources/ResourceBase.h"
 #include "interface/Texture.h"
@@ -15,6 +16,7 @@ namespace vk2d_internal {
 class InstanceImpl;
 class WindowImpl;
 class TextureResourceImpl;
+class FontResourceImpl;
 class ResourceThreadLoadTask;
 class ResourceThreadUnloadTask;
 } // vk2d_internal
@@ -38,6 +40,7 @@ class TextureResource :
 	friend class vk2d_internal::ResourceThreadLoadTask;
 	friend class vk2d_internal::ResourceThreadUnloadTask;
 	friend class vk2d_internal::WindowImpl;
+	friend class vk2d_internal::FontResourceImpl;
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		This constructor is meant for internal use only.
@@ -107,6 +110,38 @@ class TextureResource :
 		glm::uvec2											size,
 		const std::vector<const std::vector<Color8>*>	&	texels_listing );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		This constructor is meant for internal use only.
+	///
+	/// @note		Multithreading: Any thread.
+	/// 
+	/// @param[in]	resource_manager
+	///				Pointer to resource manager implementation object responsible for creating this resource.
+	/// 
+	/// @param[in]	loader_thread_index
+	///				Index to thread pool thread index. Tells which thread pool thread is responsible for creation and destruction of
+	///				the internal data of this resource.
+	/// 
+	/// @param[in]	parent_resource
+	///				Pointer to a resource that owns this resource.
+	/// 
+	/// @param[in]	size
+	///				Size of the texture in texels.
+	/// 
+	/// @param[in]	format
+	///				Format of the texel data and the texture.
+	/// 
+	/// @param[in]	texels_listing
+	///				Raw texel data in given format, one vector per texture array layer. Each vector must be at least
+	///				size.x * size.y * bytes per texel in size. Data is copied over to internal memory before returning.
+	VK2D_API												TextureResource(
+		vk2d_internal::ResourceManagerImpl				*	resource_manager,
+		uint32_t											loader_thread,
+		ResourceBase									*	parent_resource,
+		glm::uvec2											size,
+		TextureFormat										format,
+		const std::vector<const std::vector<uint8_t>*>	&	texels_listing );
+
 public:
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
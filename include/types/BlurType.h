@@ -20,6 +20,16 @@ enum class BlurType : uint32_t
 	///				This is a type of blur where closer pixels contribute more and further pixels contribute less to the
 	///				result, the amount of contribution follows the gaussian falloff.
 	GAUSSIAN,
+
+	/// @brief		Use dual Kawase blur.
+	///
+	///				Image is blurred while it's downsampled through the render target texture mip levels and again while it's
+	///				upsampled back. Cost stays nearly the same regardless of blur amount, which makes this the best choice for
+	///				large or animated blur amounts. Result looks close to gaussian blur but blur amount is approximate.
+	///				<br>
+	///				Needs compute shader support and render target texture mip levels, gaussian blur is used instead if either is
+	///				not available.
+	DUAL_KAWASE,
 };
 
 
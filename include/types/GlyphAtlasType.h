@@ -0,0 +1,29 @@
+#pragma once
+
+#include "core/Common.h"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Tells how font glyphs are stored in the font texture atlas.
+enum class GlyphAtlasType : uint32_t
+{
+	/// @brief		Glyphs are stored as regular coverage bitmaps.
+	///
+	///				Text looks best when rendered at the same size as the glyph texel size of the font, scaling text up makes it
+	///				blurry and scaling it down relies on mipmapping.
+	BITMAP,
+
+	/// @brief		Glyphs are stored as signed distance fields.
+	///
+	///				Each texel stores the distance to the nearest glyph edge instead of coverage. Text stays sharp at any scale
+	///				so a single small atlas can be used to render text at many sizes. Also allows rendering outlines and soft
+	///				shadows, see SignedDistanceFieldEffects. Color glyphs, like emojis, are not supported.
+	SIGNED_DISTANCE_FIELD,
+};
+
+
+
+} // vk2d
@@ -5,6 +5,9 @@
 #include "types/MeshPrimitives.hpp"
 #include "types/Rect2.hpp"
 #include "types/Color.hpp"
+#include "types/SignedDistanceFieldEffects.h"
+#include "types/Text.h"
+#include "types/TextLayout.h"
 
 #include <vector>
 #include <string>
@@ -74,13 +77,21 @@ class Mesh {
 	friend VK2D_API Mesh							GenerateTextMesh(
 		FontResource							*	font,
 		glm::vec2									origin,
-		std::string									text,
+		const Text								&	text,
 		float										kerning,
 		glm::vec2									scale,
 		bool										vertical,
 		uint32_t									font_face,
 		bool										wait_for_resource_load );
 
+	friend VK2D_API Mesh							GenerateTextLayoutMesh(
+		FontResource							*	font,
+		glm::vec2									origin,
+		const Text								&	text,
+		const TextLayoutSettings				&	settings,
+		std::vector<TextLineMetrics>			*	out_line_metrics,
+		bool										wait_for_resource_load );
+
 public:
 
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -302,6 +313,17 @@ public:
 	VK2D_API void									SetSampler(
 		Sampler									*	sampler_pointer );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Set outline and shadow effects used when rendering signed distance field text.
+	///
+	///				Only has an effect if this mesh was generated with GenerateTextMesh() from a font that was loaded with
+	///				GlyphAtlasType::SIGNED_DISTANCE_FIELD.
+	/// 
+	/// @param[in]	effects
+	///				Outline and shadow settings.
+	VK2D_API void									SetSignedDistanceFieldEffects(
+		const SignedDistanceFieldEffects		&	effects );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Set size of a single vertex when rendering point meshes.
 	///
@@ -425,6 +447,15 @@ private:
 	///
 	///				Can be used in all modes. Can be nullptr for default sampler.
 	Sampler										*	sampler							= nullptr;
+
+	/// @brief		Signed distance field spread in texture texels.
+	///
+	///				Set by GenerateTextMesh() when the font uses signed distance field glyphs, 0.0 means texture is sampled as
+	///				regular color.
+	float											signed_distance_field_spread	= 0.0f;
+
+	/// @brief		Effects used when rendering signed distance field text.
+	SignedDistanceFieldEffects						signed_distance_field_effects	= {};
 };
 
 
@@ -589,7 +620,7 @@ VK2D_API Mesh										GenerateLatticeMesh(
 ///				- For vertical text origin is top beginning of text and horisontal offset is middle of the symbols.
 /// 
 /// @param[in]	text
-///				Text characters to generate.
+///				Text characters to generate. <tt>std::string</tt> and <tt>const char*</tt> are decoded as UTF-8, see Text.
 /// 
 /// @param[in]	kerning
 ///				Spacing between letters. Positive values are farther apart. Value is based on size of the font texel size.
@@ -617,13 +648,50 @@ VK2D_API Mesh										GenerateLatticeMesh(
 VK2D_API Mesh										GenerateTextMesh(
 	FontResource								*	font,
 	glm::vec2										origin,
-	std::string										text,
+	const Text									&	text,
 	float											kerning							= 0.0f,
 	glm::vec2										scale							= glm::vec2( 1.0f, 1.0f ),
 	bool											vertical						= false,
 	uint32_t										font_face						= 0,
 	bool											wait_for_resource_load			= true );
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Generate a multi-line horisontal text mesh with wrapping and alignment.
+///
+///				Text is broken into lines at newline characters and wrapped to TextLayoutSettings::max_width in a single pass,
+///				kerning pairs from the font are applied. Use this instead of measuring growing substrings with
+///				FontResource::CalculateRenderedSize() to wrap text.
+///
+/// @note		Multithreading: Any thread.
+/// 
+/// @param[in]	font
+///				A pointer to font resource to use.
+/// 
+/// @param[in]	origin
+///				Left side of the first line on its baseline, alignment is done to the right of this point.
+/// 
+/// @param[in]	text
+///				Text characters to generate. <tt>std::string</tt> and <tt>const char*</tt> are decoded as UTF-8, see Text.
+/// 
+/// @param[in]	settings
+///				Layout parameters, see TextLayoutSettings.
+/// 
+/// @param[out]	out_line_metrics
+///				If not nullptr, receives metrics of each laid out line, origin included.
+/// 
+/// @param[in]	wait_for_resource_load
+///				Setting this option to true will wait for the font resource to load before allowing execution to continue. If
+///				false an empty mesh is returned until the font has been fully loaded by the resource manager.
+/// 
+/// @return		A new mesh object.
+VK2D_API Mesh										GenerateTextLayoutMesh(
+	FontResource								*	font,
+	glm::vec2										origin,
+	const Text									&	text,
+	const TextLayoutSettings					&	settings						= {},
+	std::vector<TextLineMetrics>				*	out_line_metrics				= nullptr,
+	bool											wait_for_resource_load			= true );
+
 
 
 } // vk2d
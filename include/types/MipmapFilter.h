@@ -0,0 +1,31 @@
+#pragma once
+
+#include "core/Common.h"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Filter used when generating mipmaps.
+///
+///				Only has an effect when mipmaps are generated with compute shaders, this is the case if the device supports
+///				storage images in the texture format. Otherwise mipmaps are generated by blitting with linear filtering.
+enum class MipmapFilter : uint32_t
+{
+	/// @brief		Use box filter.
+	///
+	///				Each destination texel is the area weighted average of the source texels it covers. This is the fastest
+	///				filter and allows generating up to 4 mip levels per compute dispatch.
+	BOX,
+
+	/// @brief		Use Kaiser windowed sinc filter.
+	///
+	///				Produces sharper mipmaps with less aliasing than box filter but samples a wider area of the source, mip
+	///				levels are generated one per compute dispatch.
+	KAISER,
+};
+
+
+
+} // vk2d
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "core/Common.h"
+
+#include "types/Color.hpp"
+
+#include <vector>
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		How polyline segments are connected to each other.
+enum class PolylineJoin : uint32_t
+{
+	/// @brief		Outer edges are extended until they meet, falls back to BEVEL when the corner is sharper than the miter
+	///				limit allows.
+	MITER,
+
+	/// @brief		Outer corners are cut off with a straight edge.
+	BEVEL,
+
+	/// @brief		Outer corners are rounded.
+	ROUND,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		How the ends of open polylines are drawn.
+enum class PolylineCap : uint32_t
+{
+	/// @brief		Line ends exactly at the end point.
+	BUTT,
+
+	/// @brief		Line is extended past the end point by half of the line width.
+	SQUARE,
+
+	/// @brief		Line end is rounded with a radius of half of the line width.
+	ROUND,
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		A single point on a polyline.
+///
+///				Width and color are interpolated along the segments between points.
+struct PolylinePoint
+{
+	/// @brief		Location of the point.
+	glm::vec2										position						= {};
+
+	/// @brief		Width of the line at this point.
+	float											width							= 1.0f;
+
+	/// @brief		Color of the line at this point.
+	Colorf											color							= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Connected line segments drawn with Window::DrawPolylines() or RenderTargetTexture::DrawPolylines().
+struct Polyline
+{
+	/// @brief		Points of the polyline, at least 2 are needed.
+	std::vector<PolylinePoint>						points							= {};
+
+	/// @brief		true to connect the last point back to the first one, needs at least 3 points.
+	bool											closed							= false;
+};
+
+
+
+} // vk2d
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "core/Common.h"
+
+#include "types/Rect2.hpp"
+#include "types/Color.hpp"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Filled circle drawn with Window::DrawCircles() or RenderTargetTexture::DrawCircles().
+///
+///				Shapes are drawn as a single quad each and the edge is calculated per pixel, they are always smooth and
+///				antialiased regardless of size or multisampling.
+struct CirclePrimitive
+{
+	/// @brief		Center of the circle.
+	glm::vec2										center							= {};
+
+	/// @brief		Radius of the circle.
+	float											radius							= 1.0f;
+
+	/// @brief		Color of the circle.
+	Colorf											color							= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Filled rectangle with rounded corners drawn with Window::DrawRoundedRects() or
+///				RenderTargetTexture::DrawRoundedRects().
+///
+///				Shapes are drawn as a single quad each and the edge is calculated per pixel, they are always smooth and
+///				antialiased regardless of size or multisampling.
+struct RoundedRectPrimitive
+{
+	/// @brief		Area of the rectangle.
+	Rect2f											area							= {};
+
+	/// @brief		Radius of the corners, limited to half of the shorter side. 0.0 gives sharp corners.
+	float											corner_radius					= 0.0f;
+
+	/// @brief		Color of the rectangle.
+	Colorf											color							= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Ring, or a circle with a hole in the middle, drawn with Window::DrawRings() or RenderTargetTexture::DrawRings().
+///
+///				Shapes are drawn as a single quad each and the edge is calculated per pixel, they are always smooth and
+///				antialiased regardless of size or multisampling.
+struct RingPrimitive
+{
+	/// @brief		Center of the ring.
+	glm::vec2										center							= {};
+
+	/// @brief		Radius of the outer edge of the ring.
+	float											outer_radius					= 1.0f;
+
+	/// @brief		Radius of the inner edge of the ring, limited between 0.0 and outer_radius.
+	float											inner_radius					= 0.5f;
+
+	/// @brief		Color of the ring.
+	Colorf											color							= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+};
+
+
+
+} // vk2d
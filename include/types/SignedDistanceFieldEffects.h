@@ -0,0 +1,38 @@
+#pragma once
+
+#include "core/Common.h"
+
+#include "types/Color.hpp"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Effects used when rendering text generated from a signed distance field font.
+///
+///				Only has an effect on meshes generated from fonts that were loaded with GlyphAtlasType::SIGNED_DISTANCE_FIELD.
+///				All distances are in font atlas texels, the same units as the glyph texel size of the font. Signed distance
+///				field is only stored a few texels away from the glyph edges so outline width and shadow offset plus softness
+///				should be kept under 8 texels.
+struct SignedDistanceFieldEffects
+{
+	/// @brief		Color of the outline around glyphs.
+	Colorf											outline_color					= Colorf( 0.0f, 0.0f, 0.0f, 1.0f );
+
+	/// @brief		Width of the outline around glyphs, 0.0 disables the outline.
+	float											outline_width					= 0.0f;
+
+	/// @brief		Color of the shadow under glyphs, alpha 0.0 disables the shadow.
+	Colorf											shadow_color					= Colorf( 0.0f, 0.0f, 0.0f, 0.0f );
+
+	/// @brief		Offset of the shadow from the glyph.
+	glm::vec2										shadow_offset					= glm::vec2( 2.0f, 2.0f );
+
+	/// @brief		How far the shadow edge fades out, 0.0 gives a sharp shadow.
+	float											shadow_softness					= 2.0f;
+};
+
+
+
+} // vk2d
@@ -3,6 +3,7 @@
 #include "core/Common.h"
 
 #include <string>
+#include <string_view>
 #include <string.h>
 #include <wchar.h>
 
@@ -10,60 +11,57 @@ namespace vk2d {
 
 
 
-// This is a stub of a class I'm thinking of maybe implementing.
-// Or I may throw it out.
-// Thoughts:
-// - If I implement this then I should also implement Array to replace std::vector (I kinda like the idea).
-// - I'd have to reinvent the wheel that stl already does a really good job at.
-// - Performance will likely be worse than stl libraries unless I dedicate serious efforts to this.
-// - Optional memory pool as parameter? if so, maybe use stl polymorphic memory resources instead of implementing our own pool?
-// - If memory pooled, multithreading will be a concern although this would happen anyways.
-// - There might be more types I'd have to implement in the future (List, Map, Deque, Stack...).
-// - Allows more control, more operators without fear of name conflicts, eg. std::cout << vk2d_array_object;
-// - C++ expects some lower-case names like size() instead of Size(), or begin() instead of Begin(). This conflicts with my naming scheme.
-// - Users would have to learn custom, likely less competent, containers, could be mitigated by allowing stl containers as input.
-// - Would likely result more data copying between the library and the host application.
-// - Stl is standard and most people know it well, should at least stick to the naming convention used by stl.
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Text string stored as UTF-32 code points.
+///
+///				Text can be constructed from UTF-8, UTF-16 or UTF-32 strings and is used wherever vk2d needs to look up
+///				glyphs per character, eg. GenerateTextMesh(). Constructing from <tt>char</tt> or <tt>char8_t</tt> strings
+///				decodes them as UTF-8, <tt>char16_t</tt> strings are decoded as UTF-16 and <tt>wchar_t</tt> strings are
+///				decoded as UTF-16 or UTF-32 depending on the platform width of <tt>wchar_t</tt>. Invalid sequences are replaced
+///				with U+FFFD replacement character.
+///				<br>
+///				Text keeps a null terminator after the last character so data() can be passed to functions expecting null
+///				terminated UTF-32 strings. Member names follow the standard library convention so Text works with range based
+///				for loops and standard algorithms.
 class Text
 {
 public:
-	VK2D_API																		Text()						=	default;
+	VK2D_API										Text()								= default;
 
 	template<typename T>
-																					Text(
+													Text(
 		const std::basic_string<T>				&	str
-	)
-	{
-		auto str_size = std::size( str );
-		if( str_size > 0 ) {
-			resize( str_size );
-			for( size_t i = 0; i < str_size; i++ )
-			{
-				str_data[ i ] = str[ i ];
-			}
-			str_data[ str_size ] = '\0';
-		}
-	}
+	) :
+		Text( std::basic_string_view<T>( str ) )
+	{}
 
-	template<typename T>
-																					Text(
-		std::basic_string_view<T>					str
-	)
-	{
-		auto str_size = std::size( str );
-		if( str_size > 0 ) {
-			resize( str_size );
-			for( size_t i = 0; i < str_size; i++ )
-			{
-				str_data[ i ] = str[ i ];
-			}
-			str_data[ str_size ] = '\0';
-		}
-	}
+	VK2D_API										Text(
+		std::string_view							str );
+
+	VK2D_API										Text(
+		std::u8string_view							str );
+
+	VK2D_API										Text(
+		std::u16string_view							str );
+
+	VK2D_API										Text(
+		std::u32string_view							str );
+
+	VK2D_API										Text(
+		std::wstring_view							str );
 
 	VK2D_API										Text(
 		const char								*	str );
 
+	VK2D_API										Text(
+		const char8_t							*	str );
+
+	VK2D_API										Text(
+		const char16_t							*	str );
+
+	VK2D_API										Text(
+		const char32_t							*	str );
+
 	VK2D_API										Text(
 		const wchar_t							*	str );
 
@@ -81,19 +79,80 @@ public:
 	VK2D_API Text								&	operator=(
 		Text									&&	other );
 
-	VK2D_API void									FromUTF8(
-		std::string									str );
+	VK2D_API bool									operator==(
+		const Text								&	other ) const;
+
+	VK2D_API char32_t							&	operator[](
+		size_t										index );
 
-	VK2D_API std::string							ToUTF8();
+	VK2D_API const char32_t						&	operator[](
+		size_t										index ) const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Replace contents with decoded UTF-8 string.
+	///
+	/// @param[in]	str
+	///				UTF-8 encoded string.
+	VK2D_API void									FromUTF8(
+		std::string_view							str );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Replace contents with decoded UTF-16 string.
+	///
+	/// @param[in]	str
+	///				UTF-16 encoded string.
+	VK2D_API void									FromUTF16(
+		std::u16string_view							str );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Replace contents with UTF-32 string.
+	///
+	/// @param[in]	str
+	///				UTF-32 string.
+	VK2D_API void									FromUTF32(
+		std::u32string_view							str );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @return		Contents encoded as UTF-8.
+	VK2D_API std::string							ToUTF8() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @return		Contents as UTF-32 string.
+	VK2D_API std::u32string							ToUTF32() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Append a single code point to the end of the text.
+	///
+	/// @param[in]	character
+	///				Unicode code point.
+	VK2D_API void									PushBack(
+		char32_t									character );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get a hash of the contents.
+	///
+	///				Hash is calculated from the code points so the same text gives the same hash regardless of the encoding it
+	///				was constructed from.
+	///
+	/// @return		Hash value.
+	VK2D_API size_t									Hash() const;
 
 	VK2D_API void									Reserve(
 		size_t										new_capacity );
 	VK2D_API void									Resize(
 		size_t										new_size );
-	VK2D_API size_t									size();
-	VK2D_API int32_t							*	data();
-	VK2D_API int32_t							*	begin();
-	VK2D_API int32_t							*	end();
+	VK2D_API void									Clear();
+
+	VK2D_API size_t									size() const;
+	VK2D_API bool									empty() const;
+	VK2D_API char32_t							*	data();
+	VK2D_API const char32_t						*	data() const;
+	VK2D_API char32_t							*	begin();
+	VK2D_API const char32_t						*	begin() const;
+	VK2D_API char32_t							*	end();
+	VK2D_API const char32_t						*	end() const;
+	VK2D_API char32_t							&	back();
+	VK2D_API const char32_t						&	back() const;
 
 private:
 	VK2D_API void									CopyOther(
@@ -101,7 +160,7 @@ private:
 	VK2D_API void									MoveOther(
 		Text									&&	other );
 	VK2D_API void									Deallocate();
-	int32_t										*	str_data						= {};
+	char32_t									*	str_data						= {};
 	size_t											str_size						= {};
 	size_t											str_capacity					= {};
 };
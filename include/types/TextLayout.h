@@ -0,0 +1,83 @@
+#pragma once
+
+#include "core/Common.h"
+
+#include "types/Rect2.hpp"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Horisontal alignment of text lines.
+enum class TextAlignment : uint32_t
+{
+	/// @brief		Lines start at the layout origin.
+	LEFT,
+
+	/// @brief		Lines are centered within the layout width.
+	CENTER,
+
+	/// @brief		Lines end at the right edge of the layout width.
+	RIGHT,
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Parameters for laying out multi-line horisontal text.
+///
+///				Used with GenerateTextLayoutMesh(). Lines are broken at newline characters and, if max_width is set, at the
+///				last space that still fits. Words longer than max_width are broken between characters.
+struct TextLayoutSettings
+{
+	/// @brief		Maximum width of a line after scaling, lines are wrapped to fit. 0.0 disables wrapping.
+	///
+	///				Alignment is done within this width. If wrapping is disabled alignment is done within the widest line.
+	float											max_width						= 0.0f;
+
+	/// @brief		Horisontal alignment of the lines.
+	TextAlignment									alignment						= TextAlignment::LEFT;
+
+	/// @brief		Multiplier for the distance between baselines of consecutive lines, 1.0 uses the line height of the font.
+	float											line_spacing					= 1.0f;
+
+	/// @brief		Additional spacing between letters. Positive values are farther apart. Value is based on size of the font
+	///				texel size.
+	float											kerning							= 0.0f;
+
+	/// @brief		Use kerning information from the font to adjust spacing between specific pairs of letters.
+	bool											use_font_kerning				= true;
+
+	/// @brief		Scale of the generated text, {1.0, 1.0} maps 1:1 to the font texel size.
+	glm::vec2										scale							= glm::vec2( 1.0f, 1.0f );
+
+	/// @brief		Certain fonts may contain multiple font faces, this allows you to select which one to use.
+	uint32_t										font_face						= 0;
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Metrics of a single line of laid out text.
+struct TextLineMetrics
+{
+	/// @brief		Index of the first character of this line in the source text.
+	uint32_t										first_character					= {};
+
+	/// @brief		Amount of characters on this line including trailing spaces, newline character is not included.
+	uint32_t										character_count					= {};
+
+	/// @brief		Position where this line starts on its baseline, alignment and origin included.
+	glm::vec2										baseline_origin					= {};
+
+	/// @brief		Width of the line after scaling without trailing spaces.
+	float											width							= {};
+
+	/// @brief		Area reserved for this line, from font ascender to font descender.
+	Rect2f											area							= {};
+};
+
+
+
+} // vk2d
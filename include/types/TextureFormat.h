@@ -0,0 +1,32 @@
+#pragma once
+
+#include "core/Common.h"
+
+namespace vk2d {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Tells how texels of a texture resource are stored on the GPU.
+///
+///				Formats with less than 4 channels are expanded to RGBA when sampled so textures of any format can be used with
+///				the same shaders.
+enum class TextureFormat : uint32_t
+{
+	/// @brief		4 bytes per texel, red, green, blue and alpha.
+	R8G8B8A8_UNORM,
+
+	/// @brief		2 bytes per texel, luminance and alpha.
+	///
+	///				Sampled as RGBA( R, R, R, G ). Good for grayscale images with transparency.
+	R8G8_UNORM,
+
+	/// @brief		1 byte per texel, alpha only.
+	///
+	///				Sampled as RGBA( 1, 1, 1, R ). Good for masks and font glyph coverage which get their color from vertex color.
+	R8_UNORM,
+};
+
+
+
+} // vk2d
@@ -0,0 +1,114 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Text glyphs drawn as instances. Each glyph is a single compact record and
+// the quad is built here from gl_VertexIndex, 6 vertices per instance without
+// an index buffer. Glyph rectangles come from a per font face glyph table so
+// the record only needs to tell which glyph to draw and where.
+
+
+
+// Glyph instance.
+struct GlyphInstance {
+	vec2		position;						// Unscaled pen position on the baseline relative to text origin.
+	uint		glyph;							// Glyph table index in the lower 16 bits, atlas layer in the upper 16 bits.
+	uint		color;							// RGBA, 8 bits per channel, red in the lowest bits.
+};
+
+// Glyph table entry is 12 floats.
+// [ 0 - 3 ] = UV rectangle, top left and bottom right.
+// [ 4 - 7 ] = Horisontal glyph rectangle relative to pen position, top left and bottom right.
+// [ 8 - 11 ] = Vertical glyph rectangle relative to pen position, top left and bottom right.
+const uint GLYPH_TABLE_FLOATS_PER_GLYPH = 12;
+
+// Quad corners for the 6 vertices of the two triangles, bit 0 is right and bit 1 is bottom.
+const uint QUAD_CORNERS[ 6 ] = uint[]( 0, 1, 2, 2, 1, 3 );
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Set 0: Window frame data.
+layout(std140, set=0, binding=0) uniform			WindowFrameData {
+	vec2		multiplier;
+	vec2		offset;
+} window_frame_data;
+
+// Set 3: Vertex buffer, contains glyph instances instead of vertices.
+layout(std430, set=3, binding=0) readonly buffer	GlyphInstanceBuffer {
+	GlyphInstance	ssbo[];
+} glyph_instance_buffer;
+
+// Set 6: Texture channel weights buffer, contains the glyph table.
+layout(std430, set=6, binding=0) readonly buffer	GlyphTable {
+	float		ssbo[];
+} glyph_table;
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the glyph table in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+
+	layout(offset=96)
+	vec2		origin;							// Text origin.
+	vec2		scale;							// Text scale.
+	uint		vertical;						// 1 if vertical glyph rectangles are used.
+} push_constants;
+
+// Output to fragment shader
+layout(location=0) out		vec2	fragment_output_UV;
+layout(location=1) out		vec4	fragment_output_color;
+layout(location=2) out flat	uint	fragment_output_texture_channel;
+
+
+
+////////////////////////////////////////////////////////////////
+// Utilities.
+////////////////////////////////////////////////////////////////
+
+vec4 ReadGlyphTable( uint glyph_table_index, uint float_offset )
+{
+	uint i = push_constants.texture_channel_weight_offset + glyph_table_index * GLYPH_TABLE_FLOATS_PER_GLYPH + float_offset;
+	return vec4(
+		glyph_table.ssbo[ i + 0 ],
+		glyph_table.ssbo[ i + 1 ],
+		glyph_table.ssbo[ i + 2 ],
+		glyph_table.ssbo[ i + 3 ]
+	);
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void GlyphInstanceVertex()
+{
+	GlyphInstance glyph_instance	= glyph_instance_buffer.ssbo[ gl_InstanceIndex ];
+	uint glyph_table_index			= glyph_instance.glyph & 0xFFFF;
+
+	uint corner_bits				= QUAD_CORNERS[ gl_VertexIndex ];
+	vec2 corner						= vec2( float( corner_bits & 1 ), float( corner_bits >> 1 ) );
+
+	vec4 uv_rect					= ReadGlyphTable( glyph_table_index, 0 );
+	vec4 glyph_rect					= ReadGlyphTable( glyph_table_index, push_constants.vertical != 0 ? 8 : 4 );
+
+	fragment_output_UV				= mix( uv_rect.xy, uv_rect.zw, corner );
+	fragment_output_color			= unpackUnorm4x8( glyph_instance.color );
+	fragment_output_texture_channel	= glyph_instance.glyph >> 16;
+
+	vec2 glyph_coords				= glyph_instance.position + mix( glyph_rect.xy, glyph_rect.zw, corner );
+	vec2 text_coords				= glyph_coords * push_constants.scale + push_constants.origin;
+	vec2 viewport_vertex_coords		= text_coords * window_frame_data.multiplier + window_frame_data.offset;
+
+	gl_Position						= vec4( viewport_vertex_coords, 0.5, 1.0 );
+}
@@ -0,0 +1,100 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Particles drawn as instances straight from the particle buffer the compute
+// shaders write to, one textured quad per particle slot. Dead particles are
+// moved outside of the clip volume so they produce no fragments. Particle
+// color and size are interpolated over the lifetime of the particle here so
+// the compute shaders never have to touch them.
+
+
+
+// Particle, must match vk2d::vk2d_internal::ParticleData.
+struct Particle {
+	vec2		position;
+	vec2		velocity;
+	float		age;							// Seconds since the particle was emitted.
+	float		lifetime;						// Particle is dead when age reaches lifetime.
+	float		size_begin;
+	float		size_end;
+	uint		color_begin;					// RGBA, 8 bits per channel, red in the lowest bits.
+	uint		color_end;						// RGBA, 8 bits per channel, red in the lowest bits.
+	float		rotation;
+	float		angular_velocity;
+};
+
+// Quad corners for the 6 vertices of the two triangles, bit 0 is right and bit 1 is bottom.
+const uint QUAD_CORNERS[ 6 ] = uint[]( 0, 1, 2, 2, 1, 3 );
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Set 0: Window frame data.
+layout(std140, set=0, binding=0) uniform			WindowFrameData {
+	vec2		multiplier;
+	vec2		offset;
+} window_frame_data;
+
+// Set 3: Vertex buffer, particle buffer is bound here instead.
+layout(std430, set=3, binding=0) readonly buffer	ParticleBuffer {
+	Particle	particles[];
+} particle_buffer;
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the texture channels in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+} push_constants;
+
+// Output to fragment shader
+layout(location=0) out		vec2	fragment_output_UV;
+layout(location=1) out		vec4	fragment_output_color;
+layout(location=2) out flat	uint	fragment_output_texture_channel;
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void ParticleVertex()
+{
+	Particle particle					= particle_buffer.particles[ gl_InstanceIndex ];
+
+	uint corner_bits					= QUAD_CORNERS[ gl_VertexIndex ];
+	vec2 corner							= vec2( float( corner_bits & 1 ), float( corner_bits >> 1 ) );
+
+	fragment_output_UV					= corner;
+	fragment_output_texture_channel		= 0;
+
+	if( particle.age >= particle.lifetime ) {
+		fragment_output_color			= vec4( 0.0 );
+		gl_Position						= vec4( 2.0, 2.0, 2.0, 1.0 );
+		return;
+	}
+
+	float life							= particle.age / particle.lifetime;
+	float size							= mix( particle.size_begin, particle.size_end, life );
+
+	vec2 rotation						= vec2( cos( particle.rotation ), sin( particle.rotation ) );
+	vec2 local_coords					= ( corner - 0.5 ) * size;
+	vec2 rotated_coords					= vec2(
+		local_coords.x * rotation.x - local_coords.y * rotation.y,
+		local_coords.x * rotation.y + local_coords.y * rotation.x
+	);
+
+	fragment_output_color				= mix( unpackUnorm4x8( particle.color_begin ), unpackUnorm4x8( particle.color_end ), life );
+
+	vec2 viewport_vertex_coords			= ( particle.position + rotated_coords ) * window_frame_data.multiplier + window_frame_data.offset;
+
+	gl_Position							= vec4( viewport_vertex_coords, 0.5, 1.0 );
+}
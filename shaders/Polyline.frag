@@ -0,0 +1,107 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Distances are negative inside the line and positive outside, coverage is
+// taken from the distance measured in pixels. Joins are hard clipped at the
+// bisector, the neighbouring segment covers the other side.
+
+// Segment end types, caps first, then joins.
+const uint END_CAP_BUTT					= 0;
+const uint END_CAP_SQUARE				= 1;
+const uint END_CAP_ROUND				= 2;
+const uint END_JOIN_MITER				= 3;
+const uint END_JOIN_BEVEL				= 4;
+const uint END_JOIN_ROUND				= 5;
+
+const float OUTSIDE_DISTANCE			= 1.0e20;
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// From vertex shader.
+layout(location=0) in		vec2	fragment_input_segment_coords;		// Along and across the segment from the first point.
+layout(location=1) in flat	vec4	fragment_input_first_color;
+layout(location=2) in flat	vec4	fragment_input_second_color;
+layout(location=3) in flat	vec3	fragment_input_segment_size;		// Half widths at both points and segment length.
+layout(location=4) in flat	vec4	fragment_input_clip_normals;		// Join bisectors at both ends.
+layout(location=5) in flat	uvec2	fragment_input_end_types;
+
+// Color output.
+layout(location=0) out vec4 final_fragment_color;
+
+
+
+////////////////////////////////////////////////////////////////
+// Utilities.
+////////////////////////////////////////////////////////////////
+
+// Limits the distance by how the segment ends. end_coords are relative to
+// the end point with x pointing away from the segment.
+float ApplySegmentEnd(
+	float		distance,
+	vec2		end_coords,
+	float		half_width,
+	vec2		clip_normal,
+	uint		end_type
+)
+{
+	if( end_type >= END_JOIN_MITER && dot( end_coords, clip_normal ) > 0.0 ) return OUTSIDE_DISTANCE;
+
+	if( end_type == END_CAP_BUTT ) return max( distance, end_coords.x );
+	if( end_type == END_CAP_SQUARE ) return max( distance, end_coords.x - half_width );
+	if( end_type == END_JOIN_BEVEL ) {
+		// Bevel edge is perpendicular to the bisector on the outer side of the turn.
+		vec2 outer_direction	= vec2( abs( clip_normal.y ), clip_normal.y > 0.0 ? -clip_normal.x : clip_normal.x );
+		return max( distance, dot( end_coords, outer_direction ) - half_width * clip_normal.x );
+	}
+	if( ( end_type == END_CAP_ROUND || end_type == END_JOIN_ROUND ) && end_coords.x > 0.0 ) {
+		return length( end_coords ) - half_width;
+	}
+	return distance;
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void PolylineFragment()
+{
+	vec2	coords				= fragment_input_segment_coords;
+	float	first_half_width	= fragment_input_segment_size.x;
+	float	second_half_width	= fragment_input_segment_size.y;
+	float	segment_length		= fragment_input_segment_size.z;
+
+	// Size of a pixel in render coordinates, taken before anything is discarded.
+	float	pixel_distance		= max( ( length( dFdx( coords ) ) + length( dFdy( coords ) ) ) * 0.5, 0.0001 );
+
+	float	t					= clamp( coords.x / segment_length, 0.0, 1.0 );
+	float	distance			= abs( coords.y ) - mix( first_half_width, second_half_width, t );
+
+	distance					= ApplySegmentEnd(
+		distance,
+		-coords,
+		first_half_width,
+		fragment_input_clip_normals.xy,
+		fragment_input_end_types.x
+	);
+	distance					= ApplySegmentEnd(
+		distance,
+		vec2( coords.x - segment_length, coords.y ),
+		second_half_width,
+		fragment_input_clip_normals.zw,
+		fragment_input_end_types.y
+	);
+
+	float	coverage			= clamp( 0.5 - distance / pixel_distance, 0.0, 1.0 );
+	if( coverage <= 0.0 ) discard;
+
+	vec4	color				= mix( fragment_input_first_color, fragment_input_second_color, t );
+	final_fragment_color		= vec4( color.rgb, color.a * coverage );
+}
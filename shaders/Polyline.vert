@@ -0,0 +1,217 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Thick polylines drawn as instances, one instance per segment. The segment
+// is expanded into a quad here from gl_VertexIndex, no line rasterization or
+// wide lines are used so any width can be drawn in the same draw. Neighbour
+// points are read to connect segments, each segment owns its half of a join
+// up to the bisector between the segments so joins are never drawn twice.
+
+
+
+// Polyline point.
+struct PolylinePoint {
+	vec2		position;						// Location of the point.
+	float		width;							// Line width at this point.
+	uint		color;							// RGBA, 8 bits per channel, red in the lowest bits.
+	uint		flags;							// POLYLINE_POINT_FLAG_* bits.
+};
+
+const uint POLYLINE_POINT_FLAG_FIRST			= 1;
+const uint POLYLINE_POINT_FLAG_LAST				= 2;
+const uint POLYLINE_POINT_FLAG_NEIGHBOUR_ONLY	= 4;
+
+// Matches vk2d::PolylineJoin and vk2d::PolylineCap.
+const uint JOIN_MITER							= 0;
+const uint CAP_BUTT								= 0;
+
+// Segment end types passed to the fragment shader, caps first, then joins.
+const uint END_JOIN_MITER						= 3;
+const uint END_JOIN_BEVEL						= 4;
+
+// Quad corners for the 6 vertices of the two triangles, bit 0 is right and bit 1 is bottom.
+const uint QUAD_CORNERS[ 6 ] = uint[]( 0, 1, 2, 2, 1, 3 );
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Set 0: Window frame data.
+layout(std140, set=0, binding=0) uniform			WindowFrameData {
+	vec2		multiplier;
+	vec2		offset;
+} window_frame_data;
+
+// Set 3: Vertex buffer, contains polyline points instead of vertices.
+layout(std430, set=3, binding=0) readonly buffer	PolylinePointBuffer {
+	PolylinePoint	ssbo[];
+} polyline_point_buffer;
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the texture channels in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+
+	layout(offset=96)
+	vec2		render_target_size;				// Size of the render target in pixels.
+	uint		join;							// Matches vk2d::PolylineJoin.
+	uint		cap;							// Matches vk2d::PolylineCap.
+	float		miter_limit;					// Longest allowed miter relative to half of the line width.
+} push_constants;
+
+// Output to fragment shader
+layout(location=0) out		vec2	fragment_output_segment_coords;		// Along and across the segment from the first point.
+layout(location=1) out flat	vec4	fragment_output_first_color;
+layout(location=2) out flat	vec4	fragment_output_second_color;
+layout(location=3) out flat	vec3	fragment_output_segment_size;		// Half widths at both points and segment length.
+layout(location=4) out flat	vec4	fragment_output_clip_normals;		// Join bisectors at both ends.
+layout(location=5) out flat	uvec2	fragment_output_end_types;
+
+
+
+////////////////////////////////////////////////////////////////
+// Utilities.
+////////////////////////////////////////////////////////////////
+
+// Calculates how a segment ends. Everything is in a frame where x points
+// away from the segment through the end point.
+void CalculateSegmentEnd(
+	vec2		end_position,
+	vec2		forward,
+	vec2		side,
+	bool		has_neighbour,
+	vec2		neighbour_position,
+	float		half_width,
+	out uint	end_type,
+	out vec2	clip_normal,
+	out float	extension
+)
+{
+	end_type					= push_constants.cap;
+	clip_normal					= vec2( 1.0, 0.0 );
+	extension					= push_constants.cap == CAP_BUTT ? 0.0 : half_width;
+	if( !has_neighbour ) return;
+
+	vec2 to_neighbour			= neighbour_position - end_position;
+	float neighbour_length		= length( to_neighbour );
+	if( neighbour_length <= 0.0 ) return;
+
+	vec2 neighbour_direction	= vec2( dot( to_neighbour, forward ), dot( to_neighbour, side ) ) / neighbour_length;
+	vec2 bisector				= vec2( 1.0, 0.0 ) + neighbour_direction;
+	float bisector_length		= length( bisector );
+
+	// Polyline turns straight back, keep the cap.
+	if( bisector_length < 0.001 ) return;
+
+	clip_normal					= bisector / bisector_length;
+	end_type					= END_JOIN_MITER + push_constants.join;
+
+	// Miter length relative to half width is 1 / cos( angle / 2 ) which is 1 / clip_normal.x.
+	if( end_type == END_JOIN_MITER && clip_normal.x * push_constants.miter_limit < 1.0 ) {
+		end_type				= END_JOIN_BEVEL;
+	}
+	extension					= half_width * ( end_type == END_JOIN_MITER ? max( 1.0, abs( clip_normal.y ) / clip_normal.x ) : 1.0 );
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void PolylineVertex()
+{
+	uint point_index				= gl_InstanceIndex;
+	PolylinePoint first				= polyline_point_buffer.ssbo[ point_index ];
+	PolylinePoint second			= polyline_point_buffer.ssbo[ point_index + 1 ];
+
+	vec2 segment					= second.position - first.position;
+	float segment_length			= length( segment );
+
+	// Instances between polylines or next to neighbour only points have no segment to draw.
+	if( ( first.flags & POLYLINE_POINT_FLAG_LAST ) != 0 ||
+		( ( first.flags | second.flags ) & POLYLINE_POINT_FLAG_NEIGHBOUR_ONLY ) != 0 ||
+		segment_length <= 0.0 ) {
+		gl_Position					= vec4( 0.0, 0.0, 0.0, 1.0 );
+		return;
+	}
+
+	vec2 direction					= segment / segment_length;
+	vec2 normal						= vec2( -direction.y, direction.x );
+
+	// Size of one pixel in render coordinates.
+	vec2 pixel_size_2d				= 2.0 / ( push_constants.render_target_size * abs( window_frame_data.multiplier ) );
+	float pixel_size				= max( pixel_size_2d.x, pixel_size_2d.y );
+
+	// Lines thinner than a pixel are drawn one pixel wide and faded out instead.
+	float first_half_width			= max( first.width, 0.0 ) * 0.5;
+	float second_half_width			= max( second.width, 0.0 ) * 0.5;
+	float first_drawn_half_width	= max( first_half_width, pixel_size * 0.5 );
+	float second_drawn_half_width	= max( second_half_width, pixel_size * 0.5 );
+	vec4 first_color				= unpackUnorm4x8( first.color );
+	vec4 second_color				= unpackUnorm4x8( second.color );
+	first_color.a					*= first_half_width / first_drawn_half_width;
+	second_color.a					*= second_half_width / second_drawn_half_width;
+
+	bool has_previous				= ( first.flags & POLYLINE_POINT_FLAG_FIRST ) == 0;
+	bool has_next					= ( second.flags & POLYLINE_POINT_FLAG_LAST ) == 0;
+
+	uint first_end_type;
+	vec2 first_clip_normal;
+	float first_extension;
+	CalculateSegmentEnd(
+		first.position,
+		-direction,
+		-normal,
+		has_previous,
+		has_previous ? polyline_point_buffer.ssbo[ point_index - 1 ].position : vec2( 0.0 ),
+		first_drawn_half_width,
+		first_end_type,
+		first_clip_normal,
+		first_extension
+	);
+
+	uint second_end_type;
+	vec2 second_clip_normal;
+	float second_extension;
+	CalculateSegmentEnd(
+		second.position,
+		direction,
+		normal,
+		has_next,
+		has_next ? polyline_point_buffer.ssbo[ point_index + 2 ].position : vec2( 0.0 ),
+		second_drawn_half_width,
+		second_end_type,
+		second_clip_normal,
+		second_extension
+	);
+
+	// Quad covers the segment, both ends and one extra pixel for antialiasing.
+	uint corner_bits				= QUAD_CORNERS[ gl_VertexIndex ];
+	vec2 corner						= vec2( float( corner_bits & 1 ), float( corner_bits >> 1 ) );
+	float quad_half_width			= max( first_drawn_half_width, second_drawn_half_width ) + pixel_size;
+	vec2 segment_coords				= vec2(
+		mix( -first_extension - pixel_size, segment_length + second_extension + pixel_size, corner.x ),
+		mix( -quad_half_width, quad_half_width, corner.y )
+	);
+
+	fragment_output_segment_coords	= segment_coords;
+	fragment_output_first_color		= first_color;
+	fragment_output_second_color	= second_color;
+	fragment_output_segment_size	= vec3( first_drawn_half_width, second_drawn_half_width, segment_length );
+	fragment_output_clip_normals	= vec4( first_clip_normal, second_clip_normal );
+	fragment_output_end_types		= uvec2( first_end_type, second_end_type );
+
+	vec2 coords						= first.position + direction * segment_coords.x + normal * segment_coords.y;
+	vec2 viewport_vertex_coords		= coords * window_frame_data.multiplier + window_frame_data.offset;
+
+	gl_Position						= vec4( viewport_vertex_coords, 0.5, 1.0 );
+}
@@ -0,0 +1,92 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Signed distance functions return negative values inside the shape and
+// positive values outside, in render coordinates. Coverage is taken from the
+// distance measured in pixels using screen space derivatives, which keeps the
+// edge one pixel wide at any scale.
+
+const uint SHAPE_CIRCLE					= 0;
+const uint SHAPE_ROUNDED_RECTANGLE		= 1;
+const uint SHAPE_RING					= 2;
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the texture channels in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+
+	layout(offset=96)
+	vec2		render_target_size;				// Size of the render target in pixels.
+	uint		shape;							// 0 = circle, 1 = rounded rectangle, 2 = ring.
+} push_constants;
+
+// From vertex shader.
+layout(location=0) in		vec2	fragment_input_shape_coords;
+layout(location=1) in		vec4	fragment_input_color;
+layout(location=2) in flat	vec3	fragment_input_shape_parameters;	// Half size and shape parameter.
+
+// Color output.
+layout(location=0) out vec4 final_fragment_color;
+
+
+
+////////////////////////////////////////////////////////////////
+// Utilities.
+////////////////////////////////////////////////////////////////
+
+float CircleDistance( vec2 coords, float radius )
+{
+	return length( coords ) - radius;
+}
+
+float RoundedRectangleDistance( vec2 coords, vec2 half_size, float corner_radius )
+{
+	vec2 q = abs( coords ) - half_size + corner_radius;
+	return length( max( q, 0.0 ) ) + min( max( q.x, q.y ), 0.0 ) - corner_radius;
+}
+
+float RingDistance( vec2 coords, float outer_radius, float inner_radius )
+{
+	return abs( length( coords ) - ( outer_radius + inner_radius ) * 0.5 ) - ( outer_radius - inner_radius ) * 0.5;
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void ShapeInstanceFragment()
+{
+	vec2	coords				= fragment_input_shape_coords;
+	vec2	half_size			= fragment_input_shape_parameters.xy;
+	float	parameter			= fragment_input_shape_parameters.z;
+
+	float	distance;
+	if( push_constants.shape == SHAPE_ROUNDED_RECTANGLE ) {
+		distance				= RoundedRectangleDistance( coords, half_size, parameter );
+	} else if( push_constants.shape == SHAPE_RING ) {
+		distance				= RingDistance( coords, half_size.x, parameter );
+	} else {
+		distance				= CircleDistance( coords, half_size.x );
+	}
+
+	// Length of the distance gradient is the size of a pixel in render coordinates.
+	float	pixel_distance		= max( length( vec2( dFdx( distance ), dFdy( distance ) ) ), 0.0001 );
+	float	coverage			= clamp( 0.5 - distance / pixel_distance, 0.0, 1.0 );
+	if( coverage <= 0.0 ) discard;
+
+	final_fragment_color		= vec4( fragment_input_color.rgb, fragment_input_color.a * coverage );
+}
@@ -0,0 +1,86 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Analytic shapes drawn as instances. Each shape is a single quad built here
+// from gl_VertexIndex, the fragment shader evaluates a signed distance
+// function for the shape so edges are antialiased without tessellation or
+// multisampling. The quad is grown by one pixel on every side to leave room
+// for the antialiased edge.
+
+
+
+// Shape instance.
+struct ShapeInstance {
+	vec2		center;							// Center of the shape.
+	vec2		half_size;						// Half of the width and height of the shape.
+	float		parameter;						// Corner radius for rounded rectangles, inner radius for rings.
+	uint		color;							// RGBA, 8 bits per channel, red in the lowest bits.
+};
+
+// Quad corners for the 6 vertices of the two triangles, bit 0 is right and bit 1 is bottom.
+const uint QUAD_CORNERS[ 6 ] = uint[]( 0, 1, 2, 2, 1, 3 );
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Set 0: Window frame data.
+layout(std140, set=0, binding=0) uniform			WindowFrameData {
+	vec2		multiplier;
+	vec2		offset;
+} window_frame_data;
+
+// Set 3: Vertex buffer, contains shape instances instead of vertices.
+layout(std430, set=3, binding=0) readonly buffer	ShapeInstanceBuffer {
+	ShapeInstance	ssbo[];
+} shape_instance_buffer;
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the texture channels in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+
+	layout(offset=96)
+	vec2		render_target_size;				// Size of the render target in pixels.
+	uint		shape;							// 0 = circle, 1 = rounded rectangle, 2 = ring.
+} push_constants;
+
+// Output to fragment shader
+layout(location=0) out		vec2	fragment_output_shape_coords;
+layout(location=1) out		vec4	fragment_output_color;
+layout(location=2) out flat	vec3	fragment_output_shape_parameters;
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+void ShapeInstanceVertex()
+{
+	ShapeInstance shape_instance		= shape_instance_buffer.ssbo[ gl_InstanceIndex ];
+
+	uint corner_bits					= QUAD_CORNERS[ gl_VertexIndex ];
+	vec2 corner							= vec2( float( corner_bits & 1 ), float( corner_bits >> 1 ) );
+
+	// Size of one pixel in render coordinates.
+	vec2 pixel_size						= 2.0 / ( push_constants.render_target_size * abs( window_frame_data.multiplier ) );
+	vec2 quad_half_size					= shape_instance.half_size + pixel_size;
+	vec2 shape_coords					= mix( -quad_half_size, quad_half_size, corner );
+
+	fragment_output_shape_coords		= shape_coords;
+	fragment_output_color				= unpackUnorm4x8( shape_instance.color );
+	fragment_output_shape_parameters	= vec3( shape_instance.half_size, shape_instance.parameter );
+
+	vec2 viewport_vertex_coords			= ( shape_instance.center + shape_coords ) * window_frame_data.multiplier + window_frame_data.offset;
+
+	gl_Position							= vec4( viewport_vertex_coords, 0.5, 1.0 );
+}
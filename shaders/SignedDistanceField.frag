@@ -0,0 +1,116 @@
+#version 450
+#extension GL_KHR_vulkan_glsl : enable
+
+
+
+// Signed distance field text. The glyph atlas stores the distance to the
+// nearest glyph edge instead of coverage, 0.5 is exactly on the edge and
+// larger values are inside the glyph. 0.0 and 1.0 are "spread" atlas
+// texels away from the edge.
+//
+// Edges are antialiased over a single screen pixel regardless of scale by
+// measuring how fast the distance changes between neighbouring fragments.
+
+
+
+////////////////////////////////////////////////////////////////
+// Shader program interface.
+////////////////////////////////////////////////////////////////
+
+// Set 4: Sampler
+layout(set=4, binding=0) uniform sampler			image_sampler;
+layout(std140, set=4, binding=1) uniform			image_sampler_data {
+	vec4		border_color;
+	uvec2		border_color_enable;
+} sampler_data;
+
+// Set 5: Texture
+layout(set=5, binding=0) uniform texture2DArray		sampled_image;
+
+// Push constants.
+layout(std140, push_constant) uniform PushConstants {
+	uint		transformation_offset;			// Offset into the transformation buffer.
+	uint		index_offset;					// Offset into the index buffer.
+	uint		index_count;					// Amount of indices this shader should handle.
+	uint		vertex_offset;					// Offset to first vertex in vertex buffer.
+	uint		texture_channel_weight_offset;	// Location of the texture channels in the texture channel weights ssbo.
+	uint		texture_channel_weight_count;	// Just the amount of texture channels.
+
+	layout(offset=32)
+	vec4		outline_color;					// Color of the outline.
+	vec4		shadow_color;					// Color of the shadow, alpha 0 disables shadow.
+	vec2		shadow_offset;					// Shadow offset in atlas texels.
+	float		outline_width;					// Outline width in atlas texels.
+	float		shadow_softness;				// Shadow edge fade distance in atlas texels.
+	float		spread;							// Distance field range on both sides of the edge in atlas texels.
+} push_constants;
+
+// From vertex shader.
+layout(location=0) in		vec2	fragment_input_UV;
+layout(location=1) in		vec4	fragment_input_color;
+layout(location=2) in flat	uint	fragment_input_texture_channel;
+
+// Color output.
+layout(location=0) out vec4 final_fragment_color;
+
+
+
+////////////////////////////////////////////////////////////////
+// Utilities.
+////////////////////////////////////////////////////////////////
+
+// Signed distance to the glyph edge in atlas texels, positive inside the glyph.
+float SampleDistance( vec2 uv )
+{
+	float value = texture( sampler2DArray( sampled_image, image_sampler ), vec3( uv, float( fragment_input_texture_channel ) ) ).a;
+	return ( value - 0.5 ) * 2.0 * push_constants.spread;
+}
+
+// Half of the distance covered by a single screen pixel.
+float AntialiasWidth( float distance )
+{
+	return max( fwidth( distance ) * 0.5, 0.0001 );
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Entrypoints.
+////////////////////////////////////////////////////////////////
+
+// Glyph with sharp antialiased edges.
+void SignedDistanceFieldFragment()
+{
+	float	distance			= SampleDistance( fragment_input_UV );
+	float	aa					= AntialiasWidth( distance );
+	float	coverage			= smoothstep( -aa, aa, distance );
+
+	final_fragment_color		= vec4( fragment_input_color.rgb, fragment_input_color.a * coverage );
+}
+
+
+
+// Glyph with outline and shadow.
+void SignedDistanceFieldFragmentWithEffects()
+{
+	float	distance			= SampleDistance( fragment_input_UV );
+	float	aa					= AntialiasWidth( distance );
+
+	// Outline grows the glyph outwards, glyph fill is drawn on top of it.
+	float	fill				= smoothstep( -aa, aa, distance );
+	float	outline				= smoothstep( -aa, aa, distance + push_constants.outline_width );
+	vec4	glyph_color			= mix( push_constants.outline_color, fragment_input_color, fill );
+	glyph_color.a				*= outline;
+
+	// Shadow is the outlined glyph shape moved by the shadow offset.
+	vec2	texel_size			= 1.0 / vec2( textureSize( sampler2DArray( sampled_image, image_sampler ), 0 ).xy );
+	float	shadow_distance		= SampleDistance( fragment_input_UV - push_constants.shadow_offset * texel_size ) + push_constants.outline_width;
+	float	shadow_fade			= push_constants.shadow_softness + aa;
+	vec4	shadow_color		= push_constants.shadow_color;
+	shadow_color.a				*= smoothstep( -shadow_fade, shadow_fade, shadow_distance ) * fragment_input_color.a;
+
+	// Glyph over shadow.
+	float	alpha				= glyph_color.a + shadow_color.a * ( 1.0 - glyph_color.a );
+	vec3	color				= glyph_color.rgb * glyph_color.a + shadow_color.rgb * shadow_color.a * ( 1.0 - glyph_color.a );
+	final_fragment_color		= vec4( color / max( alpha, 0.0001 ), alpha );
+}
@@ -3,6 +3,14 @@
 #include "SingleTexturedVertex.vert.spv.h"
 #include "SingleTexturedFragment.frag.spv.h"
 #include "SingleTexturedFragmentWithUVBorderColor.frag.spv.h"
+#include "SignedDistanceFieldFragment.frag.spv.h"
+#include "SignedDistanceFieldFragmentWithEffects.frag.spv.h"
+#include "GlyphInstanceVertex.vert.spv.h"
+#include "ShapeInstanceVertex.vert.spv.h"
+#include "ShapeInstanceFragment.frag.spv.h"
+#include "PolylineVertex.vert.spv.h"
+#include "PolylineFragment.frag.spv.h"
+#include "ParticleVertex.vert.spv.h"
 #include "MultitexturedVertex.vert.spv.h"
 #include "MultitexturedFragmentTriangle.frag.spv.h"
 #include "MultitexturedFragmentTriangleWithUVBorderColor.frag.spv.h"
@@ -15,3 +23,9 @@
 #include "RenderTargetTexture_GaussianBlur_Vertical.frag.spv.h"
 #include "RenderTargetTexture_BoxBlur_Horisontal.frag.spv.h"
 #include "RenderTargetTexture_BoxBlur_Vertical.frag.spv.h"
+#include "MipmapDownsample.comp.spv.h"
+#include "RenderTargetTextureBlurCompute.comp.spv.h"
+#include "RenderTargetTextureDualKawaseDownsample.comp.spv.h"
+#include "RenderTargetTextureDualKawaseUpsample.comp.spv.h"
+#include "ParticleEmit.comp.spv.h"
+#include "ParticleSimulate.comp.spv.h"
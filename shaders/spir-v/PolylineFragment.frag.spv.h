@@ -0,0 +1,143 @@
+#pragma once
+#include <array>
+#include <stdint.h>
+std::array<uint32_t, 1379> PolylineFragment_frag_shader_data {
+	0x07230203, 0x00010000, 0x00000000, 0x000000E2, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 0x00000001, 0x4C534C47, 
+	0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 0x000C000F, 0x00000004, 0x00000002, 0x6E69616D, 
+	0x00000000, 0x00000008, 0x0000000E, 0x00000046, 0x0000004E, 0x00000072, 0x00000074, 0x0000007B, 0x00030010, 0x00000002, 
+	0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00040005, 0x00000002, 0x6E69616D, 0x00000000, 0x000A0005, 0x00000008, 
+	0x67617266, 0x746E656D, 0x706E695F, 0x735F7475, 0x656D6765, 0x635F746E, 0x64726F6F, 0x00000073, 0x00040005, 0x0000000B, 
+	0x726F6F63, 0x00007364, 0x00090005, 0x0000000E, 0x67617266, 0x746E656D, 0x706E695F, 0x735F7475, 0x656D6765, 0x735F746E, 
+	0x00657A69, 0x00070005, 0x00000015, 0x73726966, 0x61685F74, 0x775F666C, 0x68746469, 0x00000000, 0x00070005, 0x0000001A, 
+	0x6F636573, 0x685F646E, 0x5F666C61, 0x74646977, 0x00000068, 0x00060005, 0x0000001E, 0x6D676573, 0x5F746E65, 0x676E656C, 
+	0x00006874, 0x00060005, 0x0000002A, 0x65786970, 0x69645F6C, 0x6E617473, 0x00006563, 0x00030005, 0x00000032, 0x00000074, 
+	0x00050005, 0x0000003B, 0x74736964, 0x65636E61, 0x00000000, 0x00040005, 0x0000003D, 0x61726170, 0x0000006D, 0x00040005, 
+	0x0000003F, 0x61726170, 0x0000006D, 0x00040005, 0x00000042, 0x61726170, 0x0000006D, 0x00040005, 0x00000044, 0x61726170, 
+	0x0000006D, 0x00090005, 0x00000046, 0x67617266, 0x746E656D, 0x706E695F, 0x635F7475, 0x5F70696C, 0x6D726F6E, 0x00736C61, 
+	0x00040005, 0x0000004A, 0x61726170, 0x0000006D, 0x00090005, 0x0000004E, 0x67617266, 0x746E656D, 0x706E695F, 0x655F7475, 
+	0x745F646E, 0x73657079, 0x00000000, 0x00040005, 0x00000054, 0x61726170, 0x0000006D, 0x00040005, 0x00000056, 0x61726170, 
+	0x0000006D, 0x00040005, 0x0000005E, 0x61726170, 0x0000006D, 0x00040005, 0x00000060, 0x61726170, 0x0000006D, 0x00040005, 
+	0x00000063, 0x61726170, 0x0000006D, 0x00050005, 0x0000006C, 0x65766F63, 0x65676172, 0x00000000, 0x00090005, 0x00000072, 
+	0x67617266, 0x746E656D, 0x706E695F, 0x665F7475, 0x74737269, 0x6C6F635F, 0x0000726F, 0x00090005, 0x00000074, 0x67617266, 
+	0x746E656D, 0x706E695F, 0x735F7475, 0x6E6F6365, 0x6F635F64, 0x00726F6C, 0x00040005, 0x00000079, 0x6F6C6F63, 0x00000072, 
+	0x00080005, 0x0000007B, 0x616E6966, 0x72665F6C, 0x656D6761, 0x635F746E, 0x726F6C6F, 0x00000000, 0x00060005, 0x0000003C, 
+	0x6C707041, 0x67655379, 0x746E656D, 0x00646E45, 0x00050005, 0x00000089, 0x74736964, 0x65636E61, 0x00000000, 0x00050005, 
+	0x0000008A, 0x5F646E65, 0x726F6F63, 0x00007364, 0x00050005, 0x0000008B, 0x666C6168, 0x6469775F, 0x00006874, 0x00050005, 
+	0x0000008C, 0x70696C63, 0x726F6E5F, 0x006C616D, 0x00050005, 0x0000008D, 0x5F646E65, 0x65707974, 0x00000000, 0x00060005, 
+	0x000000C5, 0x6574756F, 0x69645F72, 0x74636572, 0x006E6F69, 0x00040047, 0x00000008, 0x0000001E, 0x00000000, 0x00030047, 
+	0x0000000E, 0x0000000E, 0x00040047, 0x0000000E, 0x0000001E, 0x00000003, 0x00030047, 0x00000046, 0x0000000E, 0x00040047, 
+	0x00000046, 0x0000001E, 0x00000004, 0x00030047, 0x0000004E, 0x0000000E, 0x00040047, 0x0000004E, 0x0000001E, 0x00000005, 
+	0x00030047, 0x00000072, 0x0000000E, 0x00040047, 0x00000072, 0x0000001E, 0x00000001, 0x00030047, 0x00000074, 0x0000000E, 
+	0x00040047, 0x00000074, 0x0000001E, 0x00000002, 0x00040047, 0x0000007B, 0x0000001E, 0x00000000, 0x00020013, 0x00000003, 
+	0x00030021, 0x00000004, 0x00000003, 0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006, 0x00000002, 
+	0x00040020, 0x00000009, 0x00000001, 0x00000007, 0x0004003B, 0x00000009, 0x00000008, 0x00000001, 0x00040020, 0x0000000C, 
+	0x00000007, 0x00000007, 0x00040017, 0x0000000D, 0x00000006, 0x00000003, 0x00040020, 0x0000000F, 0x00000001, 0x0000000D, 
+	0x0004003B, 0x0000000F, 0x0000000E, 0x00000001, 0x00040015, 0x00000010, 0x00000020, 0x00000001, 0x0004002B, 0x00000010, 
+	0x00000011, 0x00000000, 0x00040020, 0x00000012, 0x00000001, 0x00000006, 0x00040020, 0x00000016, 0x00000007, 0x00000006, 
+	0x0004002B, 0x00000010, 0x00000017, 0x00000001, 0x0004002B, 0x00000010, 0x0000001B, 0x00000002, 0x0004002B, 0x00000006, 
+	0x00000026, 0x3F000000, 0x0004002B, 0x00000006, 0x00000028, 0x38D1B717, 0x0004002B, 0x00000006, 0x0000002F, 0x00000000, 
+	0x0004002B, 0x00000006, 0x00000030, 0x3F800000, 0x00040017, 0x00000045, 0x00000006, 0x00000004, 0x00040020, 0x00000047, 
+	0x00000001, 0x00000045, 0x0004003B, 0x00000047, 0x00000046, 0x00000001, 0x00040015, 0x0000004B, 0x00000020, 0x00000000, 
+	0x00040020, 0x0000004C, 0x00000007, 0x0000004B, 0x00040017, 0x0000004D, 0x0000004B, 0x00000002, 0x00040020, 0x0000004F, 
+	0x00000001, 0x0000004D, 0x0004003B, 0x0000004F, 0x0000004E, 0x00000001, 0x00040020, 0x00000050, 0x00000001, 0x0000004B, 
+	0x00020014, 0x0000006F, 0x0004003B, 0x00000047, 0x00000072, 0x00000001, 0x0004003B, 0x00000047, 0x00000074, 0x00000001, 
+	0x00040020, 0x0000007A, 0x00000007, 0x00000045, 0x00040020, 0x0000007C, 0x00000003, 0x00000045, 0x0004003B, 0x0000007C, 
+	0x0000007B, 0x00000003, 0x0004002B, 0x00000010, 0x0000007F, 0x00000003, 0x00080021, 0x00000088, 0x00000006, 0x00000016, 
+	0x0000000C, 0x00000016, 0x0000000C, 0x0000004C, 0x0004002B, 0x0000004B, 0x00000090, 0x00000003, 0x0004002B, 0x00000006, 
+	0x00000099, 0x60AD78EC, 0x0004002B, 0x0000004B, 0x0000009B, 0x00000000, 0x0004002B, 0x0000004B, 0x000000A4, 0x00000001, 
+	0x0004002B, 0x0000004B, 0x000000AF, 0x00000004, 0x0004002B, 0x0000004B, 0x000000D1, 0x00000002, 0x0004002B, 0x0000004B, 
+	0x000000D4, 0x00000005, 0x00050036, 0x00000003, 0x00000002, 0x00000000, 0x00000004, 0x000200F8, 0x00000005, 0x0004003B, 
+	0x0000000C, 0x0000000B, 0x00000007, 0x0004003B, 0x00000016, 0x00000015, 0x00000007, 0x0004003B, 0x00000016, 0x0000001A, 
+	0x00000007, 0x0004003B, 0x00000016, 0x0000001E, 0x00000007, 0x0004003B, 0x00000016, 0x0000002A, 0x00000007, 0x0004003B, 
+	0x00000016, 0x00000032, 0x00000007, 0x0004003B, 0x00000016, 0x0000003B, 0x00000007, 0x0004003B, 0x00000016, 0x0000003D, 
+	0x00000007, 0x0004003B, 0x0000000C, 0x0000003F, 0x00000007, 0x0004003B, 0x00000016, 0x00000042, 0x00000007, 0x0004003B, 
+	0x0000000C, 0x00000044, 0x00000007, 0x0004003B, 0x0000004C, 0x0000004A, 0x00000007, 0x0004003B, 0x00000016, 0x00000054, 
+	0x00000007, 0x0004003B, 0x0000000C, 0x00000056, 0x00000007, 0x0004003B, 0x00000016, 0x0000005E, 0x00000007, 0x0004003B, 
+	0x0000000C, 0x00000060, 0x00000007, 0x0004003B, 0x0000004C, 0x00000063, 0x00000007, 0x0004003B, 0x00000016, 0x0000006C, 
+	0x00000007, 0x0004003B, 0x0000007A, 0x00000079, 0x00000007, 0x0004003D, 0x00000007, 0x0000000A, 0x00000008, 0x0003003E, 
+	0x0000000B, 0x0000000A, 0x00050041, 0x00000012, 0x00000013, 0x0000000E, 0x00000011, 0x0004003D, 0x00000006, 0x00000014, 
+	0x00000013, 0x0003003E, 0x00000015, 0x00000014, 0x00050041, 0x00000012, 0x00000018, 0x0000000E, 0x00000017, 0x0004003D, 
+	0x00000006, 0x00000019, 0x00000018, 0x0003003E, 0x0000001A, 0x00000019, 0x00050041, 0x00000012, 0x0000001C, 0x0000000E, 
+	0x0000001B, 0x0004003D, 0x00000006, 0x0000001D, 0x0000001C, 0x0003003E, 0x0000001E, 0x0000001D, 0x0004003D, 0x00000007, 
+	0x0000001F, 0x0000000B, 0x000400CF, 0x00000007, 0x00000020, 0x0000001F, 0x0006000C, 0x00000006, 0x00000021, 0x00000001, 
+	0x00000042, 0x00000020, 0x0004003D, 0x00000007, 0x00000022, 0x0000000B, 0x000400D0, 0x00000007, 0x00000023, 0x00000022, 
+	0x0006000C, 0x00000006, 0x00000024, 0x00000001, 0x00000042, 0x00000023, 0x00050081, 0x00000006, 0x00000025, 0x00000021, 
+	0x00000024, 0x00050085, 0x00000006, 0x00000027, 0x00000025, 0x00000026, 0x0007000C, 0x00000006, 0x00000029, 0x00000001, 
+	0x00000028, 0x00000027, 0x00000028, 0x0003003E, 0x0000002A, 0x00000029, 0x00050041, 0x00000016, 0x0000002B, 0x0000000B, 
+	0x00000011, 0x0004003D, 0x00000006, 0x0000002C, 0x0000002B, 0x0004003D, 0x00000006, 0x0000002D, 0x0000001E, 0x00050088, 
+	0x00000006, 0x0000002E, 0x0000002C, 0x0000002D, 0x0008000C, 0x00000006, 0x00000031, 0x00000001, 0x0000002B, 0x0000002E, 
+	0x0000002F, 0x00000030, 0x0003003E, 0x00000032, 0x00000031, 0x00050041, 0x00000016, 0x00000033, 0x0000000B, 0x00000017, 
+	0x0004003D, 0x00000006, 0x00000034, 0x00000033, 0x0006000C, 0x00000006, 0x00000035, 0x00000001, 0x00000004, 0x00000034, 
+	0x0004003D, 0x00000006, 0x00000036, 0x00000015, 0x0004003D, 0x00000006, 0x00000037, 0x0000001A, 0x0004003D, 0x00000006, 
+	0x00000038, 0x00000032, 0x0008000C, 0x00000006, 0x00000039, 0x00000001, 0x0000002E, 0x00000036, 0x00000037, 0x00000038, 
+	0x00050083, 0x00000006, 0x0000003A, 0x00000035, 0x00000039, 0x0003003E, 0x0000003B, 0x0000003A, 0x0004003D, 0x00000006, 
+	0x0000003E, 0x0000003B, 0x0003003E, 0x0000003D, 0x0000003E, 0x0004003D, 0x00000007, 0x00000040, 0x0000000B, 0x0004007F, 
+	0x00000007, 0x00000041, 0x00000040, 0x0003003E, 0x0000003F, 0x00000041, 0x0004003D, 0x00000006, 0x00000043, 0x00000015, 
+	0x0003003E, 0x00000042, 0x00000043, 0x0004003D, 0x00000045, 0x00000048, 0x00000046, 0x0007004F, 0x00000007, 0x00000049, 
+	0x00000048, 0x00000048, 0x00000000, 0x00000001, 0x0003003E, 0x00000044, 0x00000049, 0x00050041, 0x00000050, 0x00000051, 
+	0x0000004E, 0x00000011, 0x0004003D, 0x0000004B, 0x00000052, 0x00000051, 0x0003003E, 0x0000004A, 0x00000052, 0x00090039, 
+	0x00000006, 0x00000053, 0x0000003C, 0x0000003D, 0x0000003F, 0x00000042, 0x00000044, 0x0000004A, 0x0003003E, 0x0000003B, 
+	0x00000053, 0x0004003D, 0x00000006, 0x00000055, 0x0000003B, 0x0003003E, 0x00000054, 0x00000055, 0x00050041, 0x00000016, 
+	0x00000057, 0x0000000B, 0x00000011, 0x0004003D, 0x00000006, 0x00000058, 0x00000057, 0x0004003D, 0x00000006, 0x00000059, 
+	0x0000001E, 0x00050083, 0x00000006, 0x0000005A, 0x00000058, 0x00000059, 0x00050041, 0x00000016, 0x0000005B, 0x0000000B, 
+	0x00000017, 0x0004003D, 0x00000006, 0x0000005C, 0x0000005B, 0x00050050, 0x00000007, 0x0000005D, 0x0000005A, 0x0000005C, 
+	0x0003003E, 0x00000056, 0x0000005D, 0x0004003D, 0x00000006, 0x0000005F, 0x0000001A, 0x0003003E, 0x0000005E, 0x0000005F, 
+	0x0004003D, 0x00000045, 0x00000061, 0x00000046, 0x0007004F, 0x00000007, 0x00000062, 0x00000061, 0x00000061, 0x00000002, 
+	0x00000003, 0x0003003E, 0x00000060, 0x00000062, 0x00050041, 0x00000050, 0x00000064, 0x0000004E, 0x00000017, 0x0004003D, 
+	0x0000004B, 0x00000065, 0x00000064, 0x0003003E, 0x00000063, 0x00000065, 0x00090039, 0x00000006, 0x00000066, 0x0000003C, 
+	0x00000054, 0x00000056, 0x0000005E, 0x00000060, 0x00000063, 0x0003003E, 0x0000003B, 0x00000066, 0x0004003D, 0x00000006, 
+	0x00000067, 0x0000003B, 0x0004003D, 0x00000006, 0x00000068, 0x0000002A, 0x00050088, 0x00000006, 0x00000069, 0x00000067, 
+	0x00000068, 0x00050083, 0x00000006, 0x0000006A, 0x00000026, 0x00000069, 0x0008000C, 0x00000006, 0x0000006B, 0x00000001, 
+	0x0000002B, 0x0000006A, 0x0000002F, 0x00000030, 0x0003003E, 0x0000006C, 0x0000006B, 0x0004003D, 0x00000006, 0x0000006D, 
+	0x0000006C, 0x000500BC, 0x0000006F, 0x0000006E, 0x0000006D, 0x0000002F, 0x000300F7, 0x00000071, 0x00000000, 0x000400FA, 
+	0x0000006E, 0x00000070, 0x00000071, 0x000200F8, 0x00000070, 0x000100FC, 0x000200F8, 0x00000071, 0x0004003D, 0x00000045, 
+	0x00000073, 0x00000072, 0x0004003D, 0x00000045, 0x00000075, 0x00000074, 0x0004003D, 0x00000006, 0x00000076, 0x00000032, 
+	0x00070050, 0x00000045, 0x00000077, 0x00000076, 0x00000076, 0x00000076, 0x00000076, 0x0008000C, 0x00000045, 0x00000078, 
+	0x00000001, 0x0000002E, 0x00000073, 0x00000075, 0x00000077, 0x0003003E, 0x00000079, 0x00000078, 0x0004003D, 0x00000045, 
+	0x0000007D, 0x00000079, 0x0008004F, 0x0000000D, 0x0000007E, 0x0000007D, 0x0000007D, 0x00000000, 0x00000001, 0x00000002, 
+	0x00050041, 0x00000016, 0x00000080, 0x00000079, 0x0000007F, 0x0004003D, 0x00000006, 0x00000081, 0x00000080, 0x0004003D, 
+	0x00000006, 0x00000082, 0x0000006C, 0x00050085, 0x00000006, 0x00000083, 0x00000081, 0x00000082, 0x00050051, 0x00000006, 
+	0x00000084, 0x0000007E, 0x00000000, 0x00050051, 0x00000006, 0x00000085, 0x0000007E, 0x00000001, 0x00050051, 0x00000006, 
+	0x00000086, 0x0000007E, 0x00000002, 0x00070050, 0x00000045, 0x00000087, 0x00000084, 0x00000085, 0x00000086, 0x00000083, 
+	0x0003003E, 0x0000007B, 0x00000087, 0x000100FD, 0x00010038, 0x00050036, 0x00000006, 0x0000003C, 0x00000000, 0x00000088, 
+	0x00030037, 0x00000016, 0x00000089, 0x00030037, 0x0000000C, 0x0000008A, 0x00030037, 0x00000016, 0x0000008B, 0x00030037, 
+	0x0000000C, 0x0000008C, 0x00030037, 0x0000004C, 0x0000008D, 0x000200F8, 0x0000008E, 0x0004003B, 0x00000016, 0x000000C2, 
+	0x00000007, 0x0004003B, 0x0000000C, 0x000000C5, 0x00000007, 0x0004003D, 0x0000004B, 0x0000008F, 0x0000008D, 0x000500AE, 
+	0x0000006F, 0x00000091, 0x0000008F, 0x00000090, 0x0004003D, 0x00000007, 0x00000092, 0x0000008A, 0x0004003D, 0x00000007, 
+	0x00000093, 0x0000008C, 0x00050094, 0x00000006, 0x00000094, 0x00000092, 0x00000093, 0x000500BA, 0x0000006F, 0x00000095, 
+	0x00000094, 0x0000002F, 0x000500A7, 0x0000006F, 0x00000096, 0x00000091, 0x00000095, 0x000300F7, 0x00000098, 0x00000000, 
+	0x000400FA, 0x00000096, 0x00000097, 0x00000098, 0x000200F8, 0x00000097, 0x000200FE, 0x00000099, 0x000200F8, 0x00000098, 
+	0x0004003D, 0x0000004B, 0x0000009A, 0x0000008D, 0x000500AA, 0x0000006F, 0x0000009C, 0x0000009A, 0x0000009B, 0x000300F7, 
+	0x0000009E, 0x00000000, 0x000400FA, 0x0000009C, 0x0000009D, 0x0000009E, 0x000200F8, 0x0000009D, 0x0004003D, 0x00000006, 
+	0x0000009F, 0x00000089, 0x00050041, 0x00000016, 0x000000A0, 0x0000008A, 0x00000011, 0x0004003D, 0x00000006, 0x000000A1, 
+	0x000000A0, 0x0007000C, 0x00000006, 0x000000A2, 0x00000001, 0x00000028, 0x0000009F, 0x000000A1, 0x000200FE, 0x000000A2, 
+	0x000200F8, 0x0000009E, 0x0004003D, 0x0000004B, 0x000000A3, 0x0000008D, 0x000500AA, 0x0000006F, 0x000000A5, 0x000000A3, 
+	0x000000A4, 0x000300F7, 0x000000A7, 0x00000000, 0x000400FA, 0x000000A5, 0x000000A6, 0x000000A7, 0x000200F8, 0x000000A6, 
+	0x0004003D, 0x00000006, 0x000000A8, 0x00000089, 0x00050041, 0x00000016, 0x000000A9, 0x0000008A, 0x00000011, 0x0004003D, 
+	0x00000006, 0x000000AA, 0x000000A9, 0x0004003D, 0x00000006, 0x000000AB, 0x0000008B, 0x00050083, 0x00000006, 0x000000AC, 
+	0x000000AA, 0x000000AB, 0x0007000C, 0x00000006, 0x000000AD, 0x00000001, 0x00000028, 0x000000A8, 0x000000AC, 0x000200FE, 
+	0x000000AD, 0x000200F8, 0x000000A7, 0x0004003D, 0x0000004B, 0x000000AE, 0x0000008D, 0x000500AA, 0x0000006F, 0x000000B0, 
+	0x000000AE, 0x000000AF, 0x000300F7, 0x000000B2, 0x00000000, 0x000400FA, 0x000000B0, 0x000000B1, 0x000000B2, 0x000200F8, 
+	0x000000B1, 0x00050041, 0x00000016, 0x000000B3, 0x0000008C, 0x00000017, 0x0004003D, 0x00000006, 0x000000B4, 0x000000B3, 
+	0x0006000C, 0x00000006, 0x000000B5, 0x00000001, 0x00000004, 0x000000B4, 0x00050041, 0x00000016, 0x000000B6, 0x0000008C, 
+	0x00000017, 0x0004003D, 0x00000006, 0x000000B7, 0x000000B6, 0x000500BA, 0x0000006F, 0x000000B8, 0x000000B7, 0x0000002F, 
+	0x000300F7, 0x000000BB, 0x00000000, 0x000400FA, 0x000000B8, 0x000000B9, 0x000000BA, 0x000200F8, 0x000000B9, 0x00050041, 
+	0x00000016, 0x000000BD, 0x0000008C, 0x00000011, 0x0004003D, 0x00000006, 0x000000BE, 0x000000BD, 0x0004007F, 0x00000006, 
+	0x000000BF, 0x000000BE, 0x0003003E, 0x000000C2, 0x000000BF, 0x000200F9, 0x000000BB, 0x000200F8, 0x000000BA, 0x00050041, 
+	0x00000016, 0x000000C0, 0x0000008C, 0x00000011, 0x0004003D, 0x00000006, 0x000000C1, 0x000000C0, 0x0003003E, 0x000000C2, 
+	0x000000C1, 0x000200F9, 0x000000BB, 0x000200F8, 0x000000BB, 0x0004003D, 0x00000006, 0x000000C3, 0x000000C2, 0x00050050, 
+	0x00000007, 0x000000C4, 0x000000B5, 0x000000C3, 0x0003003E, 0x000000C5, 0x000000C4, 0x0004003D, 0x00000006, 0x000000C6, 
+	0x00000089, 0x0004003D, 0x00000007, 0x000000C7, 0x0000008A, 0x0004003D, 0x00000007, 0x000000C8, 0x000000C5, 0x00050094, 
+	0x00000006, 0x000000C9, 0x000000C7, 0x000000C8, 0x0004003D, 0x00000006, 0x000000CA, 0x0000008B, 0x00050041, 0x00000016, 
+	0x000000CB, 0x0000008C, 0x00000011, 0x0004003D, 0x00000006, 0x000000CC, 0x000000CB, 0x00050085, 0x00000006, 0x000000CD, 
+	0x000000CA, 0x000000CC, 0x00050083, 0x00000006, 0x000000CE, 0x000000C9, 0x000000CD, 0x0007000C, 0x00000006, 0x000000CF, 
+	0x00000001, 0x00000028, 0x000000C6, 0x000000CE, 0x000200FE, 0x000000CF, 0x000200F8, 0x000000B2, 0x0004003D, 0x0000004B, 
+	0x000000D0, 0x0000008D, 0x000500AA, 0x0000006F, 0x000000D2, 0x000000D0, 0x000000D1, 0x0004003D, 0x0000004B, 0x000000D3, 
+	0x0000008D, 0x000500AA, 0x0000006F, 0x000000D5, 0x000000D3, 0x000000D4, 0x000500A6, 0x0000006F, 0x000000D6, 0x000000D2, 
+	0x000000D5, 0x00050041, 0x00000016, 0x000000D7, 0x0000008A, 0x00000011, 0x0004003D, 0x00000006, 0x000000D8, 0x000000D7, 
+	0x000500BA, 0x0000006F, 0x000000D9, 0x000000D8, 0x0000002F, 0x000500A7, 0x0000006F, 0x000000DA, 0x000000D6, 0x000000D9, 
+	0x000300F7, 0x000000DC, 0x00000000, 0x000400FA, 0x000000DA, 0x000000DB, 0x000000DC, 0x000200F8, 0x000000DB, 0x0004003D, 
+	0x00000007, 0x000000DD, 0x0000008A, 0x0006000C, 0x00000006, 0x000000DE, 0x00000001, 0x00000042, 0x000000DD, 0x0004003D, 
+	0x00000006, 0x000000DF, 0x0000008B, 0x00050083, 0x00000006, 0x000000E0, 0x000000DE, 0x000000DF, 0x000200FE, 0x000000E0, 
+	0x000200F8, 0x000000DC, 0x0004003D, 0x00000006, 0x000000E1, 0x00000089, 0x000200FE, 0x000000E1, 0x00010038
+};
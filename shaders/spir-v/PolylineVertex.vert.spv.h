@@ -0,0 +1,316 @@
+#pragma once
+#include <array>
+#include <stdint.h>
+std::array<uint32_t, 3107> PolylineVertex_vert_shader_data {
+	0x07230203, 0x00010000, 0x00000000, 0x000001C4, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 0x00000001, 0x4C534C47, 
+	0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 0x000E000F, 0x00000000, 0x00000002, 0x6E69616D, 
+	0x00000000, 0x00000007, 0x00000053, 0x00000100, 0x00000129, 0x0000012C, 0x0000012E, 0x00000131, 0x00000137, 0x00000140, 
+	0x00030003, 0x00000002, 0x000001C2, 0x00040005, 0x00000002, 0x6E69616D, 0x00000000, 0x00070005, 0x00000007, 0x495F6C67, 
+	0x6174736E, 0x4965636E, 0x7865646E, 0x00000000, 0x00050005, 0x0000000A, 0x6E696F70, 0x6E695F74, 0x00786564, 0x00060005, 
+	0x00000010, 0x796C6F50, 0x656E696C, 0x6E696F50, 0x00000074, 0x00060006, 0x00000010, 0x00000000, 0x69736F70, 0x6E6F6974, 
+	0x00000000, 0x00050006, 0x00000010, 0x00000001, 0x74646977, 0x00000068, 0x00050006, 0x00000010, 0x00000002, 0x6F6C6F63, 
+	0x00000072, 0x00050006, 0x00000010, 0x00000003, 0x67616C66, 0x00000073, 0x00070005, 0x00000012, 0x796C6F50, 0x656E696C, 
+	0x6E696F50, 0x66754274, 0x00726566, 0x00050006, 0x00000012, 0x00000000, 0x6F627373, 0x00000000, 0x00080005, 0x00000013, 
+	0x796C6F70, 0x656E696C, 0x696F705F, 0x625F746E, 0x65666675, 0x00000072, 0x00060005, 0x0000001B, 0x796C6F50, 0x656E696C, 
+	0x6E696F50, 0x00000074, 0x00060006, 0x0000001B, 0x00000000, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00050006, 0x0000001B, 
+	0x00000001, 0x74646977, 0x00000068, 0x00050006, 0x0000001B, 0x00000002, 0x6F6C6F63, 0x00000072, 0x00050006, 0x0000001B, 
+	0x00000003, 0x67616C66, 0x00000073, 0x00040005, 0x0000001A, 0x73726966, 0x00000074, 0x00040005, 0x00000028, 0x6F636573, 
+	0x0000646E, 0x00040005, 0x00000034, 0x6D676573, 0x00746E65, 0x00060005, 0x00000037, 0x6D676573, 0x5F746E65, 0x676E656C, 
+	0x00006874, 0x00060005, 0x00000052, 0x505F6C67, 0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x00000052, 0x00000000, 
+	0x505F6C67, 0x7469736F, 0x006E6F69, 0x00070006, 0x00000052, 0x00000001, 0x505F6C67, 0x746E696F, 0x657A6953, 0x00000000, 
+	0x00070006, 0x00000052, 0x00000002, 0x435F6C67, 0x4470696C, 0x61747369, 0x0065636E, 0x00070006, 0x00000052, 0x00000003, 
+	0x435F6C67, 0x446C6C75, 0x61747369, 0x0065636E, 0x00030005, 0x00000053, 0x00000000, 0x00050005, 0x0000005D, 0x65726964, 
+	0x6F697463, 0x0000006E, 0x00040005, 0x00000064, 0x6D726F6E, 0x00006C61, 0x00060005, 0x00000066, 0x68737550, 0x736E6F43, 
+	0x746E6174, 0x00000073, 0x00090006, 0x00000066, 0x00000000, 0x6E617274, 0x726F6673, 0x6974616D, 0x6F5F6E6F, 0x65736666, 
+	0x00000074, 0x00070006, 0x00000066, 0x00000001, 0x65646E69, 0x666F5F78, 0x74657366, 0x00000000, 0x00060006, 0x00000066, 
+	0x00000002, 0x65646E69, 0x6F635F78, 0x00746E75, 0x00070006, 0x00000066, 0x00000003, 0x74726576, 0x6F5F7865, 0x65736666, 
+	0x00000074, 0x000B0006, 0x00000066, 0x00000004, 0x74786574, 0x5F657275, 0x6E616863, 0x5F6C656E, 0x67696577, 0x6F5F7468, 
+	0x65736666, 0x00000074, 0x000B0006, 0x00000066, 0x00000005, 0x74786574, 0x5F657275, 0x6E616863, 0x5F6C656E, 0x67696577, 
+	0x635F7468, 0x746E756F, 0x00000000, 0x00080006, 0x00000066, 0x00000006, 0x646E6572, 0x745F7265, 0x65677261, 0x69735F74, 
+	0x0000657A, 0x00050006, 0x00000066, 0x00000007, 0x6E696F6A, 0x00000000, 0x00040006, 0x00000066, 0x00000008, 0x00706163, 
+	0x00060006, 0x00000066, 0x00000009, 0x6574696D, 0x696C5F72, 0x0074696D, 0x00060005, 0x00000067, 0x68737570, 0x6E6F635F, 
+	0x6E617473, 0x00007374, 0x00060005, 0x0000006D, 0x646E6957, 0x7246776F, 0x44656D61, 0x00617461, 0x00060006, 0x0000006D, 
+	0x00000000, 0x746C756D, 0x696C7069, 0x00007265, 0x00050006, 0x0000006D, 0x00000001, 0x7366666F, 0x00007465, 0x00070005, 
+	0x0000006E, 0x646E6977, 0x665F776F, 0x656D6172, 0x7461645F, 0x00000061, 0x00060005, 0x00000077, 0x65786970, 0x69735F6C, 
+	0x325F657A, 0x00000064, 0x00050005, 0x0000007D, 0x65786970, 0x69735F6C, 0x0000657A, 0x00070005, 0x00000083, 0x73726966, 
+	0x61685F74, 0x775F666C, 0x68746469, 0x00000000, 0x00070005, 0x00000088, 0x6F636573, 0x685F646E, 0x5F666C61, 0x74646977, 
+	0x00000068, 0x00080005, 0x0000008D, 0x73726966, 0x72645F74, 0x5F6E7761, 0x666C6168, 0x6469775F, 0x00006874, 0x00080005, 
+	0x00000092, 0x6F636573, 0x645F646E, 0x6E776172, 0x6C61685F, 0x69775F66, 0x00687464, 0x00050005, 0x00000097, 0x73726966, 
+	0x6F635F74, 0x00726F6C, 0x00060005, 0x0000009C, 0x6F636573, 0x635F646E, 0x726F6C6F, 0x00000000, 0x00060005, 0x000000AF, 
+	0x5F736168, 0x76657270, 0x73756F69, 0x00000000, 0x00050005, 0x000000B5, 0x5F736168, 0x7478656E, 0x00000000, 0x00060005, 
+	0x000000B6, 0x73726966, 0x6E655F74, 0x79745F64, 0x00006570, 0x00070005, 0x000000B7, 0x73726966, 0x6C635F74, 0x6E5F7069, 
+	0x616D726F, 0x0000006C, 0x00060005, 0x000000B8, 0x73726966, 0x78655F74, 0x736E6574, 0x006E6F69, 0x00040005, 0x000000BA, 
+	0x61726170, 0x0000006D, 0x00040005, 0x000000BD, 0x61726170, 0x0000006D, 0x00040005, 0x000000C0, 0x61726170, 0x0000006D, 
+	0x00040005, 0x000000C3, 0x61726170, 0x0000006D, 0x00040005, 0x000000C5, 0x61726170, 0x0000006D, 0x00040005, 0x000000D2, 
+	0x61726170, 0x0000006D, 0x00040005, 0x000000D4, 0x61726170, 0x0000006D, 0x00040005, 0x000000D5, 0x61726170, 0x0000006D, 
+	0x00040005, 0x000000D6, 0x61726170, 0x0000006D, 0x00060005, 0x000000DB, 0x6F636573, 0x655F646E, 0x745F646E, 0x00657079, 
+	0x00070005, 0x000000DC, 0x6F636573, 0x635F646E, 0x5F70696C, 0x6D726F6E, 0x00006C61, 0x00070005, 0x000000DD, 0x6F636573, 
+	0x655F646E, 0x6E657478, 0x6E6F6973, 0x00000000, 0x00040005, 0x000000DE, 0x61726170, 0x0000006D, 0x00040005, 0x000000E1, 
+	0x61726170, 0x0000006D, 0x00040005, 0x000000E3, 0x61726170, 0x0000006D, 0x00040005, 0x000000E5, 0x61726170, 0x0000006D, 
+	0x00040005, 0x000000E7, 0x61726170, 0x0000006D, 0x00040005, 0x000000F3, 0x61726170, 0x0000006D, 0x00040005, 0x000000F5, 
+	0x61726170, 0x0000006D, 0x00040005, 0x000000F6, 0x61726170, 0x0000006D, 0x00040005, 0x000000F7, 0x61726170, 0x0000006D, 
+	0x00060005, 0x00000100, 0x565F6C67, 0x65747265, 0x646E4978, 0x00007865, 0x00050005, 0x00000102, 0x65646E69, 0x6C626178, 
+	0x00000065, 0x00050005, 0x00000106, 0x6E726F63, 0x625F7265, 0x00737469, 0x00040005, 0x0000010E, 0x6E726F63, 0x00007265, 
+	0x00060005, 0x00000114, 0x64617571, 0x6C61685F, 0x69775F66, 0x00687464, 0x00060005, 0x00000128, 0x6D676573, 0x5F746E65, 
+	0x726F6F63, 0x00007364, 0x000A0005, 0x00000129, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x6D676573, 0x5F746E65, 
+	0x726F6F63, 0x00007364, 0x00090005, 0x0000012C, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x73726966, 0x6F635F74, 
+	0x00726F6C, 0x000A0005, 0x0000012E, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x6F636573, 0x635F646E, 0x726F6C6F, 
+	0x00000000, 0x000A0005, 0x00000131, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x6D676573, 0x5F746E65, 0x657A6973, 
+	0x00000000, 0x000A0005, 0x00000137, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x70696C63, 0x726F6E5F, 0x736C616D, 
+	0x00000000, 0x00090005, 0x00000140, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x5F646E65, 0x65707974, 0x00000073, 
+	0x00040005, 0x00000151, 0x726F6F63, 0x00007364, 0x00080005, 0x00000159, 0x77656976, 0x74726F70, 0x7265765F, 0x5F786574, 
+	0x726F6F63, 0x00007364, 0x00070005, 0x000000B9, 0x636C6143, 0x74616C75, 0x67655365, 0x746E656D, 0x00646E45, 0x00060005, 
+	0x00000160, 0x5F646E65, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00040005, 0x00000161, 0x77726F66, 0x00647261, 0x00040005, 
+	0x00000162, 0x65646973, 0x00000000, 0x00060005, 0x00000163, 0x5F736168, 0x6769656E, 0x756F6268, 0x00000072, 0x00070005, 
+	0x00000164, 0x6769656E, 0x756F6268, 0x6F705F72, 0x69746973, 0x00006E6F, 0x00050005, 0x00000165, 0x666C6168, 0x6469775F, 
+	0x00006874, 0x00050005, 0x00000166, 0x5F646E65, 0x65707974, 0x00000000, 0x00050005, 0x00000167, 0x70696C63, 0x726F6E5F, 
+	0x006C616D, 0x00050005, 0x00000168, 0x65747865, 0x6F69736E, 0x0000006E, 0x00060005, 0x00000180, 0x6E5F6F74, 0x68676965, 
+	0x72756F62, 0x00000000, 0x00070005, 0x00000183, 0x6769656E, 0x756F6268, 0x656C5F72, 0x6874676E, 0x00000000, 0x00070005, 
+	0x00000192, 0x6769656E, 0x756F6268, 0x69645F72, 0x74636572, 0x006E6F69, 0x00050005, 0x00000195, 0x65736962, 0x726F7463, 
+	0x00000000, 0x00060005, 0x00000198, 0x65736962, 0x726F7463, 0x6E656C5F, 0x00687467, 0x00040047, 0x00000007, 0x0000000B, 
+	0x0000002B, 0x00050048, 0x00000010, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000010, 0x00000001, 0x00000023, 
+	0x00000008, 0x00050048, 0x00000010, 0x00000002, 0x00000023, 0x0000000C, 0x00050048, 0x00000010, 0x00000003, 0x00000023, 
+	0x00000010, 0x00040047, 0x00000011, 0x00000006, 0x00000018, 0x00040048, 0x00000012, 0x00000000, 0x00000018, 0x00050048, 
+	0x00000012, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x00000012, 0x00000003, 0x00040047, 0x00000013, 0x00000022, 
+	0x00000003, 0x00040047, 0x00000013, 0x00000021, 0x00000000, 0x00050048, 0x00000052, 0x00000000, 0x0000000B, 0x00000000, 
+	0x00050048, 0x00000052, 0x00000001, 0x0000000B, 0x00000001, 0x00050048, 0x00000052, 0x00000002, 0x0000000B, 0x00000003, 
+	0x00050048, 0x00000052, 0x00000003, 0x0000000B, 0x00000004, 0x00030047, 0x00000052, 0x00000002, 0x00050048, 0x00000066, 
+	0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000066, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000066, 
+	0x00000002, 0x00000023, 0x00000008, 0x00050048, 0x00000066, 0x00000003, 0x00000023, 0x0000000C, 0x00050048, 0x00000066, 
+	0x00000004, 0x00000023, 0x00000010, 0x00050048, 0x00000066, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000066, 
+	0x00000006, 0x00000023, 0x00000060, 0x00050048, 0x00000066, 0x00000007, 0x00000023, 0x00000068, 0x00050048, 0x00000066, 
+	0x00000008, 0x00000023, 0x0000006C, 0x00050048, 0x00000066, 0x00000009, 0x00000023, 0x00000070, 0x00030047, 0x00000066, 
+	0x00000002, 0x00050048, 0x0000006D, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000006D, 0x00000001, 0x00000023, 
+	0x00000008, 0x00030047, 0x0000006D, 0x00000002, 0x00040047, 0x0000006E, 0x00000022, 0x00000000, 0x00040047, 0x0000006E, 
+	0x00000021, 0x00000000, 0x00040047, 0x00000100, 0x0000000B, 0x0000002A, 0x00040047, 0x00000129, 0x0000001E, 0x00000000, 
+	0x00030047, 0x0000012C, 0x0000000E, 0x00040047, 0x0000012C, 0x0000001E, 0x00000001, 0x00030047, 0x0000012E, 0x0000000E, 
+	0x00040047, 0x0000012E, 0x0000001E, 0x00000002, 0x00030047, 0x00000131, 0x0000000E, 0x00040047, 0x00000131, 0x0000001E, 
+	0x00000003, 0x00030047, 0x00000137, 0x0000000E, 0x00040047, 0x00000137, 0x0000001E, 0x00000004, 0x00030047, 0x00000140, 
+	0x0000000E, 0x00040047, 0x00000140, 0x0000001E, 0x00000005, 0x00020013, 0x00000003, 0x00030021, 0x00000004, 0x00000003, 
+	0x00040015, 0x00000006, 0x00000020, 0x00000001, 0x00040020, 0x00000008, 0x00000001, 0x00000006, 0x0004003B, 0x00000008, 
+	0x00000007, 0x00000001, 0x00040015, 0x0000000B, 0x00000020, 0x00000000, 0x00040020, 0x0000000C, 0x00000007, 0x0000000B, 
+	0x00030016, 0x0000000E, 0x00000020, 0x00040017, 0x0000000F, 0x0000000E, 0x00000002, 0x0006001E, 0x00000010, 0x0000000F, 
+	0x0000000E, 0x0000000B, 0x0000000B, 0x0003001D, 0x00000011, 0x00000010, 0x0003001E, 0x00000012, 0x00000011, 0x00040020, 
+	0x00000014, 0x00000002, 0x00000012, 0x0004003B, 0x00000014, 0x00000013, 0x00000002, 0x0004002B, 0x00000006, 0x00000015, 
+	0x00000000, 0x00040020, 0x00000017, 0x00000002, 0x00000010, 0x0006001E, 0x0000001B, 0x0000000F, 0x0000000E, 0x0000000B, 
+	0x0000000B, 0x00040020, 0x0000001C, 0x00000007, 0x0000001B, 0x0004002B, 0x00000006, 0x00000023, 0x00000001, 0x0004002B, 
+	0x0000000B, 0x00000024, 0x00000001, 0x00040020, 0x0000002E, 0x00000007, 0x0000000F, 0x00040020, 0x00000038, 0x00000007, 
+	0x0000000E, 0x0004002B, 0x00000006, 0x00000039, 0x00000003, 0x0004002B, 0x0000000B, 0x0000003C, 0x00000002, 0x0004002B, 
+	0x0000000B, 0x0000003E, 0x00000000, 0x00020014, 0x00000040, 0x0004002B, 0x0000000B, 0x00000046, 0x00000004, 0x0004002B, 
+	0x0000000E, 0x0000004B, 0x00000000, 0x00040017, 0x00000050, 0x0000000E, 0x00000004, 0x0004001C, 0x00000051, 0x0000000E, 
+	0x00000024, 0x0006001E, 0x00000052, 0x00000050, 0x0000000E, 0x00000051, 0x00000051, 0x00040020, 0x00000054, 0x00000003, 
+	0x00000052, 0x0004003B, 0x00000054, 0x00000053, 0x00000003, 0x0004002B, 0x0000000E, 0x00000055, 0x3F800000, 0x0007002C, 
+	0x00000050, 0x00000056, 0x0000004B, 0x0000004B, 0x0000004B, 0x00000055, 0x00040020, 0x00000057, 0x00000003, 0x00000050, 
+	0x0004002B, 0x0000000E, 0x00000065, 0x40000000, 0x000C001E, 0x00000066, 0x0000000B, 0x0000000B, 0x0000000B, 0x0000000B, 
+	0x0000000B, 0x0000000B, 0x0000000F, 0x0000000B, 0x0000000B, 0x0000000E, 0x00040020, 0x00000068, 0x00000009, 0x00000066, 
+	0x0004003B, 0x00000068, 0x00000067, 0x00000009, 0x0004002B, 0x00000006, 0x00000069, 0x00000006, 0x00040020, 0x0000006A, 
+	0x00000009, 0x0000000F, 0x0004001E, 0x0000006D, 0x0000000F, 0x0000000F, 0x00040020, 0x0000006F, 0x00000002, 0x0000006D, 
+	0x0004003B, 0x0000006F, 0x0000006E, 0x00000002, 0x00040020, 0x00000070, 0x00000002, 0x0000000F, 0x0005002C, 0x0000000F, 
+	0x00000075, 0x00000065, 0x00000065, 0x0004002B, 0x0000000E, 0x00000081, 0x3F000000, 0x0004002B, 0x00000006, 0x00000093, 
+	0x00000002, 0x00040020, 0x00000098, 0x00000007, 0x00000050, 0x00040020, 0x000000B0, 0x00000007, 0x00000040, 0x0005002C, 
+	0x0000000F, 0x000000CF, 0x0000004B, 0x0000004B, 0x0004002B, 0x0000000B, 0x000000FC, 0x00000003, 0x0004002B, 0x0000000B, 
+	0x000000FD, 0x00000006, 0x0004001C, 0x000000FE, 0x0000000B, 0x000000FD, 0x0009002C, 0x000000FE, 0x000000FF, 0x0000003E, 
+	0x00000024, 0x0000003C, 0x0000003C, 0x00000024, 0x000000FC, 0x0004003B, 0x00000008, 0x00000100, 0x00000001, 0x00040020, 
+	0x00000103, 0x00000007, 0x000000FE, 0x00040020, 0x0000012A, 0x00000003, 0x0000000F, 0x0004003B, 0x0000012A, 0x00000129, 
+	0x00000003, 0x0004003B, 0x00000057, 0x0000012C, 0x00000003, 0x0004003B, 0x00000057, 0x0000012E, 0x00000003, 0x00040017, 
+	0x00000130, 0x0000000E, 0x00000003, 0x00040020, 0x00000132, 0x00000003, 0x00000130, 0x0004003B, 0x00000132, 0x00000131, 
+	0x00000003, 0x0004003B, 0x00000057, 0x00000137, 0x00000003, 0x00040017, 0x0000013F, 0x0000000B, 0x00000002, 0x00040020, 
+	0x00000141, 0x00000003, 0x0000013F, 0x0004003B, 0x00000141, 0x00000140, 0x00000003, 0x000C0021, 0x0000015F, 0x00000003, 
+	0x0000002E, 0x0000002E, 0x0000002E, 0x000000B0, 0x0000002E, 0x00000038, 0x0000000C, 0x0000002E, 0x00000038, 0x0004002B, 
+	0x00000006, 0x0000016A, 0x00000008, 0x00040020, 0x0000016B, 0x00000009, 0x0000000B, 0x0005002C, 0x0000000F, 0x0000016E, 
+	0x00000055, 0x0000004B, 0x0004002B, 0x0000000E, 0x0000019A, 0x3A83126F, 0x0004002B, 0x00000006, 0x000001A2, 0x00000007, 
+	0x0004002B, 0x00000006, 0x000001AA, 0x00000009, 0x00040020, 0x000001AB, 0x00000009, 0x0000000E, 0x00050036, 0x00000003, 
+	0x00000002, 0x00000000, 0x00000004, 0x000200F8, 0x00000005, 0x0004003B, 0x0000000C, 0x0000000A, 0x00000007, 0x0004003B, 
+	0x0000001C, 0x0000001A, 0x00000007, 0x0004003B, 0x0000001C, 0x00000028, 0x00000007, 0x0004003B, 0x0000002E, 0x00000034, 
+	0x00000007, 0x0004003B, 0x00000038, 0x00000037, 0x00000007, 0x0004003B, 0x0000002E, 0x0000005D, 0x00000007, 0x0004003B, 
+	0x0000002E, 0x00000064, 0x00000007, 0x0004003B, 0x0000002E, 0x00000077, 0x00000007, 0x0004003B, 0x00000038, 0x0000007D, 
+	0x00000007, 0x0004003B, 0x00000038, 0x00000083, 0x00000007, 0x0004003B, 0x00000038, 0x00000088, 0x00000007, 0x0004003B, 
+	0x00000038, 0x0000008D, 0x00000007, 0x0004003B, 0x00000038, 0x00000092, 0x00000007, 0x0004003B, 0x00000098, 0x00000097, 
+	0x00000007, 0x0004003B, 0x00000098, 0x0000009C, 0x00000007, 0x0004003B, 0x000000B0, 0x000000AF, 0x00000007, 0x0004003B, 
+	0x000000B0, 0x000000B5, 0x00000007, 0x0004003B, 0x0000000C, 0x000000B6, 0x00000007, 0x0004003B, 0x0000002E, 0x000000B7, 
+	0x00000007, 0x0004003B, 0x00000038, 0x000000B8, 0x00000007, 0x0004003B, 0x0000002E, 0x000000BA, 0x00000007, 0x0004003B, 
+	0x0000002E, 0x000000BD, 0x00000007, 0x0004003B, 0x0000002E, 0x000000C0, 0x00000007, 0x0004003B, 0x000000B0, 0x000000C3, 
+	0x00000007, 0x0004003B, 0x0000002E, 0x000000C5, 0x00000007, 0x0004003B, 0x0000002E, 0x000000D0, 0x00000007, 0x0004003B, 
+	0x00000038, 0x000000D2, 0x00000007, 0x0004003B, 0x0000000C, 0x000000D4, 0x00000007, 0x0004003B, 0x0000002E, 0x000000D5, 
+	0x00000007, 0x0004003B, 0x00000038, 0x000000D6, 0x00000007, 0x0004003B, 0x0000000C, 0x000000DB, 0x00000007, 0x0004003B, 
+	0x0000002E, 0x000000DC, 0x00000007, 0x0004003B, 0x00000038, 0x000000DD, 0x00000007, 0x0004003B, 0x0000002E, 0x000000DE, 
+	0x00000007, 0x0004003B, 0x0000002E, 0x000000E1, 0x00000007, 0x0004003B, 0x0000002E, 0x000000E3, 0x00000007, 0x0004003B, 
+	0x000000B0, 0x000000E5, 0x00000007, 0x0004003B, 0x0000002E, 0x000000E7, 0x00000007, 0x0004003B, 0x0000002E, 0x000000F1, 
+	0x00000007, 0x0004003B, 0x00000038, 0x000000F3, 0x00000007, 0x0004003B, 0x0000000C, 0x000000F5, 0x00000007, 0x0004003B, 
+	0x0000002E, 0x000000F6, 0x00000007, 0x0004003B, 0x00000038, 0x000000F7, 0x00000007, 0x0004003B, 0x00000103, 0x00000102, 
+	0x00000007, 0x0004003B, 0x0000000C, 0x00000106, 0x00000007, 0x0004003B, 0x0000002E, 0x0000010E, 0x00000007, 0x0004003B, 
+	0x00000038, 0x00000114, 0x00000007, 0x0004003B, 0x0000002E, 0x00000128, 0x00000007, 0x0004003B, 0x0000002E, 0x00000151, 
+	0x00000007, 0x0004003B, 0x0000002E, 0x00000159, 0x00000007, 0x0004003D, 0x00000006, 0x00000009, 0x00000007, 0x0004007C, 
+	0x0000000B, 0x0000000D, 0x00000009, 0x0003003E, 0x0000000A, 0x0000000D, 0x0004003D, 0x0000000B, 0x00000016, 0x0000000A, 
+	0x00060041, 0x00000017, 0x00000018, 0x00000013, 0x00000015, 0x00000016, 0x0004003D, 0x00000010, 0x00000019, 0x00000018, 
+	0x00050051, 0x0000000F, 0x0000001D, 0x00000019, 0x00000000, 0x00050051, 0x0000000E, 0x0000001E, 0x00000019, 0x00000001, 
+	0x00050051, 0x0000000B, 0x0000001F, 0x00000019, 0x00000002, 0x00050051, 0x0000000B, 0x00000020, 0x00000019, 0x00000003, 
+	0x00070050, 0x0000001B, 0x00000021, 0x0000001D, 0x0000001E, 0x0000001F, 0x00000020, 0x0003003E, 0x0000001A, 0x00000021, 
+	0x0004003D, 0x0000000B, 0x00000022, 0x0000000A, 0x00050080, 0x0000000B, 0x00000025, 0x00000022, 0x00000024, 0x00060041, 
+	0x00000017, 0x00000026, 0x00000013, 0x00000015, 0x00000025, 0x0004003D, 0x00000010, 0x00000027, 0x00000026, 0x00050051, 
+	0x0000000F, 0x00000029, 0x00000027, 0x00000000, 0x00050051, 0x0000000E, 0x0000002A, 0x00000027, 0x00000001, 0x00050051, 
+	0x0000000B, 0x0000002B, 0x00000027, 0x00000002, 0x00050051, 0x0000000B, 0x0000002C, 0x00000027, 0x00000003, 0x00070050, 
+	0x0000001B, 0x0000002D, 0x00000029, 0x0000002A, 0x0000002B, 0x0000002C, 0x0003003E, 0x00000028, 0x0000002D, 0x00050041, 
+	0x0000002E, 0x0000002F, 0x00000028, 0x00000015, 0x0004003D, 0x0000000F, 0x00000030, 0x0000002F, 0x00050041, 0x0000002E, 
+	0x00000031, 0x0000001A, 0x00000015, 0x0004003D, 0x0000000F, 0x00000032, 0x00000031, 0x00050083, 0x0000000F, 0x00000033, 
+	0x00000030, 0x00000032, 0x0003003E, 0x00000034, 0x00000033, 0x0004003D, 0x0000000F, 0x00000035, 0x00000034, 0x0006000C, 
+	0x0000000E, 0x00000036, 0x00000001, 0x00000042, 0x00000035, 0x0003003E, 0x00000037, 0x00000036, 0x00050041, 0x0000000C, 
+	0x0000003A, 0x0000001A, 0x00000039, 0x0004003D, 0x0000000B, 0x0000003B, 0x0000003A, 0x000500C7, 0x0000000B, 0x0000003D, 
+	0x0000003B, 0x0000003C, 0x000500AB, 0x00000040, 0x0000003F, 0x0000003D, 0x0000003E, 0x00050041, 0x0000000C, 0x00000041, 
+	0x0000001A, 0x00000039, 0x0004003D, 0x0000000B, 0x00000042, 0x00000041, 0x00050041, 0x0000000C, 0x00000043, 0x00000028, 
+	0x00000039, 0x0004003D, 0x0000000B, 0x00000044, 0x00000043, 0x000500C5, 0x0000000B, 0x00000045, 0x00000042, 0x00000044, 
+	0x000500C7, 0x0000000B, 0x00000047, 0x00000045, 0x00000046, 0x000500AB, 0x00000040, 0x00000048, 0x00000047, 0x0000003E, 
+	0x000500A6, 0x00000040, 0x00000049, 0x0000003F, 0x00000048, 0x0004003D, 0x0000000E, 0x0000004A, 0x00000037, 0x000500BC, 
+	0x00000040, 0x0000004C, 0x0000004A, 0x0000004B, 0x000500A6, 0x00000040, 0x0000004D, 0x00000049, 0x0000004C, 0x000300F7, 
+	0x0000004F, 0x00000000, 0x000400FA, 0x0000004D, 0x0000004E, 0x0000004F, 0x000200F8, 0x0000004E, 0x00050041, 0x00000057, 
+	0x00000058, 0x00000053, 0x00000015, 0x0003003E, 0x00000058, 0x00000056, 0x000100FD, 0x000200F8, 0x0000004F, 0x0004003D, 
+	0x0000000F, 0x00000059, 0x00000034, 0x0004003D, 0x0000000E, 0x0000005A, 0x00000037, 0x00050050, 0x0000000F, 0x0000005B, 
+	0x0000005A, 0x0000005A, 0x00050088, 0x0000000F, 0x0000005C, 0x00000059, 0x0000005B, 0x0003003E, 0x0000005D, 0x0000005C, 
+	0x00050041, 0x00000038, 0x0000005E, 0x0000005D, 0x00000023, 0x0004003D, 0x0000000E, 0x0000005F, 0x0000005E, 0x0004007F, 
+	0x0000000E, 0x00000060, 0x0000005F, 0x00050041, 0x00000038, 0x00000061, 0x0000005D, 0x00000015, 0x0004003D, 0x0000000E, 
+	0x00000062, 0x00000061, 0x00050050, 0x0000000F, 0x00000063, 0x00000060, 0x00000062, 0x0003003E, 0x00000064, 0x00000063, 
+	0x00050041, 0x0000006A, 0x0000006B, 0x00000067, 0x00000069, 0x0004003D, 0x0000000F, 0x0000006C, 0x0000006B, 0x00050041, 
+	0x00000070, 0x00000071, 0x0000006E, 0x00000015, 0x0004003D, 0x0000000F, 0x00000072, 0x00000071, 0x0006000C, 0x0000000F, 
+	0x00000073, 0x00000001, 0x00000004, 0x00000072, 0x00050085, 0x0000000F, 0x00000074, 0x0000006C, 0x00000073, 0x00050088, 
+	0x0000000F, 0x00000076, 0x00000075, 0x00000074, 0x0003003E, 0x00000077, 0x00000076, 0x00050041, 0x00000038, 0x00000078, 
+	0x00000077, 0x00000015, 0x0004003D, 0x0000000E, 0x00000079, 0x00000078, 0x00050041, 0x00000038, 0x0000007A, 0x00000077, 
+	0x00000023, 0x0004003D, 0x0000000E, 0x0000007B, 0x0000007A, 0x0007000C, 0x0000000E, 0x0000007C, 0x00000001, 0x00000028, 
+	0x00000079, 0x0000007B, 0x0003003E, 0x0000007D, 0x0000007C, 0x00050041, 0x00000038, 0x0000007E, 0x0000001A, 0x00000023, 
+	0x0004003D, 0x0000000E, 0x0000007F, 0x0000007E, 0x0007000C, 0x0000000E, 0x00000080, 0x00000001, 0x00000028, 0x0000007F, 
+	0x0000004B, 0x00050085, 0x0000000E, 0x00000082, 0x00000080, 0x00000081, 0x0003003E, 0x00000083, 0x00000082, 0x00050041, 
+	0x00000038, 0x00000084, 0x00000028, 0x00000023, 0x0004003D, 0x0000000E, 0x00000085, 0x00000084, 0x0007000C, 0x0000000E, 
+	0x00000086, 0x00000001, 0x00000028, 0x00000085, 0x0000004B, 0x00050085, 0x0000000E, 0x00000087, 0x00000086, 0x00000081, 
+	0x0003003E, 0x00000088, 0x00000087, 0x0004003D, 0x0000000E, 0x00000089, 0x00000083, 0x0004003D, 0x0000000E, 0x0000008A, 
+	0x0000007D, 0x00050085, 0x0000000E, 0x0000008B, 0x0000008A, 0x00000081, 0x0007000C, 0x0000000E, 0x0000008C, 0x00000001, 
+	0x00000028, 0x00000089, 0x0000008B, 0x0003003E, 0x0000008D, 0x0000008C, 0x0004003D, 0x0000000E, 0x0000008E, 0x00000088, 
+	0x0004003D, 0x0000000E, 0x0000008F, 0x0000007D, 0x00050085, 0x0000000E, 0x00000090, 0x0000008F, 0x00000081, 0x0007000C, 
+	0x0000000E, 0x00000091, 0x00000001, 0x00000028, 0x0000008E, 0x00000090, 0x0003003E, 0x00000092, 0x00000091, 0x00050041, 
+	0x0000000C, 0x00000094, 0x0000001A, 0x00000093, 0x0004003D, 0x0000000B, 0x00000095, 0x00000094, 0x0006000C, 0x00000050, 
+	0x00000096, 0x00000001, 0x00000040, 0x00000095, 0x0003003E, 0x00000097, 0x00000096, 0x00050041, 0x0000000C, 0x00000099, 
+	0x00000028, 0x00000093, 0x0004003D, 0x0000000B, 0x0000009A, 0x00000099, 0x0006000C, 0x00000050, 0x0000009B, 0x00000001, 
+	0x00000040, 0x0000009A, 0x0003003E, 0x0000009C, 0x0000009B, 0x0004003D, 0x0000000E, 0x0000009D, 0x00000083, 0x0004003D, 
+	0x0000000E, 0x0000009E, 0x0000008D, 0x00050088, 0x0000000E, 0x0000009F, 0x0000009D, 0x0000009E, 0x00050041, 0x00000038, 
+	0x000000A0, 0x00000097, 0x00000039, 0x0004003D, 0x0000000E, 0x000000A1, 0x000000A0, 0x00050085, 0x0000000E, 0x000000A2, 
+	0x000000A1, 0x0000009F, 0x00050041, 0x00000038, 0x000000A3, 0x00000097, 0x00000039, 0x0003003E, 0x000000A3, 0x000000A2, 
+	0x0004003D, 0x0000000E, 0x000000A4, 0x00000088, 0x0004003D, 0x0000000E, 0x000000A5, 0x00000092, 0x00050088, 0x0000000E, 
+	0x000000A6, 0x000000A4, 0x000000A5, 0x00050041, 0x00000038, 0x000000A7, 0x0000009C, 0x00000039, 0x0004003D, 0x0000000E, 
+	0x000000A8, 0x000000A7, 0x00050085, 0x0000000E, 0x000000A9, 0x000000A8, 0x000000A6, 0x00050041, 0x00000038, 0x000000AA, 
+	0x0000009C, 0x00000039, 0x0003003E, 0x000000AA, 0x000000A9, 0x00050041, 0x0000000C, 0x000000AB, 0x0000001A, 0x00000039, 
+	0x0004003D, 0x0000000B, 0x000000AC, 0x000000AB, 0x000500C7, 0x0000000B, 0x000000AD, 0x000000AC, 0x00000024, 0x000500AA, 
+	0x00000040, 0x000000AE, 0x000000AD, 0x0000003E, 0x0003003E, 0x000000AF, 0x000000AE, 0x00050041, 0x0000000C, 0x000000B1, 
+	0x00000028, 0x00000039, 0x0004003D, 0x0000000B, 0x000000B2, 0x000000B1, 0x000500C7, 0x0000000B, 0x000000B3, 0x000000B2, 
+	0x0000003C, 0x000500AA, 0x00000040, 0x000000B4, 0x000000B3, 0x0000003E, 0x0003003E, 0x000000B5, 0x000000B4, 0x00050041, 
+	0x0000002E, 0x000000BB, 0x0000001A, 0x00000015, 0x0004003D, 0x0000000F, 0x000000BC, 0x000000BB, 0x0003003E, 0x000000BA, 
+	0x000000BC, 0x0004003D, 0x0000000F, 0x000000BE, 0x0000005D, 0x0004007F, 0x0000000F, 0x000000BF, 0x000000BE, 0x0003003E, 
+	0x000000BD, 0x000000BF, 0x0004003D, 0x0000000F, 0x000000C1, 0x00000064, 0x0004007F, 0x0000000F, 0x000000C2, 0x000000C1, 
+	0x0003003E, 0x000000C0, 0x000000C2, 0x0004003D, 0x00000040, 0x000000C4, 0x000000AF, 0x0003003E, 0x000000C3, 0x000000C4, 
+	0x0004003D, 0x00000040, 0x000000C6, 0x000000AF, 0x000300F7, 0x000000C9, 0x00000000, 0x000400FA, 0x000000C6, 0x000000C7, 
+	0x000000C8, 0x000200F8, 0x000000C7, 0x0004003D, 0x0000000B, 0x000000CB, 0x0000000A, 0x00050082, 0x0000000B, 0x000000CC, 
+	0x000000CB, 0x00000024, 0x00070041, 0x00000070, 0x000000CD, 0x00000013, 0x00000015, 0x000000CC, 0x00000015, 0x0004003D, 
+	0x0000000F, 0x000000CE, 0x000000CD, 0x0003003E, 0x000000D0, 0x000000CE, 0x000200F9, 0x000000C9, 0x000200F8, 0x000000C8, 
+	0x0003003E, 0x000000D0, 0x000000CF, 0x000200F9, 0x000000C9, 0x000200F8, 0x000000C9, 0x0004003D, 0x0000000F, 0x000000D1, 
+	0x000000D0, 0x0003003E, 0x000000C5, 0x000000D1, 0x0004003D, 0x0000000E, 0x000000D3, 0x0000008D, 0x0003003E, 0x000000D2, 
+	0x000000D3, 0x000D0039, 0x00000003, 0x000000D7, 0x000000B9, 0x000000BA, 0x000000BD, 0x000000C0, 0x000000C3, 0x000000C5, 
+	0x000000D2, 0x000000D4, 0x000000D5, 0x000000D6, 0x0004003D, 0x0000000B, 0x000000D8, 0x000000D4, 0x0003003E, 0x000000B6, 
+	0x000000D8, 0x0004003D, 0x0000000F, 0x000000D9, 0x000000D5, 0x0003003E, 0x000000B7, 0x000000D9, 0x0004003D, 0x0000000E, 
+	0x000000DA, 0x000000D6, 0x0003003E, 0x000000B8, 0x000000DA, 0x00050041, 0x0000002E, 0x000000DF, 0x00000028, 0x00000015, 
+	0x0004003D, 0x0000000F, 0x000000E0, 0x000000DF, 0x0003003E, 0x000000DE, 0x000000E0, 0x0004003D, 0x0000000F, 0x000000E2, 
+	0x0000005D, 0x0003003E, 0x000000E1, 0x000000E2, 0x0004003D, 0x0000000F, 0x000000E4, 0x00000064, 0x0003003E, 0x000000E3, 
+	0x000000E4, 0x0004003D, 0x00000040, 0x000000E6, 0x000000B5, 0x0003003E, 0x000000E5, 0x000000E6, 0x0004003D, 0x00000040, 
+	0x000000E8, 0x000000B5, 0x000300F7, 0x000000EB, 0x00000000, 0x000400FA, 0x000000E8, 0x000000E9, 0x000000EA, 0x000200F8, 
+	0x000000E9, 0x0004003D, 0x0000000B, 0x000000ED, 0x0000000A, 0x00050080, 0x0000000B, 0x000000EE, 0x000000ED, 0x0000003C, 
+	0x00070041, 0x00000070, 0x000000EF, 0x00000013, 0x00000015, 0x000000EE, 0x00000015, 0x0004003D, 0x0000000F, 0x000000F0, 
+	0x000000EF, 0x0003003E, 0x000000F1, 0x000000F0, 0x000200F9, 0x000000EB, 0x000200F8, 0x000000EA, 0x0003003E, 0x000000F1, 
+	0x000000CF, 0x000200F9, 0x000000EB, 0x000200F8, 0x000000EB, 0x0004003D, 0x0000000F, 0x000000F2, 0x000000F1, 0x0003003E, 
+	0x000000E7, 0x000000F2, 0x0004003D, 0x0000000E, 0x000000F4, 0x00000092, 0x0003003E, 0x000000F3, 0x000000F4, 0x000D0039, 
+	0x00000003, 0x000000F8, 0x000000B9, 0x000000DE, 0x000000E1, 0x000000E3, 0x000000E5, 0x000000E7, 0x000000F3, 0x000000F5, 
+	0x000000F6, 0x000000F7, 0x0004003D, 0x0000000B, 0x000000F9, 0x000000F5, 0x0003003E, 0x000000DB, 0x000000F9, 0x0004003D, 
+	0x0000000F, 0x000000FA, 0x000000F6, 0x0003003E, 0x000000DC, 0x000000FA, 0x0004003D, 0x0000000E, 0x000000FB, 0x000000F7, 
+	0x0003003E, 0x000000DD, 0x000000FB, 0x0004003D, 0x00000006, 0x00000101, 0x00000100, 0x0003003E, 0x00000102, 0x000000FF, 
+	0x00050041, 0x0000000C, 0x00000104, 0x00000102, 0x00000101, 0x0004003D, 0x0000000B, 0x00000105, 0x00000104, 0x0003003E, 
+	0x00000106, 0x00000105, 0x0004003D, 0x0000000B, 0x00000107, 0x00000106, 0x000500C7, 0x0000000B, 0x00000108, 0x00000107, 
+	0x00000024, 0x00040070, 0x0000000E, 0x00000109, 0x00000108, 0x0004003D, 0x0000000B, 0x0000010A, 0x00000106, 0x000500C2, 
+	0x0000000B, 0x0000010B, 0x0000010A, 0x00000023, 0x00040070, 0x0000000E, 0x0000010C, 0x0000010B, 0x00050050, 0x0000000F, 
+	0x0000010D, 0x00000109, 0x0000010C, 0x0003003E, 0x0000010E, 0x0000010D, 0x0004003D, 0x0000000E, 0x0000010F, 0x0000008D, 
+	0x0004003D, 0x0000000E, 0x00000110, 0x00000092, 0x0007000C, 0x0000000E, 0x00000111, 0x00000001, 0x00000028, 0x0000010F, 
+	0x00000110, 0x0004003D, 0x0000000E, 0x00000112, 0x0000007D, 0x00050081, 0x0000000E, 0x00000113, 0x00000111, 0x00000112, 
+	0x0003003E, 0x00000114, 0x00000113, 0x0004003D, 0x0000000E, 0x00000115, 0x000000B8, 0x0004007F, 0x0000000E, 0x00000116, 
+	0x00000115, 0x0004003D, 0x0000000E, 0x00000117, 0x0000007D, 0x00050083, 0x0000000E, 0x00000118, 0x00000116, 0x00000117, 
+	0x0004003D, 0x0000000E, 0x00000119, 0x00000037, 0x0004003D, 0x0000000E, 0x0000011A, 0x000000DD, 0x00050081, 0x0000000E, 
+	0x0000011B, 0x00000119, 0x0000011A, 0x0004003D, 0x0000000E, 0x0000011C, 0x0000007D, 0x00050081, 0x0000000E, 0x0000011D, 
+	0x0000011B, 0x0000011C, 0x00050041, 0x00000038, 0x0000011E, 0x0000010E, 0x00000015, 0x0004003D, 0x0000000E, 0x0000011F, 
+	0x0000011E, 0x0008000C, 0x0000000E, 0x00000120, 0x00000001, 0x0000002E, 0x00000118, 0x0000011D, 0x0000011F, 0x0004003D, 
+	0x0000000E, 0x00000121, 0x00000114, 0x0004007F, 0x0000000E, 0x00000122, 0x00000121, 0x0004003D, 0x0000000E, 0x00000123, 
+	0x00000114, 0x00050041, 0x00000038, 0x00000124, 0x0000010E, 0x00000023, 0x0004003D, 0x0000000E, 0x00000125, 0x00000124, 
+	0x0008000C, 0x0000000E, 0x00000126, 0x00000001, 0x0000002E, 0x00000122, 0x00000123, 0x00000125, 0x00050050, 0x0000000F, 
+	0x00000127, 0x00000120, 0x00000126, 0x0003003E, 0x00000128, 0x00000127, 0x0004003D, 0x0000000F, 0x0000012B, 0x00000128, 
+	0x0003003E, 0x00000129, 0x0000012B, 0x0004003D, 0x00000050, 0x0000012D, 0x00000097, 0x0003003E, 0x0000012C, 0x0000012D, 
+	0x0004003D, 0x00000050, 0x0000012F, 0x0000009C, 0x0003003E, 0x0000012E, 0x0000012F, 0x0004003D, 0x0000000E, 0x00000133, 
+	0x0000008D, 0x0004003D, 0x0000000E, 0x00000134, 0x00000092, 0x0004003D, 0x0000000E, 0x00000135, 0x00000037, 0x00060050, 
+	0x00000130, 0x00000136, 0x00000133, 0x00000134, 0x00000135, 0x0003003E, 0x00000131, 0x00000136, 0x0004003D, 0x0000000F, 
+	0x00000138, 0x000000B7, 0x0004003D, 0x0000000F, 0x00000139, 0x000000DC, 0x00050051, 0x0000000E, 0x0000013A, 0x00000138, 
+	0x00000000, 0x00050051, 0x0000000E, 0x0000013B, 0x00000138, 0x00000001, 0x00050051, 0x0000000E, 0x0000013C, 0x00000139, 
+	0x00000000, 0x00050051, 0x0000000E, 0x0000013D, 0x00000139, 0x00000001, 0x00070050, 0x00000050, 0x0000013E, 0x0000013A, 
+	0x0000013B, 0x0000013C, 0x0000013D, 0x0003003E, 0x00000137, 0x0000013E, 0x0004003D, 0x0000000B, 0x00000142, 0x000000B6, 
+	0x0004003D, 0x0000000B, 0x00000143, 0x000000DB, 0x00050050, 0x0000013F, 0x00000144, 0x00000142, 0x00000143, 0x0003003E, 
+	0x00000140, 0x00000144, 0x00050041, 0x0000002E, 0x00000145, 0x0000001A, 0x00000015, 0x0004003D, 0x0000000F, 0x00000146, 
+	0x00000145, 0x0004003D, 0x0000000F, 0x00000147, 0x0000005D, 0x00050041, 0x00000038, 0x00000148, 0x00000128, 0x00000015, 
+	0x0004003D, 0x0000000E, 0x00000149, 0x00000148, 0x0005008E, 0x0000000F, 0x0000014A, 0x00000147, 0x00000149, 0x00050081, 
+	0x0000000F, 0x0000014B, 0x00000146, 0x0000014A, 0x0004003D, 0x0000000F, 0x0000014C, 0x00000064, 0x00050041, 0x00000038, 
+	0x0000014D, 0x00000128, 0x00000023, 0x0004003D, 0x0000000E, 0x0000014E, 0x0000014D, 0x0005008E, 0x0000000F, 0x0000014F, 
+	0x0000014C, 0x0000014E, 0x00050081, 0x0000000F, 0x00000150, 0x0000014B, 0x0000014F, 0x0003003E, 0x00000151, 0x00000150, 
+	0x0004003D, 0x0000000F, 0x00000152, 0x00000151, 0x00050041, 0x00000070, 0x00000153, 0x0000006E, 0x00000015, 0x0004003D, 
+	0x0000000F, 0x00000154, 0x00000153, 0x00050085, 0x0000000F, 0x00000155, 0x00000152, 0x00000154, 0x00050041, 0x00000070, 
+	0x00000156, 0x0000006E, 0x00000023, 0x0004003D, 0x0000000F, 0x00000157, 0x00000156, 0x00050081, 0x0000000F, 0x00000158, 
+	0x00000155, 0x00000157, 0x0003003E, 0x00000159, 0x00000158, 0x0004003D, 0x0000000F, 0x0000015A, 0x00000159, 0x00050051, 
+	0x0000000E, 0x0000015B, 0x0000015A, 0x00000000, 0x00050051, 0x0000000E, 0x0000015C, 0x0000015A, 0x00000001, 0x00070050, 
+	0x00000050, 0x0000015D, 0x0000015B, 0x0000015C, 0x00000081, 0x00000055, 0x00050041, 0x00000057, 0x0000015E, 0x00000053, 
+	0x00000015, 0x0003003E, 0x0000015E, 0x0000015D, 0x000100FD, 0x00010038, 0x00050036, 0x00000003, 0x000000B9, 0x00000000, 
+	0x0000015F, 0x00030037, 0x0000002E, 0x00000160, 0x00030037, 0x0000002E, 0x00000161, 0x00030037, 0x0000002E, 0x00000162, 
+	0x00030037, 0x000000B0, 0x00000163, 0x00030037, 0x0000002E, 0x00000164, 0x00030037, 0x00000038, 0x00000165, 0x00030037, 
+	0x0000000C, 0x00000166, 0x00030037, 0x0000002E, 0x00000167, 0x00030037, 0x00000038, 0x00000168, 0x000200F8, 0x00000169, 
+	0x0004003B, 0x00000038, 0x00000177, 0x00000007, 0x0004003B, 0x0000002E, 0x00000180, 0x00000007, 0x0004003B, 0x00000038, 
+	0x00000183, 0x00000007, 0x0004003B, 0x0000002E, 0x00000192, 0x00000007, 0x0004003B, 0x0000002E, 0x00000195, 0x00000007, 
+	0x0004003B, 0x00000038, 0x00000198, 0x00000007, 0x0004003B, 0x00000038, 0x000001C1, 0x00000007, 0x00050041, 0x0000016B, 
+	0x0000016C, 0x00000067, 0x0000016A, 0x0004003D, 0x0000000B, 0x0000016D, 0x0000016C, 0x0003003E, 0x00000166, 0x0000016D, 
+	0x0003003E, 0x00000167, 0x0000016E, 0x00050041, 0x0000016B, 0x0000016F, 0x00000067, 0x0000016A, 0x0004003D, 0x0000000B, 
+	0x00000170, 0x0000016F, 0x000500AA, 0x00000040, 0x00000171, 0x00000170, 0x0000003E, 0x000300F7, 0x00000174, 0x00000000, 
+	0x000400FA, 0x00000171, 0x00000172, 0x00000173, 0x000200F8, 0x00000172, 0x0003003E, 0x00000177, 0x0000004B, 0x000200F9, 
+	0x00000174, 0x000200F8, 0x00000173, 0x0004003D, 0x0000000E, 0x00000176, 0x00000165, 0x0003003E, 0x00000177, 0x00000176, 
+	0x000200F9, 0x00000174, 0x000200F8, 0x00000174, 0x0004003D, 0x0000000E, 0x00000178, 0x00000177, 0x0003003E, 0x00000168, 
+	0x00000178, 0x0004003D, 0x00000040, 0x00000179, 0x00000163, 0x000400A8, 0x00000040, 0x0000017A, 0x00000179, 0x000300F7, 
+	0x0000017C, 0x00000000, 0x000400FA, 0x0000017A, 0x0000017B, 0x0000017C, 0x000200F8, 0x0000017B, 0x000100FD, 0x000200F8, 
+	0x0000017C, 0x0004003D, 0x0000000F, 0x0000017D, 0x00000164, 0x0004003D, 0x0000000F, 0x0000017E, 0x00000160, 0x00050083, 
+	0x0000000F, 0x0000017F, 0x0000017D, 0x0000017E, 0x0003003E, 0x00000180, 0x0000017F, 0x0004003D, 0x0000000F, 0x00000181, 
+	0x00000180, 0x0006000C, 0x0000000E, 0x00000182, 0x00000001, 0x00000042, 0x00000181, 0x0003003E, 0x00000183, 0x00000182, 
+	0x0004003D, 0x0000000E, 0x00000184, 0x00000183, 0x000500BC, 0x00000040, 0x00000185, 0x00000184, 0x0000004B, 0x000300F7, 
+	0x00000187, 0x00000000, 0x000400FA, 0x00000185, 0x00000186, 0x00000187, 0x000200F8, 0x00000186, 0x000100FD, 0x000200F8, 
+	0x00000187, 0x0004003D, 0x0000000F, 0x00000188, 0x00000180, 0x0004003D, 0x0000000F, 0x00000189, 0x00000161, 0x00050094, 
+	0x0000000E, 0x0000018A, 0x00000188, 0x00000189, 0x0004003D, 0x0000000F, 0x0000018B, 0x00000180, 0x0004003D, 0x0000000F, 
+	0x0000018C, 0x00000162, 0x00050094, 0x0000000E, 0x0000018D, 0x0000018B, 0x0000018C, 0x00050050, 0x0000000F, 0x0000018E, 
+	0x0000018A, 0x0000018D, 0x0004003D, 0x0000000E, 0x0000018F, 0x00000183, 0x00050050, 0x0000000F, 0x00000190, 0x0000018F, 
+	0x0000018F, 0x00050088, 0x0000000F, 0x00000191, 0x0000018E, 0x00000190, 0x0003003E, 0x00000192, 0x00000191, 0x0004003D, 
+	0x0000000F, 0x00000193, 0x00000192, 0x00050081, 0x0000000F, 0x00000194, 0x0000016E, 0x00000193, 0x0003003E, 0x00000195, 
+	0x00000194, 0x0004003D, 0x0000000F, 0x00000196, 0x00000195, 0x0006000C, 0x0000000E, 0x00000197, 0x00000001, 0x00000042, 
+	0x00000196, 0x0003003E, 0x00000198, 0x00000197, 0x0004003D, 0x0000000E, 0x00000199, 0x00000198, 0x000500B8, 0x00000040, 
+	0x0000019B, 0x00000199, 0x0000019A, 0x000300F7, 0x0000019D, 0x00000000, 0x000400FA, 0x0000019B, 0x0000019C, 0x0000019D, 
+	0x000200F8, 0x0000019C, 0x000100FD, 0x000200F8, 0x0000019D, 0x0004003D, 0x0000000F, 0x0000019E, 0x00000195, 0x0004003D, 
+	0x0000000E, 0x0000019F, 0x00000198, 0x00050050, 0x0000000F, 0x000001A0, 0x0000019F, 0x0000019F, 0x00050088, 0x0000000F, 
+	0x000001A1, 0x0000019E, 0x000001A0, 0x0003003E, 0x00000167, 0x000001A1, 0x00050041, 0x0000016B, 0x000001A3, 0x00000067, 
+	0x000001A2, 0x0004003D, 0x0000000B, 0x000001A4, 0x000001A3, 0x00050080, 0x0000000B, 0x000001A5, 0x000000FC, 0x000001A4, 
+	0x0003003E, 0x00000166, 0x000001A5, 0x0004003D, 0x0000000B, 0x000001A6, 0x00000166, 0x000500AA, 0x00000040, 0x000001A7, 
+	0x000001A6, 0x000000FC, 0x00050041, 0x00000038, 0x000001A8, 0x00000167, 0x00000015, 0x0004003D, 0x0000000E, 0x000001A9, 
+	0x000001A8, 0x00050041, 0x000001AB, 0x000001AC, 0x00000067, 0x000001AA, 0x0004003D, 0x0000000E, 0x000001AD, 0x000001AC, 
+	0x00050085, 0x0000000E, 0x000001AE, 0x000001A9, 0x000001AD, 0x000500B8, 0x00000040, 0x000001AF, 0x000001AE, 0x00000055, 
+	0x000500A7, 0x00000040, 0x000001B0, 0x000001A7, 0x000001AF, 0x000300F7, 0x000001B2, 0x00000000, 0x000400FA, 0x000001B0, 
+	0x000001B1, 0x000001B2, 0x000200F8, 0x000001B1, 0x0003003E, 0x00000166, 0x00000046, 0x000200F9, 0x000001B2, 0x000200F8, 
+	0x000001B2, 0x0004003D, 0x0000000E, 0x000001B3, 0x00000165, 0x0004003D, 0x0000000B, 0x000001B4, 0x00000166, 0x000500AA, 
+	0x00000040, 0x000001B5, 0x000001B4, 0x000000FC, 0x000300F7, 0x000001B8, 0x00000000, 0x000400FA, 0x000001B5, 0x000001B6, 
+	0x000001B7, 0x000200F8, 0x000001B6, 0x00050041, 0x00000038, 0x000001BA, 0x00000167, 0x00000023, 0x0004003D, 0x0000000E, 
+	0x000001BB, 0x000001BA, 0x0006000C, 0x0000000E, 0x000001BC, 0x00000001, 0x00000004, 0x000001BB, 0x00050041, 0x00000038, 
+	0x000001BD, 0x00000167, 0x00000015, 0x0004003D, 0x0000000E, 0x000001BE, 0x000001BD, 0x00050088, 0x0000000E, 0x000001BF, 
+	0x000001BC, 0x000001BE, 0x0007000C, 0x0000000E, 0x000001C0, 0x00000001, 0x00000028, 0x00000055, 0x000001BF, 0x0003003E, 
+	0x000001C1, 0x000001C0, 0x000200F9, 0x000001B8, 0x000200F8, 0x000001B7, 0x0003003E, 0x000001C1, 0x00000055, 0x000200F9, 
+	0x000001B8, 0x000200F8, 0x000001B8, 0x0004003D, 0x0000000E, 0x000001C2, 0x000001C1, 0x00050085, 0x0000000E, 0x000001C3, 
+	0x000001B3, 0x000001C2, 0x0003003E, 0x00000168, 0x000001C3, 0x000100FD, 0x00010038
+};
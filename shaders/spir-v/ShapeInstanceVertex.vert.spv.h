@@ -0,0 +1,114 @@
+#pragma once
+#include <array>
+#include <stdint.h>
+std::array<uint32_t, 1090> ShapeInstanceVertex_vert_shader_data {
+	0x07230203, 0x00010000, 0x00000000, 0x00000081, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 0x00000001, 0x4C534C47, 
+	0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 0x000B000F, 0x00000000, 0x00000002, 0x6E69616D, 
+	0x00000000, 0x00000010, 0x00000025, 0x00000055, 0x00000059, 0x00000060, 0x00000078, 0x00030003, 0x00000002, 0x000001C2, 
+	0x00040005, 0x00000002, 0x6E69616D, 0x00000000, 0x00060005, 0x00000009, 0x70616853, 0x736E4965, 0x636E6174, 0x00000065, 
+	0x00050006, 0x00000009, 0x00000000, 0x746E6563, 0x00007265, 0x00060006, 0x00000009, 0x00000001, 0x666C6168, 0x7A69735F, 
+	0x00000065, 0x00060006, 0x00000009, 0x00000002, 0x61726170, 0x6574656D, 0x00000072, 0x00050006, 0x00000009, 0x00000003, 
+	0x6F6C6F63, 0x00000072, 0x00070005, 0x0000000B, 0x70616853, 0x736E4965, 0x636E6174, 0x66754265, 0x00726566, 0x00050006, 
+	0x0000000B, 0x00000000, 0x6F627373, 0x00000000, 0x00080005, 0x0000000C, 0x70616873, 0x6E695F65, 0x6E617473, 0x625F6563, 
+	0x65666675, 0x00000072, 0x00070005, 0x00000010, 0x495F6C67, 0x6174736E, 0x4965636E, 0x7865646E, 0x00000000, 0x00060005, 
+	0x00000017, 0x70616853, 0x736E4965, 0x636E6174, 0x00000065, 0x00050006, 0x00000017, 0x00000000, 0x746E6563, 0x00007265, 
+	0x00060006, 0x00000017, 0x00000001, 0x666C6168, 0x7A69735F, 0x00000065, 0x00060006, 0x00000017, 0x00000002, 0x61726170, 
+	0x6574656D, 0x00000072, 0x00050006, 0x00000017, 0x00000003, 0x6F6C6F63, 0x00000072, 0x00060005, 0x00000016, 0x70616873, 
+	0x6E695F65, 0x6E617473, 0x00006563, 0x00060005, 0x00000025, 0x565F6C67, 0x65747265, 0x646E4978, 0x00007865, 0x00050005, 
+	0x00000027, 0x65646E69, 0x6C626178, 0x00000065, 0x00050005, 0x0000002C, 0x6E726F63, 0x625F7265, 0x00737469, 0x00040005, 
+	0x00000035, 0x6E726F63, 0x00007265, 0x00060005, 0x00000038, 0x68737550, 0x736E6F43, 0x746E6174, 0x00000073, 0x00090006, 
+	0x00000038, 0x00000000, 0x6E617274, 0x726F6673, 0x6974616D, 0x6F5F6E6F, 0x65736666, 0x00000074, 0x00070006, 0x00000038, 
+	0x00000001, 0x65646E69, 0x666F5F78, 0x74657366, 0x00000000, 0x00060006, 0x00000038, 0x00000002, 0x65646E69, 0x6F635F78, 
+	0x00746E75, 0x00070006, 0x00000038, 0x00000003, 0x74726576, 0x6F5F7865, 0x65736666, 0x00000074, 0x000B0006, 0x00000038, 
+	0x00000004, 0x74786574, 0x5F657275, 0x6E616863, 0x5F6C656E, 0x67696577, 0x6F5F7468, 0x65736666, 0x00000074, 0x000B0006, 
+	0x00000038, 0x00000005, 0x74786574, 0x5F657275, 0x6E616863, 0x5F6C656E, 0x67696577, 0x635F7468, 0x746E756F, 0x00000000, 
+	0x00080006, 0x00000038, 0x00000006, 0x646E6572, 0x745F7265, 0x65677261, 0x69735F74, 0x0000657A, 0x00050006, 0x00000038, 
+	0x00000007, 0x70616873, 0x00000065, 0x00060005, 0x00000039, 0x68737570, 0x6E6F635F, 0x6E617473, 0x00007374, 0x00060005, 
+	0x0000003F, 0x646E6957, 0x7246776F, 0x44656D61, 0x00617461, 0x00060006, 0x0000003F, 0x00000000, 0x746C756D, 0x696C7069, 
+	0x00007265, 0x00050006, 0x0000003F, 0x00000001, 0x7366666F, 0x00007465, 0x00070005, 0x00000040, 0x646E6977, 0x665F776F, 
+	0x656D6172, 0x7461645F, 0x00000061, 0x00050005, 0x00000049, 0x65786970, 0x69735F6C, 0x0000657A, 0x00060005, 0x0000004E, 
+	0x64617571, 0x6C61685F, 0x69735F66, 0x0000657A, 0x00060005, 0x00000054, 0x70616873, 0x6F635F65, 0x7364726F, 0x00000000, 
+	0x000A0005, 0x00000055, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x70616873, 0x6F635F65, 0x7364726F, 0x00000000, 
+	0x00080005, 0x00000059, 0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x6F6C6F63, 0x00000072, 0x000B0005, 0x00000060, 
+	0x67617266, 0x746E656D, 0x74756F5F, 0x5F747570, 0x70616873, 0x61705F65, 0x656D6172, 0x73726574, 0x00000000, 0x00080005, 
+	0x00000075, 0x77656976, 0x74726F70, 0x7265765F, 0x5F786574, 0x726F6F63, 0x00007364, 0x00060005, 0x00000077, 0x505F6C67, 
+	0x65567265, 0x78657472, 0x00000000, 0x00060006, 0x00000077, 0x00000000, 0x505F6C67, 0x7469736F, 0x006E6F69, 0x00070006, 
+	0x00000077, 0x00000001, 0x505F6C67, 0x746E696F, 0x657A6953, 0x00000000, 0x00070006, 0x00000077, 0x00000002, 0x435F6C67, 
+	0x4470696C, 0x61747369, 0x0065636E, 0x00070006, 0x00000077, 0x00000003, 0x435F6C67, 0x446C6C75, 0x61747369, 0x0065636E, 
+	0x00030005, 0x00000078, 0x00000000, 0x00050048, 0x00000009, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000009, 
+	0x00000001, 0x00000023, 0x00000008, 0x00050048, 0x00000009, 0x00000002, 0x00000023, 0x00000010, 0x00050048, 0x00000009, 
+	0x00000003, 0x00000023, 0x00000014, 0x00040047, 0x0000000A, 0x00000006, 0x00000018, 0x00040048, 0x0000000B, 0x00000000, 
+	0x00000018, 0x00050048, 0x0000000B, 0x00000000, 0x00000023, 0x00000000, 0x00030047, 0x0000000B, 0x00000003, 0x00040047, 
+	0x0000000C, 0x00000022, 0x00000003, 0x00040047, 0x0000000C, 0x00000021, 0x00000000, 0x00040047, 0x00000010, 0x0000000B, 
+	0x0000002B, 0x00040047, 0x00000025, 0x0000000B, 0x0000002A, 0x00050048, 0x00000038, 0x00000000, 0x00000023, 0x00000000, 
+	0x00050048, 0x00000038, 0x00000001, 0x00000023, 0x00000004, 0x00050048, 0x00000038, 0x00000002, 0x00000023, 0x00000008, 
+	0x00050048, 0x00000038, 0x00000003, 0x00000023, 0x0000000C, 0x00050048, 0x00000038, 0x00000004, 0x00000023, 0x00000010, 
+	0x00050048, 0x00000038, 0x00000005, 0x00000023, 0x00000014, 0x00050048, 0x00000038, 0x00000006, 0x00000023, 0x00000060, 
+	0x00050048, 0x00000038, 0x00000007, 0x00000023, 0x00000068, 0x00030047, 0x00000038, 0x00000002, 0x00050048, 0x0000003F, 
+	0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000003F, 0x00000001, 0x00000023, 0x00000008, 0x00030047, 0x0000003F, 
+	0x00000002, 0x00040047, 0x00000040, 0x00000022, 0x00000000, 0x00040047, 0x00000040, 0x00000021, 0x00000000, 0x00040047, 
+	0x00000055, 0x0000001E, 0x00000000, 0x00040047, 0x00000059, 0x0000001E, 0x00000001, 0x00030047, 0x00000060, 0x0000000E, 
+	0x00040047, 0x00000060, 0x0000001E, 0x00000002, 0x00050048, 0x00000077, 0x00000000, 0x0000000B, 0x00000000, 0x00050048, 
+	0x00000077, 0x00000001, 0x0000000B, 0x00000001, 0x00050048, 0x00000077, 0x00000002, 0x0000000B, 0x00000003, 0x00050048, 
+	0x00000077, 0x00000003, 0x0000000B, 0x00000004, 0x00030047, 0x00000077, 0x00000002, 0x00020013, 0x00000003, 0x00030021, 
+	0x00000004, 0x00000003, 0x00030016, 0x00000006, 0x00000020, 0x00040017, 0x00000007, 0x00000006, 0x00000002, 0x00040015, 
+	0x00000008, 0x00000020, 0x00000000, 0x0006001E, 0x00000009, 0x00000007, 0x00000007, 0x00000006, 0x00000008, 0x0003001D, 
+	0x0000000A, 0x00000009, 0x0003001E, 0x0000000B, 0x0000000A, 0x00040020, 0x0000000D, 0x00000002, 0x0000000B, 0x0004003B, 
+	0x0000000D, 0x0000000C, 0x00000002, 0x00040015, 0x0000000E, 0x00000020, 0x00000001, 0x0004002B, 0x0000000E, 0x0000000F, 
+	0x00000000, 0x00040020, 0x00000011, 0x00000001, 0x0000000E, 0x0004003B, 0x00000011, 0x00000010, 0x00000001, 0x00040020, 
+	0x00000013, 0x00000002, 0x00000009, 0x0006001E, 0x00000017, 0x00000007, 0x00000007, 0x00000006, 0x00000008, 0x00040020, 
+	0x00000018, 0x00000007, 0x00000017, 0x0004002B, 0x00000008, 0x0000001E, 0x00000000, 0x0004002B, 0x00000008, 0x0000001F, 
+	0x00000001, 0x0004002B, 0x00000008, 0x00000020, 0x00000002, 0x0004002B, 0x00000008, 0x00000021, 0x00000003, 0x0004002B, 
+	0x00000008, 0x00000022, 0x00000006, 0x0004001C, 0x00000023, 0x00000008, 0x00000022, 0x0009002C, 0x00000023, 0x00000024, 
+	0x0000001E, 0x0000001F, 0x00000020, 0x00000020, 0x0000001F, 0x00000021, 0x0004003B, 0x00000011, 0x00000025, 0x00000001, 
+	0x00040020, 0x00000028, 0x00000007, 0x00000023, 0x00040020, 0x00000029, 0x00000007, 0x00000008, 0x0004002B, 0x0000000E, 
+	0x0000002E, 0x00000001, 0x00040020, 0x00000036, 0x00000007, 0x00000007, 0x0004002B, 0x00000006, 0x00000037, 0x40000000, 
+	0x000A001E, 0x00000038, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000008, 0x00000007, 0x00000008, 
+	0x00040020, 0x0000003A, 0x00000009, 0x00000038, 0x0004003B, 0x0000003A, 0x00000039, 0x00000009, 0x0004002B, 0x0000000E, 
+	0x0000003B, 0x00000006, 0x00040020, 0x0000003C, 0x00000009, 0x00000007, 0x0004001E, 0x0000003F, 0x00000007, 0x00000007, 
+	0x00040020, 0x00000041, 0x00000002, 0x0000003F, 0x0004003B, 0x00000041, 0x00000040, 0x00000002, 0x00040020, 0x00000042, 
+	0x00000002, 0x00000007, 0x0005002C, 0x00000007, 0x00000047, 0x00000037, 0x00000037, 0x00040020, 0x00000056, 0x00000003, 
+	0x00000007, 0x0004003B, 0x00000056, 0x00000055, 0x00000003, 0x00040017, 0x00000058, 0x00000006, 0x00000004, 0x00040020, 
+	0x0000005A, 0x00000003, 0x00000058, 0x0004003B, 0x0000005A, 0x00000059, 0x00000003, 0x0004002B, 0x0000000E, 0x0000005B, 
+	0x00000003, 0x00040017, 0x0000005F, 0x00000006, 0x00000003, 0x00040020, 0x00000061, 0x00000003, 0x0000005F, 0x0004003B, 
+	0x00000061, 0x00000060, 0x00000003, 0x0004002B, 0x0000000E, 0x00000064, 0x00000002, 0x00040020, 0x00000065, 0x00000007, 
+	0x00000006, 0x0004001C, 0x00000076, 0x00000006, 0x0000001F, 0x0006001E, 0x00000077, 0x00000058, 0x00000006, 0x00000076, 
+	0x00000076, 0x00040020, 0x00000079, 0x00000003, 0x00000077, 0x0004003B, 0x00000079, 0x00000078, 0x00000003, 0x0004002B, 
+	0x00000006, 0x0000007B, 0x3F000000, 0x0004002B, 0x00000006, 0x0000007C, 0x3F800000, 0x00050036, 0x00000003, 0x00000002, 
+	0x00000000, 0x00000004, 0x000200F8, 0x00000005, 0x0004003B, 0x00000018, 0x00000016, 0x00000007, 0x0004003B, 0x00000028, 
+	0x00000027, 0x00000007, 0x0004003B, 0x00000029, 0x0000002C, 0x00000007, 0x0004003B, 0x00000036, 0x00000035, 0x00000007, 
+	0x0004003B, 0x00000036, 0x00000049, 0x00000007, 0x0004003B, 0x00000036, 0x0000004E, 0x00000007, 0x0004003B, 0x00000036, 
+	0x00000054, 0x00000007, 0x0004003B, 0x00000036, 0x00000075, 0x00000007, 0x0004003D, 0x0000000E, 0x00000012, 0x00000010, 
+	0x00060041, 0x00000013, 0x00000014, 0x0000000C, 0x0000000F, 0x00000012, 0x0004003D, 0x00000009, 0x00000015, 0x00000014, 
+	0x00050051, 0x00000007, 0x00000019, 0x00000015, 0x00000000, 0x00050051, 0x00000007, 0x0000001A, 0x00000015, 0x00000001, 
+	0x00050051, 0x00000006, 0x0000001B, 0x00000015, 0x00000002, 0x00050051, 0x00000008, 0x0000001C, 0x00000015, 0x00000003, 
+	0x00070050, 0x00000017, 0x0000001D, 0x00000019, 0x0000001A, 0x0000001B, 0x0000001C, 0x0003003E, 0x00000016, 0x0000001D, 
+	0x0004003D, 0x0000000E, 0x00000026, 0x00000025, 0x0003003E, 0x00000027, 0x00000024, 0x00050041, 0x00000029, 0x0000002A, 
+	0x00000027, 0x00000026, 0x0004003D, 0x00000008, 0x0000002B, 0x0000002A, 0x0003003E, 0x0000002C, 0x0000002B, 0x0004003D, 
+	0x00000008, 0x0000002D, 0x0000002C, 0x000500C7, 0x00000008, 0x0000002F, 0x0000002D, 0x0000001F, 0x00040070, 0x00000006, 
+	0x00000030, 0x0000002F, 0x0004003D, 0x00000008, 0x00000031, 0x0000002C, 0x000500C2, 0x00000008, 0x00000032, 0x00000031, 
+	0x0000002E, 0x00040070, 0x00000006, 0x00000033, 0x00000032, 0x00050050, 0x00000007, 0x00000034, 0x00000030, 0x00000033, 
+	0x0003003E, 0x00000035, 0x00000034, 0x00050041, 0x0000003C, 0x0000003D, 0x00000039, 0x0000003B, 0x0004003D, 0x00000007, 
+	0x0000003E, 0x0000003D, 0x00050041, 0x00000042, 0x00000043, 0x00000040, 0x0000000F, 0x0004003D, 0x00000007, 0x00000044, 
+	0x00000043, 0x0006000C, 0x00000007, 0x00000045, 0x00000001, 0x00000004, 0x00000044, 0x00050085, 0x00000007, 0x00000046, 
+	0x0000003E, 0x00000045, 0x00050088, 0x00000007, 0x00000048, 0x00000047, 0x00000046, 0x0003003E, 0x00000049, 0x00000048, 
+	0x00050041, 0x00000036, 0x0000004A, 0x00000016, 0x0000002E, 0x0004003D, 0x00000007, 0x0000004B, 0x0000004A, 0x0004003D, 
+	0x00000007, 0x0000004C, 0x00000049, 0x00050081, 0x00000007, 0x0000004D, 0x0000004B, 0x0000004C, 0x0003003E, 0x0000004E, 
+	0x0000004D, 0x0004003D, 0x00000007, 0x0000004F, 0x0000004E, 0x0004007F, 0x00000007, 0x00000050, 0x0000004F, 0x0004003D, 
+	0x00000007, 0x00000051, 0x0000004E, 0x0004003D, 0x00000007, 0x00000052, 0x00000035, 0x0008000C, 0x00000007, 0x00000053, 
+	0x00000001, 0x0000002E, 0x00000050, 0x00000051, 0x00000052, 0x0003003E, 0x00000054, 0x00000053, 0x0004003D, 0x00000007, 
+	0x00000057, 0x00000054, 0x0003003E, 0x00000055, 0x00000057, 0x00050041, 0x00000029, 0x0000005C, 0x00000016, 0x0000005B, 
+	0x0004003D, 0x00000008, 0x0000005D, 0x0000005C, 0x0006000C, 0x00000058, 0x0000005E, 0x00000001, 0x00000040, 0x0000005D, 
+	0x0003003E, 0x00000059, 0x0000005E, 0x00050041, 0x00000036, 0x00000062, 0x00000016, 0x0000002E, 0x0004003D, 0x00000007, 
+	0x00000063, 0x00000062, 0x00050041, 0x00000065, 0x00000066, 0x00000016, 0x00000064, 0x0004003D, 0x00000006, 0x00000067, 
+	0x00000066, 0x00050051, 0x00000006, 0x00000068, 0x00000063, 0x00000000, 0x00050051, 0x00000006, 0x00000069, 0x00000063, 
+	0x00000001, 0x00060050, 0x0000005F, 0x0000006A, 0x00000068, 0x00000069, 0x00000067, 0x0003003E, 0x00000060, 0x0000006A, 
+	0x00050041, 0x00000036, 0x0000006B, 0x00000016, 0x0000000F, 0x0004003D, 0x00000007, 0x0000006C, 0x0000006B, 0x0004003D, 
+	0x00000007, 0x0000006D, 0x00000054, 0x00050081, 0x00000007, 0x0000006E, 0x0000006C, 0x0000006D, 0x00050041, 0x00000042, 
+	0x0000006F, 0x00000040, 0x0000000F, 0x0004003D, 0x00000007, 0x00000070, 0x0000006F, 0x00050085, 0x00000007, 0x00000071, 
+	0x0000006E, 0x00000070, 0x00050041, 0x00000042, 0x00000072, 0x00000040, 0x0000002E, 0x0004003D, 0x00000007, 0x00000073, 
+	0x00000072, 0x00050081, 0x00000007, 0x00000074, 0x00000071, 0x00000073, 0x0003003E, 0x00000075, 0x00000074, 0x0004003D, 
+	0x00000007, 0x0000007A, 0x00000075, 0x00050051, 0x00000006, 0x0000007D, 0x0000007A, 0x00000000, 0x00050051, 0x00000006, 
+	0x0000007E, 0x0000007A, 0x00000001, 0x00070050, 0x00000058, 0x0000007F, 0x0000007D, 0x0000007E, 0x0000007B, 0x0000007C, 
+	0x00050041, 0x0000005A, 0x00000080, 0x00000078, 0x0000000F, 0x0003003E, 0x00000080, 0x0000007F, 0x000100FD, 0x00010038
+};
@@ -8,6 +8,7 @@
 #include "system/QueueResolver.h"
 #include "system/ThreadPool.h"
 #include "system/ThreadPrivateResources.h"
+#include "system/ParallelWork.h"
 #include "system/DescriptorSet.h"
 
 #include "interface/Instance.h"
@@ -22,6 +23,9 @@
 #include "interface/Sampler.h"
 #include "interface/SamplerImpl.h"
 
+#include "interface/ParticleSystem.h"
+#include "interface/ParticleSystemImpl.h"
+
 #include "interface/resources/TextureResource.h"
 #include "interface/resources/TextureResourceImpl.h"
 
@@ -286,6 +290,20 @@ VK2D_API void vk2d::Instance::DestroySampler(
 	impl->DestroySampler( sampler );
 }
 
+VK2D_API vk2d::ParticleSystem * vk2d::Instance::CreateParticleSystem(
+	const ParticleSystemCreateInfo	&	particle_system_create_info
+)
+{
+	return impl->CreateParticleSystem( particle_system_create_info );
+}
+
+VK2D_API void vk2d::Instance::DestroyParticleSystem(
+	ParticleSystem					*	particle_system
+)
+{
+	impl->DestroyParticleSystem( particle_system );
+}
+
 VK2D_API vk2d::Multisamples vk2d::Instance::GetMaximumSupportedMultisampling()
 {
 	return impl->GetMaximumSupportedMultisampling();
@@ -359,6 +377,13 @@ vk2d::vk2d_internal::InstanceImpl::InstanceImpl(
 		glfwSetMonitorCallback( glfwMonitorCallback );
 		glfwSetJoystickCallback( glfwJoystickEventCallback );
 		UpdateMonitorLists( true );
+
+		// Parallel work runs on the calling thread if this fails so it's not fatal.
+		if( !CreateParallelWorkThreads() ) {
+			if( instance_create_info.report_function ) {
+				instance_create_info.report_function( ReportSeverity::WARNING, "Internal error: Cannot create parallel work threads!" );
+			}
+		}
 	}
 	++instance_count;
 
@@ -414,6 +439,7 @@ vk2d::vk2d_internal::InstanceImpl::InstanceImpl(
 	if( !CreatePipelineCache() ) return;
 	if( !CreateShaderModules() ) return;
 	if( !CreatePipelineLayouts() ) return;
+	if( !CreatePipelines() ) return;
 	if( !CreateDeviceMemoryPool() ) return;
 	if( !CreateThreadPool() ) return;
 	if( !CreateResourceManager() ) return;
@@ -437,6 +463,7 @@ vk2d::vk2d_internal::InstanceImpl::~InstanceImpl()
 
 	windows.clear();
 	render_target_textures.clear();
+	particle_systems.clear();
 	cursors.clear();
 	samplers.clear();
 
@@ -458,6 +485,7 @@ vk2d::vk2d_internal::InstanceImpl::~InstanceImpl()
 	// If this is the last instance exiting, also terminate glfw
 	--instance_count;
 	if( instance_count == 0 ) {
+		DestroyParallelWorkThreads();
 		glfwTerminate();
 	}
 }
@@ -824,6 +852,59 @@ void vk2d::vk2d_internal::InstanceImpl::DestroySampler(
 	}
 }
 
+vk2d::ParticleSystem * vk2d::vk2d_internal::InstanceImpl::CreateParticleSystem(
+	const ParticleSystemCreateInfo	&	particle_system_create_info
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( this );
+
+	if( !IsThisThreadCreatorThread() ) {
+		Report( ReportSeverity::WARNING, "Instance::CreateParticleSystem() must be called from main thread only!" );
+		return {};
+	}
+
+	auto particle_system	= std::unique_ptr<ParticleSystem>(
+		new ParticleSystem( this, particle_system_create_info )
+		);
+
+	if( particle_system && particle_system->IsGood() ) {
+		auto ret	= particle_system.get();
+		particle_systems.push_back( std::move( particle_system ) );
+		return ret;
+	} else {
+		return nullptr;
+	}
+}
+
+void vk2d::vk2d_internal::InstanceImpl::DestroyParticleSystem(
+	ParticleSystem			*	particle_system
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( this );
+
+	if( !IsThisThreadCreatorThread() ) {
+		Report( ReportSeverity::WARNING, "Instance::DestroyParticleSystem() must be called from main thread only!" );
+		return;
+	}
+
+	auto result = vkDeviceWaitIdle(
+		vk_device
+	);
+	if( result != VK_SUCCESS ) {
+		Report( result, "Cannot destroy particle system, error waiting device!" );
+	}
+
+	auto it = particle_systems.begin();
+	while( it != particle_systems.end() ) {
+		if( it->get() == particle_system ) {
+			it = particle_systems.erase( it );
+			break;
+		} else {
+			++it;
+		}
+	}
+}
+
 vk2d::Multisamples vk2d::vk2d_internal::InstanceImpl::GetMaximumSupportedMultisampling() const
 {
 	VK2D_ASSERT_MAIN_THREAD( this );
@@ -990,6 +1071,24 @@ vk2d::ResourceManager * vk2d::vk2d_internal::InstanceImpl::GetResourceManager()
 	return resource_manager.get();
 }
 
+void vk2d::vk2d_internal::InstanceImpl::FlushPendingFontGlyphs()
+{
+	VK2D_ASSERT_MAIN_THREAD( this );
+
+	resource_manager->impl->FlushPendingFontGlyphs();
+}
+
+bool vk2d::vk2d_internal::InstanceImpl::CmdUploadPendingFontGlyphs(
+	VkCommandBuffer								command_buffer,
+	std::vector<CompleteBufferResource>		&	out_staging_buffers,
+	std::vector<TextureResource*>			&	out_retired_texture_resources
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( this );
+
+	return resource_manager->impl->CmdUploadPendingFontGlyphs( command_buffer, out_staging_buffers, out_retired_texture_resources );
+}
+
 VkInstance vk2d::vk2d_internal::InstanceImpl::GetVulkanInstance() const
 {
 	return vk_instance;
@@ -1420,6 +1519,31 @@ VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetGraphicsBlurPipelineLayou
 	return vk_graphics_blur_pipeline_layout;
 }
 
+VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetComputeMipmapDownsamplePipelineLayout() const
+{
+	return vk_compute_mipmap_downsample_pipeline_layout;
+}
+
+VkPipeline vk2d::vk2d_internal::InstanceImpl::GetComputeMipmapDownsamplePipeline() const
+{
+	return vk_compute_mipmap_downsample_pipeline;
+}
+
+VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetComputeBlurPipelineLayout() const
+{
+	return vk_compute_blur_pipeline_layout;
+}
+
+VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetComputeDualKawasePipelineLayout() const
+{
+	return vk_compute_dual_kawase_pipeline_layout;
+}
+
+VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetComputeParticlePipelineLayout() const
+{
+	return vk_compute_particle_pipeline_layout;
+}
+
 /*
 VkPipelineLayout vk2d::vk2d_internal::InstanceImpl::GetComputeBlurPipelineLayout() const
 {
@@ -1452,6 +1576,11 @@ const vk2d::vk2d_internal::DescriptorSetLayout & vk2d::vk2d_internal::InstanceIm
 	return *graphics_render_target_blur_texture_descriptor_set_layout;
 }
 
+const vk2d::vk2d_internal::DescriptorSetLayout & vk2d::vk2d_internal::InstanceImpl::GetComputeMipmapDownsampleDescriptorSetLayout() const
+{
+	return *compute_mipmap_downsample_descriptor_set_layout;
+}
+
 const vk2d::vk2d_internal::DescriptorSetLayout & vk2d::vk2d_internal::InstanceImpl::GetGraphicsUniformBufferDescriptorSetLayout() const
 {
 	return *graphics_uniform_buffer_descriptor_set_layout;
@@ -1477,6 +1606,11 @@ VkDescriptorSet vk2d::vk2d_internal::InstanceImpl::GetBlurSamplerDescriptorSet()
 	return blur_sampler_descriptor_set.descriptorSet;
 }
 
+vk2d::Sampler * vk2d::vk2d_internal::InstanceImpl::GetBlurSampler() const
+{
+	return blur_sampler.get();
+}
+
 vk2d::vk2d_internal::DeviceMemoryPool * vk2d::vk2d_internal::InstanceImpl::GetDeviceMemoryPool() const
 {
 	return device_memory_pool.get();
@@ -2049,6 +2183,58 @@ bool vk2d::vk2d_internal::InstanceImpl::CreateShaderModules()
 
 
 
+		// Create individual shader modules for signed distance field text entries.
+		auto signed_distance_field_fragment						= CreateModule(
+			SignedDistanceFieldFragment_frag_shader_data.data(),
+			SignedDistanceFieldFragment_frag_shader_data.size()
+		);
+		auto signed_distance_field_fragment_with_effects		= CreateModule(
+			SignedDistanceFieldFragmentWithEffects_frag_shader_data.data(),
+			SignedDistanceFieldFragmentWithEffects_frag_shader_data.size()
+		);
+
+
+
+		// Create individual shader modules for instanced glyph entries.
+		auto glyph_instance_vertex								= CreateModule(
+			GlyphInstanceVertex_vert_shader_data.data(),
+			GlyphInstanceVertex_vert_shader_data.size()
+		);
+
+
+
+		// Create individual shader modules for instanced shape entries.
+		auto shape_instance_vertex								= CreateModule(
+			ShapeInstanceVertex_vert_shader_data.data(),
+			ShapeInstanceVertex_vert_shader_data.size()
+		);
+		auto shape_instance_fragment							= CreateModule(
+			ShapeInstanceFragment_frag_shader_data.data(),
+			ShapeInstanceFragment_frag_shader_data.size()
+		);
+
+
+
+		// Create individual shader modules for polyline entries.
+		auto polyline_vertex									= CreateModule(
+			PolylineVertex_vert_shader_data.data(),
+			PolylineVertex_vert_shader_data.size()
+		);
+		auto polyline_fragment									= CreateModule(
+			PolylineFragment_frag_shader_data.data(),
+			PolylineFragment_frag_shader_data.size()
+		);
+
+
+
+		// Create individual shader modules for particle entries.
+		auto particle_vertex									= CreateModule(
+			ParticleVertex_vert_shader_data.data(),
+			ParticleVertex_vert_shader_data.size()
+		);
+
+
+
 		// Create individual shader modules for single textured entries.
 		auto multitextured_vertex								= CreateModule(
 			MultitexturedVertex_vert_shader_data.data(),
@@ -2113,6 +2299,17 @@ bool vk2d::vk2d_internal::InstanceImpl::CreateShaderModules()
 		vk_graphics_shader_modules.push_back( single_textured_fragment );
 		vk_graphics_shader_modules.push_back( single_textured_fragment_uv_border_color );
 
+		vk_graphics_shader_modules.push_back( signed_distance_field_fragment );
+		vk_graphics_shader_modules.push_back( signed_distance_field_fragment_with_effects );
+
+		vk_graphics_shader_modules.push_back( glyph_instance_vertex );
+
+		vk_graphics_shader_modules.push_back( shape_instance_vertex );
+		vk_graphics_shader_modules.push_back( shape_instance_fragment );
+
+		vk_graphics_shader_modules.push_back( polyline_vertex );
+		vk_graphics_shader_modules.push_back( polyline_fragment );
+
 		vk_graphics_shader_modules.push_back( multitextured_vertex );
 		vk_graphics_shader_modules.push_back( multitextured_fragment_triangle );
 		vk_graphics_shader_modules.push_back( multitextured_fragment_line );
@@ -2131,6 +2328,18 @@ bool vk2d::vk2d_internal::InstanceImpl::CreateShaderModules()
 		graphics_shader_programs[ GraphicsShaderProgramID::SINGLE_TEXTURED ]								= GraphicsShaderProgram( single_textured_vertex, single_textured_fragment );
 		graphics_shader_programs[ GraphicsShaderProgramID::SINGLE_TEXTURED_UV_BORDER_COLOR ]				= GraphicsShaderProgram( single_textured_vertex, single_textured_fragment_uv_border_color );
 
+		graphics_shader_programs[ GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD ]							= GraphicsShaderProgram( single_textured_vertex, signed_distance_field_fragment );
+		graphics_shader_programs[ GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD_WITH_EFFECTS ]			= GraphicsShaderProgram( single_textured_vertex, signed_distance_field_fragment_with_effects );
+
+		graphics_shader_programs[ GraphicsShaderProgramID::GLYPH_INSTANCE ]								= GraphicsShaderProgram( glyph_instance_vertex, single_textured_fragment );
+		graphics_shader_programs[ GraphicsShaderProgramID::GLYPH_INSTANCE_SIGNED_DISTANCE_FIELD ]			= GraphicsShaderProgram( glyph_instance_vertex, signed_distance_field_fragment );
+
+		graphics_shader_programs[ GraphicsShaderProgramID::SHAPE_INSTANCE ]								= GraphicsShaderProgram( shape_instance_vertex, shape_instance_fragment );
+
+		graphics_shader_programs[ GraphicsShaderProgramID::POLYLINE ]										= GraphicsShaderProgram( polyline_vertex, polyline_fragment );
+
+		graphics_shader_programs[ GraphicsShaderProgramID::PARTICLE ]										= GraphicsShaderProgram( particle_vertex, single_textured_fragment );
+
 		graphics_shader_programs[ GraphicsShaderProgramID::MULTITEXTURED_TRIANGLE ]						= GraphicsShaderProgram( multitextured_vertex, multitextured_fragment_triangle );
 		graphics_shader_programs[ GraphicsShaderProgramID::MULTITEXTURED_LINE ]							= GraphicsShaderProgram( multitextured_vertex, multitextured_fragment_line );
 		graphics_shader_programs[ GraphicsShaderProgramID::MULTITEXTURED_POINT ]							= GraphicsShaderProgram( multitextured_vertex, multitextured_fragment_point );
@@ -2151,7 +2360,59 @@ bool vk2d::vk2d_internal::InstanceImpl::CreateShaderModules()
 	////////////////////////////////
 
 	{
-		// Nothing yet.
+		auto mipmap_downsample									= CreateModule(
+			MipmapDownsample_comp_shader_data.data(),
+			MipmapDownsample_comp_shader_data.size()
+		);
+
+		vk_compute_shader_modules.push_back( mipmap_downsample );
+
+		compute_shader_programs[ ComputeShaderProgramID::MIPMAP_DOWNSAMPLE ]								= mipmap_downsample;
+	}
+
+	{
+		auto render_target_texture_blur							= CreateModule(
+			RenderTargetTextureBlurCompute_comp_shader_data.data(),
+			RenderTargetTextureBlurCompute_comp_shader_data.size()
+		);
+
+		vk_compute_shader_modules.push_back( render_target_texture_blur );
+
+		compute_shader_programs[ ComputeShaderProgramID::RENDER_TARGET_BLUR ]								= render_target_texture_blur;
+	}
+
+	{
+		auto render_target_texture_dual_kawase_downsample		= CreateModule(
+			RenderTargetTextureDualKawaseDownsample_comp_shader_data.data(),
+			RenderTargetTextureDualKawaseDownsample_comp_shader_data.size()
+		);
+		auto render_target_texture_dual_kawase_upsample			= CreateModule(
+			RenderTargetTextureDualKawaseUpsample_comp_shader_data.data(),
+			RenderTargetTextureDualKawaseUpsample_comp_shader_data.size()
+		);
+
+		vk_compute_shader_modules.push_back( render_target_texture_dual_kawase_downsample );
+		vk_compute_shader_modules.push_back( render_target_texture_dual_kawase_upsample );
+
+		compute_shader_programs[ ComputeShaderProgramID::RENDER_TARGET_DUAL_KAWASE_DOWNSAMPLE ]			= render_target_texture_dual_kawase_downsample;
+		compute_shader_programs[ ComputeShaderProgramID::RENDER_TARGET_DUAL_KAWASE_UPSAMPLE ]				= render_target_texture_dual_kawase_upsample;
+	}
+
+	{
+		auto particle_emit										= CreateModule(
+			ParticleEmit_comp_shader_data.data(),
+			ParticleEmit_comp_shader_data.size()
+		);
+		auto particle_simulate									= CreateModule(
+			ParticleSimulate_comp_shader_data.data(),
+			ParticleSimulate_comp_shader_data.size()
+		);
+
+		vk_compute_shader_modules.push_back( particle_emit );
+		vk_compute_shader_modules.push_back( particle_simulate );
+
+		compute_shader_programs[ ComputeShaderProgramID::PARTICLE_EMIT ]									= particle_emit;
+		compute_shader_programs[ ComputeShaderProgramID::PARTICLE_SIMULATE ]								= particle_simulate;
 	}
 
 
@@ -2303,6 +2564,71 @@ bool vk2d::vk2d_internal::InstanceImpl::CreateDescriptorSetLayouts()
 		}
 	}
 
+	// Compute: Descriptor set layout for mipmap downsample.
+	// Binding 0 = Source mip level as storage image
+	// Binding 1 to 4 = Destination mip levels as storage images
+	{
+		compute_mipmap_downsample_descriptor_set_layout = CreateLocalDescriptorSetLayout(
+			{
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT }
+			},
+			VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+		);
+		if( !compute_mipmap_downsample_descriptor_set_layout ) {
+			return false;
+		}
+	}
+
+	// Compute: Descriptor set layout for render target texture blur.
+	// Binding 0 = Source image as storage image
+	// Binding 1 = Destination image as storage image
+	{
+		compute_blur_descriptor_set_layout = CreateLocalDescriptorSetLayout(
+			{
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT }
+			},
+			VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+		);
+		if( !compute_blur_descriptor_set_layout ) {
+			return false;
+		}
+	}
+
+	// Compute: Descriptor set layout for render target texture dual Kawase blur.
+	// Binding 0 = Source mip level with sampler
+	// Binding 1 = Destination mip level as storage image
+	{
+		compute_dual_kawase_descriptor_set_layout = CreateLocalDescriptorSetLayout(
+			{
+				{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, VK_SHADER_STAGE_COMPUTE_BIT },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, VK_SHADER_STAGE_COMPUTE_BIT }
+			},
+			VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+		);
+		if( !compute_dual_kawase_descriptor_set_layout ) {
+			return false;
+		}
+	}
+
+	// Compute: Descriptor set layout for particle systems.
+	// Binding 0 = Particle buffer
+	{
+		compute_particle_descriptor_set_layout = CreateLocalDescriptorSetLayout(
+			{
+				{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT }
+			},
+			VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR
+		);
+		if( !compute_particle_descriptor_set_layout ) {
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -2335,7 +2661,15 @@ bool vk2d::vk2d_internal::InstanceImpl::CreatePipelineLayouts()
 		std::array<VkPushConstantRange, 1> push_constant_ranges {};
 		push_constant_ranges[ 0 ].stageFlags	= VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT;
 		push_constant_ranges[ 0 ].offset		= 0;
-		push_constant_ranges[ 0 ].size			= uint32_t( sizeof( GraphicsPrimaryRenderPushConstants ) );
+		push_constant_ranges[ 0 ].size			= uint32_t( GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsGlyphInstancePushConstants ) );
+
+		static_assert( sizeof( GraphicsPrimaryRenderPushConstants ) <= GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET );
+		static_assert( GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET + sizeof( GraphicsSignedDistanceFieldPushConstants ) <= GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET );
+		static_assert( GRAPHICS_PRIMARY_RENDER_SHAPE_INSTANCE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsShapeInstancePushConstants ) <= GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsGlyphInstancePushConstants ) );
+		static_assert( GRAPHICS_PRIMARY_RENDER_POLYLINE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsPolylinePushConstants ) <= GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsGlyphInstancePushConstants ) );
+
+		// Vulkan guarantees only 128 bytes of push constants.
+		static_assert( GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET + sizeof( GraphicsGlyphInstancePushConstants ) <= 128 );
 
 		VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
 		pipeline_layout_create_info.sType					= VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
@@ -2392,6 +2726,160 @@ bool vk2d::vk2d_internal::InstanceImpl::CreatePipelineLayouts()
 		}
 	}
 
+	// Compute mipmap downsample pipeline layout.
+	{
+		// This must match shader layout.
+		std::vector<VkDescriptorSetLayout> set_layouts {
+			compute_mipmap_downsample_descriptor_set_layout->GetVulkanDescriptorSetLayout(),		// Pipeline set 0 is source and destination mip levels.
+		};
+
+		std::array<VkPushConstantRange, 1> push_constant_ranges {};
+		push_constant_ranges[ 0 ].stageFlags	= VK_SHADER_STAGE_COMPUTE_BIT;
+		push_constant_ranges[ 0 ].offset		= 0;
+		push_constant_ranges[ 0 ].size			= uint32_t( sizeof( ComputeMipmapDownsamplePushConstants ) );
+
+		VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+		pipeline_layout_create_info.sType					= VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipeline_layout_create_info.pNext					= nullptr;
+		pipeline_layout_create_info.flags					= 0;
+		pipeline_layout_create_info.setLayoutCount			= uint32_t( set_layouts.size() );
+		pipeline_layout_create_info.pSetLayouts				= set_layouts.data();
+		pipeline_layout_create_info.pushConstantRangeCount	= uint32_t( push_constant_ranges.size() );
+		pipeline_layout_create_info.pPushConstantRanges		= push_constant_ranges.data();
+
+		auto result = vkCreatePipelineLayout(
+			vk_device,
+			&pipeline_layout_create_info,
+			nullptr,
+			&vk_compute_mipmap_downsample_pipeline_layout
+		);
+		if( result != VK_SUCCESS ) {
+			Report( result, "Internal error: Cannot create Vulkan pipeline layout!" );
+			return false;
+		}
+	}
+
+	// Compute render target texture blur pipeline layout.
+	{
+		// This must match shader layout.
+		std::vector<VkDescriptorSetLayout> set_layouts {
+			compute_blur_descriptor_set_layout->GetVulkanDescriptorSetLayout(),		// Pipeline set 0 is source and destination images.
+		};
+
+		std::array<VkPushConstantRange, 1> push_constant_ranges {};
+		push_constant_ranges[ 0 ].stageFlags	= VK_SHADER_STAGE_COMPUTE_BIT;
+		push_constant_ranges[ 0 ].offset		= 0;
+		push_constant_ranges[ 0 ].size			= uint32_t( sizeof( ComputeBlurPushConstants ) );
+
+		VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+		pipeline_layout_create_info.sType					= VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipeline_layout_create_info.pNext					= nullptr;
+		pipeline_layout_create_info.flags					= 0;
+		pipeline_layout_create_info.setLayoutCount			= uint32_t( set_layouts.size() );
+		pipeline_layout_create_info.pSetLayouts				= set_layouts.data();
+		pipeline_layout_create_info.pushConstantRangeCount	= uint32_t( push_constant_ranges.size() );
+		pipeline_layout_create_info.pPushConstantRanges		= push_constant_ranges.data();
+
+		auto result = vkCreatePipelineLayout(
+			vk_device,
+			&pipeline_layout_create_info,
+			nullptr,
+			&vk_compute_blur_pipeline_layout
+		);
+		if( result != VK_SUCCESS ) {
+			Report( result, "Internal error: Cannot create Vulkan pipeline layout!" );
+			return false;
+		}
+	}
+
+	// Compute render target texture dual Kawase blur pipeline layout, shared by downsample and upsample.
+	{
+		// This must match shader layout.
+		std::vector<VkDescriptorSetLayout> set_layouts {
+			compute_dual_kawase_descriptor_set_layout->GetVulkanDescriptorSetLayout(),		// Pipeline set 0 is source and destination mip levels.
+		};
+
+		std::array<VkPushConstantRange, 1> push_constant_ranges {};
+		push_constant_ranges[ 0 ].stageFlags	= VK_SHADER_STAGE_COMPUTE_BIT;
+		push_constant_ranges[ 0 ].offset		= 0;
+		push_constant_ranges[ 0 ].size			= uint32_t( sizeof( ComputeDualKawasePushConstants ) );
+
+		VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+		pipeline_layout_create_info.sType					= VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipeline_layout_create_info.pNext					= nullptr;
+		pipeline_layout_create_info.flags					= 0;
+		pipeline_layout_create_info.setLayoutCount			= uint32_t( set_layouts.size() );
+		pipeline_layout_create_info.pSetLayouts				= set_layouts.data();
+		pipeline_layout_create_info.pushConstantRangeCount	= uint32_t( push_constant_ranges.size() );
+		pipeline_layout_create_info.pPushConstantRanges		= push_constant_ranges.data();
+
+		auto result = vkCreatePipelineLayout(
+			vk_device,
+			&pipeline_layout_create_info,
+			nullptr,
+			&vk_compute_dual_kawase_pipeline_layout
+		);
+		if( result != VK_SUCCESS ) {
+			Report( result, "Internal error: Cannot create Vulkan pipeline layout!" );
+			return false;
+		}
+	}
+
+	// Compute particle pipeline layout, shared by particle emission and simulation.
+	{
+		// This must match shader layout.
+		std::vector<VkDescriptorSetLayout> set_layouts {
+			compute_particle_descriptor_set_layout->GetVulkanDescriptorSetLayout(),		// Pipeline set 0 is the particle buffer.
+		};
+
+		std::array<VkPushConstantRange, 1> push_constant_ranges {};
+		push_constant_ranges[ 0 ].stageFlags	= VK_SHADER_STAGE_COMPUTE_BIT;
+		push_constant_ranges[ 0 ].offset		= 0;
+		push_constant_ranges[ 0 ].size			= uint32_t( std::max( sizeof( ComputeParticleEmitPushConstants ), sizeof( ComputeParticleSimulatePushConstants ) ) );
+		static_assert( sizeof( ComputeParticleEmitPushConstants ) <= 128, "Must fit in the minimum guaranteed push constant size." );
+
+		VkPipelineLayoutCreateInfo pipeline_layout_create_info {};
+		pipeline_layout_create_info.sType					= VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipeline_layout_create_info.pNext					= nullptr;
+		pipeline_layout_create_info.flags					= 0;
+		pipeline_layout_create_info.setLayoutCount			= uint32_t( set_layouts.size() );
+		pipeline_layout_create_info.pSetLayouts				= set_layouts.data();
+		pipeline_layout_create_info.pushConstantRangeCount	= uint32_t( push_constant_ranges.size() );
+		pipeline_layout_create_info.pPushConstantRanges		= push_constant_ranges.data();
+
+		auto result = vkCreatePipelineLayout(
+			vk_device,
+			&pipeline_layout_create_info,
+			nullptr,
+			&vk_compute_particle_pipeline_layout
+		);
+		if( result != VK_SUCCESS ) {
+			Report( result, "Internal error: Cannot create Vulkan pipeline layout!" );
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool vk2d::vk2d_internal::InstanceImpl::CreatePipelines()
+{
+	// Most pipelines are created on demand from the main thread, pipelines
+	// needed by resource loader threads are created here ahead of time.
+
+	// Compute mipmap downsample pipeline.
+	{
+		ComputePipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= vk_compute_mipmap_downsample_pipeline_layout;
+		pipeline_settings.vk_shader_program		= GetComputeShaderModules( ComputeShaderProgramID::MIPMAP_DOWNSAMPLE );
+
+		vk_compute_mipmap_downsample_pipeline	= GetComputePipeline( pipeline_settings );
+		if( !vk_compute_mipmap_downsample_pipeline ) {
+			Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot create mipmap downsample compute pipeline!" );
+			return false;
+		}
+	}
+
 	return true;
 }
 
@@ -2568,6 +3056,7 @@ void vk2d::vk2d_internal::InstanceImpl::DestroyPipelines()
 		);
 	}
 	vk_compute_pipelines.clear();
+	vk_compute_mipmap_downsample_pipeline	= {};
 }
 
 void vk2d::vk2d_internal::InstanceImpl::DestroyShaderModules()
@@ -2601,6 +3090,10 @@ void vk2d::vk2d_internal::InstanceImpl::DestroyDescriptorSetLayouts()
 	graphics_render_target_blur_texture_descriptor_set_layout	= nullptr;
 	graphics_uniform_buffer_descriptor_set_layout				= nullptr;
 	graphics_storage_buffer_descriptor_set_layout				= nullptr;
+	compute_mipmap_downsample_descriptor_set_layout				= nullptr;
+	compute_blur_descriptor_set_layout							= nullptr;
+	compute_dual_kawase_descriptor_set_layout					= nullptr;
+	compute_particle_descriptor_set_layout						= nullptr;
 }
 
 void vk2d::vk2d_internal::InstanceImpl::DestroyPipelineLayouts()
@@ -2618,6 +3111,34 @@ void vk2d::vk2d_internal::InstanceImpl::DestroyPipelineLayouts()
 		nullptr
 	);
 	vk_graphics_blur_pipeline_layout = {};
+
+	vkDestroyPipelineLayout(
+		vk_device,
+		vk_compute_mipmap_downsample_pipeline_layout,
+		nullptr
+	);
+	vk_compute_mipmap_downsample_pipeline_layout = {};
+
+	vkDestroyPipelineLayout(
+		vk_device,
+		vk_compute_blur_pipeline_layout,
+		nullptr
+	);
+	vk_compute_blur_pipeline_layout = {};
+
+	vkDestroyPipelineLayout(
+		vk_device,
+		vk_compute_dual_kawase_pipeline_layout,
+		nullptr
+	);
+	vk_compute_dual_kawase_pipeline_layout = {};
+
+	vkDestroyPipelineLayout(
+		vk_device,
+		vk_compute_particle_pipeline_layout,
+		nullptr
+	);
+	vk_compute_particle_pipeline_layout = {};
 }
 
 void vk2d::vk2d_internal::InstanceImpl::DestroyDeviceMemoryPool()
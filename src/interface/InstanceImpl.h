@@ -8,6 +8,7 @@
 #include "system/QueueResolver.h"
 #include "system/DescriptorSet.h"
 #include "system/ShaderInterface.h"
+#include "system/VulkanMemoryManagement.h"
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
@@ -22,6 +23,7 @@ class Cursor;
 class ResourceManager;
 class TextureResource;
 class Sampler;
+class ParticleSystem;
 class RenderTargetTexture;
 
 namespace vk2d_internal {
@@ -177,6 +179,16 @@ public:
 	void													DestroySampler(
 		Sampler									*	sampler );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @see		Instance::CreateParticleSystem()
+	ParticleSystem								*	CreateParticleSystem(
+		const ParticleSystemCreateInfo			&	particle_system_create_info );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @see		Instance::DestroyParticleSystem()
+	void													DestroyParticleSystem(
+		ParticleSystem							*	particle_system );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @see		Instance::GetMaximumSupportedMultisampling()
 	Multisamples										GetMaximumSupportedMultisampling() const;
@@ -275,6 +287,38 @@ public:
 	/// @see		Instance::GetResourceManager()
 	ResourceManager								*	GetResourceManager() const;
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Upload glyphs that were rasterized into dynamic glyph cache fonts since the previous call.
+	///
+	///				Called at the beginning of every frame so that new glyphs are uploaded in batches instead of once per
+	///				glyph.
+	///
+	/// @note		Multithreading: Main thread only.
+	void													FlushPendingFontGlyphs();
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record copies of glyphs that were rasterized into dynamic glyph cache fonts since the previous call.
+	///
+	///				Glyphs are copied into the existing font textures, only the changed atlas regions are uploaded.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	command_buffer
+	///				Command buffer in the primary render queue, outside of a render pass.
+	///
+	/// @param[out]	out_staging_buffers
+	///				Staging buffers are added here, they must be kept alive until the command buffer has finished executing.
+	///
+	/// @param[out]	out_retired_texture_resources
+	///				Font textures replaced by a newer generation since the previous call are added here. Command buffers
+	///				recorded up to this point may still use them, destroy them once the command buffer has finished executing.
+	///
+	/// @return		true on success, false if something went wrong.
+	bool													CmdUploadPendingFontGlyphs(
+		VkCommandBuffer										command_buffer,
+		std::vector<CompleteBufferResource>				&	out_staging_buffers,
+		std::vector<TextureResource*>					&	out_retired_texture_resources );
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Get Vulkan instance.
 	///
@@ -510,6 +554,59 @@ public:
 	/// @return		Graphics blur pipeline layout.
 	VkPipelineLayout										GetGraphicsBlurPipelineLayout() const;
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute mipmap downsample pipeline layout.
+	///
+	///				Pipeline layout is the interface between shader and data on the GPU, this defines how the shader gets the data.
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Compute mipmap downsample pipeline layout.
+	VkPipelineLayout										GetComputeMipmapDownsamplePipelineLayout() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute mipmap downsample pipeline.
+	///
+	///				This pipeline is created when the instance is created so that it can be used from resource loader threads
+	///				without going through GetComputePipeline().
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Compute mipmap downsample pipeline.
+	VkPipeline												GetComputeMipmapDownsamplePipeline() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute render target texture blur pipeline layout.
+	///
+	///				Set 0 is the source and destination storage images pushed directly into the command buffer.
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Compute blur pipeline layout.
+	VkPipelineLayout										GetComputeBlurPipelineLayout() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute render target texture dual Kawase blur pipeline layout.
+	///
+	///				Shared by downsample and upsample, set 0 is the source mip level with sampler and the destination mip level
+	///				as storage image, both pushed directly into the command buffer.
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Compute dual Kawase blur pipeline layout.
+	VkPipelineLayout										GetComputeDualKawasePipelineLayout() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute particle pipeline layout.
+	///
+	///				Shared by particle emission and simulation, set 0 is the particle buffer pushed directly into the command
+	///				buffer.
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Compute particle pipeline layout.
+	VkPipelineLayout										GetComputeParticlePipelineLayout() const;
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Get graphics sampler descriptor set layout.
 	///
@@ -540,6 +637,16 @@ public:
 	/// @return		Descriptor set layout.
 	const DescriptorSetLayout			&	GetGraphicsRenderTargetBlurTextureDescriptorSetLayout() const;
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get compute mipmap downsample descriptor set layout.
+	///
+	///				Descriptor set layout is the layout for a set of data that may be bound at a time in shader.
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Descriptor set layout.
+	const DescriptorSetLayout			&	GetComputeMipmapDownsampleDescriptorSetLayout() const;
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Get graphics uniform buffer descriptor set layout.
 	///
@@ -591,6 +698,16 @@ public:
 	/// @return		Default sampler handle.
 	VkDescriptorSet											GetBlurSamplerDescriptorSet() const;
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Get blur sampler.
+	///
+	///				Linear filtering, clamped to edge. Same sampler as in GetBlurSamplerDescriptorSet().
+	/// 
+	/// @note		Multithreading: Any thread.
+	///
+	/// @return		Blur sampler handle.
+	Sampler										*	GetBlurSampler() const;
+
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Get device memory pool.
 	///
@@ -672,6 +789,7 @@ private:
 	bool													CreateShaderModules();
 	bool													CreateDescriptorSetLayouts();
 	bool													CreatePipelineLayouts();
+	bool													CreatePipelines();
 	bool													CreateDeviceMemoryPool();
 	bool													CreateThreadPool();
 	bool													CreateResourceManager();
@@ -743,6 +861,12 @@ private:
 
 	VkPipelineLayout										vk_graphics_primary_render_pipeline_layout	= {};
 	VkPipelineLayout										vk_graphics_blur_pipeline_layout			= {};
+	VkPipelineLayout										vk_compute_mipmap_downsample_pipeline_layout	= {};
+	VkPipelineLayout										vk_compute_blur_pipeline_layout				= {};
+	VkPipelineLayout										vk_compute_dual_kawase_pipeline_layout		= {};
+	VkPipelineLayout										vk_compute_particle_pipeline_layout			= {};
+
+	VkPipeline												vk_compute_mipmap_downsample_pipeline		= {};
 
 	std::unique_ptr<DescriptorSetLayout>					graphics_simple_sampler_descriptor_set_layout;
 	std::unique_ptr<DescriptorSetLayout>					graphics_sampler_descriptor_set_layout;
@@ -750,6 +874,10 @@ private:
 	std::unique_ptr<DescriptorSetLayout>					graphics_render_target_blur_texture_descriptor_set_layout;
 	std::unique_ptr<DescriptorSetLayout>					graphics_uniform_buffer_descriptor_set_layout;
 	std::unique_ptr<DescriptorSetLayout>					graphics_storage_buffer_descriptor_set_layout;
+	std::unique_ptr<DescriptorSetLayout>					compute_mipmap_downsample_descriptor_set_layout;
+	std::unique_ptr<DescriptorSetLayout>					compute_blur_descriptor_set_layout;
+	std::unique_ptr<DescriptorSetLayout>					compute_dual_kawase_descriptor_set_layout;
+	std::unique_ptr<DescriptorSetLayout>					compute_particle_descriptor_set_layout;
 
 	ResolvedQueue											primary_render_queue						= {};
 	ResolvedQueue											secondary_render_queue						= {};
@@ -769,6 +897,7 @@ private:
 	std::vector<std::unique_ptr<Window>>					windows;
 	std::vector<std::unique_ptr<RenderTargetTexture>>		render_target_textures;
 	std::vector<std::unique_ptr<Sampler>>					samplers;
+	std::vector<std::unique_ptr<ParticleSystem>>			particle_systems;
 	std::vector<std::unique_ptr<Cursor>>					cursors;
 
 	PFN_GamepadConnectionEventCallback						joystick_event_callback						= {};
@@ -0,0 +1,556 @@
+
+#include "core/SourceCommon.h"
+
+#include "interface/InstanceImpl.h"
+
+#include "interface/ParticleSystem.h"
+#include "interface/ParticleSystemImpl.h"
+
+#include "system/ShapeInstances.h"
+
+
+
+
+
+
+
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+// Interface.
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+
+VK2D_API vk2d::ParticleSystem::ParticleSystem(
+	vk2d_internal::InstanceImpl		*	instance,
+	const ParticleSystemCreateInfo	&	create_info
+)
+{
+	impl			= std::make_unique<vk2d_internal::ParticleSystemImpl>(
+		this,
+		instance,
+		create_info
+	);
+
+	if( !impl || !impl->IsGood() ) {
+		impl		= nullptr;
+		instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create particle system implementation!" );
+	}
+}
+
+VK2D_API vk2d::ParticleSystem::~ParticleSystem()
+{}
+
+VK2D_API void vk2d::ParticleSystem::Update(
+	float								delta_time
+)
+{
+	impl->Update( delta_time );
+}
+
+VK2D_API void vk2d::ParticleSystem::Emit(
+	uint32_t							count
+)
+{
+	impl->Emit( count );
+}
+
+VK2D_API void vk2d::ParticleSystem::Clear()
+{
+	impl->Clear();
+}
+
+VK2D_API void vk2d::ParticleSystem::SetEmitter(
+	const ParticleEmitterSettings	&	emitter
+)
+{
+	impl->SetEmitter( emitter );
+}
+
+VK2D_API const vk2d::ParticleEmitterSettings & vk2d::ParticleSystem::GetEmitter() const
+{
+	return impl->GetEmitter();
+}
+
+VK2D_API void vk2d::ParticleSystem::SetEmissionRate(
+	float								particles_per_second
+)
+{
+	impl->SetEmissionRate( particles_per_second );
+}
+
+VK2D_API void vk2d::ParticleSystem::SetGravity(
+	glm::vec2							gravity
+)
+{
+	impl->SetGravity( gravity );
+}
+
+VK2D_API void vk2d::ParticleSystem::SetDrag(
+	float								drag
+)
+{
+	impl->SetDrag( drag );
+}
+
+VK2D_API uint32_t vk2d::ParticleSystem::GetCapacity() const
+{
+	return impl->GetCapacity();
+}
+
+VK2D_API bool vk2d::ParticleSystem::IsGood() const
+{
+	return !!impl;
+}
+
+
+
+
+
+
+
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+// Implementation.
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////
+
+
+
+
+
+
+
+vk2d::vk2d_internal::ParticleSystemImpl::ParticleSystemImpl(
+	ParticleSystem					*	my_interface,
+	InstanceImpl					*	instance,
+	const ParticleSystemCreateInfo	&	create_info
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	this->my_interface		= my_interface;
+	this->instance			= instance;
+	assert( this->my_interface );
+	assert( this->instance );
+
+	vk_device				= instance->GetVulkanDevice();
+	assert( vk_device );
+
+	// Simulation is recorded in the same command buffers as rendering.
+	if( !( instance->GetPrimaryRenderQueue().GetQueueFamilyProperties().queueFlags & VK_QUEUE_COMPUTE_BIT ) ) {
+		instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Cannot create particle system, render queue does not support compute shaders!" );
+		return;
+	}
+
+	if( create_info.capacity == 0 ) {
+		instance->Report( ReportSeverity::WARNING, "Cannot create particle system, 'ParticleSystemCreateInfo::capacity' must be larger than 0!" );
+		return;
+	}
+
+	capacity				= create_info.capacity;
+	emitter					= create_info.emitter;
+	emission_rate			= std::max( create_info.emission_rate, 0.0f );
+	gravity					= create_info.gravity;
+	drag					= std::max( create_info.drag, 0.0f );
+
+	// Particle buffer contents are undefined until the first CmdUpdate()
+	// clears it.
+	pending_clear			= true;
+
+	VkBufferCreateInfo buffer_create_info {};
+	buffer_create_info.sType					= VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buffer_create_info.pNext					= nullptr;
+	buffer_create_info.flags					= 0;
+	buffer_create_info.size						= VkDeviceSize( capacity ) * sizeof( ParticleData );
+	buffer_create_info.usage					= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	buffer_create_info.sharingMode				= VK_SHARING_MODE_EXCLUSIVE;
+	buffer_create_info.queueFamilyIndexCount	= 0;
+	buffer_create_info.pQueueFamilyIndices		= nullptr;
+	particle_buffer = instance->GetDeviceMemoryPool()->CreateCompleteBufferResource(
+		&buffer_create_info,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+	);
+	if( particle_buffer != VK_SUCCESS ) {
+		instance->Report( particle_buffer.result, "Internal error: Cannot create particle buffer!" );
+		return;
+	}
+
+	{
+		vertex_buffer_descriptor_set	= instance->AllocateDescriptorSet( instance->GetGraphicsStorageBufferDescriptorSetLayout() );
+		if( vertex_buffer_descriptor_set != VK_SUCCESS ) {
+			instance->Report( vertex_buffer_descriptor_set.result, "Internal error: Cannot allocate particle buffer descriptor set!" );
+			return;
+		}
+
+		VkDescriptorBufferInfo descriptor_write_buffer_info {};
+		descriptor_write_buffer_info.buffer		= particle_buffer.buffer;
+		descriptor_write_buffer_info.offset		= 0;
+		descriptor_write_buffer_info.range		= VK_WHOLE_SIZE;
+		std::array<VkWriteDescriptorSet, 1> descriptor_write {};
+		descriptor_write[ 0 ].sType				= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+		descriptor_write[ 0 ].pNext				= nullptr;
+		descriptor_write[ 0 ].dstSet			= vertex_buffer_descriptor_set.descriptorSet;
+		descriptor_write[ 0 ].dstBinding		= 0;
+		descriptor_write[ 0 ].dstArrayElement	= 0;
+		descriptor_write[ 0 ].descriptorCount	= 1;
+		descriptor_write[ 0 ].descriptorType	= VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+		descriptor_write[ 0 ].pImageInfo		= nullptr;
+		descriptor_write[ 0 ].pBufferInfo		= &descriptor_write_buffer_info;
+		descriptor_write[ 0 ].pTexelBufferView	= nullptr;
+		vkUpdateDescriptorSets(
+			vk_device,
+			uint32_t( descriptor_write.size() ), descriptor_write.data(),
+			0, nullptr
+		);
+	}
+
+	is_good					= true;
+}
+
+vk2d::vk2d_internal::ParticleSystemImpl::~ParticleSystemImpl()
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	instance->FreeDescriptorSet( vertex_buffer_descriptor_set );
+	instance->GetDeviceMemoryPool()->FreeCompleteResource( particle_buffer );
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::Update(
+	float								delta_time
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	delta_time					= std::max( delta_time, 0.0f );
+	pending_delta_time			+= delta_time;
+
+	// Fractions carry over so low emission rates still emit at high frame rates.
+	pending_emission_fraction	+= emission_rate * delta_time;
+	auto count					= std::min( std::floor( pending_emission_fraction ), float( capacity ) );
+	pending_emission_fraction	-= std::floor( pending_emission_fraction );
+	if( count >= 1.0f ) {
+		Emit( uint32_t( count ) );
+	}
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::Emit(
+	uint32_t							count
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( count == 0 ) return;
+
+	// Emitting more than the capacity would overwrite particles emitted in the same dispatch.
+	PendingEmission emission {};
+	emission.emitter			= emitter;
+	emission.count				= std::min( count, capacity );
+	pending_emissions.push_back( emission );
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::Clear()
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	pending_clear				= true;
+	pending_emissions.clear();
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::SetEmitter(
+	const ParticleEmitterSettings	&	emitter
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	this->emitter				= emitter;
+}
+
+const vk2d::ParticleEmitterSettings & vk2d::vk2d_internal::ParticleSystemImpl::GetEmitter() const
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	return emitter;
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::SetEmissionRate(
+	float								particles_per_second
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	emission_rate				= std::max( particles_per_second, 0.0f );
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::SetGravity(
+	glm::vec2							gravity
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	this->gravity				= gravity;
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::SetDrag(
+	float								drag
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	this->drag					= std::max( drag, 0.0f );
+}
+
+uint32_t vk2d::vk2d_internal::ParticleSystemImpl::GetCapacity() const
+{
+	return capacity;
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::CmdUpdate(
+	VkCommandBuffer						command_buffer
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( !pending_clear && pending_delta_time <= 0.0f && pending_emissions.empty() ) return;
+
+	auto pipeline_layout		= instance->GetComputeParticlePipelineLayout();
+
+	// Earlier frames may still be drawing from or simulating the particle
+	// buffer, barriers also cover commands submitted earlier to the same queue.
+	{
+		VkPipelineStageFlags src_stage_mask	= VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+		VkMemoryBarrier memory_barrier {};
+		memory_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memory_barrier.pNext			= nullptr;
+		memory_barrier.srcAccessMask	= VK_ACCESS_SHADER_WRITE_BIT;
+		memory_barrier.dstAccessMask	= VK_ACCESS_TRANSFER_WRITE_BIT;
+
+		if( pending_clear ) {
+			vkCmdPipelineBarrier(
+				command_buffer,
+				src_stage_mask,
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				0,
+				1, &memory_barrier,
+				0, nullptr,
+				0, nullptr
+			);
+
+			// Zero lifetime marks every particle dead.
+			vkCmdFillBuffer(
+				command_buffer,
+				particle_buffer.buffer,
+				0,
+				VK_WHOLE_SIZE,
+				0
+			);
+			src_stage_mask					= VK_PIPELINE_STAGE_TRANSFER_BIT;
+			memory_barrier.srcAccessMask	= VK_ACCESS_TRANSFER_WRITE_BIT;
+
+			pending_clear					= false;
+			pending_delta_time				= 0.0f;
+			next_emit_index					= 0;
+		}
+
+		memory_barrier.dstAccessMask	= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		vkCmdPipelineBarrier(
+			command_buffer,
+			src_stage_mask,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			1, &memory_barrier,
+			0, nullptr,
+			0, nullptr
+		);
+	}
+
+	CmdPushParticleBufferDescriptor(
+		command_buffer
+	);
+
+	// Each dispatch reads or overwrites particles written by the previous one.
+	auto CmdComputeToComputeBarrier = [ command_buffer ]()
+	{
+		VkMemoryBarrier memory_barrier {};
+		memory_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memory_barrier.pNext			= nullptr;
+		memory_barrier.srcAccessMask	= VK_ACCESS_SHADER_WRITE_BIT;
+		memory_barrier.dstAccessMask	= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			1, &memory_barrier,
+			0, nullptr,
+			0, nullptr
+		);
+	};
+
+	// Simulate before emitting so new particles are drawn where they were emitted.
+	bool first_dispatch = true;
+	if( pending_delta_time > 0.0f ) {
+		ComputePipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= pipeline_layout;
+		pipeline_settings.vk_shader_program		= instance->GetComputeShaderModules( ComputeShaderProgramID::PARTICLE_SIMULATE );
+
+		vkCmdBindPipeline(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			instance->GetComputePipeline( pipeline_settings )
+		);
+
+		ComputeParticleSimulatePushConstants push_constants {};
+		push_constants.gravity		= gravity;
+		push_constants.delta_time	= pending_delta_time;
+		push_constants.drag			= drag;
+		push_constants.capacity		= capacity;
+
+		vkCmdPushConstants(
+			command_buffer,
+			pipeline_layout,
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			uint32_t( sizeof( ComputeParticleSimulatePushConstants ) ),
+			&push_constants
+		);
+
+		vkCmdDispatch(
+			command_buffer,
+			( capacity + PARTICLE_WORK_GROUP_SIZE - 1 ) / PARTICLE_WORK_GROUP_SIZE,
+			1,
+			1
+		);
+
+		pending_delta_time	= 0.0f;
+		first_dispatch		= false;
+	}
+
+	if( !pending_emissions.empty() ) {
+		ComputePipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= pipeline_layout;
+		pipeline_settings.vk_shader_program		= instance->GetComputeShaderModules( ComputeShaderProgramID::PARTICLE_EMIT );
+
+		vkCmdBindPipeline(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			instance->GetComputePipeline( pipeline_settings )
+		);
+
+		for( auto & e : pending_emissions ) {
+			if( !first_dispatch ) {
+				CmdComputeToComputeBarrier();
+			}
+			first_dispatch = false;
+
+			ComputeParticleEmitPushConstants push_constants {};
+			push_constants.position					= e.emitter.position;
+			push_constants.radius					= std::max( e.emitter.radius, 0.0f );
+			push_constants.direction				= e.emitter.direction;
+			push_constants.spread					= e.emitter.spread;
+			push_constants.speed_min				= e.emitter.speed_min;
+			push_constants.speed_max				= e.emitter.speed_max;
+			push_constants.lifetime_min				= std::max( e.emitter.lifetime_min, 0.0f );
+			push_constants.lifetime_max				= std::max( e.emitter.lifetime_max, 0.0f );
+			push_constants.size_begin				= e.emitter.size_begin;
+			push_constants.size_end					= e.emitter.size_end;
+			push_constants.angular_velocity_min		= e.emitter.angular_velocity_min;
+			push_constants.angular_velocity_max		= e.emitter.angular_velocity_max;
+			push_constants.color_begin				= PackShapeColor( e.emitter.color_begin );
+			push_constants.color_end				= PackShapeColor( e.emitter.color_end );
+			push_constants.first_index				= next_emit_index;
+			push_constants.count					= e.count;
+			push_constants.capacity					= capacity;
+			push_constants.seed						= emission_seed++;
+
+			vkCmdPushConstants(
+				command_buffer,
+				pipeline_layout,
+				VK_SHADER_STAGE_COMPUTE_BIT,
+				0,
+				uint32_t( sizeof( ComputeParticleEmitPushConstants ) ),
+				&push_constants
+			);
+
+			vkCmdDispatch(
+				command_buffer,
+				( e.count + PARTICLE_WORK_GROUP_SIZE - 1 ) / PARTICLE_WORK_GROUP_SIZE,
+				1,
+				1
+			);
+
+			next_emit_index		= uint32_t( ( uint64_t( next_emit_index ) + e.count ) % capacity );
+		}
+		pending_emissions.clear();
+	}
+
+	// Particles are drawn after this.
+	{
+		VkMemoryBarrier memory_barrier {};
+		memory_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memory_barrier.pNext			= nullptr;
+		memory_barrier.srcAccessMask	= VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
+		memory_barrier.dstAccessMask	= VK_ACCESS_SHADER_READ_BIT;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_VERTEX_SHADER_BIT,
+			0,
+			1, &memory_barrier,
+			0, nullptr,
+			0, nullptr
+		);
+	}
+}
+
+VkDescriptorSet vk2d::vk2d_internal::ParticleSystemImpl::GetVertexBufferDescriptorSet() const
+{
+	return vertex_buffer_descriptor_set.descriptorSet;
+}
+
+bool vk2d::vk2d_internal::ParticleSystemImpl::IsGood() const
+{
+	return is_good;
+}
+
+void vk2d::vk2d_internal::ParticleSystemImpl::CmdPushParticleBufferDescriptor(
+	VkCommandBuffer						command_buffer
+)
+{
+	VkDescriptorBufferInfo buffer_info {};
+	buffer_info.buffer							= particle_buffer.buffer;
+	buffer_info.offset							= 0;
+	buffer_info.range							= VK_WHOLE_SIZE;
+
+	VkWriteDescriptorSet descriptor_write {};
+	descriptor_write.sType						= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	descriptor_write.pNext						= nullptr;
+	descriptor_write.dstSet						= VK_NULL_HANDLE;	// Ignored when pushing descriptor set directly into the command buffer.
+	descriptor_write.dstBinding					= 0;
+	descriptor_write.dstArrayElement			= 0;
+	descriptor_write.descriptorCount			= 1;
+	descriptor_write.descriptorType				= VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+	descriptor_write.pImageInfo					= nullptr;
+	descriptor_write.pBufferInfo				= &buffer_info;
+	descriptor_write.pTexelBufferView			= nullptr;
+
+	instance->VkFun_vkCmdPushDescriptorSetKHR(
+		command_buffer,
+		VK_PIPELINE_BIND_POINT_COMPUTE,
+		instance->GetComputeParticlePipelineLayout(),
+		0,
+		1,
+		&descriptor_write
+	);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+#include "interface/ParticleSystem.h"
+
+#include "system/DescriptorSet.h"
+#include "system/ShaderInterface.h"
+#include "system/VulkanMemoryManagement.h"
+
+#include <vector>
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+class ParticleSystemImpl {
+public:
+	ParticleSystemImpl(
+		ParticleSystem						*	particle_system,
+		InstanceImpl						*	instance,
+		const ParticleSystemCreateInfo		&	create_info );
+
+	~ParticleSystemImpl();
+
+	void										Update(
+		float									delta_time );
+
+	void										Emit(
+		uint32_t								count );
+
+	void										Clear();
+
+	void										SetEmitter(
+		const ParticleEmitterSettings		&	emitter );
+
+	const ParticleEmitterSettings			&	GetEmitter() const;
+
+	void										SetEmissionRate(
+		float									particles_per_second );
+
+	void										SetGravity(
+		glm::vec2								gravity );
+
+	void										SetDrag(
+		float									drag );
+
+	uint32_t									GetCapacity() const;
+
+	// Records work queued with Update(), Emit() and Clear() since the last
+	// call. Must be recorded outside of a render pass, in the same queue and
+	// before the draws reading the particle buffer.
+	void										CmdUpdate(
+		VkCommandBuffer							command_buffer );
+
+	// Particle buffer for the vertex buffer set of the primary render
+	// pipeline layout, see GRAPHICS_DESCRIPTOR_SET_ALLOCATION_VERTEX_BUFFER_AS_STORAGE_BUFFER.
+	VkDescriptorSet								GetVertexBufferDescriptorSet() const;
+
+	bool										IsGood() const;
+
+private:
+	void										CmdPushParticleBufferDescriptor(
+		VkCommandBuffer							command_buffer );
+
+	struct PendingEmission {
+		ParticleEmitterSettings					emitter						= {};
+		uint32_t								count						= {};
+	};
+
+	ParticleSystem							*	my_interface				= {};
+	InstanceImpl							*	instance					= {};
+	VkDevice									vk_device					= {};
+
+	uint32_t									capacity					= {};
+	ParticleEmitterSettings						emitter						= {};
+	float										emission_rate				= {};
+	glm::vec2									gravity						= {};
+	float										drag						= {};
+
+	CompleteBufferResource						particle_buffer				= {};
+	PoolDescriptorSet							vertex_buffer_descriptor_set	= {};
+
+	// Work queued for the next CmdUpdate().
+	float										pending_delta_time			= {};
+	float										pending_emission_fraction	= {};
+	std::vector<PendingEmission>				pending_emissions;
+	bool										pending_clear				= {};
+
+	uint32_t									next_emit_index				= {};
+	uint32_t									emission_seed				= {};
+
+	bool										is_good						= {};
+};
+
+
+
+} // vk2d_internal
+
+} // vk2d
@@ -9,6 +9,7 @@
 #include "system/RenderTargetTextureDependecyGraphInfo.hpp"
 #include "system/ShaderInterface.h"
 #include "system/MeshBuffer.h"
+#include "system/ShapeInstances.h"
 
 #include "interface/Instance.h"
 #include "interface/InstanceImpl.h"
@@ -22,6 +23,12 @@
 #include "interface/Sampler.h"
 #include "interface/SamplerImpl.h"
 
+#include "interface/ParticleSystem.h"
+#include "interface/ParticleSystemImpl.h"
+
+#include "interface/resources/FontResource.h"
+#include "interface/resources/FontResourceImpl.h"
+
 
 
 
@@ -320,6 +327,86 @@ VK2D_API void vk2d::RenderTargetTexture::DrawMesh(
 	);
 }
 
+VK2D_API void vk2d::RenderTargetTexture::DrawText(
+	FontResource					*	font,
+	glm::vec2							origin,
+	const Text						&	text,
+	float								kerning,
+	glm::vec2							scale,
+	bool								vertical,
+	uint32_t							font_face,
+	Colorf								color,
+	bool								wait_for_resource_load
+)
+{
+	impl->DrawText(
+		font,
+		origin,
+		text,
+		kerning,
+		scale,
+		vertical,
+		font_face,
+		color,
+		wait_for_resource_load
+	);
+}
+
+VK2D_API void vk2d::RenderTargetTexture::DrawCircles(
+	const std::vector<CirclePrimitive>		&	circles
+)
+{
+	impl->DrawCircles(
+		circles
+	);
+}
+
+VK2D_API void vk2d::RenderTargetTexture::DrawRoundedRects(
+	const std::vector<RoundedRectPrimitive>	&	rounded_rects
+)
+{
+	impl->DrawRoundedRects(
+		rounded_rects
+	);
+}
+
+VK2D_API void vk2d::RenderTargetTexture::DrawRings(
+	const std::vector<RingPrimitive>		&	rings
+)
+{
+	impl->DrawRings(
+		rings
+	);
+}
+
+VK2D_API void vk2d::RenderTargetTexture::DrawPolylines(
+	const std::vector<Polyline>		&	polylines,
+	PolylineJoin						join,
+	PolylineCap							cap,
+	float								miter_limit
+)
+{
+	impl->DrawPolylines(
+		polylines,
+		join,
+		cap,
+		miter_limit
+	);
+}
+
+VK2D_API void vk2d::RenderTargetTexture::DrawParticleSystem(
+	ParticleSystem					*	particle_system,
+	Texture							*	texture,
+	Sampler							*	sampler
+)
+{
+	impl->DrawParticleSystem(
+		particle_system,
+		texture,
+		sampler
+	);
+}
+
 VK2D_API bool vk2d::RenderTargetTexture::IsGood() const
 {
 	return !!impl;
@@ -383,7 +470,7 @@ vk2d::vk2d_internal::RenderTargetTextureImpl::RenderTargetTextureImpl(
 		instance->GetDeviceMemoryPool()
 		);
 
-	// Initial final image layouts, change later if implementing mipmapless render target texture.
+	// Final image layouts, same for all mipmap modes.
 	vk_attachment_image_final_layout	= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
 	vk_sampled_image_final_layout		= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 	vk_sampled_image_final_access_mask	= VK_ACCESS_SHADER_READ_BIT;
@@ -453,6 +540,10 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::SetSize(
 			}
 		}
 
+		for( auto & s : swap_buffers ) {
+			DiscardDeferredMipmapGeneration( s );
+		}
+
 		DestroyImages();
 		DestroyFramebuffers();
 
@@ -564,6 +655,10 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::BeginRender()
 		// We no longer contain sampled image that's ready to be used without synchronization.
 		swap.contains_non_pending_sampled_image = false;
 
+		// Previous render in this swap buffer was never committed.
+		DiscardDeferredMipmapGeneration( swap );
+		swap.are_mipmaps_requested = false;
+
 		ResetRenderTargetTextureRenderDependencies( current_swap_buffer );
 	}
 
@@ -692,30 +787,86 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::EndRender(
 	}
 	CmdFinalizeRender( swap, blur_type, blur_amount );
 
-	// End command buffer
+	// With on demand mipmaps the render command buffer is ended once
+	// the render is committed, see EndDeferredMipmapGeneration().
+	if( !swap.is_mipmap_generation_deferred ) {
+		swap.are_sampled_image_mip_levels_initialized = true;
+		if( !EndRenderCommandBuffer( swap ) ) return false;
+	}
+
+	RecordTransferCommandBuffer( swap );
+
+	++swap.render_counter;
+
+	previous_graphics_pipeline_settings	= {};
+	previous_texture					= {};
+	previous_sampler					= {};
+	previous_line_width					= 1.0f;
+
+	return true;
+}
+
+bool vk2d::vk2d_internal::RenderTargetTextureImpl::EndRenderCommandBuffer(
+	RenderTargetTextureImpl::SwapBuffer		&	swap
+)
+{
 	CmdInsertCommandBufferCheckpoint(
-		render_command_buffer,
+		swap.vk_render_command_buffer,
 		"RenderTargetTextureImpl",
 		CommandBufferCheckpointType::END_COMMAND_BUFFER
 	);
 	auto result = vkEndCommandBuffer(
-		render_command_buffer
+		swap.vk_render_command_buffer
 	);
 	if( result != VK_SUCCESS ) {
 		instance->Report( result, "Internal error: Cannot render to RenderTargetTexture, Cannot compile primary render command buffer!" );
 		return false;
 	}
+	return true;
+}
 
-	RecordTransferCommandBuffer( swap );
+bool vk2d::vk2d_internal::RenderTargetTextureImpl::EndDeferredMipmapGeneration(
+	RenderTargetTextureImpl::SwapBuffer		&	swap
+)
+{
+	if( !swap.is_mipmap_generation_deferred ) return true;
+	swap.is_mipmap_generation_deferred = false;
+
+	assert( swap.deferred_mipmap_source_image );
+
+	if( swap.are_mipmaps_requested || are_mipmaps_sampled_after_commit ) {
+		CmdRecordMipmapsToSampledImage(
+			swap,
+			swap.vk_render_command_buffer,
+			*swap.deferred_mipmap_source_image,
+			swap.deferred_mipmap_source_image_layout,
+			swap.deferred_mipmap_source_image_stage
+		);
+	} else {
+		CmdCopyToSampledImageWithoutMipmaps(
+			swap,
+			swap.vk_render_command_buffer,
+			*swap.deferred_mipmap_source_image,
+			swap.deferred_mipmap_source_image_layout,
+			swap.deferred_mipmap_source_image_stage
+		);
+	}
+	swap.are_sampled_image_mip_levels_initialized	= true;
+	swap.deferred_mipmap_source_image				= nullptr;
 
-	++swap.render_counter;
+	return EndRenderCommandBuffer( swap );
+}
 
-	previous_graphics_pipeline_settings	= {};
-	previous_texture					= {};
-	previous_sampler					= {};
-	previous_line_width					= 1.0f;
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DiscardDeferredMipmapGeneration(
+	RenderTargetTextureImpl::SwapBuffer		&	swap
+)
+{
+	if( !swap.is_mipmap_generation_deferred ) return;
+	swap.is_mipmap_generation_deferred	= false;
+	swap.deferred_mipmap_source_image	= nullptr;
 
-	return true;
+	// Command buffer cannot be recorded again while it's still in recording state.
+	vkEndCommandBuffer( swap.vk_render_command_buffer );
 }
 
 bool vk2d::vk2d_internal::RenderTargetTextureImpl::SynchronizeFrame()
@@ -797,7 +948,7 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::WaitIdle()
 
 bool vk2d::vk2d_internal::RenderTargetTextureImpl::CommitRenderTargetTextureRender(
 	RenderTargetTextureDependencyInfo	&	dependency_info,
-	RenderTargetTextureRenderCollector	&	collector
+	RenderTargetTextureRenderGraph		&	render_graph
 )
 {
 	VK2D_ASSERT_MAIN_THREAD( instance );
@@ -813,43 +964,39 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CommitRenderTargetTextureRend
 		if( swap.render_commitment_request_count == 0 ) {
 
 			for( auto & d : swap.render_target_texture_dependencies ) {
-				if( !d.render_target->CommitRenderTargetTextureRender( d, collector ) ) {
+				if( !d.render_target->CommitRenderTargetTextureRender( d, render_graph ) ) {
 					return false;
 				}
 			}
 
-			// Give this render info to the collector if this render target texture data is out of date.
-			// Basically if we're pending render and render commitment count is 0.
-			{
-				// Get immediate children render complete semaphores.
-				std::vector<VkSemaphore>			wait_for_semaphores;				wait_for_semaphores.reserve( std::size( swap.render_target_texture_dependencies ) );
-				std::vector<uint64_t>				wait_for_semaphore_timeline_values;	wait_for_semaphore_timeline_values.reserve( std::size( swap.render_target_texture_dependencies ) );
-				std::vector<VkPipelineStageFlags>	wait_for_semaphore_pipeline_stages;	wait_for_semaphore_pipeline_stages.reserve( std::size( swap.render_target_texture_dependencies ) );
-				for( auto & d : swap.render_target_texture_dependencies ) {
-					wait_for_semaphores.push_back( d.render_target->GetAllCompleteSemaphore( d ) );
-					wait_for_semaphore_timeline_values.push_back( d.render_target->GetRenderCounter( d ) );
-					// TODO: Replace VK_PIPELINE_STAGE_ALL_COMMANDS_BIT with something that narrows down the potential pipeline bubble more.
-					wait_for_semaphore_pipeline_stages.push_back( VK_PIPELINE_STAGE_ALL_COMMANDS_BIT );
-				}
+			// All draws using this render were recorded by now, on demand
+			// mipmaps can be decided.
+			if( !EndDeferredMipmapGeneration( swap ) ) {
+				return false;
+			}
 
-				// Update submit info to account for render dependencies.
-				if( !UpdateSubmitInfos(
-					swap,
-					wait_for_semaphores,
-					wait_for_semaphore_timeline_values,
-					wait_for_semaphore_pipeline_stages
-				) ) {
-					return false;
+			// Renders already in the graph are submitted before this one in
+			// the same batch, anything else was submitted earlier and has to
+			// be waited for.
+			RenderTargetTextureRenderGraph::Node node {};
+			node.render_target					= this;
+			node.swap_buffer_index				= dependency_info.swap_buffer_index;
+			node.vk_transfer_command_buffer		= swap.vk_transfer_command_buffer;
+			node.vk_render_command_buffer		= swap.vk_render_command_buffer;
+			node.vk_render_complete_semaphore	= swap.vk_render_complete_semaphore;
+			node.render_counter					= swap.render_counter;
+			node.depth							= 0;
+			for( auto & d : swap.render_target_texture_dependencies ) {
+				if( auto dependency_node = render_graph.FindNode( d ) ) {
+					node.depth = std::max( node.depth, dependency_node->depth + 1 );
+				} else {
+					render_graph.AddExternalDependency(
+						d.render_target->GetAllCompleteSemaphore( d ),
+						d.render_target->GetRenderCounter( d )
+					);
 				}
-
-				// Append to render collector.
-				collector.Append(
-					&swap.vk_transfer_submit_info,
-					&swap.vk_render_submit_info
-					//create_info_copy.enable_blur ? &swap.vk_blur_submit_info : nullptr,
-					//create_info_copy.enable_blur ? &swap.vk_mipmap_submit_info : nullptr
-				);
 			}
+			render_graph.AddNode( node );
 		}
 
 		++swap.render_commitment_request_count;
@@ -925,9 +1072,6 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::ResetRenderTargetTextureRende
 
 	swap.render_commitment_request_count	= 0;
 	swap.render_target_texture_dependencies.clear();
-	swap.render_wait_for_semaphores.clear();
-	swap.render_wait_for_semaphore_timeline_values.clear();
-	swap.render_wait_for_pipeline_stages.clear();
 }
 
 void vk2d::vk2d_internal::RenderTargetTextureImpl::CheckAndAddRenderTargetTextureDependency(
@@ -967,6 +1111,66 @@ vk2d::vk2d_internal::RenderTargetTextureDependencyInfo vk2d::vk2d_internal::Rend
 	return dependency_info;
 }
 
+void vk2d::vk2d_internal::RenderTargetTextureImpl::RequestMipmapsIfSampled(
+	Sampler								*	sampler,
+	const std::vector<Vertex>			*	vertices,
+	const std::vector<glm::mat4>		&	transformations,
+	glm::vec2								surface_pixels_per_unit
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( create_info_copy.mipmap_mode != RenderTargetTextureMipmapMode::ON_DEMAND ) return;
+
+	// Draws sample the sampled image of the current swap buffer, see GetVulkanImageView().
+	auto & swap = swap_buffers[ current_swap_buffer ];
+	if( swap.are_mipmaps_requested || are_mipmaps_sampled_after_commit ) return;
+
+	auto sampler_impl	= sampler->impl.get();
+	if( !sampler_impl->SamplesMipLevels( true ) ) return;
+
+	bool are_mipmaps_sampled = true;
+	if( vertices ) {
+		are_mipmaps_sampled = sampler_impl->SamplesMipLevels(
+			IsTextureMinified(
+				*vertices,
+				transformations,
+				size,
+				surface_pixels_per_unit
+			)
+		);
+	}
+	if( !are_mipmaps_sampled ) return;
+
+	if( swap.is_mipmap_generation_deferred ) {
+		swap.are_mipmaps_requested = true;
+	} else if( swap.are_sampled_image_mip_levels_initialized ) {
+		// Mipmaps were already decided for this render, it is sampled after
+		// it was committed, eg. in a later frame or by another window.
+		// Generate mipmaps for every render from now on.
+		are_mipmaps_sampled_after_commit = true;
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CheckAndRequestRenderTargetTextureMipmaps(
+	Texture								*	texture,
+	Sampler								*	sampler,
+	const std::vector<Vertex>			*	vertices,
+	const std::vector<glm::mat4>		&	transformations
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( auto render_target = dynamic_cast<RenderTargetTextureImpl*>( texture->texture_impl ) ) {
+		render_target->RequestMipmapsIfSampled(
+			sampler,
+			vertices,
+			transformations,
+			CalculateSurfacePixelsPerUnit( coordinate_space, size )
+		);
+	}
+}
+
 void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawTriangleList(
 	const std::vector<VertexIndex_3>	&	indices,
 	const std::vector<Vertex>			&	vertices,
@@ -1006,7 +1210,9 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawTriangleList(
 	const std::vector<glm::mat4>		&	transformations,
 	bool									solid,
 	Texture								*	texture,
-	Sampler								*	sampler
+	Sampler								*	sampler,
+	float									signed_distance_field_spread,
+	const SignedDistanceFieldEffects	*	signed_distance_field_effects
 )
 {
 	VK2D_ASSERT_MAIN_THREAD( instance );
@@ -1032,42 +1238,16 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawTriangleList(
 		texture
 	);
 
-	{
-		bool multitextured = texture->GetLayerCount() > 1 &&
-			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
-
-		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
-			multitextured,
-			sampler->impl->IsAnyBorderColorEnabled(),
-			3
-		);
-
-		GraphicsPipelineSettings pipeline_settings {};
-		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
-		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
-		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-		pipeline_settings.polygon_mode			= solid ? VK_POLYGON_MODE_FILL : VK_POLYGON_MODE_LINE;
-		pipeline_settings.shader_programs		= graphics_shader_programs;
-		pipeline_settings.samples				= VkSampleCountFlags( samples );
-		pipeline_settings.enable_blending		= VK_TRUE;
-
-		CmdBindGraphicsPipelineIfDifferent(
-			command_buffer,
-			pipeline_settings
-		);
-	}
-
-	CmdBindSamplerIfDifferent(
-		command_buffer,
-		sampler,
-		instance->GetGraphicsPrimaryRenderPipelineLayout()
-	);
-	CmdBindTextureIfDifferent(
-		command_buffer,
+	CheckAndRequestRenderTargetTextureMipmaps(
 		texture,
-		instance->GetGraphicsPrimaryRenderPipelineLayout()
+		sampler,
+		&vertices,
+		transformations
 	);
 
+	bool multitextured = texture->GetLayerCount() > 1 &&
+		texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
+
 	//TODO, Transformations...;
 	// TODO: Transformations. Data path to the shader is done, just need to modify the actual shaders and add the data here.
 	// TODO: Matrix4f might not play nice with the alignment, might need to use Matrix4f, make sure alignment actually works on all GPUs.
@@ -1080,36 +1260,23 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawTriangleList(
 	);
 
 	if( push_result.success ) {
-		{
-			GraphicsPrimaryRenderPushConstants pc {};
-			pc.transformation_offset	= push_result.location_info.transformation_offset;
-			pc.index_offset				= push_result.location_info.index_offset;
-			pc.index_count				= 3;
-			pc.vertex_offset			= push_result.location_info.vertex_offset;
-			pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
-			pc.texture_channel_weight_count	= texture->GetLayerCount();
-
-			vkCmdPushConstants(
-				command_buffer,
-				instance->GetGraphicsPrimaryRenderPipelineLayout(),
-				VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-				0, sizeof( pc ),
-				&pc
-			);
-		}
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.index_offset						= push_result.location_info.index_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
 
-		CmdInsertCommandBufferCheckpoint(
-			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::DRAW
-		);
-		vkCmdDrawIndexed(
+		CmdDrawTriangleList(
 			command_buffer,
+			pc,
 			index_count,
 			uint32_t( std::size( transformations ) ),
-			push_result.location_info.index_offset,
-			int32_t( push_result.location_info.vertex_offset ),
-			0
+			solid,
+			multitextured,
+			texture,
+			sampler,
+			signed_distance_field_spread,
+			signed_distance_field_effects
 		);
 	} else {
 		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push mesh into mesh render queue!" );
@@ -1131,86 +1298,103 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawTriangleList(
 	#endif
 }
 
-void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
-	const std::vector<VertexIndex_2>	&	indices,
-	const std::vector<Vertex>			&	vertices,
-	const std::vector<float>			&	texture_layer_weights,
-	const std::vector<glm::mat4>		&	transformations,
-	Texture								*	texture,
-	Sampler								*	sampler,
-	float									line_width
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawText(
+	FontResource						*	font,
+	glm::vec2								origin,
+	const Text							&	text,
+	float									kerning,
+	glm::vec2								scale,
+	bool									vertical,
+	uint32_t								font_face,
+	const Colorf						&	color,
+	bool									wait_for_resource_load
 )
 {
 	VK2D_ASSERT_MAIN_THREAD( instance );
 
-	auto index_count	= uint32_t( indices.size() * 2 );
-	std::vector<uint32_t> raw_indices;
-	raw_indices.resize( index_count );
-	for( size_t i = 0, a = 0; i < indices.size(); ++i, a += 2 ) {
-		raw_indices[ a + 0 ] = indices[ i ].indices[ 0 ];
-		raw_indices[ a + 1 ] = indices[ i ].indices[ 1 ];
+	if( std::size( text ) <= 0 ) return;
+	if( !font || !font->impl ) return;
+	auto fi = font->impl.get();
+	if( wait_for_resource_load ) {
+		fi->WaitUntilLoaded( std::chrono::nanoseconds::max() );
+	} else {
+		if( fi->GetStatus() == ResourceStatus::UNDETERMINED ) return;
 	}
-
-	DrawLineList(
-		raw_indices,
-		vertices,
-		texture_layer_weights,
-		transformations,
-		texture,
-		sampler,
-		line_width
+	if( !fi->FaceExists( font_face ) ) return;
+
+	Texture * texture = fi->GetTextureResource();
+	if( !texture || !texture->IsTextureDataReady() ) return;
+
+	// Glyphs are laid out unscaled, the shader scales them.
+	fi->LayoutTextForDrawing(
+		text,
+		kerning,
+		glm::vec2( 1.0f, 1.0f ),
+		vertical,
+		font_face,
+		texture->GetLayerCount(),
+		text_glyph_placements,
+		text_line_metrics
 	);
-}
-
-void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
-	const std::vector<uint32_t>		&	raw_indices,
-	const std::vector<Vertex>		&	vertices,
-	const std::vector<float>		&	texture_layer_weights,
-	const std::vector<glm::mat4>	&	transformations,
-	Texture							*	texture,
-	Sampler							*	sampler,
-	float								line_width
-)
-{
-	VK2D_ASSERT_MAIN_THREAD( instance );
-
-	auto & swap			= swap_buffers[ current_swap_buffer ];
-	auto command_buffer	= swap.vk_render_command_buffer;
+	if( text_glyph_placements.empty() ) return;
 
-	auto vertex_count	= uint32_t( vertices.size() );
-	auto index_count	= uint32_t( raw_indices.size() );
+	auto & swap				= swap_buffers[ current_swap_buffer ];
+	auto command_buffer		= swap.vk_render_command_buffer;
+	auto glyph_count		= uint32_t( text_glyph_placements.size() );
 
-	if( !texture ) {
-		texture = instance->GetDefaultTexture();
-	}
-	if( !texture->IsTextureDataReady() ) {
-		texture = instance->GetDefaultTexture();
-	}
-	if( !sampler ) {
-		sampler = instance->GetDefaultSampler();
-	}
+	uint64_t glyph_table_generation	= {};
+	auto glyph_table_size			= fi->AddGlyphTableEntries( font_face, text_glyph_placements, glyph_table_generation );
 
 	CheckAndAddRenderTargetTextureDependency(
 		current_swap_buffer,
 		texture
 	);
 
-	{
-		bool multitextured = texture->GetLayerCount() > 1 &&
-			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		glyph_count,
+		uint32_t( sizeof( GlyphInstance ) ),
+		fi->GetGlyphTableKey( font_face ),
+		glyph_table_generation,
+		glyph_table_size * GLYPH_TABLE_FLOATS_PER_GLYPH,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push text into mesh render queue!" );
+		return;
+	}
 
-		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
-			multitextured,
-			sampler->impl->IsAnyBorderColorEnabled(),
-			2
+	fi->WriteGlyphInstances(
+		font_face,
+		text_glyph_placements,
+		color,
+		static_cast<GlyphInstance*>( instance_data )
+	);
+	if( table_data ) {
+		fi->WriteGlyphTable(
+			font_face,
+			glyph_table_size,
+			table_data
 		);
+	}
 
+	auto sampler							= instance->GetDefaultSampler();
+	auto signed_distance_field_spread		= fi->GetSignedDistanceFieldSpread();
+
+	{
 		GraphicsPipelineSettings pipeline_settings {};
 		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
 		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
-		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
-		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_LINE;
-		pipeline_settings.shader_programs		= graphics_shader_programs;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules(
+			signed_distance_field_spread > 0.0f ?
+			GraphicsShaderProgramID::GLYPH_INSTANCE_SIGNED_DISTANCE_FIELD :
+			GraphicsShaderProgramID::GLYPH_INSTANCE
+		);
 		pipeline_settings.samples				= VkSampleCountFlags( samples );
 		pipeline_settings.enable_blending		= VK_TRUE;
 
@@ -1220,10 +1404,6 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
 		);
 	}
 
-	CmdSetLineWidthIfDifferent(
-		command_buffer,
-		line_width
-	);
 	CmdBindSamplerIfDifferent(
 		command_buffer,
 		sampler,
@@ -1235,9 +1415,528 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
 		instance->GetGraphicsPrimaryRenderPipelineLayout()
 	);
 
-	auto push_result = mesh_buffer->CmdPushMesh(
-		command_buffer,
-		raw_indices,
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	if( signed_distance_field_spread > 0.0f ) {
+		GraphicsSignedDistanceFieldPushConstants pc {};
+		pc.spread							= signed_distance_field_spread;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsGlyphInstancePushConstants pc {};
+		pc.origin							= origin;
+		pc.scale							= scale;
+		pc.vertical							= vertical ? 1 : 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( GlyphInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		glyph_count,
+		0,
+		first_instance
+	);
+}
+
+template<typename ShapePrimitiveT>
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawShapes(
+	ShapeInstanceType						shape,
+	const std::vector<ShapePrimitiveT>	&	shapes
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( shapes.empty() ) return;
+
+	auto & swap				= swap_buffers[ current_swap_buffer ];
+	auto command_buffer		= swap.vk_render_command_buffer;
+	auto shape_count		= uint32_t( shapes.size() );
+
+	// Shapes do not use a shared table, an empty one is pushed once per frame.
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		shape_count,
+		uint32_t( sizeof( ShapeInstance ) ),
+		nullptr,
+		0,
+		0,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push shapes into mesh render queue!" );
+		return;
+	}
+
+	WriteShapeInstances(
+		shapes,
+		static_cast<ShapeInstance*>( instance_data )
+	);
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::SHAPE_INSTANCE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsShapeInstancePushConstants pc {};
+		pc.render_target_size				= glm::vec2( size );
+		pc.shape							= shape;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SHAPE_INSTANCE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( ShapeInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		shape_count,
+		0,
+		first_instance
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawCircles(
+	const std::vector<CirclePrimitive>		&	circles
+)
+{
+	DrawShapes(
+		ShapeInstanceType::CIRCLE,
+		circles
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawRoundedRects(
+	const std::vector<RoundedRectPrimitive>	&	rounded_rects
+)
+{
+	DrawShapes(
+		ShapeInstanceType::ROUNDED_RECTANGLE,
+		rounded_rects
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawRings(
+	const std::vector<RingPrimitive>		&	rings
+)
+{
+	DrawShapes(
+		ShapeInstanceType::RING,
+		rings
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawPolylines(
+	const std::vector<Polyline>			&	polylines,
+	PolylineJoin							join,
+	PolylineCap								cap,
+	float									miter_limit
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	auto point_count		= CalculatePolylinePointInstanceCount( polylines );
+	if( point_count < 2 ) return;
+
+	auto & swap				= swap_buffers[ current_swap_buffer ];
+	auto command_buffer		= swap.vk_render_command_buffer;
+
+	// Polylines do not use a shared table, an empty one is pushed once per frame.
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		point_count,
+		uint32_t( sizeof( PolylinePointInstance ) ),
+		nullptr,
+		0,
+		0,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push polylines into mesh render queue!" );
+		return;
+	}
+
+	WritePolylinePointInstances(
+		polylines,
+		static_cast<PolylinePointInstance*>( instance_data )
+	);
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::POLYLINE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsPolylinePushConstants pc {};
+		pc.render_target_size				= glm::vec2( size );
+		pc.join								= uint32_t( join );
+		pc.cap								= uint32_t( cap );
+		pc.miter_limit						= std::max( miter_limit, 1.0f );
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_POLYLINE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	// Each segment reads its own point and the next one, the last point
+	// does not start a segment.
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( PolylinePointInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		point_count - 1,
+		0,
+		first_instance
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawParticleSystem(
+	ParticleSystem						*	particle_system,
+	Texture								*	texture,
+	Sampler								*	sampler
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( !particle_system || !particle_system->IsGood() ) return;
+
+	auto & swap					= swap_buffers[ current_swap_buffer ];
+	auto command_buffer			= swap.vk_render_command_buffer;
+	auto particle_system_impl	= particle_system->impl.get();
+
+	if( !texture ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !texture->IsTextureDataReady() ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !sampler ) {
+		sampler = instance->GetDefaultSampler();
+	}
+
+	CheckAndAddRenderTargetTextureDependency(
+		current_swap_buffer,
+		texture
+	);
+
+	// Particle sizes are only known on the GPU.
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		nullptr,
+		{}
+	);
+
+	// Simulation is recorded in the transfer command buffer, see RecordTransferCommandBuffer().
+	if( std::find( particle_systems_to_update.begin(), particle_systems_to_update.end(), particle_system_impl ) == particle_systems_to_update.end() ) {
+		particle_systems_to_update.push_back( particle_system_impl );
+	}
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::PARTICLE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	CmdBindSamplerIfDifferent(
+		command_buffer,
+		sampler,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+	CmdBindTextureIfDifferent(
+		command_buffer,
+		texture,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+
+	// Particle buffer takes the place of the vertex buffer.
+	{
+		auto descriptor_set = particle_system_impl->GetVertexBufferDescriptorSet();
+
+		CmdInsertCommandBufferCheckpoint(
+			command_buffer,
+			"ParticleSystem",
+			CommandBufferCheckpointType::BIND_VERTEX_BUFFER
+		);
+		vkCmdBindDescriptorSets(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_VERTEX_BUFFER_AS_STORAGE_BUFFER,
+			1, &descriptor_set,
+			0, nullptr
+		);
+		mesh_buffer->InvalidateBoundVertexBuffer();
+	}
+
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.texture_channel_weight_count		= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"ParticleSystem",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		particle_system_impl->GetCapacity(),
+		0,
+		0
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
+	const std::vector<VertexIndex_2>	&	indices,
+	const std::vector<Vertex>			&	vertices,
+	const std::vector<float>			&	texture_layer_weights,
+	const std::vector<glm::mat4>		&	transformations,
+	Texture								*	texture,
+	Sampler								*	sampler,
+	float									line_width
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	auto index_count	= uint32_t( indices.size() * 2 );
+	std::vector<uint32_t> raw_indices;
+	raw_indices.resize( index_count );
+	for( size_t i = 0, a = 0; i < indices.size(); ++i, a += 2 ) {
+		raw_indices[ a + 0 ] = indices[ i ].indices[ 0 ];
+		raw_indices[ a + 1 ] = indices[ i ].indices[ 1 ];
+	}
+
+	DrawLineList(
+		raw_indices,
+		vertices,
+		texture_layer_weights,
+		transformations,
+		texture,
+		sampler,
+		line_width
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawLineList(
+	const std::vector<uint32_t>		&	raw_indices,
+	const std::vector<Vertex>		&	vertices,
+	const std::vector<float>		&	texture_layer_weights,
+	const std::vector<glm::mat4>	&	transformations,
+	Texture							*	texture,
+	Sampler							*	sampler,
+	float								line_width
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	auto & swap			= swap_buffers[ current_swap_buffer ];
+	auto command_buffer	= swap.vk_render_command_buffer;
+
+	auto vertex_count	= uint32_t( vertices.size() );
+	auto index_count	= uint32_t( raw_indices.size() );
+
+	if( !texture ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !texture->IsTextureDataReady() ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !sampler ) {
+		sampler = instance->GetDefaultSampler();
+	}
+
+	CheckAndAddRenderTargetTextureDependency(
+		current_swap_buffer,
+		texture
+	);
+
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		&vertices,
+		transformations
+	);
+
+	{
+		bool multitextured = texture->GetLayerCount() > 1 &&
+			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
+
+		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
+			multitextured,
+			sampler->impl->IsAnyBorderColorEnabled(),
+			2
+		);
+
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_LINE;
+		pipeline_settings.shader_programs		= graphics_shader_programs;
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	CmdSetLineWidthIfDifferent(
+		command_buffer,
+		line_width
+	);
+	CmdBindSamplerIfDifferent(
+		command_buffer,
+		sampler,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+	CmdBindTextureIfDifferent(
+		command_buffer,
+		texture,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+
+	auto push_result = mesh_buffer->CmdPushMesh(
+		command_buffer,
+		raw_indices,
 		vertices,
 		texture_layer_weights,
 		transformations
@@ -1310,6 +2009,14 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawPointList(
 		texture
 	);
 
+	// Point sprites cover the whole texture regardless of UV coordinates.
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		nullptr,
+		transformations
+	);
+
 	{
 		bool multitextured = texture->GetLayerCount() > 1 &&
 			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
@@ -1408,7 +2115,9 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::DrawMesh(
 				transformations,
 				true,
 				mesh.texture,
-				mesh.sampler
+				mesh.sampler,
+				mesh.signed_distance_field_spread,
+				&mesh.signed_distance_field_effects
 			);
 			break;
 		case MeshType::TRIANGLE_WIREFRAME:
@@ -1737,9 +2446,28 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 		granularity_aligned = false;
 	}
 
-	mipmap_levels				= GenerateMipSizes(
-		create_info_copy.size
+	if( create_info_copy.mipmap_mode == RenderTargetTextureMipmapMode::NEVER ) {
+		mipmap_levels			= { { create_info_copy.size.x, create_info_copy.size.y } };
+	} else {
+		mipmap_levels			= GenerateMipSizes(
+			create_info_copy.size
+		);
+	}
+
+	// Sampled image mipmaps are generated with compute shaders if the
+	// format can be used as a storage image, blitting is used otherwise.
+	use_compute_mipmap_generation	= IsComputeMipmapGenerationSupported(
+		instance,
+		surface_format,
+		render_queue
 	);
+	// Blur images are always storage images, compute blur has the same
+	// format and queue requirements as compute mipmap generation.
+	use_compute_blur				= use_compute_mipmap_generation && create_info_copy.enable_blur;
+	VkImageUsageFlags sampled_image_usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+	if( use_compute_mipmap_generation ) {
+		sampled_image_usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+	}
 
 	// Using switch to decouple different paths of what resources to create.
 	switch( type ) {
@@ -1764,7 +2492,7 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 
 				// Create sampled image.
 				s.sampled_image = CreateLocalImageResource(
-					VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					sampled_image_usage,
 					{ &render_queue },
 					VK_SAMPLE_COUNT_1_BIT,
 					mipmap_levels,
@@ -1798,7 +2526,7 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 
 				// Create sampled image.
 				s.sampled_image = CreateLocalImageResource(
-					VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					sampled_image_usage,
 					{ &render_queue },
 					VK_SAMPLE_COUNT_1_BIT,
 					mipmap_levels,
@@ -1833,7 +2561,7 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 
 				// Create sampled image.
 				s.sampled_image = CreateLocalImageResource(
-					VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					sampled_image_usage,
 					{ &render_queue },
 					VK_SAMPLE_COUNT_1_BIT,
 					mipmap_levels,
@@ -1874,7 +2602,7 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 
 				// Create sampled image.
 				s.sampled_image = CreateLocalImageResource(
-					VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
+					sampled_image_usage,
 					{ &render_queue },
 					VK_SAMPLE_COUNT_1_BIT,
 					mipmap_levels,
@@ -1892,12 +2620,33 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateImages(
 		}
 	}
 
+	for( auto & s : swap_buffers ) {
+		s.are_sampled_image_mip_levels_initialized = false;
+	}
+
+	if( use_compute_mipmap_generation ) {
+		for( auto & s : swap_buffers ) {
+			s.sampled_image_mip_level_views = CreateMipLevelImageViews(
+				instance,
+				s.sampled_image.image,
+				surface_format,
+				uint32_t( std::size( mipmap_levels ) ),
+				1
+			);
+			if( std::empty( s.sampled_image_mip_level_views ) ) {
+				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create RenderTargetTexture, cannot create sampled image mip level views!" );
+				return false;
+			}
+		}
+	}
+
 	return true;
 }
 
 void vk2d::vk2d_internal::RenderTargetTextureImpl::DestroyImages()
 {
 	for( auto & s : swap_buffers ) {
+		DestroyMipLevelImageViews( instance, s.sampled_image_mip_level_views );
 		instance->GetDeviceMemoryPool()->FreeCompleteResource( s.attachment_image );
 		instance->GetDeviceMemoryPool()->FreeCompleteResource( s.sampled_image );
 		instance->GetDeviceMemoryPool()->FreeCompleteResource( s.buffer_1_image );
@@ -2272,11 +3021,8 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateSynchronizationPrimitiv
 	// to set it once finished and then use the same semaphore to indicate the render
 	// target texture is ready to be used. As a bonus we can also wait on the timeline
 	// semaphore on CPU, making host synchronization a bit easier to implement.
-	VkSemaphoreCreateInfo binary_semaphore_create_info {};
-	binary_semaphore_create_info.sType		= VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-	binary_semaphore_create_info.pNext		= nullptr;
-	binary_semaphore_create_info.flags		= 0;
-
+	// Transfers need no semaphore, they are submitted in the same batch before
+	// all renders, see RenderTargetTextureRenderGraph.
 	VkSemaphoreTypeCreateInfo timeline_semaphore_type_create_info {};
 	timeline_semaphore_type_create_info.sType			= VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
 	timeline_semaphore_type_create_info.pNext			= nullptr;
@@ -2290,17 +3036,6 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateSynchronizationPrimitiv
 
 	for( auto & s : swap_buffers ) {
 
-		result = vkCreateSemaphore(
-			instance->GetVulkanDevice(),
-			&binary_semaphore_create_info,
-			nullptr,
-			&s.vk_transfer_complete_semaphore
-		);
-		if( result != VK_SUCCESS ) {
-			instance->Report( result, "Internal error: Cannot create RenderTargetTexture, cannot create synchronization primitives!" );
-			return false;
-		}
-
 		result = vkCreateSemaphore(
 			instance->GetVulkanDevice(),
 			//create_info_copy.enable_blur ? &binary_semaphore_create_info : &timeline_semaphore_create_info,
@@ -2319,11 +3054,6 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CreateSynchronizationPrimitiv
 void vk2d::vk2d_internal::RenderTargetTextureImpl::DestroySynchronizationPrimitives()
 {
 	for( auto & s : swap_buffers ) {
-		vkDestroySemaphore(
-			instance->GetVulkanDevice(),
-			s.vk_transfer_complete_semaphore,
-			nullptr
-		);
 		vkDestroySemaphore(
 			instance->GetVulkanDevice(),
 			s.vk_render_complete_semaphore,
@@ -2378,6 +3108,16 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::RecordTransferCommandBuffer(
 		}
 	}
 
+	// Record particle system updates, particles drawn this frame read the results
+	{
+		for( auto particle_system : particle_systems_to_update ) {
+			particle_system->CmdUpdate(
+				command_buffer
+			);
+		}
+		particle_systems_to_update.clear();
+	}
+
 	// End command buffer
 	{
 		auto result = vkEndCommandBuffer(
@@ -2392,63 +3132,6 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::RecordTransferCommandBuffer(
 	return true;
 }
 
-bool vk2d::vk2d_internal::RenderTargetTextureImpl::UpdateSubmitInfos(
-	RenderTargetTextureImpl::SwapBuffer			&	swap,
-	const std::vector<VkSemaphore>				&	wait_for_semaphores,
-	const std::vector<uint64_t>					&	wait_for_semaphore_timeline_values,
-	const std::vector<VkPipelineStageFlags>		&	wait_for_semaphore_pipeline_stages
-)
-{
-	assert( std::size( wait_for_semaphores ) == std::size( wait_for_semaphore_timeline_values ) );
-	assert( std::size( wait_for_semaphores ) == std::size( wait_for_semaphore_pipeline_stages ) );
-
-	swap.vk_transfer_submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	swap.vk_transfer_submit_info.pNext					= nullptr;
-	swap.vk_transfer_submit_info.waitSemaphoreCount		= 0;
-	swap.vk_transfer_submit_info.pWaitSemaphores		= nullptr;
-	swap.vk_transfer_submit_info.pWaitDstStageMask		= nullptr;
-	swap.vk_transfer_submit_info.commandBufferCount		= 1;
-	swap.vk_transfer_submit_info.pCommandBuffers		= &swap.vk_transfer_command_buffer;
-	swap.vk_transfer_submit_info.signalSemaphoreCount	= 1;
-	swap.vk_transfer_submit_info.pSignalSemaphores		= &swap.vk_transfer_complete_semaphore;
-
-	// wait_for_semaphores lists all semaphores the render must wait for.
-	// wait_for_semaphore_timeline_values lists values to wait for in the timeline semaphores.
-	// These lists need to be same size, each semaphore in wait_for_semaphores has a corresponding
-	// timeline value to wait for in wait_for_semaphore_timeline_values.
-	// First entry is a transfer semaphore (binary), rest will be from dependant render target render
-	// semaphores (timeline). We need a dummy value for every binary semaphore to keep the lists in sync.
-
-	swap.render_wait_for_semaphores.push_back( swap.vk_transfer_complete_semaphore );
-	swap.render_wait_for_semaphore_timeline_values.push_back( 1 );
-	swap.render_wait_for_pipeline_stages.push_back( VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT );
-
-	for( size_t i = 0; i < std::size( wait_for_semaphores ); ++i ) {
-		swap.render_wait_for_semaphores.push_back( wait_for_semaphores[ i ] );
-		swap.render_wait_for_semaphore_timeline_values.push_back( wait_for_semaphore_timeline_values[ i ] );
-		swap.render_wait_for_pipeline_stages.push_back( wait_for_semaphore_pipeline_stages[ i ] );
-	}
-
-	swap.vk_render_timeline_semaphore_submit_info.sType						= VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
-	swap.vk_render_timeline_semaphore_submit_info.pNext						= nullptr;
-	swap.vk_render_timeline_semaphore_submit_info.waitSemaphoreValueCount	= uint32_t( std::size( swap.render_wait_for_semaphore_timeline_values ) );
-	swap.vk_render_timeline_semaphore_submit_info.pWaitSemaphoreValues		= swap.render_wait_for_semaphore_timeline_values.data();
-	swap.vk_render_timeline_semaphore_submit_info.signalSemaphoreValueCount	= 1;
-	swap.vk_render_timeline_semaphore_submit_info.pSignalSemaphoreValues	= &swap.render_counter;		// Ignored if blur is enabled.
-
-	swap.vk_render_submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	swap.vk_render_submit_info.pNext					= &swap.vk_render_timeline_semaphore_submit_info;
-	swap.vk_render_submit_info.waitSemaphoreCount		= uint32_t( std::size( swap.render_wait_for_semaphores ) );
-	swap.vk_render_submit_info.pWaitSemaphores			= swap.render_wait_for_semaphores.data();
-	swap.vk_render_submit_info.pWaitDstStageMask		= swap.render_wait_for_pipeline_stages.data();
-	swap.vk_render_submit_info.commandBufferCount		= 1;
-	swap.vk_render_submit_info.pCommandBuffers			= &swap.vk_render_command_buffer;
-	swap.vk_render_submit_info.signalSemaphoreCount		= 1;
-	swap.vk_render_submit_info.pSignalSemaphores		= &swap.vk_render_complete_semaphore;
-
-	return true;
-}
-
 vk2d::vk2d_internal::TimedDescriptorPoolData & vk2d::vk2d_internal::RenderTargetTextureImpl::GetOrCreateDescriptorSetForSampler(
 	Sampler	*	sampler
 )
@@ -2598,29 +3281,65 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdFinalizeRender(
 		case RenderTargetTextureType::DIRECT:
 			// ( Render ) -> Attachment -> ( Blit ) -> Sampled.
 
-			CmdBlitMipmapsToSampledImage(
+			CmdGenerateMipmapsToSampledImage(
+				swap,
 				swap.vk_render_command_buffer,
 				swap.attachment_image,
 				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
-				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-				swap.sampled_image
+				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
 			);
 			break;
 
 		case RenderTargetTextureType::WITH_MULTISAMPLE:
 			// (Render) -> Attachment -> (Resolve) -> Buffer1 -> (Blit) -> Sampled.
 
-			CmdBlitMipmapsToSampledImage(
+			CmdGenerateMipmapsToSampledImage(
+				swap,
 				swap.vk_render_command_buffer,
 				swap.buffer_1_image,
 				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
-				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-				swap.sampled_image
+				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
 			);
 			break;
 
 		case RenderTargetTextureType::WITH_BLUR:
 			// (Render) -> Attachment -> (Render) -> Buffer1 -> (Render) -> Attachment -> (Blit) -> Sampled.
+			// (Render) -> Attachment -> (Compute) -> Buffer1 -> (Compute) -> Attachment -> (Blit) -> Sampled.
+			// (Render) -> Attachment -> (Copy) -> Sampled -> (Compute) -> Sampled.
+
+			if( blur_type == BlurType::DUAL_KAWASE && CanUseDualKawaseBlur() ) {
+				CmdComputeMipmapsToSampledImage(
+					swap.vk_render_command_buffer,
+					swap.attachment_image,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
+					VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+					swap.sampled_image,
+					swap.sampled_image_mip_level_views,
+					blur_amount
+				);
+				break;
+			}
+
+			if( CanUseComputeBlur( blur_amount ) ) {
+				CmdRecordComputeBlurCommands(
+					swap.vk_render_command_buffer,
+					blur_type,
+					blur_amount,
+					swap.attachment_image,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
+					VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+					swap.buffer_1_image,
+					swap.attachment_image
+				);
+				CmdGenerateMipmapsToSampledImage(
+					swap,
+					swap.vk_render_command_buffer,
+					swap.attachment_image,
+					VK_IMAGE_LAYOUT_GENERAL,					// Coming from compute blur, the image layout will be general.
+					VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+				);
+				break;
+			}
 
 			CmdRecordBlurCommands(
 				swap,
@@ -2633,17 +3352,53 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdFinalizeRender(
 				swap.buffer_1_image,
 				swap.attachment_image
 			);
-			CmdBlitMipmapsToSampledImage(
+			CmdGenerateMipmapsToSampledImage(
+				swap,
 				swap.vk_render_command_buffer,
 				swap.attachment_image,
 				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from blur render pass, the image layout will be color attachment optimal.
-				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-				swap.sampled_image
+				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
 			);
 			break;
 
 		case RenderTargetTextureType::WITH_MULTISAMPLE_AND_BLUR:
 			// (Render) -> Attachment -> (Resolve) -> Buffer1 -> (Render) -> Buffer2 -> (Render) -> Buffer1 -> (Blit) -> Sampled.
+			// (Render) -> Attachment -> (Resolve) -> Buffer1 -> (Compute) -> Buffer2 -> (Compute) -> Buffer1 -> (Blit) -> Sampled.
+			// (Render) -> Attachment -> (Resolve) -> Buffer1 -> (Copy) -> Sampled -> (Compute) -> Sampled.
+
+			if( blur_type == BlurType::DUAL_KAWASE && CanUseDualKawaseBlur() ) {
+				CmdComputeMipmapsToSampledImage(
+					swap.vk_render_command_buffer,
+					swap.buffer_1_image,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
+					VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+					swap.sampled_image,
+					swap.sampled_image_mip_level_views,
+					blur_amount
+				);
+				break;
+			}
+
+			if( CanUseComputeBlur( blur_amount ) ) {
+				CmdRecordComputeBlurCommands(
+					swap.vk_render_command_buffer,
+					blur_type,
+					blur_amount,
+					swap.buffer_1_image,
+					VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from render pass, the image layout will be color attachment optimal.
+					VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+					swap.buffer_2_image,
+					swap.buffer_1_image
+				);
+				CmdGenerateMipmapsToSampledImage(
+					swap,
+					swap.vk_render_command_buffer,
+					swap.buffer_1_image,
+					VK_IMAGE_LAYOUT_GENERAL,					// Coming from compute blur, the image layout will be general.
+					VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT
+				);
+				break;
+			}
 
 			CmdRecordBlurCommands(
 				swap,
@@ -2656,18 +3411,189 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdFinalizeRender(
 				swap.buffer_2_image,
 				swap.buffer_1_image
 			);
-			CmdBlitMipmapsToSampledImage(
+			CmdGenerateMipmapsToSampledImage(
+				swap,
 				swap.vk_render_command_buffer,
 				swap.buffer_1_image,
 				VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,	// Coming from blur render pass, the image layout will be color attachment optimal.
-				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
-				swap.sampled_image
+				VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
 			);
 			break;
 
-		default:
-			instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot finalize render target texture rendering, Invalid RenderTargetTextureType!" );
-			break;
+		default:
+			instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot finalize render target texture rendering, Invalid RenderTargetTextureType!" );
+			break;
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdGenerateMipmapsToSampledImage(
+	RenderTargetTextureImpl::SwapBuffer		&	swap,
+	VkCommandBuffer								command_buffer,
+	CompleteImageResource					&	source_image,
+	VkImageLayout								source_image_layout,
+	VkPipelineStageFlagBits						source_image_pipeline_barrier_src_stage
+)
+{
+	// On demand mipmaps are decided when the render is committed.
+	if( create_info_copy.mipmap_mode == RenderTargetTextureMipmapMode::ON_DEMAND ) {
+		assert( command_buffer == swap.vk_render_command_buffer );
+		swap.deferred_mipmap_source_image			= &source_image;
+		swap.deferred_mipmap_source_image_layout	= source_image_layout;
+		swap.deferred_mipmap_source_image_stage		= source_image_pipeline_barrier_src_stage;
+		swap.is_mipmap_generation_deferred			= true;
+		return;
+	}
+
+	CmdRecordMipmapsToSampledImage(
+		swap,
+		command_buffer,
+		source_image,
+		source_image_layout,
+		source_image_pipeline_barrier_src_stage
+	);
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdRecordMipmapsToSampledImage(
+	RenderTargetTextureImpl::SwapBuffer		&	swap,
+	VkCommandBuffer								command_buffer,
+	CompleteImageResource					&	source_image,
+	VkImageLayout								source_image_layout,
+	VkPipelineStageFlagBits						source_image_pipeline_barrier_src_stage
+)
+{
+	if( use_compute_mipmap_generation && std::size( mipmap_levels ) > 1 ) {
+		CmdComputeMipmapsToSampledImage(
+			command_buffer,
+			source_image,
+			source_image_layout,
+			source_image_pipeline_barrier_src_stage,
+			swap.sampled_image,
+			swap.sampled_image_mip_level_views,
+			glm::vec2( 0.0f )
+		);
+	} else {
+		CmdBlitMipmapsToSampledImage(
+			command_buffer,
+			source_image,
+			source_image_layout,
+			source_image_pipeline_barrier_src_stage,
+			swap.sampled_image
+		);
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdCopyToSampledImageWithoutMipmaps(
+	RenderTargetTextureImpl::SwapBuffer		&	swap,
+	VkCommandBuffer								command_buffer,
+	CompleteImageResource					&	source_image,
+	VkImageLayout								source_image_layout,
+	VkPipelineStageFlagBits						source_image_pipeline_barrier_src_stage
+)
+{
+	assert( command_buffer );
+	assert( instance );
+	assert( std::size( mipmap_levels ) );
+
+	VkImageSubresourceRange subresource_range_mip_0 {};
+	subresource_range_mip_0.aspectMask				= VK_IMAGE_ASPECT_COLOR_BIT;
+	subresource_range_mip_0.baseMipLevel			= 0;
+	subresource_range_mip_0.levelCount				= 1;
+	subresource_range_mip_0.baseArrayLayer			= 0;
+	subresource_range_mip_0.layerCount				= 1;
+
+	VkImageSubresourceRange subresource_range_mip_1_and_up {};
+	subresource_range_mip_1_and_up.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+	subresource_range_mip_1_and_up.baseMipLevel		= 1;
+	subresource_range_mip_1_and_up.levelCount		= uint32_t( std::size( mipmap_levels ) - 1 );
+	subresource_range_mip_1_and_up.baseArrayLayer	= 0;
+	subresource_range_mip_1_and_up.layerCount		= 1;
+
+	{
+		std::array<VkImageMemoryBarrier, 3> image_memory_barriers;
+		uint32_t image_memory_barrier_count = 2;
+
+		// Source image barrier ( mip level 0 only ).
+		image_memory_barriers[ 0 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext					= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask			= VK_ACCESS_MEMORY_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask			= VK_ACCESS_TRANSFER_READ_BIT;
+		image_memory_barriers[ 0 ].oldLayout				= source_image_layout;
+		image_memory_barriers[ 0 ].newLayout				= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image					= source_image.image;
+		image_memory_barriers[ 0 ].subresourceRange			= subresource_range_mip_0;
+
+		// Sampled image barrier ( mip level 0 only ).
+		image_memory_barriers[ 1 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 1 ].pNext					= nullptr;
+		image_memory_barriers[ 1 ].srcAccessMask			= 0;
+		image_memory_barriers[ 1 ].dstAccessMask			= VK_ACCESS_TRANSFER_WRITE_BIT;
+		image_memory_barriers[ 1 ].oldLayout				= VK_IMAGE_LAYOUT_UNDEFINED;
+		image_memory_barriers[ 1 ].newLayout				= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		image_memory_barriers[ 1 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].image					= swap.sampled_image.image;
+		image_memory_barriers[ 1 ].subresourceRange			= subresource_range_mip_0;
+
+		// Sampled image barrier ( mip level 1 and up ).
+		// Other mip levels are left untouched so that they keep the mipmaps
+		// of an earlier render, they only need to leave undefined layout once.
+		if( !swap.are_sampled_image_mip_levels_initialized && subresource_range_mip_1_and_up.levelCount ) {
+			image_memory_barriers[ 2 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			image_memory_barriers[ 2 ].pNext					= nullptr;
+			image_memory_barriers[ 2 ].srcAccessMask			= 0;
+			image_memory_barriers[ 2 ].dstAccessMask			= vk_sampled_image_final_access_mask;
+			image_memory_barriers[ 2 ].oldLayout				= VK_IMAGE_LAYOUT_UNDEFINED;
+			image_memory_barriers[ 2 ].newLayout				= vk_sampled_image_final_layout;
+			image_memory_barriers[ 2 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+			image_memory_barriers[ 2 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+			image_memory_barriers[ 2 ].image					= swap.sampled_image.image;
+			image_memory_barriers[ 2 ].subresourceRange			= subresource_range_mip_1_and_up;
+			++image_memory_barrier_count;
+		}
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			source_image_pipeline_barrier_src_stage,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			image_memory_barrier_count, image_memory_barriers.data()
+		);
+	}
+
+	CmdCopyToSampledImageMipLevel0(
+		command_buffer,
+		source_image,
+		swap.sampled_image
+	);
+
+	// Transition sampled image mip level 0 layout to shader use optimal.
+	{
+		std::array<VkImageMemoryBarrier, 1> image_memory_barriers;
+
+		image_memory_barriers[ 0 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext					= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask			= VK_ACCESS_TRANSFER_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask			= vk_sampled_image_final_access_mask;
+		image_memory_barriers[ 0 ].oldLayout				= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		image_memory_barriers[ 0 ].newLayout				= vk_sampled_image_final_layout;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image					= swap.sampled_image.image;
+		image_memory_barriers[ 0 ].subresourceRange			= subresource_range_mip_0;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
 	}
 }
 
@@ -2759,69 +3685,11 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdBlitMipmapsToSampledImage(
 		);
 	}
 
-	if( granularity_aligned ) {
-
-		// Copying from the source image to sampled image mip level 0.
-		// The render target image size is aligned to image granularity so we
-		// can do a fast copy from source to sampled image.
-
-		VkImageCopy region {};
-		region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-		region.srcSubresource.mipLevel			= 0;
-		region.srcSubresource.baseArrayLayer	= 0;
-		region.srcSubresource.layerCount		= 1;
-		region.srcOffset						= { 0, 0, 0 };
-		region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-		region.dstSubresource.mipLevel			= 0;
-		region.dstSubresource.baseArrayLayer	= 0;
-		region.dstSubresource.layerCount		= 1;
-		region.dstOffset						= { 0, 0, 0 };
-		region.extent							= { size.x, size.y, 1 };
-		vkCmdCopyImage(
-			command_buffer,
-			source_image.image,
-			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-			destination_image.image,
-			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			1, &region
-		);
-	} else {
-
-		// Copying from the source image to sampled image mip level 0.
-		// The render target image is not aligned to image granularity
-		// so as a shortcut we'll do a 1:1 blit operation.
-
-		// TODO: Investigate if we can get rid of blitting when copying from source to sampled image with unaligned granularity.
-		// Force render target extent to be multiple of the primary render queue
-		// family granularity. Needs more research of how the render target
-		// texture behaves when rendered as a texture on a surface, specifically
-		// need to know if we can control the image extent manually when sampling
-		// the sampled image in a shader.
-
-		// Blit from source to sampled ( to mip level 0 only ).
-		VkImageBlit region {};
-		region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-		region.srcSubresource.mipLevel			= 0;
-		region.srcSubresource.baseArrayLayer	= 0;
-		region.srcSubresource.layerCount		= 1;
-		region.srcOffsets[ 0 ]					= { 0, 0, 0 };
-		region.srcOffsets[ 1 ]					= { int32_t( size.x ), int32_t( size.y ), 1 };
-		region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-		region.dstSubresource.mipLevel			= 0;
-		region.dstSubresource.baseArrayLayer	= 0;
-		region.dstSubresource.layerCount		= 1;
-		region.dstOffsets[ 0 ]					= { 0, 0, 0 };
-		region.dstOffsets[ 1 ]					= { int32_t( size.x ), int32_t( size.y ), 1 };
-		vkCmdBlitImage(
-			command_buffer,
-			source_image.image,
-			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-			destination_image.image,
-			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-			1, &region,
-			VK_FILTER_NEAREST
-		);
-	}
+	CmdCopyToSampledImageMipLevel0(
+		command_buffer,
+		source_image,
+		destination_image
+	);
 
 	// We can directly blit into the second mip level from the source image.
 	if( std::size( mipmap_levels ) > 1 ) {
@@ -2993,16 +3861,260 @@ void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdBlitMipmapsToSampledImage(
 		image_memory_barriers[ 0 ].subresourceRange.baseArrayLayer	= 0;
 		image_memory_barriers[ 0 ].subresourceRange.layerCount		= 1;
 
-		vkCmdPipelineBarrier(
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdComputeMipmapsToSampledImage(
+	VkCommandBuffer						command_buffer,
+	CompleteImageResource			&	source_image,
+	VkImageLayout						source_image_layout,
+	VkPipelineStageFlagBits				source_image_pipeline_barrier_src_stage,
+	CompleteImageResource			&	destination_image,
+	const std::vector<VkImageView>	&	destination_mip_level_views,
+	glm::vec2							dual_kawase_blur_amount
+)
+{
+	// General view of this function:
+	// - Copy the source image to sampled image mip level 0.
+	// - Optionally blur mip level 0 in place, see
+	//   CmdRecordDualKawaseBlur().
+	// - Generate remaining mip levels with compute shader, see
+	//   CmdGenerateMipmapsWithCompute(), storage images need
+	//   general layout.
+	// - Transition all mip levels to final layout at once.
+
+	assert( command_buffer );
+	assert( instance );
+	assert( std::size( mipmap_levels ) > 1 );
+	assert( std::size( destination_mip_level_views ) == std::size( mipmap_levels ) );
+
+	VkImageSubresourceRange subresource_range_mip_0 {};
+	subresource_range_mip_0.aspectMask			= VK_IMAGE_ASPECT_COLOR_BIT;
+	subresource_range_mip_0.baseMipLevel		= 0;
+	subresource_range_mip_0.levelCount			= 1;
+	subresource_range_mip_0.baseArrayLayer		= 0;
+	subresource_range_mip_0.layerCount			= 1;
+
+	VkImageSubresourceRange subresource_range_mip_1_and_up {};
+	subresource_range_mip_1_and_up.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+	subresource_range_mip_1_and_up.baseMipLevel		= 1;
+	subresource_range_mip_1_and_up.levelCount		= uint32_t( std::size( mipmap_levels ) - 1 );
+	subresource_range_mip_1_and_up.baseArrayLayer	= 0;
+	subresource_range_mip_1_and_up.layerCount		= 1;
+
+	VkImageSubresourceRange subresource_range_all_mips {};
+	subresource_range_all_mips.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+	subresource_range_all_mips.baseMipLevel		= 0;
+	subresource_range_all_mips.levelCount		= uint32_t( std::size( mipmap_levels ) );
+	subresource_range_all_mips.baseArrayLayer	= 0;
+	subresource_range_all_mips.layerCount		= 1;
+
+	{
+		std::array<VkImageMemoryBarrier, 3> image_memory_barriers;
+
+		// Source image barrier ( mip level 0 only ).
+		image_memory_barriers[ 0 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext					= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask			= VK_ACCESS_MEMORY_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask			= VK_ACCESS_TRANSFER_READ_BIT;
+		image_memory_barriers[ 0 ].oldLayout				= source_image_layout;
+		image_memory_barriers[ 0 ].newLayout				= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image					= source_image.image;
+		image_memory_barriers[ 0 ].subresourceRange			= subresource_range_mip_0;
+
+		// Sampled image barrier ( mip level 0 ), copy destination.
+		image_memory_barriers[ 1 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 1 ].pNext					= nullptr;
+		image_memory_barriers[ 1 ].srcAccessMask			= 0;
+		image_memory_barriers[ 1 ].dstAccessMask			= VK_ACCESS_TRANSFER_WRITE_BIT;
+		image_memory_barriers[ 1 ].oldLayout				= VK_IMAGE_LAYOUT_UNDEFINED;
+		image_memory_barriers[ 1 ].newLayout				= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		image_memory_barriers[ 1 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].image					= destination_image.image;
+		image_memory_barriers[ 1 ].subresourceRange			= subresource_range_mip_0;
+
+		// Sampled image barrier ( mip level 1 and up ), compute shader destinations.
+		image_memory_barriers[ 2 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 2 ].pNext					= nullptr;
+		image_memory_barriers[ 2 ].srcAccessMask			= 0;
+		image_memory_barriers[ 2 ].dstAccessMask			= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		image_memory_barriers[ 2 ].oldLayout				= VK_IMAGE_LAYOUT_UNDEFINED;
+		image_memory_barriers[ 2 ].newLayout				= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 2 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 2 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 2 ].image					= destination_image.image;
+		image_memory_barriers[ 2 ].subresourceRange			= subresource_range_mip_1_and_up;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			source_image_pipeline_barrier_src_stage,
+			VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
+	}
+
+	CmdCopyToSampledImageMipLevel0(
+		command_buffer,
+		source_image,
+		destination_image
+	);
+
+	// Mip level 0 is read by the compute shader, and written to by dual Kawase blur.
+	{
+		std::array<VkImageMemoryBarrier, 1> image_memory_barriers;
+
+		image_memory_barriers[ 0 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext					= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask			= VK_ACCESS_TRANSFER_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask			= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+		image_memory_barriers[ 0 ].oldLayout				= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		image_memory_barriers[ 0 ].newLayout				= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image					= destination_image.image;
+		image_memory_barriers[ 0 ].subresourceRange			= subresource_range_mip_0;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
+	}
+
+	CmdRecordDualKawaseBlur(
+		command_buffer,
+		destination_mip_level_views,
+		dual_kawase_blur_amount
+	);
+
+	CmdGenerateMipmapsWithCompute(
+		instance,
+		command_buffer,
+		destination_mip_level_views,
+		mipmap_levels,
+		1,
+		create_info_copy.mipmap_filter
+	);
+
+	// Transition all mip levels to final layout.
+	{
+		std::array<VkImageMemoryBarrier, 1> image_memory_barriers;
+
+		image_memory_barriers[ 0 ].sType					= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext					= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask			= VK_ACCESS_SHADER_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask			= vk_sampled_image_final_access_mask;
+		image_memory_barriers[ 0 ].oldLayout				= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 0 ].newLayout				= vk_sampled_image_final_layout;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex		= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image					= destination_image.image;
+		image_memory_barriers[ 0 ].subresourceRange			= subresource_range_all_mips;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdCopyToSampledImageMipLevel0(
+	VkCommandBuffer						command_buffer,
+	CompleteImageResource			&	source_image,
+	CompleteImageResource			&	destination_image
+)
+{
+	// Source image must be in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL layout and
+	// destination image mip level 0 in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+
+	if( granularity_aligned ) {
+
+		// Copying from the source image to sampled image mip level 0.
+		// The render target image size is aligned to image granularity so we
+		// can do a fast copy from source to sampled image.
+
+		VkImageCopy region {};
+		region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		region.srcSubresource.mipLevel			= 0;
+		region.srcSubresource.baseArrayLayer	= 0;
+		region.srcSubresource.layerCount		= 1;
+		region.srcOffset						= { 0, 0, 0 };
+		region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		region.dstSubresource.mipLevel			= 0;
+		region.dstSubresource.baseArrayLayer	= 0;
+		region.dstSubresource.layerCount		= 1;
+		region.dstOffset						= { 0, 0, 0 };
+		region.extent							= { size.x, size.y, 1 };
+		vkCmdCopyImage(
+			command_buffer,
+			source_image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			destination_image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			1, &region
+		);
+	} else {
+
+		// Copying from the source image to sampled image mip level 0.
+		// The render target image is not aligned to image granularity
+		// so as a shortcut we'll do a 1:1 blit operation.
+
+		// TODO: Investigate if we can get rid of blitting when copying from source to sampled image with unaligned granularity.
+		// Force render target extent to be multiple of the primary render queue
+		// family granularity. Needs more research of how the render target
+		// texture behaves when rendered as a texture on a surface, specifically
+		// need to know if we can control the image extent manually when sampling
+		// the sampled image in a shader.
+
+		// Blit from source to sampled ( to mip level 0 only ).
+		VkImageBlit region {};
+		region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		region.srcSubresource.mipLevel			= 0;
+		region.srcSubresource.baseArrayLayer	= 0;
+		region.srcSubresource.layerCount		= 1;
+		region.srcOffsets[ 0 ]					= { 0, 0, 0 };
+		region.srcOffsets[ 1 ]					= { int32_t( size.x ), int32_t( size.y ), 1 };
+		region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		region.dstSubresource.mipLevel			= 0;
+		region.dstSubresource.baseArrayLayer	= 0;
+		region.dstSubresource.layerCount		= 1;
+		region.dstOffsets[ 0 ]					= { 0, 0, 0 };
+		region.dstOffsets[ 1 ]					= { int32_t( size.x ), int32_t( size.y ), 1 };
+		vkCmdBlitImage(
 			command_buffer,
-			VK_PIPELINE_STAGE_TRANSFER_BIT,
-			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
-			0,
-			0, nullptr,
-			0, nullptr,
-			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+			source_image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			destination_image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			1, &region,
+			VK_FILTER_NEAREST
 		);
 	}
+
 }
 
 
@@ -3058,6 +4170,20 @@ std::array<float, 4> CalculateBlurShaderInfo(
 	return ret;
 }
 
+/// @brief		Amount of texels sampled on each side of the center texel, calculated the same way as the blur shaders do.
+/// @param		texel_coverage
+///				Same as in CalculateBlurShaderInfo().
+/// @return		Blur radius in texels.
+uint32_t CalculateBlurRadius(
+	float		texel_coverage
+)
+{
+	if( texel_coverage < 1.0f ) texel_coverage = 1.0f;
+
+	float	sigma		= texel_coverage / 3.0f;
+	return uint32_t( sigma * 3.0f );
+}
+
 
 
 bool vk2d::vk2d_internal::RenderTargetTextureImpl::CmdRecordBlurCommands(
@@ -3327,6 +4453,475 @@ bool vk2d::vk2d_internal::RenderTargetTextureImpl::CmdRecordBlurCommands(
 	return true;
 }
 
+bool vk2d::vk2d_internal::RenderTargetTextureImpl::CanUseComputeBlur(
+	glm::vec2		blur_amount
+) const
+{
+	if( !use_compute_blur ) return false;
+
+	return
+		CalculateBlurRadius( blur_amount.x ) <= COMPUTE_BLUR_MAX_RADIUS &&
+		CalculateBlurRadius( blur_amount.y ) <= COMPUTE_BLUR_MAX_RADIUS;
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdRecordComputeBlurCommands(
+	VkCommandBuffer								command_buffer,
+	BlurType									blur_type,
+	glm::vec2									blur_amount,
+	CompleteImageResource					&	source_image,
+	VkImageLayout								source_image_layout,
+	VkPipelineStageFlagBits						source_image_pipeline_barrier_src_stage,
+	CompleteImageResource					&	intermediate_image,
+	CompleteImageResource					&	destination_image
+)
+{
+	// General flow of this function is:
+	// - Transition source and intermediate images to general layout.
+	// - Dispatch horisontal blur, source -> intermediate.
+	// - Memory barrier, destination transition if it's a separate image.
+	// - Dispatch vertical blur, intermediate -> destination.
+	//
+	// Both passes are recorded into the render command buffer so the
+	// result is ready for mipmap generation without extra semaphores.
+
+	assert( command_buffer );
+	assert( instance );
+
+	auto pipeline_layout	= instance->GetComputeBlurPipelineLayout();
+
+	VkImageSubresourceRange mip_0_only_subresource_range {};
+	mip_0_only_subresource_range.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+	mip_0_only_subresource_range.baseMipLevel	= 0;
+	mip_0_only_subresource_range.levelCount		= 1;
+	mip_0_only_subresource_range.baseArrayLayer	= 0;
+	mip_0_only_subresource_range.layerCount		= 1;
+
+	auto RecordBlurDispatch =[ this, command_buffer, pipeline_layout, blur_type ](
+		VkImageView					source_view,
+		VkImageView					destination_view,
+		uint32_t					direction,
+		float						blur_coverage
+		) -> void
+	{
+		std::array<VkDescriptorImageInfo, 2> image_infos {};
+		image_infos[ 0 ].sampler		= VK_NULL_HANDLE;
+		image_infos[ 0 ].imageView		= source_view;
+		image_infos[ 0 ].imageLayout	= VK_IMAGE_LAYOUT_GENERAL;
+		image_infos[ 1 ].sampler		= VK_NULL_HANDLE;
+		image_infos[ 1 ].imageView		= destination_view;
+		image_infos[ 1 ].imageLayout	= VK_IMAGE_LAYOUT_GENERAL;
+
+		std::array<VkWriteDescriptorSet, 2> descriptor_writes {};
+		for( uint32_t i = 0; i < std::size( descriptor_writes ); ++i ) {
+			descriptor_writes[ i ].sType			= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptor_writes[ i ].pNext			= nullptr;
+			descriptor_writes[ i ].dstSet			= VK_NULL_HANDLE;	// Ignored when pushing descriptor set directly into the command buffer.
+			descriptor_writes[ i ].dstBinding		= i;
+			descriptor_writes[ i ].dstArrayElement	= 0;
+			descriptor_writes[ i ].descriptorCount	= 1;
+			descriptor_writes[ i ].descriptorType	= VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			descriptor_writes[ i ].pImageInfo		= &image_infos[ i ];
+			descriptor_writes[ i ].pBufferInfo		= nullptr;
+			descriptor_writes[ i ].pTexelBufferView	= nullptr;
+		}
+
+		instance->VkFun_vkCmdPushDescriptorSetKHR(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			pipeline_layout,
+			0,
+			uint32_t( std::size( descriptor_writes ) ),
+			descriptor_writes.data()
+		);
+
+		if( blur_coverage < 1.0f ) blur_coverage = 1.0f;
+
+		ComputeBlurPushConstants push_constants {};
+		push_constants.image_size		= size;
+		push_constants.direction		= direction;
+		push_constants.blur_type		= uint32_t( blur_type );
+		push_constants.sigma			= blur_coverage / 3.0f;
+		push_constants.radius			= CalculateBlurRadius( blur_coverage );
+
+		vkCmdPushConstants(
+			command_buffer,
+			pipeline_layout,
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			uint32_t( sizeof( ComputeBlurPushConstants ) ),
+			&push_constants
+		);
+
+		// One work group per run of texels along the blur axis, one row of work groups per line.
+		auto along_size		= direction == 0 ? size.x : size.y;
+		auto line_count		= direction == 0 ? size.y : size.x;
+		vkCmdDispatch(
+			command_buffer,
+			( along_size + COMPUTE_BLUR_WORK_GROUP_SIZE - 1 ) / COMPUTE_BLUR_WORK_GROUP_SIZE,
+			line_count,
+			1
+		);
+	};
+
+	// Bind pipeline.
+	{
+		ComputePipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= pipeline_layout;
+		pipeline_settings.vk_shader_program		= instance->GetComputeShaderModules( ComputeShaderProgramID::RENDER_TARGET_BLUR );
+		auto pipeline = instance->GetComputePipeline( pipeline_settings );
+
+		vkCmdBindPipeline(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			pipeline
+		);
+	}
+
+	// Pipeline barriers.
+	{
+		std::array<VkImageMemoryBarrier, 2> image_memory_barriers {};
+
+		// Source image.
+		image_memory_barriers[ 0 ].sType				= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext				= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask		= VK_ACCESS_MEMORY_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask		= VK_ACCESS_SHADER_READ_BIT;
+		image_memory_barriers[ 0 ].oldLayout			= source_image_layout;
+		image_memory_barriers[ 0 ].newLayout			= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image				= source_image.image;
+		image_memory_barriers[ 0 ].subresourceRange		= mip_0_only_subresource_range;
+
+		// Intermediate image, previous contents are not needed.
+		image_memory_barriers[ 1 ].sType				= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 1 ].pNext				= nullptr;
+		image_memory_barriers[ 1 ].srcAccessMask		= 0;
+		image_memory_barriers[ 1 ].dstAccessMask		= VK_ACCESS_SHADER_WRITE_BIT;
+		image_memory_barriers[ 1 ].oldLayout			= VK_IMAGE_LAYOUT_UNDEFINED;
+		image_memory_barriers[ 1 ].newLayout			= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 1 ].srcQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].dstQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 1 ].image				= intermediate_image.image;
+		image_memory_barriers[ 1 ].subresourceRange		= mip_0_only_subresource_range;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			source_image_pipeline_barrier_src_stage,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			uint32_t( std::size( image_memory_barriers ) ), image_memory_barriers.data()
+		);
+	}
+
+	RecordBlurDispatch(
+		source_image.view,
+		intermediate_image.view,
+		0,
+		blur_amount.x
+	);
+
+	// Pipeline barriers.
+	{
+		std::array<VkImageMemoryBarrier, 2> image_memory_barriers {};
+		uint32_t image_memory_barrier_count = 1;
+
+		// Intermediate image, horisontal pass results are read by the vertical pass.
+		image_memory_barriers[ 0 ].sType				= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barriers[ 0 ].pNext				= nullptr;
+		image_memory_barriers[ 0 ].srcAccessMask		= VK_ACCESS_SHADER_WRITE_BIT;
+		image_memory_barriers[ 0 ].dstAccessMask		= VK_ACCESS_SHADER_READ_BIT;
+		image_memory_barriers[ 0 ].oldLayout			= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 0 ].newLayout			= VK_IMAGE_LAYOUT_GENERAL;
+		image_memory_barriers[ 0 ].srcQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].dstQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barriers[ 0 ].image				= intermediate_image.image;
+		image_memory_barriers[ 0 ].subresourceRange		= mip_0_only_subresource_range;
+
+		// Destination image is usually the source image which is already in general
+		// layout, the execution dependency alone protects the horisontal pass reads.
+		if( destination_image.image != source_image.image ) {
+			image_memory_barriers[ 1 ].sType				= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+			image_memory_barriers[ 1 ].pNext				= nullptr;
+			image_memory_barriers[ 1 ].srcAccessMask		= 0;
+			image_memory_barriers[ 1 ].dstAccessMask		= VK_ACCESS_SHADER_WRITE_BIT;
+			image_memory_barriers[ 1 ].oldLayout			= VK_IMAGE_LAYOUT_UNDEFINED;
+			image_memory_barriers[ 1 ].newLayout			= VK_IMAGE_LAYOUT_GENERAL;
+			image_memory_barriers[ 1 ].srcQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+			image_memory_barriers[ 1 ].dstQueueFamilyIndex	= VK_QUEUE_FAMILY_IGNORED;
+			image_memory_barriers[ 1 ].image				= destination_image.image;
+			image_memory_barriers[ 1 ].subresourceRange		= mip_0_only_subresource_range;
+			++image_memory_barrier_count;
+		}
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			0, nullptr,
+			0, nullptr,
+			image_memory_barrier_count, image_memory_barriers.data()
+		);
+	}
+
+	RecordBlurDispatch(
+		intermediate_image.view,
+		destination_image.view,
+		1,
+		blur_amount.y
+	);
+}
+
+bool vk2d::vk2d_internal::RenderTargetTextureImpl::CanUseDualKawaseBlur() const
+{
+	// Mip levels of the sampled image are used as the downsample chain.
+	return use_compute_blur && std::size( mipmap_levels ) > 1;
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdRecordDualKawaseBlur(
+	VkCommandBuffer								command_buffer,
+	const std::vector<VkImageView>			&	mip_level_views,
+	glm::vec2									blur_amount
+)
+{
+	// Blurs mip level 0 in place, other mip levels are used as scratch
+	// space and must be regenerated afterwards. All mip levels must be in
+	// general layout and mip level 0 visible to compute shader reads.
+	//
+	// Blur radius roughly doubles with every mip level used, offset
+	// scales the samples in between so that blur amount can be animated
+	// smoothly from one mip level count to the next.
+
+	assert( command_buffer );
+	assert( instance );
+	assert( std::size( mip_level_views ) == std::size( mipmap_levels ) );
+
+	auto largest_blur_amount	= std::max( blur_amount.x, blur_amount.y );
+	if( largest_blur_amount < 1.0f ) return;
+
+	auto max_iterations			= uint32_t( std::size( mipmap_levels ) - 1 );
+	auto iterations				= std::min( std::max( uint32_t( std::log2( largest_blur_amount ) ), 1U ), max_iterations );
+	auto offset					= blur_amount / float( 1U << iterations );
+
+	auto pipeline_layout		= instance->GetComputeDualKawasePipelineLayout();
+	auto sampler				= instance->GetBlurSampler()->impl->GetVulkanSampler();
+
+	auto BindPipeline =[ this, command_buffer, pipeline_layout ](
+		ComputeShaderProgramID		shader_program_id
+		) -> void
+	{
+		ComputePipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= pipeline_layout;
+		pipeline_settings.vk_shader_program		= instance->GetComputeShaderModules( shader_program_id );
+		auto pipeline = instance->GetComputePipeline( pipeline_settings );
+
+		vkCmdBindPipeline(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			pipeline
+		);
+	};
+
+	auto RecordPass =[ this, command_buffer, pipeline_layout, sampler, &mip_level_views, offset ](
+		uint32_t					source_level,
+		uint32_t					destination_level
+		) -> void
+	{
+		std::array<VkDescriptorImageInfo, 2> image_infos {};
+		image_infos[ 0 ].sampler		= sampler;
+		image_infos[ 0 ].imageView		= mip_level_views[ source_level ];
+		image_infos[ 0 ].imageLayout	= VK_IMAGE_LAYOUT_GENERAL;
+		image_infos[ 1 ].sampler		= VK_NULL_HANDLE;
+		image_infos[ 1 ].imageView		= mip_level_views[ destination_level ];
+		image_infos[ 1 ].imageLayout	= VK_IMAGE_LAYOUT_GENERAL;
+
+		std::array<VkWriteDescriptorSet, 2> descriptor_writes {};
+		for( uint32_t i = 0; i < std::size( descriptor_writes ); ++i ) {
+			descriptor_writes[ i ].sType			= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptor_writes[ i ].pNext			= nullptr;
+			descriptor_writes[ i ].dstSet			= VK_NULL_HANDLE;	// Ignored when pushing descriptor set directly into the command buffer.
+			descriptor_writes[ i ].dstBinding		= i;
+			descriptor_writes[ i ].dstArrayElement	= 0;
+			descriptor_writes[ i ].descriptorCount	= 1;
+			descriptor_writes[ i ].descriptorType	= VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			descriptor_writes[ i ].pImageInfo		= &image_infos[ i ];
+			descriptor_writes[ i ].pBufferInfo		= nullptr;
+			descriptor_writes[ i ].pTexelBufferView	= nullptr;
+		}
+		descriptor_writes[ 0 ].descriptorType		= VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+
+		instance->VkFun_vkCmdPushDescriptorSetKHR(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			pipeline_layout,
+			0,
+			uint32_t( std::size( descriptor_writes ) ),
+			descriptor_writes.data()
+		);
+
+		auto & source_size			= mipmap_levels[ source_level ];
+		auto & destination_size		= mipmap_levels[ destination_level ];
+
+		ComputeDualKawasePushConstants push_constants {};
+		push_constants.destination_size	= { destination_size.width, destination_size.height };
+		push_constants.sample_offset	= offset * 0.5f / glm::vec2( float( source_size.width ), float( source_size.height ) );
+
+		vkCmdPushConstants(
+			command_buffer,
+			pipeline_layout,
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			uint32_t( sizeof( ComputeDualKawasePushConstants ) ),
+			&push_constants
+		);
+
+		vkCmdDispatch(
+			command_buffer,
+			( destination_size.width + COMPUTE_DUAL_KAWASE_WORK_GROUP_SIZE - 1 ) / COMPUTE_DUAL_KAWASE_WORK_GROUP_SIZE,
+			( destination_size.height + COMPUTE_DUAL_KAWASE_WORK_GROUP_SIZE - 1 ) / COMPUTE_DUAL_KAWASE_WORK_GROUP_SIZE,
+			1
+		);
+
+		// Next pass reads the level written by this one.
+		VkMemoryBarrier memory_barrier {};
+		memory_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memory_barrier.pNext			= nullptr;
+		memory_barrier.srcAccessMask	= VK_ACCESS_SHADER_WRITE_BIT;
+		memory_barrier.dstAccessMask	= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+
+		vkCmdPipelineBarrier(
+			command_buffer,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+			0,
+			1, &memory_barrier,
+			0, nullptr,
+			0, nullptr
+		);
+	};
+
+	BindPipeline( ComputeShaderProgramID::RENDER_TARGET_DUAL_KAWASE_DOWNSAMPLE );
+	for( uint32_t i = 0; i < iterations; ++i ) {
+		RecordPass( i, i + 1 );
+	}
+
+	BindPipeline( ComputeShaderProgramID::RENDER_TARGET_DUAL_KAWASE_UPSAMPLE );
+	for( uint32_t i = iterations; i > 0; --i ) {
+		RecordPass( i, i - 1 );
+	}
+}
+
+void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdDrawTriangleList(
+	VkCommandBuffer								command_buffer,
+	const GraphicsPrimaryRenderPushConstants	&	primary_push_constants,
+	uint32_t									index_count,
+	uint32_t									instance_count,
+	bool										solid,
+	bool										multitextured,
+	Texture									*	texture,
+	Sampler									*	sampler,
+	float										signed_distance_field_spread,
+	const SignedDistanceFieldEffects		*	signed_distance_field_effects
+)
+{
+	// Signed distance field atlases need their own shader, skip it if the
+	// texture was swapped for the default texture.
+	bool use_signed_distance_field = signed_distance_field_spread > 0.0f && texture != instance->GetDefaultTexture();
+	bool use_signed_distance_field_effects = use_signed_distance_field && signed_distance_field_effects && (
+		signed_distance_field_effects->outline_width > 0.0f ||
+		signed_distance_field_effects->shadow_color.a > 0.0f );
+
+	{
+		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
+			multitextured,
+			sampler->impl->IsAnyBorderColorEnabled(),
+			3
+		);
+		if( use_signed_distance_field ) {
+			graphics_shader_programs = instance->GetGraphicsShaderModules(
+				use_signed_distance_field_effects ?
+				GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD_WITH_EFFECTS :
+				GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD
+			);
+		}
+
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_attachment_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= solid ? VK_POLYGON_MODE_FILL : VK_POLYGON_MODE_LINE;
+		pipeline_settings.shader_programs		= graphics_shader_programs;
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	CmdBindSamplerIfDifferent(
+		command_buffer,
+		sampler,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+	CmdBindTextureIfDifferent(
+		command_buffer,
+		texture,
+		instance->GetGraphicsPrimaryRenderPipelineLayout()
+	);
+
+	{
+		GraphicsPrimaryRenderPushConstants pc = primary_push_constants;
+		pc.index_count					= 3;
+		pc.texture_channel_weight_count	= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	if( use_signed_distance_field ) {
+		SignedDistanceFieldEffects effects = signed_distance_field_effects ? *signed_distance_field_effects : SignedDistanceFieldEffects {};
+
+		GraphicsSignedDistanceFieldPushConstants pc {};
+		pc.outline_color			= { effects.outline_color.r, effects.outline_color.g, effects.outline_color.b, effects.outline_color.a };
+		pc.shadow_color				= { effects.shadow_color.r, effects.shadow_color.g, effects.shadow_color.b, effects.shadow_color.a };
+		pc.shadow_offset			= effects.shadow_offset;
+		pc.outline_width			= effects.outline_width;
+		pc.shadow_softness			= effects.shadow_softness;
+		pc.spread					= signed_distance_field_spread;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDrawIndexed(
+		command_buffer,
+		index_count,
+		instance_count,
+		primary_push_constants.index_offset,
+		int32_t( primary_push_constants.vertex_offset ),
+		0
+	);
+}
+
 void vk2d::vk2d_internal::RenderTargetTextureImpl::CmdBindGraphicsPipelineIfDifferent(
 	VkCommandBuffer						command_buffer,
 	const GraphicsPipelineSettings	&	pipeline_settings
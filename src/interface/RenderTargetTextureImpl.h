@@ -5,8 +5,14 @@
 #include "interface/RenderTargetTexture.h"
 
 #include "types/BlurType.h"
+#include "types/SignedDistanceFieldEffects.h"
+#include "types/Text.h"
+#include "types/TextLayout.h"
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
 
 #include "system/CommonTools.h"
+#include "system/MipmapGeneration.h"
 #include "system/ShaderInterface.h"
 #include "system/MeshBuffer.h"
 #include "system/RenderTargetTextureDependecyGraphInfo.hpp"
@@ -14,6 +20,7 @@
 #include "system/VulkanMemoryManagement.h"
 
 #include "interface/InstanceImpl.h"
+#include "interface/ParticleSystemImpl.h"
 
 #include "interface/SamplerImpl.h"
 
@@ -26,12 +33,14 @@
 namespace vk2d {
 
 class Mesh;
+class FontResource;
 
 namespace vk2d_internal {
 
 class InstanceImpl;
 class MeshBuffer;
 class RenderTargetTextureImpl;
+struct TextGlyphPlacement;
 
 
 
@@ -97,6 +106,7 @@ private:
 		CompleteImageResource								buffer_1_image								= {};	// Buffer image, used as multisample resolve and blur buffer
 		CompleteImageResource								buffer_2_image								= {};	// Buffer image, used as second blur buffer
 		CompleteImageResource								sampled_image								= {};	// Output, sampled image with mip mapping
+		std::vector<VkImageView>							sampled_image_mip_level_views				= {};	// One view per sampled image mip level, used with compute mipmap generation
 		VkFramebuffer										vk_render_framebuffer						= {};	// Framebuffer for the main render
 		VkFramebuffer										vk_blur_framebuffer_1						= {};	// Framebuffer for blur pass 1
 		VkFramebuffer										vk_blur_framebuffer_2						= {};	// Framebuffer for blur pass 2
@@ -104,16 +114,6 @@ private:
 		VkCommandBuffer										vk_transfer_command_buffer					= {};	// Data transfer command buffer, this transfers vertex, index, etc... data in the primary render queue.
 		VkCommandBuffer										vk_render_command_buffer					= {};	// Primary render, if no blur is used then also embeds mipmap generation.
 
-		VkSubmitInfo										vk_transfer_submit_info						= {};
-		VkSubmitInfo										vk_render_submit_info						= {};
-
-		VkTimelineSemaphoreSubmitInfo						vk_render_timeline_semaphore_submit_info	= {};
-
-		std::vector<VkSemaphore>							render_wait_for_semaphores;
-		std::vector<uint64_t>								render_wait_for_semaphore_timeline_values;			// Used with render_wait_for_semaphores.
-		std::vector<VkPipelineStageFlags>					render_wait_for_pipeline_stages;
-
-		VkSemaphore											vk_transfer_complete_semaphore				= {};	// Binary
 		VkSemaphore											vk_render_complete_semaphore				= {};	// Binary if blur enabled, Timeline if blur enabled.
 
 		uint64_t											render_counter								= {};	// Used with the vk_render_complete_semaphore to determine value to wait for.
@@ -125,6 +125,15 @@ private:
 
 		bool												has_been_submitted							= {};
 		bool												contains_non_pending_sampled_image			= {};	// Sampled image ready to be used anywhere without checks or barriers.
+
+		// With on demand mipmaps the render command buffer is left open at EndRender() and mipmap generation is recorded
+		// when the render is committed, see EndDeferredMipmapGeneration().
+		CompleteImageResource							*	deferred_mipmap_source_image				= {};
+		VkImageLayout										deferred_mipmap_source_image_layout			= {};
+		VkPipelineStageFlagBits								deferred_mipmap_source_image_stage			= {};
+		bool												is_mipmap_generation_deferred				= {};
+		bool												are_mipmaps_requested						= {};	// A draw sampling this render can read mipmaps, see RequestMipmapsIfSampled().
+		bool												are_sampled_image_mip_levels_initialized	= {};	// Sampled image mip levels 1 and up are no longer in undefined layout.
 	};
 
 public:
@@ -179,7 +188,7 @@ public:
 	// TODO: Figure out how to best track render target texture commitments, a render target can be re-used in multiple places but should only be rendered once while at the same time submissions should be grouped together.
 	bool													CommitRenderTargetTextureRender(
 		RenderTargetTextureDependencyInfo				&	dependency_info,
-		RenderTargetTextureRenderCollector				&	collector );
+		RenderTargetTextureRenderGraph					&	render_graph );
 
 	// This notifies that the render target texture has been submitted to rendering.
 	void													ConfirmRenderTargetTextureRenderSubmission(
@@ -203,6 +212,25 @@ public:
 
 	RenderTargetTextureDependencyInfo						GetDependencyInfo();
 
+	// Called when this render target texture is drawn. With on demand mipmaps,
+	// asks the render being drawn, the one in the current swap buffer, to
+	// generate mipmaps if the draw can read them. vertices is nullptr if the
+	// draw texture coordinates are not known on the host, mipmaps are then
+	// requested if the sampler can read them. If the render was already
+	// committed without mipmaps, every later render generates them instead.
+	void													RequestMipmapsIfSampled(
+		Sampler											*	sampler,
+		const std::vector<Vertex>						*	vertices,
+		const std::vector<glm::mat4>					&	transformations,
+		glm::vec2											surface_pixels_per_unit );
+
+	// Forwards a draw to RequestMipmapsIfSampled() if texture is a render target texture.
+	void													CheckAndRequestRenderTargetTextureMipmaps(
+		Texture											*	texture,
+		Sampler											*	sampler,
+		const std::vector<Vertex>						*	vertices,
+		const std::vector<glm::mat4>					&	transformations );
+
 	void													DrawTriangleList(
 		const std::vector<VertexIndex_3>				&	indices,
 		const std::vector<Vertex>						&	vertices,
@@ -219,7 +247,9 @@ public:
 		const std::vector<glm::mat4>					&	transformations,
 		bool												filled,
 		Texture											*	texture,
-		Sampler											*	sampler );
+		Sampler											*	sampler,
+		float												signed_distance_field_spread		= 0.0f,
+		const SignedDistanceFieldEffects				*	signed_distance_field_effects		= nullptr );
 
 	void													DrawLineList(
 		const std::vector<VertexIndex_2>				&	indices,
@@ -250,9 +280,46 @@ public:
 		const Mesh										&	mesh,
 		const std::vector<glm::mat4>					&	transformations );
 
+	void													DrawText(
+		FontResource									*	font,
+		glm::vec2											origin,
+		const Text										&	text,
+		float												kerning,
+		glm::vec2											scale,
+		bool												vertical,
+		uint32_t											font_face,
+		const Colorf									&	color,
+		bool												wait_for_resource_load );
+
+	void													DrawCircles(
+		const std::vector<CirclePrimitive>				&	circles );
+
+	void													DrawRoundedRects(
+		const std::vector<RoundedRectPrimitive>			&	rounded_rects );
+
+	void													DrawRings(
+		const std::vector<RingPrimitive>				&	rings );
+
+	void													DrawPolylines(
+		const std::vector<Polyline>						&	polylines,
+		PolylineJoin										join,
+		PolylineCap											cap,
+		float												miter_limit );
+
+	void													DrawParticleSystem(
+		ParticleSystem									*	particle_system,
+		Texture											*	texture,
+		Sampler											*	sampler );
+
 	bool												IsGood() const;
 
 private:
+	// Draws shapes using the shape instance shaders, see DrawCircles().
+	template<typename ShapePrimitiveT>
+	void												DrawShapes(
+		ShapeInstanceType								shape,
+		const std::vector<ShapePrimitiveT>			&	shapes );
+
 	bool												DetermineType();
 
 	bool												CreateCommandBuffers();
@@ -277,12 +344,6 @@ private:
 	bool												RecordTransferCommandBuffer(
 		RenderTargetTextureImpl::SwapBuffer			&	swap );
 
-	bool												UpdateSubmitInfos(
-		RenderTargetTextureImpl::SwapBuffer			&	swap,
-		const std::vector<VkSemaphore>				&	wait_for_semaphores,
-		const std::vector<uint64_t>					&	wait_for_semaphore_timeline_values,
-		const std::vector<VkPipelineStageFlags>		&	wait_for_semaphore_pipeline_stages );
-
 	TimedDescriptorPoolData							&	GetOrCreateDescriptorSetForSampler(
 		Sampler										*	sampler );
 
@@ -318,7 +379,90 @@ private:
 	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	/// @brief		Record commands to copy an image to the final sampled image, then generate mipmaps for it.
 	///
-	///				Called by RenderTargetTextureImpl::CmdFinalizeNonBlurredRender().
+	///				Uses compute shaders if supported, see CmdComputeMipmapsToSampledImage(), otherwise falls back to
+	///				CmdBlitMipmapsToSampledImage().
+	/// 
+	/// @note		Multithreading: Main thread only.
+	/// 
+	/// @param[in]	swap
+	///				Reference to internal structure which contains all the information about the current frame. Mipmaps are
+	///				generated into the sampled image of this swap buffer.
+	/// 
+	/// @param[in]	command_buffer
+	///				Command buffer where to record mipmap generation commands to.
+	/// 
+	/// @param[in]	source_image
+	///				Reference to image object from where data is copied from. Only mip level 0 is accessed.
+	/// 
+	/// @param[in]	source_image_layout
+	///				Source image current layout. See Vulkan documentation about VkImageLayout.
+	/// 
+	/// @param[in]	source_image_pipeline_barrier_src_stage
+	///				Vulkan pipeline stage flags that must complete before source image data is accessed.
+	void													CmdGenerateMipmapsToSampledImage(
+		RenderTargetTextureImpl::SwapBuffer				&	swap,
+		VkCommandBuffer										command_buffer,
+		CompleteImageResource							&	source_image,
+		VkImageLayout										source_image_layout,
+		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage );
+
+	// Body of CmdGenerateMipmapsToSampledImage(), records the commands right away regardless of the mipmap mode.
+	void													CmdRecordMipmapsToSampledImage(
+		RenderTargetTextureImpl::SwapBuffer				&	swap,
+		VkCommandBuffer										command_buffer,
+		CompleteImageResource							&	source_image,
+		VkImageLayout										source_image_layout,
+		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record commands to copy an image to the final sampled image mip level 0 only.
+	///
+	///				Used with RenderTargetTextureMipmapMode::ON_DEMAND when no draw needs mipmaps. Mip levels 1 and up keep the
+	///				contents of the last render that generated them.
+	/// 
+	/// @note		Multithreading: Main thread only.
+	/// 
+	/// @param[in]	swap
+	///				Reference to internal structure which contains all the information about the current frame.
+	/// 
+	/// @param[in]	command_buffer
+	///				Command buffer where to record commands to.
+	/// 
+	/// @param[in]	source_image
+	///				Reference to image object from where data is copied from. Only mip level 0 is accessed. After this function
+	///				returns source image layout will be VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+	/// 
+	/// @param[in]	source_image_layout
+	///				Source image current layout. See Vulkan documentation about VkImageLayout.
+	/// 
+	/// @param[in]	source_image_pipeline_barrier_src_stage
+	///				Vulkan pipeline stage flags that must complete before source image data is accessed.
+	void													CmdCopyToSampledImageWithoutMipmaps(
+		RenderTargetTextureImpl::SwapBuffer				&	swap,
+		VkCommandBuffer										command_buffer,
+		CompleteImageResource							&	source_image,
+		VkImageLayout										source_image_layout,
+		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage );
+
+	// Records deferred mipmap generation, or only mip level 0 if no draw
+	// requested mipmaps, then ends the render command buffer. Does nothing if
+	// mipmap generation was not deferred.
+	bool													EndDeferredMipmapGeneration(
+		RenderTargetTextureImpl::SwapBuffer				&	swap );
+
+	// Closes a render command buffer left open for deferred mipmap generation
+	// without recording anything, used when the render is never going to be
+	// submitted.
+	void													DiscardDeferredMipmapGeneration(
+		RenderTargetTextureImpl::SwapBuffer				&	swap );
+
+	bool													EndRenderCommandBuffer(
+		RenderTargetTextureImpl::SwapBuffer				&	swap );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record commands to copy an image to the final sampled image, then generate mipmaps for it.
+	///
+	///				Called by RenderTargetTextureImpl::CmdGenerateMipmapsToSampledImage().
 	/// 
 	/// @note		Multithreading: Main thread only.
 	/// 
@@ -345,6 +489,52 @@ private:
 		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage,
 		CompleteImageResource							&	destination_image );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record commands to copy an image to the final sampled image, then generate mipmaps for it with compute
+	///				shaders.
+	///
+	///				Called by RenderTargetTextureImpl::CmdGenerateMipmapsToSampledImage(). Uses the mipmap filter selected in
+	///				RenderTargetTextureCreateInfo::mipmap_filter. Several mip levels are generated per dispatch so there are far
+	///				fewer pipeline barriers than when blitting.
+	/// 
+	/// @note		Multithreading: Main thread only.
+	/// 
+	/// @param[in]	command_buffer
+	///				Command buffer where to record commands to.
+	/// 
+	/// @param[in]	source_image
+	///				Reference to image object from where data is copied from. Only mip level 0 is accessed. After this function
+	///				returns source image layout will be VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+	/// 
+	/// @param[in]	source_image_layout
+	///				Source image current layout. See Vulkan documentation about VkImageLayout.
+	/// 
+	/// @param[in]	source_image_pipeline_barrier_src_stage
+	///				Vulkan pipeline stage flags that must complete before source image data is accessed.
+	/// 
+	/// @param[in]	destination_image
+	///				Sampled image, must have been created with VK_IMAGE_USAGE_STORAGE_BIT and have more than 1 mip level.
+	/// 
+	/// @param[in]	destination_mip_level_views
+	///				Destination image views, one per mip level.
+	///
+	/// @param[in]	dual_kawase_blur_amount
+	///				If 1.0 or more, mip level 0 is blurred with CmdRecordDualKawaseBlur() before mip levels are generated.
+	void													CmdComputeMipmapsToSampledImage(
+		VkCommandBuffer										command_buffer,
+		CompleteImageResource							&	source_image,
+		VkImageLayout										source_image_layout,
+		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage,
+		CompleteImageResource							&	destination_image,
+		const std::vector<VkImageView>					&	destination_mip_level_views,
+		glm::vec2											dual_kawase_blur_amount );
+
+	// Copies or blits source image mip level 0 to destination image mip level 0 depending on granularity alignment.
+	void													CmdCopyToSampledImageMipLevel0(
+		VkCommandBuffer										command_buffer,
+		CompleteImageResource							&	source_image,
+		CompleteImageResource							&	destination_image );
+
 	bool													CmdRecordBlurCommands(
 		RenderTargetTextureImpl::SwapBuffer				&	swap,
 		VkCommandBuffer										command_buffer,
@@ -356,10 +546,114 @@ private:
 		CompleteImageResource							&	intermediate_image,
 		CompleteImageResource							&	destination_image );
 
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Checks if blur can be done with compute shaders, see CmdRecordComputeBlurCommands().
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	blur_amount
+	///				Blur amount in texels on both axis.
+	///
+	/// @return		true if compute shaders are supported and the blur radius fits in the compute shader shared memory.
+	bool													CanUseComputeBlur(
+		glm::vec2											blur_amount ) const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record commands to blur an image with compute shaders.
+	///
+	///				Same as CmdRecordBlurCommands() but each pass is a single dispatch which reads the source texels through
+	///				shared memory, no render passes or framebuffers are used. All images must have been created with
+	///				VK_IMAGE_USAGE_STORAGE_BIT. After this function returns destination image layout will be
+	///				VK_IMAGE_LAYOUT_GENERAL.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @see		CanUseComputeBlur()
+	///
+	/// @param[in]	command_buffer
+	///				Command buffer where to record commands to. Must be outside of a render pass.
+	///
+	/// @param[in]	blur_type
+	///				Type of blur to use.
+	///
+	/// @param[in]	blur_amount
+	///				Blur amount in texels on both axis.
+	///
+	/// @param[in]	source_image
+	///				Image to blur, horisontal pass reads from this.
+	///
+	/// @param[in]	source_image_layout
+	///				Source image current layout.
+	///
+	/// @param[in]	source_image_pipeline_barrier_src_stage
+	///				Vulkan pipeline stage flags that must complete before source image data is accessed.
+	///
+	/// @param[in]	intermediate_image
+	///				Horisontal pass writes to this and vertical pass reads from this.
+	///
+	/// @param[in]	destination_image
+	///				Vertical pass writes to this, may be the same as source image.
+	void													CmdRecordComputeBlurCommands(
+		VkCommandBuffer										command_buffer,
+		BlurType											blur_type,
+		glm::vec2											blur_amount,
+		CompleteImageResource							&	source_image,
+		VkImageLayout										source_image_layout,
+		VkPipelineStageFlagBits								source_image_pipeline_barrier_src_stage,
+		CompleteImageResource							&	intermediate_image,
+		CompleteImageResource							&	destination_image );
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Checks if BlurType::DUAL_KAWASE can be used, gaussian blur is used instead if not.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @return		true if compute shaders are supported and the sampled image has mip levels to blur through.
+	bool													CanUseDualKawaseBlur() const;
+
+	////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// @brief		Record commands to blur sampled image mip level 0 with dual Kawase blur.
+	///
+	///				Image is downsampled through the mip levels and upsampled back to mip level 0, blurring on every step.
+	///				Amount of mip levels used depends on blur amount. Contents of mip levels 1 and up are left undefined and
+	///				must be regenerated afterwards.
+	///				<br>
+	///				All mip levels must be in VK_IMAGE_LAYOUT_GENERAL and mip level 0 contents must be visible to compute shader
+	///				reads before calling this. Mip level 0 contents are visible to compute shaders when this function returns.
+	///
+	/// @note		Multithreading: Main thread only.
+	///
+	/// @param[in]	command_buffer
+	///				Command buffer where to record commands to. Must be outside of a render pass.
+	///
+	/// @param[in]	mip_level_views
+	///				Sampled image views, one per mip level.
+	///
+	/// @param[in]	blur_amount
+	///				Approximate blur amount in texels on both axis. Nothing is recorded if both are less than 1.0.
+	void													CmdRecordDualKawaseBlur(
+		VkCommandBuffer										command_buffer,
+		const std::vector<VkImageView>					&	mip_level_views,
+		glm::vec2											blur_amount );
+
 	void													CmdBindGraphicsPipelineIfDifferent(
 		VkCommandBuffer										command_buffer,
 		const GraphicsPipelineSettings					&	pipeline_settings );
 
+	// Binds pipeline, sampler and texture and records the draw for triangles
+	// already pushed into the mesh buffer.
+	void													CmdDrawTriangleList(
+		VkCommandBuffer										command_buffer,
+		const GraphicsPrimaryRenderPushConstants		&	primary_push_constants,
+		uint32_t											index_count,
+		uint32_t											instance_count,
+		bool												solid,
+		bool												multitextured,
+		Texture											*	texture,
+		Sampler											*	sampler,
+		float												signed_distance_field_spread,
+		const SignedDistanceFieldEffects				*	signed_distance_field_effects );
+
 	void													CmdBindSamplerIfDifferent(
 		VkCommandBuffer										command_buffer,
 		Sampler											*	sampler,
@@ -389,6 +683,9 @@ private:
 	Multisamples											samples										= {};
 	std::vector<VkExtent2D>									mipmap_levels								= {};
 	bool													granularity_aligned							= {};
+	bool													use_compute_mipmap_generation				= {};
+	bool													use_compute_blur							= {};
+	bool													are_mipmaps_sampled_after_commit			= {};	// See RequestMipmapsIfSampled().
 
 	CompleteBufferResource									frame_data_staging_buffer					= {};
 	CompleteBufferResource									frame_data_device_buffer					= {};
@@ -403,6 +700,13 @@ private:
 
 	std::unique_ptr<MeshBuffer>								mesh_buffer;
 
+	// Particle systems drawn this frame, updated in the transfer command buffer.
+	std::vector<ParticleSystemImpl*>						particle_systems_to_update					= {};
+
+	// Reused by DrawText() to avoid allocating every call.
+	std::vector<TextGlyphPlacement>							text_glyph_placements						= {};
+	std::vector<TextLineMetrics>							text_line_metrics							= {};
+
 	uint32_t												current_swap_buffer							= {};
 	std::array<RenderTargetTextureImpl::SwapBuffer, 2>		swap_buffers								= {};
 
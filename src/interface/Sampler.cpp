@@ -287,6 +287,9 @@ vk2d::vk2d_internal::SamplerImpl::SamplerImpl(
 		sampler_data.memory.DataCopy( &sd, sizeof( vk2d::vk2d_internal::SamplerImpl::BufferData ) );
 	}
 
+	max_level_of_detail			= create_info.mipmap_max_level_of_detail;
+	is_level_of_detail_raised	= create_info.mipmap_min_level_of_detail > 0.0f || create_info.mipmap_level_of_detail_bias > 0.0f;
+
 	is_good			= true;
 }
 
@@ -331,6 +334,17 @@ bool vk2d::vk2d_internal::SamplerImpl::IsAnyBorderColorEnabled() const
 	return bool( border_color_enable.x || border_color_enable.y );
 }
 
+bool vk2d::vk2d_internal::SamplerImpl::SamplesMipLevels(
+	bool			is_minified
+) const
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	if( max_level_of_detail <= 0.0f ) return false;
+	if( is_level_of_detail_raised ) return true;
+	return is_minified;
+}
+
 bool vk2d::vk2d_internal::SamplerImpl::IsGood() const
 {
 	return is_good;
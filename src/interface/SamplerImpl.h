@@ -25,6 +25,12 @@ public:
 	glm::uvec2									GetBorderColorEnable() const;
 	bool										IsAnyBorderColorEnabled() const;
 
+	// Tells if a draw can read mip levels other than mip level 0 with this
+	// sampler. Level of detail only goes above 0 when the texture is shrunk,
+	// unless the sampler forces it higher.
+	bool										SamplesMipLevels(
+		bool									is_minified ) const;
+
 	bool										IsGood() const;
 
 
@@ -44,6 +50,9 @@ private:
 
 	glm::uvec2									border_color_enable	= {};
 
+	float										max_level_of_detail	= {};
+	bool										is_level_of_detail_raised	= {};
+
 	bool										is_good				= {};
 };
 
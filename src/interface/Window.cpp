@@ -6,6 +6,7 @@
 #include "types/Mesh.h"
 
 #include "system/MeshBuffer.h"
+#include "system/ShapeInstances.h"
 #include "system/ThreadPool.h"
 
 #include "interface/Window.h"
@@ -16,12 +17,18 @@
 
 #include "interface/resources/TextureResource.h"
 #include "interface/resources/TextureResourceImpl.h"
+#include "interface/resources/FontResource.h"
+#include "interface/resources/FontResourceImpl.h"
+#include "interface/resources/ResourceManager.h"
 
 #include "interface/RenderTargetTexture.h"
 #include "interface/RenderTargetTextureImpl.h"
 
 #include "interface/SamplerImpl.h"
 
+#include "interface/ParticleSystem.h"
+#include "interface/ParticleSystemImpl.h"
+
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
@@ -497,6 +504,86 @@ VK2D_API void vk2d::Window::DrawMesh(
 	);
 }
 
+VK2D_API void vk2d::Window::DrawText(
+	FontResource					*	font,
+	glm::vec2							origin,
+	const Text						&	text,
+	float								kerning,
+	glm::vec2							scale,
+	bool								vertical,
+	uint32_t							font_face,
+	Colorf								color,
+	bool								wait_for_resource_load
+)
+{
+	impl->DrawText(
+		font,
+		origin,
+		text,
+		kerning,
+		scale,
+		vertical,
+		font_face,
+		color,
+		wait_for_resource_load
+	);
+}
+
+VK2D_API void vk2d::Window::DrawCircles(
+	const std::vector<CirclePrimitive>		&	circles
+)
+{
+	impl->DrawCircles(
+		circles
+	);
+}
+
+VK2D_API void vk2d::Window::DrawRoundedRects(
+	const std::vector<RoundedRectPrimitive>	&	rounded_rects
+)
+{
+	impl->DrawRoundedRects(
+		rounded_rects
+	);
+}
+
+VK2D_API void vk2d::Window::DrawRings(
+	const std::vector<RingPrimitive>		&	rings
+)
+{
+	impl->DrawRings(
+		rings
+	);
+}
+
+VK2D_API void vk2d::Window::DrawPolylines(
+	const std::vector<Polyline>		&	polylines,
+	PolylineJoin						join,
+	PolylineCap							cap,
+	float								miter_limit
+)
+{
+	impl->DrawPolylines(
+		polylines,
+		join,
+		cap,
+		miter_limit
+	);
+}
+
+VK2D_API void vk2d::Window::DrawParticleSystem(
+	ParticleSystem					*	particle_system,
+	Texture							*	texture,
+	Sampler							*	sampler
+)
+{
+	impl->DrawParticleSystem(
+		particle_system,
+		texture,
+		sampler
+	);
+}
+
 VK2D_API bool vk2d::Window::IsGood() const
 {
 	if( !impl ) return false;
@@ -1108,6 +1195,13 @@ vk2d::vk2d_internal::WindowImpl::~WindowImpl()
 	instance->GetDeviceMemoryPool()->FreeCompleteResource( frame_data_device_buffer );
 	instance->GetDeviceMemoryPool()->FreeCompleteResource( frame_data_staging_buffer );
 
+	for( auto & b : font_glyph_staging_buffers ) {
+		instance->GetDeviceMemoryPool()->FreeCompleteResource( b );
+	}
+	for( auto t : font_retired_texture_resources ) {
+		instance->GetResourceManager()->DestroyResource( t );
+	}
+
 	for( auto f : vk_gpu_to_cpu_frame_fences ) {
 		vkDestroyFence(
 			vk_device,
@@ -1124,12 +1218,6 @@ vk2d::vk2d_internal::WindowImpl::~WindowImpl()
 		);
 	}
 
-	vkDestroySemaphore(
-		vk_device,
-		vk_transfer_semaphore,
-		nullptr
-	);
-
 	vkDestroyFence(
 		vk_device,
 		vk_acquire_image_fence,
@@ -1313,6 +1401,9 @@ bool vk2d::vk2d_internal::WindowImpl::BeginRender()
 		return false;
 	};
 
+	// Frame boundary, upload glyphs that were added to fonts during the previous frame.
+	instance->FlushPendingFontGlyphs();
+
 	// Skip if the window is iconified, swapchain images might not be available.
 	if( is_iconified ) return true;
 
@@ -1697,6 +1788,49 @@ bool vk2d::vk2d_internal::WindowImpl::EndRender()
 			}
 		}
 
+		// Record commands to copy newly rasterized glyphs into font textures
+		{
+			if( !instance->CmdUploadPendingFontGlyphs(
+				vk_transfer_command_buffer,
+				font_glyph_staging_buffers,
+				font_retired_texture_resources
+			) ) {
+				instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot record commands to transfer font glyphs to GPU!" );
+				return false;
+			}
+		}
+
+		// Record particle system updates, particles drawn this frame read the results
+		{
+			for( auto particle_system : particle_systems_to_update ) {
+				particle_system->CmdUpdate(
+					vk_transfer_command_buffer
+				);
+			}
+			particle_systems_to_update.clear();
+		}
+
+		// Transfer command buffers of all render target textures are submitted
+		// before this one in the same batch, this makes all transfers and
+		// particle updates visible to every render in the frame.
+		{
+			VkMemoryBarrier transfer_barrier {};
+			transfer_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			transfer_barrier.pNext			= nullptr;
+			transfer_barrier.srcAccessMask	= VK_ACCESS_TRANSFER_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+			transfer_barrier.dstAccessMask	= VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+
+			vkCmdPipelineBarrier(
+				vk_transfer_command_buffer,
+				VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+				0,
+				1, &transfer_barrier,
+				0, nullptr,
+				0, nullptr
+			);
+		}
+
 		// End command buffer
 		{
 			auto result = vkEndCommandBuffer(
@@ -1711,10 +1845,11 @@ bool vk2d::vk2d_internal::WindowImpl::EndRender()
 
 	// Submit renders
 	{
-		RenderTargetTextureRenderCollector collector;
+		RenderTargetTextureRenderGraph render_graph;
 
-		// Collect render target texture render submissions.
-		if( !CommitRenderTargetTextureRender( collector ) ) {
+		// Collect render target texture renders, only renders this window
+		// depends on directly or indirectly end up in the graph.
+		if( !CommitRenderTargetTextureRender( render_graph ) ) {
 			AbortRenderTargetTextureRender();
 			instance->Report(
 				ReportSeverity::NON_CRITICAL_ERROR,
@@ -1723,78 +1858,72 @@ bool vk2d::vk2d_internal::WindowImpl::EndRender()
 			return false;
 		}
 
-		std::vector<VkSubmitInfo> graphics_queue_submit_infos;
-		graphics_queue_submit_infos.reserve( collector.size() * 2 + 2 );
-
-		// TODO: During submission on the frame it could be more efficient to separate transfer and render further and just use a single semaphore between all transfers and renders.
-		// Right now the transfer and render submissions are rather fragmented. Need to get a larger workload to measure impact on performance before modifying this.
-
-		// Get all the submit infos from all render targets into one list.
-		for( auto & c : collector ) {
-			graphics_queue_submit_infos.push_back( *c.vk_transfer_submit_info );
-			graphics_queue_submit_infos.push_back( *c.vk_render_submit_info );
+		// Immediate dependencies that were already submitted earlier.
+		for( auto & d : render_target_texture_dependencies[ next_image ] ) {
+			if( !render_graph.FindNode( d ) ) {
+				render_graph.AddExternalDependency(
+					d.render_target->GetAllCompleteSemaphore( d ),
+					d.render_target->GetRenderCounter( d )
+				);
+			}
 		}
 
-		// Collection of semaphores that the main window render needs to wait for, this considers timeline semaphores.
-		std::vector<VkSemaphore>			render_wait_for_semaphores;
-		std::vector<uint64_t>				render_wait_for_semaphore_timeline_values;
-		std::vector<VkPipelineStageFlags>	render_wait_for_pipeline_stages;
-		render_wait_for_semaphores.reserve( std::size( render_target_texture_dependencies[ next_image ] ) + 1 );
-		render_wait_for_semaphore_timeline_values.reserve( std::size( render_target_texture_dependencies[ next_image ] ) + 1 );
-		render_wait_for_pipeline_stages.reserve( std::size( render_target_texture_dependencies[ next_image ] ) + 1 );
-
-		// First entry is the regular transfer semaphore which is a binary semaphore.
-		render_wait_for_semaphores.push_back( vk_transfer_semaphore );
-		render_wait_for_semaphore_timeline_values.push_back( 1 );
-		render_wait_for_pipeline_stages.push_back( VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT );
+		render_graph.Sort();
 
-		// Resolve immediate dependencies we need to wait for before the main render happens.
-		for( auto & d : render_target_texture_dependencies[ next_image ] ) {
-			render_wait_for_semaphores.push_back( d.render_target->GetAllCompleteSemaphore( d ) );
-			render_wait_for_semaphore_timeline_values.push_back( d.render_target->GetRenderCounter( d ) );
-			// TODO: Replace VK_PIPELINE_STAGE_ALL_COMMANDS_BIT with something that narrows down the potential pipeline bubble more.
-			render_wait_for_pipeline_stages.push_back( VK_PIPELINE_STAGE_ALL_COMMANDS_BIT );
+		// Whole frame goes in as a single batch. All transfers first, the window
+		// transfer command buffer is last as it ends with the barrier that makes
+		// the transfers visible, then renders in graph order with the window last.
+		std::vector<VkCommandBuffer> command_buffers;
+		command_buffers.reserve( render_graph.size() * 2 + 2 );
+		for( auto & n : render_graph.nodes ) {
+			command_buffers.push_back( n.vk_transfer_command_buffer );
+		}
+		command_buffers.push_back( vk_transfer_command_buffer );
+		for( auto & n : render_graph.nodes ) {
+			command_buffers.push_back( n.vk_render_command_buffer );
 		}
+		command_buffers.push_back( render_command_buffer );
+
+		// Render target texture timeline semaphores followed by the binary present semaphore,
+		// value for the binary semaphore is ignored.
+		std::vector<VkSemaphore>	signal_semaphores;
+		std::vector<uint64_t>		signal_semaphore_values;
+		signal_semaphores.reserve( render_graph.size() + 1 );
+		signal_semaphore_values.reserve( render_graph.size() + 1 );
+		for( auto & n : render_graph.nodes ) {
+			signal_semaphores.push_back( n.vk_render_complete_semaphore );
+			signal_semaphore_values.push_back( n.render_counter );
+		}
+		signal_semaphores.push_back( vk_submit_to_present_semaphores[ next_image ] );
+		signal_semaphore_values.push_back( 0 );
+
+		// External dependencies are only ever sampled.
+		std::vector<VkPipelineStageFlags> wait_pipeline_stages(
+			std::size( render_graph.external_wait_semaphores ),
+			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+		);
 
-		assert( std::size( render_wait_for_semaphores ) == std::size( render_wait_for_semaphore_timeline_values ) &&
-			std::size( render_wait_for_semaphores ) == std::size( render_wait_for_pipeline_stages ) );
-
-	// Get submit infos for the window itself.
-		VkSubmitInfo window_transfer_submit_info {};
-		window_transfer_submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		window_transfer_submit_info.pNext					= nullptr;
-		window_transfer_submit_info.waitSemaphoreCount		= 0;
-		window_transfer_submit_info.pWaitSemaphores			= nullptr;
-		window_transfer_submit_info.pWaitDstStageMask		= nullptr;
-		window_transfer_submit_info.commandBufferCount		= 1;
-		window_transfer_submit_info.pCommandBuffers			= &vk_transfer_command_buffer;
-		window_transfer_submit_info.signalSemaphoreCount	= 1;
-		window_transfer_submit_info.pSignalSemaphores		= &vk_transfer_semaphore;
-		graphics_queue_submit_infos.push_back( window_transfer_submit_info );
-
-		uint64_t signal_timeline_semaphore_value = 1;
-		VkTimelineSemaphoreSubmitInfo window_render_timeline_submit_info {};
-		window_render_timeline_submit_info.sType						= VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
-		window_render_timeline_submit_info.pNext						= nullptr;
-		window_render_timeline_submit_info.waitSemaphoreValueCount		= uint32_t( std::size( render_wait_for_semaphore_timeline_values ) );
-		window_render_timeline_submit_info.pWaitSemaphoreValues			= render_wait_for_semaphore_timeline_values.data();
-		window_render_timeline_submit_info.signalSemaphoreValueCount	= 1;
-		window_render_timeline_submit_info.pSignalSemaphoreValues		= &signal_timeline_semaphore_value;
-
-		VkSubmitInfo window_render_submit_info {};
-		window_render_submit_info.sType						= VK_STRUCTURE_TYPE_SUBMIT_INFO;
-		window_render_submit_info.pNext						= &window_render_timeline_submit_info;
-		window_render_submit_info.waitSemaphoreCount		= uint32_t( std::size( render_wait_for_semaphores ) );
-		window_render_submit_info.pWaitSemaphores			= render_wait_for_semaphores.data();
-		window_render_submit_info.pWaitDstStageMask			= render_wait_for_pipeline_stages.data();
-		window_render_submit_info.commandBufferCount		= 1;
-		window_render_submit_info.pCommandBuffers			= &render_command_buffer;
-		window_render_submit_info.signalSemaphoreCount		= 1;
-		window_render_submit_info.pSignalSemaphores			= &vk_submit_to_present_semaphores[ next_image ];
-		graphics_queue_submit_infos.push_back( window_render_submit_info );
+		VkTimelineSemaphoreSubmitInfo timeline_submit_info {};
+		timeline_submit_info.sType						= VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+		timeline_submit_info.pNext						= nullptr;
+		timeline_submit_info.waitSemaphoreValueCount	= uint32_t( std::size( render_graph.external_wait_semaphore_values ) );
+		timeline_submit_info.pWaitSemaphoreValues		= render_graph.external_wait_semaphore_values.data();
+		timeline_submit_info.signalSemaphoreValueCount	= uint32_t( std::size( signal_semaphore_values ) );
+		timeline_submit_info.pSignalSemaphoreValues		= signal_semaphore_values.data();
+
+		VkSubmitInfo submit_info {};
+		submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
+		submit_info.pNext					= &timeline_submit_info;
+		submit_info.waitSemaphoreCount		= uint32_t( std::size( render_graph.external_wait_semaphores ) );
+		submit_info.pWaitSemaphores			= render_graph.external_wait_semaphores.data();
+		submit_info.pWaitDstStageMask		= wait_pipeline_stages.data();
+		submit_info.commandBufferCount		= uint32_t( std::size( command_buffers ) );
+		submit_info.pCommandBuffers			= command_buffers.data();
+		submit_info.signalSemaphoreCount	= uint32_t( std::size( signal_semaphores ) );
+		submit_info.pSignalSemaphores		= signal_semaphores.data();
 
 		auto result = primary_render_queue.Submit(
-			graphics_queue_submit_infos,
+			submit_info,
 			vk_gpu_to_cpu_frame_fences[ next_image ]
 		);
 		if( result != VK_SUCCESS ) {
@@ -2231,7 +2360,9 @@ void vk2d::vk2d_internal::WindowImpl::DrawTriangleList(
 	const std::vector<glm::mat4>			&	transformations,
 	bool										filled,
 	Texture							*	texture,
-	Sampler							*	sampler
+	Sampler							*	sampler,
+	float										signed_distance_field_spread,
+	const SignedDistanceFieldEffects		*	signed_distance_field_effects
 )
 {
 	VK2D_ASSERT_MAIN_THREAD( instance );
@@ -2256,22 +2387,159 @@ void vk2d::vk2d_internal::WindowImpl::DrawTriangleList(
 
 	CheckAndAddRenderTargetTextureDependency( texture );
 
-	{
-		bool multitextured = texture->GetLayerCount() > 1 &&
-			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		&vertices,
+		transformations
+	);
 
-		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
+	bool multitextured = texture->GetLayerCount() > 1 &&
+		texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
+
+	auto push_result = mesh_buffer->CmdPushMesh(
+		command_buffer,
+		raw_indices,
+		vertices,
+		texture_layer_weights,
+		transformations
+	);
+
+	if( push_result.success ) {
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.index_offset						= push_result.location_info.index_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+
+		CmdDrawTriangleList(
+			command_buffer,
+			pc,
+			index_count,
+			uint32_t( std::size( transformations ) ),
+			filled,
 			multitextured,
-			sampler->impl->IsAnyBorderColorEnabled(),
-			3
+			texture,
+			sampler,
+			signed_distance_field_spread,
+			signed_distance_field_effects
+		);
+	} else {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push mesh into mesh render queue!" );
+	}
+
+	#if VK2D_BUILD_OPTION_DEBUG_ALWAYS_DRAW_TRIANGLES_WIREFRAME
+	if( filled ) {
+		auto vertices_copy = vertices;
+		for( auto & v : vertices_copy ) {
+			v.color = Colorf( 0.2f, 1.0f, 0.4f, 0.25f );
+		}
+		DrawTriangleList(
+			raw_indices,
+			vertices_copy,
+			{},
+			false
 		);
+	}
+	#endif
+}
 
+void vk2d::vk2d_internal::WindowImpl::DrawText(
+	FontResource						*	font,
+	glm::vec2								origin,
+	const Text							&	text,
+	float									kerning,
+	glm::vec2								scale,
+	bool									vertical,
+	uint32_t								font_face,
+	const Colorf						&	color,
+	bool									wait_for_resource_load
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	// Skip if the window is iconified, swapchain images might not be available.
+	if( is_iconified ) return;
+
+	if( std::size( text ) <= 0 ) return;
+	if( !font || !font->impl ) return;
+	auto fi = font->impl.get();
+	if( wait_for_resource_load ) {
+		fi->WaitUntilLoaded( std::chrono::nanoseconds::max() );
+	} else {
+		if( fi->GetStatus() == ResourceStatus::UNDETERMINED ) return;
+	}
+	if( !fi->FaceExists( font_face ) ) return;
+
+	Texture * texture = fi->GetTextureResource();
+	if( !texture || !texture->IsTextureDataReady() ) return;
+
+	// Glyphs are laid out unscaled, the shader scales them.
+	fi->LayoutTextForDrawing(
+		text,
+		kerning,
+		glm::vec2( 1.0f, 1.0f ),
+		vertical,
+		font_face,
+		texture->GetLayerCount(),
+		text_glyph_placements,
+		text_line_metrics
+	);
+	if( text_glyph_placements.empty() ) return;
+
+	auto command_buffer		= vk_render_command_buffers[ next_image ];
+	auto glyph_count		= uint32_t( text_glyph_placements.size() );
+
+	uint64_t glyph_table_generation	= {};
+	auto glyph_table_size			= fi->AddGlyphTableEntries( font_face, text_glyph_placements, glyph_table_generation );
+
+	CheckAndAddRenderTargetTextureDependency( texture );
+
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		glyph_count,
+		uint32_t( sizeof( GlyphInstance ) ),
+		fi->GetGlyphTableKey( font_face ),
+		glyph_table_generation,
+		glyph_table_size * GLYPH_TABLE_FLOATS_PER_GLYPH,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push text into mesh render queue!" );
+		return;
+	}
+
+	fi->WriteGlyphInstances(
+		font_face,
+		text_glyph_placements,
+		color,
+		static_cast<GlyphInstance*>( instance_data )
+	);
+	if( table_data ) {
+		fi->WriteGlyphTable(
+			font_face,
+			glyph_table_size,
+			table_data
+		);
+	}
+
+	auto sampler							= instance->GetDefaultSampler();
+	auto signed_distance_field_spread		= fi->GetSignedDistanceFieldSpread();
+
+	{
 		GraphicsPipelineSettings pipeline_settings {};
 		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
 		pipeline_settings.vk_render_pass		= vk_render_pass;
 		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-		pipeline_settings.polygon_mode			= filled ? VK_POLYGON_MODE_FILL : VK_POLYGON_MODE_LINE;
-		pipeline_settings.shader_programs		= graphics_shader_programs;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules(
+			signed_distance_field_spread > 0.0f ?
+			GraphicsShaderProgramID::GLYPH_INSTANCE_SIGNED_DISTANCE_FIELD :
+			GraphicsShaderProgramID::GLYPH_INSTANCE
+		);
 		pipeline_settings.samples				= VkSampleCountFlags( samples );
 		pipeline_settings.enable_blending		= VK_TRUE;
 
@@ -2290,64 +2558,414 @@ void vk2d::vk2d_internal::WindowImpl::DrawTriangleList(
 		texture
 	);
 
-	auto push_result = mesh_buffer->CmdPushMesh(
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	if( signed_distance_field_spread > 0.0f ) {
+		GraphicsSignedDistanceFieldPushConstants pc {};
+		pc.spread							= signed_distance_field_spread;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsGlyphInstancePushConstants pc {};
+		pc.origin							= origin;
+		pc.scale							= scale;
+		pc.vertical							= vertical ? 1 : 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( GlyphInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
 		command_buffer,
-		raw_indices,
-		vertices,
-		texture_layer_weights,
-		transformations
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		glyph_count,
+		0,
+		first_instance
 	);
+}
 
-	if( push_result.success ) {
-		{
-			GraphicsPrimaryRenderPushConstants pc {};
-			pc.transformation_offset	= push_result.location_info.transformation_offset;
-			pc.index_offset				= push_result.location_info.index_offset;
-			pc.index_count				= 3;
-			pc.vertex_offset			= push_result.location_info.vertex_offset;
-			pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
-			pc.texture_channel_weight_count	= texture->GetLayerCount();
+template<typename ShapePrimitiveT>
+void vk2d::vk2d_internal::WindowImpl::DrawShapes(
+	ShapeInstanceType						shape,
+	const std::vector<ShapePrimitiveT>	&	shapes
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
 
-			vkCmdPushConstants(
-				command_buffer,
-				instance->GetGraphicsPrimaryRenderPipelineLayout(),
-				VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
-				0, sizeof( pc ),
-				&pc
-			);
-		}
+	// Skip if the window is iconified, swapchain images might not be available.
+	if( is_iconified ) return;
+
+	if( shapes.empty() ) return;
+
+	auto command_buffer		= vk_render_command_buffers[ next_image ];
+	auto shape_count		= uint32_t( shapes.size() );
+
+	// Shapes do not use a shared table, an empty one is pushed once per frame.
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		shape_count,
+		uint32_t( sizeof( ShapeInstance ) ),
+		nullptr,
+		0,
+		0,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push shapes into mesh render queue!" );
+		return;
+	}
+
+	WriteShapeInstances(
+		shapes,
+		static_cast<ShapeInstance*>( instance_data )
+	);
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::SHAPE_INSTANCE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsShapeInstancePushConstants pc {};
+		pc.render_target_size				= glm::vec2( float( extent.width ), float( extent.height ) );
+		pc.shape							= shape;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SHAPE_INSTANCE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( ShapeInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		shape_count,
+		0,
+		first_instance
+	);
+}
+
+void vk2d::vk2d_internal::WindowImpl::DrawCircles(
+	const std::vector<CirclePrimitive>		&	circles
+)
+{
+	DrawShapes(
+		ShapeInstanceType::CIRCLE,
+		circles
+	);
+}
+
+void vk2d::vk2d_internal::WindowImpl::DrawRoundedRects(
+	const std::vector<RoundedRectPrimitive>	&	rounded_rects
+)
+{
+	DrawShapes(
+		ShapeInstanceType::ROUNDED_RECTANGLE,
+		rounded_rects
+	);
+}
+
+void vk2d::vk2d_internal::WindowImpl::DrawRings(
+	const std::vector<RingPrimitive>		&	rings
+)
+{
+	DrawShapes(
+		ShapeInstanceType::RING,
+		rings
+	);
+}
+
+void vk2d::vk2d_internal::WindowImpl::DrawPolylines(
+	const std::vector<Polyline>			&	polylines,
+	PolylineJoin							join,
+	PolylineCap								cap,
+	float									miter_limit
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	// Skip if the window is iconified, swapchain images might not be available.
+	if( is_iconified ) return;
+
+	auto point_count		= CalculatePolylinePointInstanceCount( polylines );
+	if( point_count < 2 ) return;
+
+	auto command_buffer		= vk_render_command_buffers[ next_image ];
+
+	// Polylines do not use a shared table, an empty one is pushed once per frame.
+	void	*	instance_data	= nullptr;
+	float	*	table_data		= nullptr;
+	auto push_result = mesh_buffer->CmdPushInstances(
+		command_buffer,
+		point_count,
+		uint32_t( sizeof( PolylinePointInstance ) ),
+		nullptr,
+		0,
+		0,
+		instance_data,
+		table_data
+	);
+	if( !push_result.success ) {
+		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push polylines into mesh render queue!" );
+		return;
+	}
+
+	WritePolylinePointInstances(
+		polylines,
+		static_cast<PolylinePointInstance*>( instance_data )
+	);
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::POLYLINE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.transformation_offset			= push_result.location_info.transformation_offset;
+		pc.vertex_offset					= push_result.location_info.vertex_offset;
+		pc.texture_channel_weight_offset	= push_result.location_info.texture_channel_weight_offset;
+		pc.texture_channel_weight_count		= 0;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	{
+		GraphicsPolylinePushConstants pc {};
+		pc.render_target_size				= glm::vec2( float( extent.width ), float( extent.height ) );
+		pc.join								= uint32_t( join );
+		pc.cap								= uint32_t( cap );
+		pc.miter_limit						= std::max( miter_limit, 1.0f );
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_POLYLINE_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	// Instances are packed into vertex sized slots, see MeshBuffer::CmdPushInstances().
+	// Each segment reads its own point and the next one, the last point
+	// does not start a segment.
+	auto first_instance = push_result.location_info.vertex_offset * uint32_t( sizeof( Vertex ) / sizeof( PolylinePointInstance ) );
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		point_count - 1,
+		0,
+		first_instance
+	);
+}
+
+void vk2d::vk2d_internal::WindowImpl::DrawParticleSystem(
+	ParticleSystem						*	particle_system,
+	Texture								*	texture,
+	Sampler								*	sampler
+)
+{
+	VK2D_ASSERT_MAIN_THREAD( instance );
+
+	// Skip if the window is iconified, swapchain images might not be available.
+	if( is_iconified ) return;
+
+	if( !particle_system || !particle_system->IsGood() ) return;
+
+	auto command_buffer		= vk_render_command_buffers[ next_image ];
+	auto particle_system_impl	= particle_system->impl.get();
+
+	if( !texture ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !texture->IsTextureDataReady() ) {
+		texture = instance->GetDefaultTexture();
+	}
+	if( !sampler ) {
+		sampler = instance->GetDefaultSampler();
+	}
+
+	CheckAndAddRenderTargetTextureDependency( texture );
+
+	// Particle sizes are only known on the GPU.
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		nullptr,
+		{}
+	);
+
+	// Compute dispatches are not allowed inside a render pass, simulation
+	// is recorded in the transfer command buffer which runs before this.
+	if( std::find( particle_systems_to_update.begin(), particle_systems_to_update.end(), particle_system_impl ) == particle_systems_to_update.end() ) {
+		particle_systems_to_update.push_back( particle_system_impl );
+	}
+
+	{
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= VK_POLYGON_MODE_FILL;
+		pipeline_settings.shader_programs		= instance->GetGraphicsShaderModules( GraphicsShaderProgramID::PARTICLE );
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	CmdBindSamplerIfDifferent(
+		command_buffer,
+		sampler
+	);
+	CmdBindTextureIfDifferent(
+		command_buffer,
+		texture
+	);
+
+	// Particle buffer takes the place of the vertex buffer.
+	{
+		auto descriptor_set = particle_system_impl->GetVertexBufferDescriptorSet();
 
 		CmdInsertCommandBufferCheckpoint(
 			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::DRAW
+			"ParticleSystem",
+			CommandBufferCheckpointType::BIND_VERTEX_BUFFER
 		);
-		vkCmdDrawIndexed(
+		vkCmdBindDescriptorSets(
 			command_buffer,
-			index_count,
-			uint32_t( std::size( transformations ) ),
-			push_result.location_info.index_offset,
-			int32_t( push_result.location_info.vertex_offset ),
-			0
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_VERTEX_BUFFER_AS_STORAGE_BUFFER,
+			1, &descriptor_set,
+			0, nullptr
 		);
-	} else {
-		instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot push mesh into mesh render queue!" );
+		mesh_buffer->InvalidateBoundVertexBuffer();
 	}
 
-	#if VK2D_BUILD_OPTION_DEBUG_ALWAYS_DRAW_TRIANGLES_WIREFRAME
-	if( filled ) {
-		auto vertices_copy = vertices;
-		for( auto & v : vertices_copy ) {
-			v.color = Colorf( 0.2f, 1.0f, 0.4f, 0.25f );
-		}
-		DrawTriangleList(
-			raw_indices,
-			vertices_copy,
-			{},
-			false
+	{
+		GraphicsPrimaryRenderPushConstants pc {};
+		pc.texture_channel_weight_count		= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
 		);
 	}
-	#endif
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"ParticleSystem",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDraw(
+		command_buffer,
+		6,
+		particle_system_impl->GetCapacity(),
+		0,
+		0
+	);
 }
 
 void vk2d::vk2d_internal::WindowImpl::DrawLineList(
@@ -2413,6 +3031,13 @@ void vk2d::vk2d_internal::WindowImpl::DrawLineList(
 
 	CheckAndAddRenderTargetTextureDependency( texture );
 
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		&vertices,
+		transformations
+	);
+
 	{
 		bool multitextured = texture->GetLayerCount() > 1 &&
 			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
@@ -2525,6 +3150,14 @@ void vk2d::vk2d_internal::WindowImpl::DrawPointList(
 
 	CheckAndAddRenderTargetTextureDependency( texture );
 
+	// Point sprites cover the whole texture regardless of UV coordinates.
+	CheckAndRequestRenderTargetTextureMipmaps(
+		texture,
+		sampler,
+		nullptr,
+		transformations
+	);
+
 	{
 		bool multitextured = texture->GetLayerCount() > 1 &&
 			texture_layer_weights.size() >= texture->GetLayerCount() * vertices.size();
@@ -2620,7 +3253,9 @@ void vk2d::vk2d_internal::WindowImpl::DrawMesh(
 				transformations,
 				true,
 				mesh.texture,
-				mesh.sampler
+				mesh.sampler,
+				mesh.signed_distance_field_spread,
+				&mesh.signed_distance_field_effects
 			);
 			break;
 		case MeshType::TRIANGLE_WIREFRAME:
@@ -2809,6 +3444,15 @@ bool vk2d::vk2d_internal::WindowImpl::SynchronizeFrame()
 
 		ConfirmRenderTargetTextureRenderFinished( previous_image );
 
+		for( auto & b : font_glyph_staging_buffers ) {
+			instance->GetDeviceMemoryPool()->FreeCompleteResource( b );
+		}
+		font_glyph_staging_buffers.clear();
+		for( auto t : font_retired_texture_resources ) {
+			instance->GetResourceManager()->DestroyResource( t );
+		}
+		font_retired_texture_resources.clear();
+
 		result = vkResetFences(
 			vk_device,
 			1, &vk_gpu_to_cpu_frame_fences[ previous_image ]
@@ -3698,22 +4342,6 @@ bool vk2d::vk2d_internal::WindowImpl::CreateWindowSynchronizationPrimitives()
 		return false;
 	}
 
-	VkSemaphoreCreateInfo mesh_transfer_semaphore_create_info {};
-	mesh_transfer_semaphore_create_info.sType	= VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-	mesh_transfer_semaphore_create_info.pNext	= nullptr;
-	mesh_transfer_semaphore_create_info.flags	= 0;
-
-	result = vkCreateSemaphore(
-		vk_device,
-		&mesh_transfer_semaphore_create_info,
-		nullptr,
-		&vk_transfer_semaphore
-	);
-	if( result != VK_SUCCESS ) {
-		instance->Report( result, "Internal error: Cannot create mesh transfer semaphore!" );
-		return false;
-	}
-
 	return true;
 }
 
@@ -3846,11 +4474,11 @@ bool vk2d::vk2d_internal::WindowImpl::CreateWindowFrameDataBuffer()
 }
 
 bool vk2d::vk2d_internal::WindowImpl::CommitRenderTargetTextureRender(
-	RenderTargetTextureRenderCollector		&	collector
+	RenderTargetTextureRenderGraph			&	render_graph
 )
 {
 	for( auto & d : render_target_texture_dependencies[ next_image ] ) {
-		if( !d.render_target->CommitRenderTargetTextureRender( d, collector ) ) {
+		if( !d.render_target->CommitRenderTargetTextureRender( d, render_graph ) ) {
 			return false;
 		}
 	}
@@ -3909,6 +4537,24 @@ void vk2d::vk2d_internal::WindowImpl::CheckAndAddRenderTargetTextureDependency(
 	}
 }
 
+void vk2d::vk2d_internal::WindowImpl::CheckAndRequestRenderTargetTextureMipmaps(
+	Texture								*	texture,
+	Sampler								*	sampler,
+	const std::vector<Vertex>			*	vertices,
+	const std::vector<glm::mat4>		&	transformations
+)
+{
+	auto render_target = dynamic_cast<RenderTargetTextureImpl*>( texture->texture_impl );
+	if( render_target ) {
+		render_target->RequestMipmapsIfSampled(
+			sampler,
+			vertices,
+			transformations,
+			CalculateSurfacePixelsPerUnit( coordinate_space, { extent.width, extent.height } )
+		);
+	}
+}
+
 void vk2d::vk2d_internal::WindowImpl::HandleScreenshotEvent()
 {
 	assert( screenshot_state == vk2d::vk2d_internal::WindowImpl::ScreenshotState::WAITING_EVENT_REPORT );
@@ -3939,6 +4585,112 @@ void vk2d::vk2d_internal::WindowImpl::HandleScreenshotEvent()
 	screenshot_state				= vk2d::vk2d_internal::WindowImpl::ScreenshotState::IDLE;
 }
 
+void vk2d::vk2d_internal::WindowImpl::CmdDrawTriangleList(
+	VkCommandBuffer								command_buffer,
+	const GraphicsPrimaryRenderPushConstants	&	primary_push_constants,
+	uint32_t									index_count,
+	uint32_t									instance_count,
+	bool										filled,
+	bool										multitextured,
+	Texture									*	texture,
+	Sampler									*	sampler,
+	float										signed_distance_field_spread,
+	const SignedDistanceFieldEffects		*	signed_distance_field_effects
+)
+{
+	// Signed distance field atlases need their own shader, skip it if the
+	// texture was swapped for the default texture.
+	bool use_signed_distance_field = signed_distance_field_spread > 0.0f && texture != instance->GetDefaultTexture();
+	bool use_signed_distance_field_effects = use_signed_distance_field && signed_distance_field_effects && (
+		signed_distance_field_effects->outline_width > 0.0f ||
+		signed_distance_field_effects->shadow_color.a > 0.0f );
+
+	{
+		auto graphics_shader_programs = instance->GetCompatibleGraphicsShaderModules(
+			multitextured,
+			sampler->impl->IsAnyBorderColorEnabled(),
+			3
+		);
+		if( use_signed_distance_field ) {
+			graphics_shader_programs = instance->GetGraphicsShaderModules(
+				use_signed_distance_field_effects ?
+				GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD_WITH_EFFECTS :
+				GraphicsShaderProgramID::SIGNED_DISTANCE_FIELD
+			);
+		}
+
+		GraphicsPipelineSettings pipeline_settings {};
+		pipeline_settings.vk_pipeline_layout	= instance->GetGraphicsPrimaryRenderPipelineLayout();
+		pipeline_settings.vk_render_pass		= vk_render_pass;
+		pipeline_settings.primitive_topology	= VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		pipeline_settings.polygon_mode			= filled ? VK_POLYGON_MODE_FILL : VK_POLYGON_MODE_LINE;
+		pipeline_settings.shader_programs		= graphics_shader_programs;
+		pipeline_settings.samples				= VkSampleCountFlags( samples );
+		pipeline_settings.enable_blending		= VK_TRUE;
+
+		CmdBindGraphicsPipelineIfDifferent(
+			command_buffer,
+			pipeline_settings
+		);
+	}
+
+	CmdBindSamplerIfDifferent(
+		command_buffer,
+		sampler
+	);
+	CmdBindTextureIfDifferent(
+		command_buffer,
+		texture
+	);
+
+	{
+		GraphicsPrimaryRenderPushConstants pc = primary_push_constants;
+		pc.index_count					= 3;
+		pc.texture_channel_weight_count	= texture->GetLayerCount();
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			0, sizeof( pc ),
+			&pc
+		);
+	}
+	if( use_signed_distance_field ) {
+		SignedDistanceFieldEffects effects = signed_distance_field_effects ? *signed_distance_field_effects : SignedDistanceFieldEffects {};
+
+		GraphicsSignedDistanceFieldPushConstants pc {};
+		pc.outline_color			= { effects.outline_color.r, effects.outline_color.g, effects.outline_color.b, effects.outline_color.a };
+		pc.shadow_color				= { effects.shadow_color.r, effects.shadow_color.g, effects.shadow_color.b, effects.shadow_color.a };
+		pc.shadow_offset			= effects.shadow_offset;
+		pc.outline_width			= effects.outline_width;
+		pc.shadow_softness			= effects.shadow_softness;
+		pc.spread					= signed_distance_field_spread;
+
+		vkCmdPushConstants(
+			command_buffer,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT,
+			GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET, sizeof( pc ),
+			&pc
+		);
+	}
+
+	CmdInsertCommandBufferCheckpoint(
+		command_buffer,
+		"MeshBuffer",
+		CommandBufferCheckpointType::DRAW
+	);
+	vkCmdDrawIndexed(
+		command_buffer,
+		index_count,
+		instance_count,
+		primary_push_constants.index_offset,
+		int32_t( primary_push_constants.vertex_offset ),
+		0
+	);
+}
+
 void vk2d::vk2d_internal::WindowImpl::CmdBindGraphicsPipelineIfDifferent(
 	VkCommandBuffer											command_buffer,
 	const GraphicsPipelineSettings		&	pipeline_settings
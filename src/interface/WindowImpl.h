@@ -3,8 +3,14 @@
 #include "core/SourceCommon.h"
 
 #include "types/Synchronization.hpp"
+#include "types/SignedDistanceFieldEffects.h"
+#include "types/Text.h"
+#include "types/TextLayout.h"
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
 
 #include "system/MeshBuffer.h"
+#include "system/MipmapGeneration.h"
 #include "system/QueueResolver.h"
 #include "system/VulkanMemoryManagement.h"
 #include "system/DescriptorSet.h"
@@ -13,6 +19,7 @@
 
 #include "interface/Instance.h"
 #include "interface/InstanceImpl.h"
+#include "interface/ParticleSystemImpl.h"
 
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
@@ -28,6 +35,7 @@ class Window;
 class Monitor;
 class Cursor;
 class TextureResource;
+class FontResource;
 class Mesh;
 
 namespace vk2d_internal {
@@ -40,6 +48,7 @@ class MeshBuffer;
 class TextureResourceImpl;
 class ScreenshotSaverTask;
 class GraphicsShaderProgram;
+struct TextGlyphPlacement;
 
 enum class NextRenderCallFunction : uint32_t {
 	BEGIN		= 0,
@@ -175,7 +184,9 @@ public:
 		const std::vector<glm::mat4>						&	transformations,
 		bool													solid,
 		Texture												*	texture,
-		Sampler												*	sampler);
+		Sampler												*	sampler,
+		float													signed_distance_field_spread		= 0.0f,
+		const SignedDistanceFieldEffects					*	signed_distance_field_effects		= nullptr );
 
 	void														DrawLineList(
 		const std::vector<VertexIndex_2>					&	indices,
@@ -206,11 +217,48 @@ public:
 		const Mesh											&	mesh,
 		const std::vector<glm::mat4>						&	transformations );
 
+	void														DrawText(
+		FontResource										*	font,
+		glm::vec2												origin,
+		const Text											&	text,
+		float													kerning,
+		glm::vec2												scale,
+		bool													vertical,
+		uint32_t												font_face,
+		const Colorf										&	color,
+		bool													wait_for_resource_load );
+
+	void														DrawCircles(
+		const std::vector<CirclePrimitive>					&	circles );
+
+	void														DrawRoundedRects(
+		const std::vector<RoundedRectPrimitive>				&	rounded_rects );
+
+	void														DrawRings(
+		const std::vector<RingPrimitive>					&	rings );
+
+	void														DrawPolylines(
+		const std::vector<Polyline>							&	polylines,
+		PolylineJoin											join,
+		PolylineCap												cap,
+		float													miter_limit );
+
+	void														DrawParticleSystem(
+		ParticleSystem										*	particle_system,
+		Texture												*	texture,
+		Sampler												*	sampler );
+
 	bool														SynchronizeFrame();
 
 	bool														IsGood();
 
 private:
+	// Draws shapes using the shape instance shaders, see DrawCircles().
+	template<typename ShapePrimitiveT>
+	void														DrawShapes(
+		ShapeInstanceType										shape,
+		const std::vector<ShapePrimitiveT>					&	shapes );
+
 	bool														RecreateWindowSizeDependantResources();
 	bool														CreateGLFWWindow();
 	bool														CreateSurface();
@@ -233,7 +281,7 @@ private:
 	// it will swap the buffers so 2 renders can be queued, however third call to
 	// BeginRender() will be blocked until the first BeginRender() call has been rendered.
 	bool														CommitRenderTargetTextureRender(
-		RenderTargetTextureRenderCollector					&	collector );
+		RenderTargetTextureRenderGraph						&	render_graph );
 
 	void														ConfirmRenderTargetTextureRenderSubmission();
 	void														ConfirmRenderTargetTextureRenderFinished(
@@ -245,12 +293,33 @@ private:
 	void														CheckAndAddRenderTargetTextureDependency(
 		Texture												*	texture );
 
+	// Lets render target textures with on demand mipmaps know if this draw can read their mip levels.
+	void														CheckAndRequestRenderTargetTextureMipmaps(
+		Texture												*	texture,
+		Sampler												*	sampler,
+		const std::vector<Vertex>							*	vertices,
+		const std::vector<glm::mat4>						&	transformations );
+
 	void														HandleScreenshotEvent();
 
 	void														CmdBindGraphicsPipelineIfDifferent(
 		VkCommandBuffer											command_buffer,
 		const GraphicsPipelineSettings						&	pipeline_settings );
 
+	// Binds pipeline, sampler and texture and records the draw for triangles
+	// already pushed into the mesh buffer.
+	void														CmdDrawTriangleList(
+		VkCommandBuffer											command_buffer,
+		const GraphicsPrimaryRenderPushConstants			&	primary_push_constants,
+		uint32_t												index_count,
+		uint32_t												instance_count,
+		bool													filled,
+		bool													multitextured,
+		Texture												*	texture,
+		Sampler												*	sampler,
+		float													signed_distance_field_spread,
+		const SignedDistanceFieldEffects					*	signed_distance_field_effects );
+
 	void														CmdBindSamplerIfDifferent(
 		VkCommandBuffer											command_buffer,
 		Sampler												*	sampler );
@@ -306,7 +375,6 @@ private:
 	VkCommandPool												vk_command_pool								= {};
 	std::vector<VkCommandBuffer>								vk_render_command_buffers					= {};	// For more overlapped execution multiple command buffers are needed.
 	VkCommandBuffer												vk_transfer_command_buffer					= {};	// For data transfer each frame, this is small command buffer and can be re-recorded just before submitting the work.
-	VkSemaphore													vk_transfer_semaphore						= {};
 
 	VkExtent2D													min_extent									= {};
 	VkExtent2D													max_extent									= {};
@@ -345,6 +413,18 @@ private:
 
 	std::unique_ptr<MeshBuffer>									mesh_buffer									= {};
 
+	// Particle systems drawn this frame, updated in the transfer command buffer.
+	std::vector<ParticleSystemImpl*>							particle_systems_to_update					= {};
+
+	// Glyph upload staging buffers and replaced font textures of the previous
+	// frame, destroyed after the frame fence.
+	std::vector<CompleteBufferResource>							font_glyph_staging_buffers					= {};
+	std::vector<TextureResource*>								font_retired_texture_resources				= {};
+
+	// Reused by DrawText() to avoid allocating every call.
+	std::vector<TextGlyphPlacement>								text_glyph_placements						= {};
+	std::vector<TextLineMetrics>								text_line_metrics							= {};
+
 	std::vector<std::vector<RenderTargetTextureDependencyInfo>>	render_target_texture_dependencies			= {};
 
 	enum class ScreenshotState : uint32_t {
@@ -0,0 +1,341 @@
+
+#include "core/SourceCommon.h"
+
+#include "system/CommonTools.h"
+
+#include "interface/resources/FontAtlasCache.h"
+
+#include <fstream>
+#include <thread>
+
+
+
+namespace vk2d {
+namespace vk2d_internal {
+
+// Cache files are only meant to be read on the machine that wrote them,
+// structures are stored as is in native byte order. Every section starts
+// at an 8 byte boundary so the file can be used directly from memory.
+constexpr char FONT_ATLAS_CACHE_MAGIC[ 8 ]					= { 'V', 'K', '2', 'D', 'F', 'A', 'C', '\0' };
+constexpr size_t FONT_ATLAS_CACHE_SECTION_ALIGNMENT			= 8;
+
+struct FontAtlasCacheFileHeader {
+	char			magic[ 8 ]						= {};
+	uint32_t		version							= {};
+	uint32_t		face_count						= {};
+	uint64_t		font_file_hash					= {};
+	uint64_t		font_file_size					= {};
+	uint32_t		glyph_texel_size				= {};
+	uint32_t		glyph_atlas_padding				= {};
+	uint32_t		fallback_character				= {};
+	uint32_t		use_alpha						= {};
+	uint32_t		glyph_atlas_type				= {};
+	uint32_t		signed_distance_field_spread	= {};
+	uint32_t		atlas_size						= {};
+	uint32_t		atlas_layer_count				= {};
+	double			glyph_size_bitmap_size_ratio	= {};
+	uint64_t		glyph_count						= {};
+	uint64_t		glyph_texel_count				= {};
+	uint64_t		glyph_info_size					= {};	// sizeof( GlyphInfo ) when written.
+};
+
+struct FontAtlasCacheFileFace {
+	uint32_t		fallback_glyph_index			= {};
+	float			ascender						= {};
+	float			descender						= {};
+	float			line_height						= {};
+	uint64_t		glyph_info_count				= {};
+	uint64_t		character_count					= {};
+	uint64_t		kerning_pair_count				= {};
+};
+
+struct FontAtlasCacheFileCharacter {
+	uint32_t		character						= {};
+	uint32_t		glyph_index						= {};
+};
+
+struct FontAtlasCacheFileKerningPair {
+	uint64_t		glyph_pair						= {};
+	float			kerning							= {};
+	uint32_t		padding							= {};
+};
+
+static_assert( std::is_trivially_copyable_v<GlyphInfo>, "GlyphInfo is stored in font atlas cache files as is" );
+
+uint64_t HashFontAtlasCacheBytes(
+	const void			*	data,
+	size_t					byte_size,
+	uint64_t				hash		= 14695981039346656037ULL
+)
+{
+	// FNV-1a
+	auto bytes = reinterpret_cast<const uint8_t*>( data );
+	for( size_t i = 0; i < byte_size; ++i ) {
+		hash ^= uint64_t( bytes[ i ] );
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+class FontAtlasCacheWriter {
+public:
+	void Write( const void * data, size_t byte_size )
+	{
+		auto bytes = reinterpret_cast<const uint8_t*>( data );
+		buffer.insert( buffer.end(), bytes, bytes + byte_size );
+	}
+
+	template<typename T>
+	void Write( const T & value )
+	{
+		static_assert( std::is_trivially_copyable_v<T> );
+		Write( &value, sizeof( T ) );
+	}
+
+	template<typename T>
+	void WriteSection( const std::vector<T> & values )
+	{
+		static_assert( std::is_trivially_copyable_v<T> );
+		Write( values.data(), values.size() * sizeof( T ) );
+		buffer.resize( ( buffer.size() + FONT_ATLAS_CACHE_SECTION_ALIGNMENT - 1 ) & ~( FONT_ATLAS_CACHE_SECTION_ALIGNMENT - 1 ) );
+	}
+
+	std::vector<uint8_t>			buffer;
+};
+
+class FontAtlasCacheReader {
+public:
+	FontAtlasCacheReader( const std::vector<uint8_t> & buffer ) :
+		buffer( buffer )
+	{}
+
+	bool Read( void * data, size_t byte_size )
+	{
+		if( byte_size > buffer.size() - position ) return false;
+		std::memcpy( data, buffer.data() + position, byte_size );
+		position += byte_size;
+		return true;
+	}
+
+	template<typename T>
+	bool Read( T & value )
+	{
+		static_assert( std::is_trivially_copyable_v<T> );
+		return Read( &value, sizeof( T ) );
+	}
+
+	template<typename T>
+	bool ReadSection( std::vector<T> & values, uint64_t count )
+	{
+		static_assert( std::is_trivially_copyable_v<T> );
+		if( count > ( buffer.size() - position ) / sizeof( T ) ) return false;
+		values.resize( size_t( count ) );
+		if( !Read( values.data(), values.size() * sizeof( T ) ) ) return false;
+		position = std::min( ( position + FONT_ATLAS_CACHE_SECTION_ALIGNMENT - 1 ) & ~( FONT_ATLAS_CACHE_SECTION_ALIGNMENT - 1 ), buffer.size() );
+		return true;
+	}
+
+	bool IsAtEnd() const
+	{
+		return position == buffer.size();
+	}
+
+private:
+	const std::vector<uint8_t>	&	buffer;
+	size_t							position		= {};
+};
+
+} // vk2d_internal
+} // vk2d
+
+
+
+vk2d::vk2d_internal::FontAtlasCacheKey vk2d::vk2d_internal::CreateFontAtlasCacheKey(
+	const std::vector<uint8_t>		&	font_file_contents
+)
+{
+	FontAtlasCacheKey key {};
+	key.font_file_hash		= HashFontAtlasCacheBytes( font_file_contents.data(), font_file_contents.size() );
+	key.font_file_size		= uint64_t( font_file_contents.size() );
+	return key;
+}
+
+std::filesystem::path vk2d::vk2d_internal::GetFontAtlasCacheFilePath(
+	const std::filesystem::path		&	cache_directory,
+	const FontAtlasCacheKey			&	key
+)
+{
+	auto hash = HashFontAtlasCacheBytes( &key.font_file_hash, sizeof( key.font_file_hash ) );
+	hash = HashFontAtlasCacheBytes( &key.font_file_size, sizeof( key.font_file_size ), hash );
+	hash = HashFontAtlasCacheBytes( &key.glyph_texel_size, sizeof( key.glyph_texel_size ), hash );
+	hash = HashFontAtlasCacheBytes( &key.glyph_atlas_padding, sizeof( key.glyph_atlas_padding ), hash );
+	hash = HashFontAtlasCacheBytes( &key.fallback_character, sizeof( key.fallback_character ), hash );
+	hash = HashFontAtlasCacheBytes( &key.use_alpha, sizeof( key.use_alpha ), hash );
+	hash = HashFontAtlasCacheBytes( &key.glyph_atlas_type, sizeof( key.glyph_atlas_type ), hash );
+	hash = HashFontAtlasCacheBytes( &key.signed_distance_field_spread, sizeof( key.signed_distance_field_spread ), hash );
+
+	char file_name[ 32 ] {};
+	std::snprintf( file_name, sizeof( file_name ), "%016llx.vk2dfont", static_cast<unsigned long long>( hash ) );
+	return cache_directory / file_name;
+}
+
+bool vk2d::vk2d_internal::ReadFontAtlasCache(
+	const std::filesystem::path					&	file_path,
+	const FontAtlasCacheKey						&	key,
+	FontAtlasCacheData							&	out_data,
+	std::vector<std::vector<uint8_t>>			&	out_atlas_layers
+)
+{
+	std::vector<uint8_t> buffer;
+	if( !ReadBinaryFile( file_path, buffer ) ) return false;
+
+	FontAtlasCacheReader reader( buffer );
+
+	FontAtlasCacheFileHeader header {};
+	if( !reader.Read( header ) ) return false;
+	if( std::memcmp( header.magic, FONT_ATLAS_CACHE_MAGIC, sizeof( header.magic ) ) != 0 ) return false;
+	if( header.version								!= FONT_ATLAS_CACHE_VERSION ) return false;
+	if( header.glyph_info_size						!= sizeof( GlyphInfo ) ) return false;
+	if( header.font_file_hash						!= key.font_file_hash ) return false;
+	if( header.font_file_size						!= key.font_file_size ) return false;
+	if( header.glyph_texel_size						!= key.glyph_texel_size ) return false;
+	if( header.glyph_atlas_padding					!= key.glyph_atlas_padding ) return false;
+	if( header.fallback_character					!= key.fallback_character ) return false;
+	if( header.use_alpha							!= key.use_alpha ) return false;
+	if( header.glyph_atlas_type						!= uint32_t( key.glyph_atlas_type ) ) return false;
+	if( header.signed_distance_field_spread			!= key.signed_distance_field_spread ) return false;
+	if( !header.face_count || !header.atlas_size || !header.atlas_layer_count ) return false;
+	if( header.face_count > buffer.size() / sizeof( FontAtlasCacheFileFace ) ) return false;
+
+	FontAtlasCacheData data {};
+	data.atlas_size						= header.atlas_size;
+	data.glyph_size_bitmap_size_ratio	= header.glyph_size_bitmap_size_ratio;
+	data.glyph_count					= header.glyph_count;
+	data.glyph_texel_count				= header.glyph_texel_count;
+	data.faces.resize( header.face_count );
+	for( auto & face : data.faces ) {
+		FontAtlasCacheFileFace file_face {};
+		if( !reader.Read( file_face ) ) return false;
+		face.fallback_glyph_index		= file_face.fallback_glyph_index;
+		face.ascender					= file_face.ascender;
+		face.descender					= file_face.descender;
+		face.line_height				= file_face.line_height;
+
+		std::vector<FontAtlasCacheFileCharacter>		characters;
+		std::vector<FontAtlasCacheFileKerningPair>		kerning_pairs;
+		if( !reader.ReadSection( face.glyph_infos, file_face.glyph_info_count ) ) return false;
+		if( !reader.ReadSection( characters, file_face.character_count ) ) return false;
+		if( !reader.ReadSection( kerning_pairs, file_face.kerning_pair_count ) ) return false;
+
+		face.character_glyph_pairs.reserve( characters.size() );
+		for( auto & c : characters ) {
+			if( c.glyph_index >= face.glyph_infos.size() ) return false;
+			face.character_glyph_pairs.push_back( { c.character, c.glyph_index } );
+		}
+		face.kerning_pairs.reserve( kerning_pairs.size() );
+		for( auto & k : kerning_pairs ) {
+			face.kerning_pairs.push_back( { k.glyph_pair, k.kerning } );
+		}
+		if( face.fallback_glyph_index >= face.glyph_infos.size() ) return false;
+		for( auto & g : face.glyph_infos ) {
+			if( g.atlas_index >= header.atlas_layer_count ) return false;
+		}
+	}
+
+	std::vector<std::vector<uint8_t>> atlas_layers( header.atlas_layer_count );
+	for( auto & layer : atlas_layers ) {
+		if( !reader.ReadSection( layer, uint64_t( header.atlas_size ) * uint64_t( header.atlas_size ) ) ) return false;
+	}
+	if( !reader.IsAtEnd() ) return false;
+
+	out_data			= std::move( data );
+	out_atlas_layers	= std::move( atlas_layers );
+	return true;
+}
+
+bool vk2d::vk2d_internal::WriteFontAtlasCache(
+	const std::filesystem::path						&	file_path,
+	const FontAtlasCacheKey							&	key,
+	const FontAtlasCacheData						&	data,
+	const std::vector<const std::vector<uint8_t>*>	&	atlas_layers
+)
+{
+	FontAtlasCacheWriter writer;
+
+	FontAtlasCacheFileHeader header {};
+	std::memcpy( header.magic, FONT_ATLAS_CACHE_MAGIC, sizeof( header.magic ) );
+	header.version							= FONT_ATLAS_CACHE_VERSION;
+	header.face_count						= uint32_t( data.faces.size() );
+	header.font_file_hash					= key.font_file_hash;
+	header.font_file_size					= key.font_file_size;
+	header.glyph_texel_size					= key.glyph_texel_size;
+	header.glyph_atlas_padding				= key.glyph_atlas_padding;
+	header.fallback_character				= key.fallback_character;
+	header.use_alpha						= key.use_alpha;
+	header.glyph_atlas_type					= uint32_t( key.glyph_atlas_type );
+	header.signed_distance_field_spread		= key.signed_distance_field_spread;
+	header.atlas_size						= data.atlas_size;
+	header.atlas_layer_count				= uint32_t( atlas_layers.size() );
+	header.glyph_size_bitmap_size_ratio		= data.glyph_size_bitmap_size_ratio;
+	header.glyph_count						= data.glyph_count;
+	header.glyph_texel_count				= data.glyph_texel_count;
+	header.glyph_info_size					= sizeof( GlyphInfo );
+	writer.Write( header );
+
+	for( auto & face : data.faces ) {
+		FontAtlasCacheFileFace file_face {};
+		file_face.fallback_glyph_index		= face.fallback_glyph_index;
+		file_face.ascender					= face.ascender;
+		file_face.descender					= face.descender;
+		file_face.line_height				= face.line_height;
+		file_face.glyph_info_count			= face.glyph_infos.size();
+		file_face.character_count			= face.character_glyph_pairs.size();
+		file_face.kerning_pair_count		= face.kerning_pairs.size();
+		writer.Write( file_face );
+
+		std::vector<FontAtlasCacheFileCharacter> characters;
+		characters.reserve( face.character_glyph_pairs.size() );
+		for( auto & c : face.character_glyph_pairs ) {
+			characters.push_back( { c.first, c.second } );
+		}
+		std::vector<FontAtlasCacheFileKerningPair> kerning_pairs;
+		kerning_pairs.reserve( face.kerning_pairs.size() );
+		for( auto & k : face.kerning_pairs ) {
+			kerning_pairs.push_back( { k.first, k.second } );
+		}
+
+		writer.WriteSection( face.glyph_infos );
+		writer.WriteSection( characters );
+		writer.WriteSection( kerning_pairs );
+	}
+
+	for( auto layer : atlas_layers ) {
+		assert( layer->size() == size_t( data.atlas_size ) * size_t( data.atlas_size ) );
+		writer.WriteSection( *layer );
+	}
+
+	// Write to a temporary file and move it in place so that a partially
+	// written file is never picked up by another process.
+	std::error_code error;
+	std::filesystem::create_directories( file_path.parent_path(), error );
+	if( error ) return false;
+
+	auto temporary_file_path = file_path;
+	temporary_file_path += "." + std::to_string( std::hash<std::thread::id>()( std::this_thread::get_id() ) ) + ".tmp";
+	{
+		std::ofstream file( temporary_file_path, std::ios::binary | std::ios::trunc );
+		if( !file ) return false;
+		file.write( reinterpret_cast<const char*>( writer.buffer.data() ), std::streamsize( writer.buffer.size() ) );
+		if( !file ) {
+			file.close();
+			std::filesystem::remove( temporary_file_path, error );
+			return false;
+		}
+	}
+	std::filesystem::rename( temporary_file_path, file_path, error );
+	if( error ) {
+		std::filesystem::remove( temporary_file_path, error );
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+#include "types/GlyphAtlasType.h"
+
+#include "interface/resources/FontResourceImpl.h"
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Increase this whenever the cache file layout or anything stored in it,
+// like GlyphInfo, changes. Old cache files are then ignored and rewritten.
+constexpr uint32_t FONT_ATLAS_CACHE_VERSION					= 1;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Identifies the font file and settings a font atlas cache file was created with.
+struct FontAtlasCacheKey
+{
+	uint64_t										font_file_hash						= {};
+	uint64_t										font_file_size						= {};
+	uint32_t										glyph_texel_size					= {};
+	uint32_t										glyph_atlas_padding					= {};
+	uint32_t										fallback_character					= {};
+	uint32_t										use_alpha							= {};
+	GlyphAtlasType									glyph_atlas_type					= {};
+	uint32_t										signed_distance_field_spread		= {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Everything needed to use a font face without FreeType.
+struct FontAtlasCacheFace
+{
+	uint32_t										fallback_glyph_index				= {};
+	float											ascender							= {};
+	float											descender							= {};
+	float											line_height							= {};
+	std::vector<GlyphInfo>							glyph_infos							= {};
+	std::vector<std::pair<uint32_t, uint32_t>>		character_glyph_pairs				= {};
+	std::vector<std::pair<uint64_t, float>>			kerning_pairs						= {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Contents of a font atlas cache file.
+struct FontAtlasCacheData
+{
+	uint32_t										atlas_size							= {};
+	double											glyph_size_bitmap_size_ratio		= {};
+	uint64_t										glyph_count							= {};
+	uint64_t										glyph_texel_count					= {};
+	std::vector<FontAtlasCacheFace>					faces								= {};
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Create cache key for a font file and settings.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	font_file_contents
+///				Entire font file.
+///
+/// @return		Cache key, glyph settings are left to default and should be filled in by the caller.
+FontAtlasCacheKey									CreateFontAtlasCacheKey(
+	const std::vector<uint8_t>					&	font_file_contents );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get the cache file path for a key.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	cache_directory
+///				Directory where cache files are stored.
+///
+/// @param[in]	key
+///				Cache key.
+///
+/// @return		Path to the cache file, the file may not exist.
+std::filesystem::path								GetFontAtlasCacheFilePath(
+	const std::filesystem::path					&	cache_directory,
+	const FontAtlasCacheKey						&	key );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Read font atlas cache file.
+///
+///				Fails silently if the file does not exist, was created with a different key or cache version, or is corrupt.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	file_path
+///				Path to cache file.
+///
+/// @param[in]	key
+///				Key the cache file must match.
+///
+/// @param[out]	out_data
+///				Glyph and face information.
+///
+/// @param[out]	out_atlas_layers
+///				Atlas texture data, one vector per layer, atlas_size * atlas_size texels of glyph coverage each.
+///
+/// @return		true if cache was read, false otherwise.
+bool												ReadFontAtlasCache(
+	const std::filesystem::path					&	file_path,
+	const FontAtlasCacheKey						&	key,
+	FontAtlasCacheData							&	out_data,
+	std::vector<std::vector<uint8_t>>			&	out_atlas_layers );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Write font atlas cache file.
+///
+///				File is written to a temporary file first and renamed over the final file so that other processes never see
+///				a partially written cache file.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	file_path
+///				Path to cache file, parent directories are created if needed.
+///
+/// @param[in]	key
+///				Key to store in the cache file.
+///
+/// @param[in]	data
+///				Glyph and face information.
+///
+/// @param[in]	atlas_layers
+///				Atlas texture data, one vector per layer, atlas_size * atlas_size texels of glyph coverage each.
+///
+/// @return		true if cache was written, false otherwise.
+bool												WriteFontAtlasCache(
+	const std::filesystem::path					&	file_path,
+	const FontAtlasCacheKey						&	key,
+	const FontAtlasCacheData					&	data,
+	const std::vector<const std::vector<uint8_t>*>	&	atlas_layers );
+
+
+
+} // vk2d_internal
+
+} // vk2d
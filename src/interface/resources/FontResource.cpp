@@ -2,6 +2,8 @@
 #include "core/SourceCommon.h"
 
 #include "system/ThreadPrivateResources.h"
+#include "system/CommonTools.h"
+#include "system/ShaderInterface.h"
 
 #include "interface/InstanceImpl.h"
 
@@ -10,8 +12,10 @@
 
 #include "interface/resources/FontResource.h"
 #include "interface/resources/FontResourceImpl.h"
+#include "interface/resources/FontAtlasCache.h"
 
 #include "interface/resources/TextureResource.h"
+#include "interface/resources/TextureResourceImpl.h"
 
 #include <stb_image_write.h>
 
@@ -28,6 +32,45 @@ uint32_t RoundToCeilingPowerOfTwo(
 
 
 
+// Shared by the thread loading a font and the loader threads helping it.
+// Helpers may start only after the font has finished loading so they must
+// not touch the font unless they managed to claim a glyph range.
+struct FontGlyphRasterizationJob {
+	FontResourceImpl								*	font						= {};
+	std::vector<std::pair<uint32_t, uint32_t>>			glyphs						= {};	// { face index, glyph index }
+	std::vector<RasterizedGlyph>						rasterized_glyphs			= {};
+	std::atomic_size_t									next_glyph					= {};
+	std::atomic_bool									failed						= {};
+
+	std::mutex											helper_mutex;
+	std::condition_variable								helpers_finished;
+	uint32_t											active_helper_count			= {};
+};
+
+// Claims and renders glyph ranges until there are none left. Null faces
+// are created with the given library when first needed.
+void RasterizeFontGlyphRanges(
+	FontGlyphRasterizationJob				&	job,
+	FT_Library									library,
+	std::vector<FT_Face>					&	faces );
+
+class FontGlyphRasterizationTask : public Task
+{
+public:
+	FontGlyphRasterizationTask(
+		std::shared_ptr<FontGlyphRasterizationJob>	job ) :
+		job( std::move( job ) )
+	{};
+
+	void operator()(
+		ThreadPrivateResource				*	thread_resource );
+
+private:
+	std::shared_ptr<FontGlyphRasterizationJob>	job					= {};
+};
+
+
+
 }
 }
 
@@ -59,7 +102,11 @@ VK2D_API vk2d::FontResource::FontResource(
 	uint32_t									glyph_texel_size,
 	bool										use_alpha,
 	uint32_t									fallback_character,
-	uint32_t									glyph_atlas_padding
+	uint32_t									glyph_atlas_padding,
+	bool										use_dynamic_glyph_cache,
+	const std::vector<uint32_t>				&	preload_characters,
+	GlyphAtlasType								glyph_atlas_type,
+	const std::filesystem::path				&	atlas_cache_directory
 )
 {
 	impl = std::make_unique<vk2d_internal::FontResourceImpl>(
@@ -71,7 +118,11 @@ VK2D_API vk2d::FontResource::FontResource(
 		glyph_texel_size,
 		use_alpha,
 		fallback_character,
-		glyph_atlas_padding
+		glyph_atlas_padding,
+		use_dynamic_glyph_cache,
+		preload_characters,
+		glyph_atlas_type,
+		atlas_cache_directory
 	);
 	if( !impl || !impl->IsGood() ) {
 		impl		= nullptr;
@@ -105,7 +156,7 @@ VK2D_API vk2d::ResourceStatus vk2d::FontResource::WaitUntilLoaded(
 }
 
 VK2D_API vk2d::Rect2f vk2d::FontResource::CalculateRenderedSize(
-	std::string_view	text,
+	const Text		&	text,
 	float				kerning,
 	glm::vec2			scale,
 	bool				vertical,
@@ -123,6 +174,11 @@ VK2D_API vk2d::Rect2f vk2d::FontResource::CalculateRenderedSize(
 	);
 }
 
+VK2D_API vk2d::FontAtlasStatistics vk2d::FontResource::GetAtlasStatistics()
+{
+	return impl->GetAtlasStatistics();
+}
+
 VK2D_API bool vk2d::FontResource::IsGood() const
 {
 	return !!impl;
@@ -157,7 +213,11 @@ vk2d::vk2d_internal::FontResourceImpl::FontResourceImpl(
 	uint32_t									glyph_texel_size,
 	bool										use_alpha,
 	uint32_t									fallback_character,
-	uint32_t									glyph_atlas_padding
+	uint32_t									glyph_atlas_padding,
+	bool										use_dynamic_glyph_cache,
+	const std::vector<uint32_t>				&	preload_characters,
+	GlyphAtlasType								glyph_atlas_type,
+	const std::filesystem::path				&	atlas_cache_directory
 ) :
 	ResourceImplBase(
 		my_interface,
@@ -177,6 +237,10 @@ vk2d::vk2d_internal::FontResourceImpl::FontResourceImpl(
 	this->glyph_atlas_padding			= glyph_atlas_padding;
 	this->fallback_character			= fallback_character;
 	this->use_alpha						= use_alpha;
+	this->use_dynamic_glyph_cache		= use_dynamic_glyph_cache;
+	this->preload_characters			= preload_characters;
+	this->glyph_atlas_type				= glyph_atlas_type;
+	this->atlas_cache_directory			= atlas_cache_directory;
 
 	is_good		= true;
 }
@@ -250,15 +314,61 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 	auto max_texture_size			= instance->GetVulkanPhysicalDeviceProperties().limits.maxImageDimension2D;
 	auto min_texture_size			= std::min( uint32_t( 128 ), max_texture_size );
 
-	// average_to_max_weight variable is used to estimate glyph space requirements on atlas textures.
-	// 0 sets the estimation to average size, 1 sets the estimation to max weights. Default is 0.05
-	// which should give enough space in the atlas to contain all glyphs in 
-	auto average_to_max_weight					= 0.05;
 	auto total_glyph_count						= uint64_t( 0 );
 	auto maximum_glyph_size						= glm::dvec2( 0.0, 0.0 );
 	auto maximum_glyph_bitmap_size				= glm::dvec2( 0.0, 0.0 );
-	auto maximum_glyph_bitmap_occupancy_size	= glm::dvec2( 0.0, 0.0 );
-	auto average_glyph_bitmap_occupancy_size	= glm::dvec2( 0.0, 0.0 );
+	auto estimated_glyph_area					= uint64_t( 0 );
+	auto largest_glyph_cell_size				= uint32_t( 0 );
+
+	// Per face list of { estimated cell height, glyph index }. Glyphs are
+	// rasterized tallest first which packs tighter on the atlas skyline.
+	std::vector<std::vector<std::pair<uint32_t, uint32_t>>> face_glyph_heights;
+
+	// Font file is read once, atlas cache key and every face are created
+	// from the same buffer.
+	if( my_interface->impl->IsFromFile() ) {
+		if( !ReadBinaryFile( my_interface->impl->GetFilePaths()[ 0 ], font_file_data ) ) {
+			instance->Report(
+				ReportSeverity::NON_CRITICAL_ERROR,
+				std::string( "Cannot load font: Cannot read file: " ) + path_str
+			);
+			return false;
+		}
+	}
+
+	// Fonts rasterized earlier with the same file and settings are loaded
+	// from the atlas cache without using FreeType at all.
+	bool								use_atlas_cache				= !use_dynamic_glyph_cache && !atlas_cache_directory.empty() && my_interface->impl->IsFromFile();
+	FontAtlasCacheKey					atlas_cache_key				= {};
+	std::filesystem::path				atlas_cache_file_path		= {};
+	std::vector<std::vector<std::pair<uint32_t, uint32_t>>>	face_character_glyph_pairs;
+	if( use_atlas_cache ) {
+		atlas_cache_key									= CreateFontAtlasCacheKey( font_file_data );
+		atlas_cache_key.glyph_texel_size				= glyph_texel_size;
+		atlas_cache_key.glyph_atlas_padding				= glyph_atlas_padding;
+		atlas_cache_key.fallback_character				= fallback_character;
+		atlas_cache_key.use_alpha						= use_alpha ? 1 : 0;
+		atlas_cache_key.glyph_atlas_type				= glyph_atlas_type;
+		atlas_cache_key.signed_distance_field_spread	= glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ? FONT_SIGNED_DISTANCE_FIELD_SPREAD : 0;
+		atlas_cache_file_path							= GetFontAtlasCacheFilePath( atlas_cache_directory, atlas_cache_key );
+
+		FontAtlasCacheData					cache_data;
+		std::vector<std::vector<uint8_t>>	cache_atlas_layers;
+		if( ReadFontAtlasCache( atlas_cache_file_path, atlas_cache_key, cache_data, cache_atlas_layers ) &&
+			cache_data.atlas_size <= max_texture_size ) {
+			LoadFromAtlasCache( std::move( cache_data ), std::move( cache_atlas_layers ) );
+
+			// Font file is not needed anymore.
+			font_file_data		= {};
+
+			texture_resource = CreateTextureResourceFromAtlas();
+			if( !texture_resource ) {
+				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, cannot create texture resource for font!" );
+				return false;
+			}
+			return true;
+		}
+	}
 
 	if( my_interface->impl->IsFromFile() ) {
 		// Try to load from file.
@@ -266,10 +376,13 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 		// Get amount of faces in the file
 		uint32_t face_count = 0;
 		{
+			// Face index -1 only checks the file and gets the face count,
+			// this is cheap compared to opening a face.
 			FT_Face face {};
-			auto ft_error = FT_New_Face(
+			auto ft_error = FT_New_Memory_Face(
 				loader_thread_resource->GetFreeTypeInstance(),
-				path_str.c_str(),
+				font_file_data.data(),
+				FT_Long( font_file_data.size() ),
 				-1,
 				&face
 			);
@@ -280,13 +393,6 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 					face_count = uint32_t( face->num_faces );
 					FT_Done_Face( face );
 					break;
-				case FT_Err_Cannot_Open_Resource:
-					// Cannot open file error
-					instance->Report(
-						ReportSeverity::NON_CRITICAL_ERROR,
-						std::string( "Cannot load font: File not found: " ) + path_str
-					);
-					return false;
 				case FT_Err_Unknown_File_Format:
 					// Unknown file format error
 					instance->Report(
@@ -307,43 +413,27 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 		assert( !face_infos.size() );	// If hit, this function was called twice for some reason, should never happen.
 		face_infos.clear();
 		face_infos.resize( face_count );
+		face_glyph_heights.resize( face_count );
 		for( uint32_t i = 0; i < face_count; ++i ) {
-			FT_Face face {};
-			{
-				auto ft_error = FT_New_Face(
-					loader_thread_resource->GetFreeTypeInstance(),
-					path_str.c_str(),
-					i,
-					&face
-				);
-				if( ft_error ) {
-					instance->Report(
-						ReportSeverity::NON_CRITICAL_ERROR,
-						std::string( "Cannot load font: " ) + path_str
-					);
-					return false;
-				}
-			}
-			{
-				auto ft_error = FT_Set_Pixel_Sizes(
-					face,
-					0,
-					glyph_texel_size
+			FT_Face face = CreateFace( loader_thread_resource->GetFreeTypeInstance(), i );
+			if( !face ) {
+				instance->Report(
+					ReportSeverity::NON_CRITICAL_ERROR,
+					std::string( "Cannot load font: " ) + path_str
 				);
-				if( ft_error ) {
-					instance->Report(
-						ReportSeverity::NON_CRITICAL_ERROR,
-						std::string( "Cannot load font: " ) + path_str
-					);
-					return false;
-				}
+				return false;
 			}
 
-			// Get glyph sizes
+			// Get glyph sizes. Dynamic glyph cache only knows the glyph sizes
+			// when they're rasterized, atlas size is estimated from the
+			// nominal glyph size instead.
 			total_glyph_count			+= uint64_t( face->num_glyphs ) + 1;
-			for( decltype( face->num_glyphs ) i = 0; i < face->num_glyphs; ++i ) {
+			if( !use_dynamic_glyph_cache ) {
+				face_glyph_heights[ i ].reserve( size_t( face->num_glyphs ) );
+			}
+			for( decltype( face->num_glyphs ) glyph_index = 0; glyph_index < face->num_glyphs && !use_dynamic_glyph_cache; ++glyph_index ) {
 
-				auto ft_load_error = FT_Load_Glyph( face, FT_UInt( i ), FT_LOAD_DEFAULT );
+				auto ft_load_error = FT_Load_Glyph( face, FT_UInt( glyph_index ), FT_LOAD_DEFAULT );
 				if( ft_load_error ) {
 					instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, cannot load glyph for bitmap metrics!" );
 					return false;
@@ -361,11 +451,18 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 						double( face->glyph->bitmap.rows )
 					);
 
-				auto glyph_bitmap_space_occupancy =
-					glm::dvec2(
-						double( face->glyph->bitmap.width + glyph_atlas_padding ),
-						double( face->glyph->bitmap.rows + glyph_atlas_padding )
+				// Outline glyphs have no bitmap until rendered, estimate the
+				// rendered size from the 26.6 fixed point metrics with a
+				// texel of antialiasing on both sides.
+				auto glyph_cell_size =
+					glm::max(
+						glm::uvec2( glyph_bitmap_size ),
+						glm::uvec2( glm::ceil( glyph_size / 64.0 ) ) + glm::uvec2( 2, 2 )
 					);
+				if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+					glyph_cell_size						+= glm::uvec2( FONT_SIGNED_DISTANCE_FIELD_SPREAD * 2 );
+				}
+				glyph_cell_size							+= glm::uvec2( glyph_atlas_padding );
 
 				maximum_glyph_size.x					= std::max( maximum_glyph_size.x, glyph_size.x );
 				maximum_glyph_size.y					= std::max( maximum_glyph_size.y, glyph_size.y );
@@ -373,10 +470,10 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 				maximum_glyph_bitmap_size.x				= std::max( maximum_glyph_bitmap_size.x, glyph_bitmap_size.x );
 				maximum_glyph_bitmap_size.y				= std::max( maximum_glyph_bitmap_size.y, glyph_bitmap_size.y );
 
-				maximum_glyph_bitmap_occupancy_size.x	= std::max( maximum_glyph_bitmap_occupancy_size.x, glyph_bitmap_space_occupancy.x );
-				maximum_glyph_bitmap_occupancy_size.y	= std::max( maximum_glyph_bitmap_occupancy_size.y, glyph_bitmap_space_occupancy.y );
+				largest_glyph_cell_size					= std::max( largest_glyph_cell_size, std::max( glyph_cell_size.x, glyph_cell_size.y ) );
+				estimated_glyph_area					+= uint64_t( glyph_cell_size.x ) * uint64_t( glyph_cell_size.y );
 
-				average_glyph_bitmap_occupancy_size		+= glyph_bitmap_space_occupancy;
+				face_glyph_heights[ i ].push_back( { glyph_cell_size.y, uint32_t( glyph_index ) } );
 			}
 
 			face_infos[ i ].face	= face;
@@ -394,27 +491,24 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 	}
 
 	// Estimate appropriate atlas size.
-	// This code tries to find a tradeoff between texture size and amount so that 1 to 3 textures are
-	// created. For example if glyphs do not fit into 3 textures of size 512 * 512, a larger 1024 * 1024
-	// texture is created which should be able to contain the glyphs.
-	average_glyph_bitmap_occupancy_size	+= glm::dvec2( double( glyph_atlas_padding ), double( glyph_atlas_padding ) ) * 2.0;
-	average_glyph_bitmap_occupancy_size	/= float( total_glyph_count );
-	{
-		auto estimated_glyph_space_requirements		= average_glyph_bitmap_occupancy_size * ( 1.0 - average_to_max_weight ) + maximum_glyph_bitmap_occupancy_size * average_to_max_weight;
-		auto estimated_average_space_requirements	= estimated_glyph_space_requirements / 1.5;	// aim to have 1 to 4 textures to optimize memory usage
-//		auto estimated_average_space_requirements	= estimated_glyph_space_requirements / 5.0;	// aim to have 1 to 4 textures to optimize memory usage
-		atlas_size			=
-			RoundToCeilingPowerOfTwo(
-				uint32_t(
-					std::sqrt(
-						std::ceil( estimated_average_space_requirements.x ) *
-						std::ceil( estimated_average_space_requirements.y ) *
-						double( total_glyph_count )
-					)
-				)
-			);
+	if( use_dynamic_glyph_cache ) {
+		// Glyphs are added over time so there's no way to know how many we'll
+		// need, aim for roughly 16 * 16 glyphs per atlas layer and let the
+		// atlas grow more layers if needed.
+		auto estimated_glyph_cell_size				= glyph_texel_size + glyph_atlas_padding * 2;
+		if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+			estimated_glyph_cell_size				+= FONT_SIGNED_DISTANCE_FIELD_SPREAD * 2;
+		}
+		atlas_size			= RoundToCeilingPowerOfTwo( estimated_glyph_cell_size * 16 );
 		if( atlas_size > max_texture_size ) atlas_size = max_texture_size;
 		if( atlas_size < min_texture_size ) atlas_size = min_texture_size;
+	} else {
+		atlas_size			= ChooseAtlasSize(
+			estimated_glyph_area,
+			largest_glyph_cell_size + glyph_atlas_padding,
+			min_texture_size,
+			max_texture_size
+		);
 	}
 
 	// Stop if we don't have any font's to work with.
@@ -426,156 +520,48 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 		return false;
 	}
 
-	current_atlas_texture						= CreateNewAtlasTexture();
+	CreateNewAtlasTexture();
+
+	if( use_dynamic_glyph_cache || glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+		// Glyph metrics are in 26.6 fixed point. Signed distance field bitmaps
+		// are larger than the glyphs so they can't be used for measuring.
+		glyph_size_bitmap_size_ratio				= 1.0 / 64.0;
+	} else {
+		auto glyph_size_bitmap_size_ratio_vector	= maximum_glyph_bitmap_size / maximum_glyph_size;
+		glyph_size_bitmap_size_ratio				= std::max( glyph_size_bitmap_size_ratio_vector.x, glyph_size_bitmap_size_ratio_vector.y );
+	}
 
-	auto glyph_size_bitmap_size_ratio_vector	= maximum_glyph_bitmap_size / maximum_glyph_size;
-	auto glyph_size_bitmap_size_ratio			= std::max( glyph_size_bitmap_size_ratio_vector.x, glyph_size_bitmap_size_ratio_vector.y );
+	face_character_glyph_pairs.resize( use_atlas_cache ? face_infos.size() : 0 );
 
-	// Process all glyphs from all font faces
+	// { face index, glyph index } in the order they're packed into the atlas.
+	std::vector<std::pair<uint32_t, uint32_t>> glyphs_to_rasterize;
+	glyphs_to_rasterize.reserve( size_t( total_glyph_count ) );
+
+	// Process all font faces
 	for( size_t face_index = 0; face_index < face_infos.size(); ++face_index ) {
 		auto & face = face_infos[ face_index ];
 		face.glyph_infos.resize( face.face->num_glyphs );
 
-		for( auto glyph_index = 0; glyph_index < face.face->num_glyphs; ++glyph_index ) {
-			{
-				auto ft_load_error = FT_Load_Glyph( face.face, glyph_index, FT_LOAD_DEFAULT );
-				if( ft_load_error ) {
-					instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, cannot load glyph!" );
-					return false;
-				}
-			}
-			{
-				auto ft_render_error = FT_Render_Glyph( face.face->glyph, use_alpha ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO );
-				if( ft_render_error ) {
-					instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, cannot render glyph!" );
-					return false;
-				}
-			}
-			auto	ft_glyph	= face.face->glyph;
-			auto &	ft_bitmap	= ft_glyph->bitmap;
-
-			std::vector<Color8> final_glyph_pixels( size_t( ft_bitmap.rows ) * size_t( ft_bitmap.width ) );
-
-			switch( ft_bitmap.pixel_mode ) {
-				case FT_PIXEL_MODE_MONO:
-				{
-					for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
-						for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
-							auto	texel_pos	= y * ft_bitmap.width + x;
-							auto &	dst			= final_glyph_pixels[ texel_pos ];
-							auto	src_bit		= 7 - x % 8;
-							auto	src_byte	= ft_bitmap.buffer[ ( y * ft_bitmap.pitch ) + ( x / 8 ) ];
-
-							dst.r				= ( ( src_byte >> src_bit ) & 1 ) * 255;
-							dst.g				= dst.r;
-							dst.b				= dst.r;
-							dst.a				= dst.r;
-						}
-					}
-				}
-				break;
-
-				case FT_PIXEL_MODE_GRAY:
-				{
-					for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
-						for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
-							auto	texel_pos	= y * ft_bitmap.width + x;
-							auto &	dst			= final_glyph_pixels[ texel_pos ];
-							auto	src			= ft_bitmap.buffer[ texel_pos ];
-
-							dst.r				= src;
-							dst.g				= src;
-							dst.b				= src;
-							dst.a				= src;
-						}
-					}
-				}
-				break;
-
-				case FT_PIXEL_MODE_BGRA:
-				{
-					for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
-						for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
-							auto	texel_pos	= y * ft_bitmap.width + x;
-							auto &	dst			= final_glyph_pixels[ texel_pos ];
-							auto	src			= &ft_bitmap.buffer[ texel_pos * 4 ];
-
-							dst.r				= src[ 2 ];
-							dst.g				= src[ 1 ];
-							dst.b				= src[ 0 ];
-							dst.a				= src[ 3 ];
-						}
-					}
-				}
-				break;
-
-				default:
-					// Unsupported
-					instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, Unsupported pixel format!" );
-					return false;
-					break;
-			}
-
-			// Attach rendered glyph to final texture atlas.
-			auto atlas_location			= AttachGlyphToAtlas(
-				face.face->glyph,
-				glyph_atlas_padding,
-				final_glyph_pixels
-			);
-			if( !atlas_location.atlas_ptr ) {
-				instance->Report(
-					ReportSeverity::NON_CRITICAL_ERROR,
-					"Internal error: Cannot create font, cannot copy glyph image to font texture atlas!"
-				);
-				return false;
-			}
-
-			// Create glyph info structure for the glyph
-			{
-				Rect2f uv_coords		= {
-					float( atlas_location.location.top_left.x ) / float( atlas_size ),
-					float( atlas_location.location.top_left.y ) / float( atlas_size ),
-					float( atlas_location.location.bottom_right.x ) / float( atlas_size ),
-					float( atlas_location.location.bottom_right.y ) / float( atlas_size )
-				};
-
-				auto & metrics								= face.face->glyph->metrics;
-				auto glyph_size								= glm::dvec2( metrics.width, metrics.height ) * glyph_size_bitmap_size_ratio;
-				auto glyph_hori_top_left					= glm::dvec2( metrics.horiBearingX, -metrics.horiBearingY ) * glyph_size_bitmap_size_ratio;
-				auto glyph_hori_bottom_right				= glyph_hori_top_left + glyph_size;
-				auto glyph_vert_top_left					= glm::dvec2( metrics.vertBearingX, metrics.vertBearingY ) * glyph_size_bitmap_size_ratio;
-				auto glyph_vert_bottom_right				= glyph_vert_top_left + glyph_size;
-				auto hori_advance							= metrics.horiAdvance * glyph_size_bitmap_size_ratio;
-				auto vert_advance							= metrics.vertAdvance * glyph_size_bitmap_size_ratio;
-
-				GlyphInfo glyph_info {};
-				glyph_info.face_index						= uint32_t( face_index );
-				glyph_info.atlas_index						= atlas_location.atlas_index;
-				glyph_info.uv_coords						= uv_coords;
-				glyph_info.horisontal_coords.top_left		= glm::vec2( float( glyph_hori_top_left.x ), float( glyph_hori_top_left.y ) );
-				glyph_info.horisontal_coords.bottom_right	= glm::vec2( float( glyph_hori_bottom_right.x ), float( glyph_hori_bottom_right.y ) );
-				glyph_info.vertical_coords.top_left			= glm::vec2( float( glyph_vert_top_left.x ), float( glyph_vert_top_left.y ) );
-				glyph_info.vertical_coords.bottom_right		= glm::vec2( float( glyph_vert_bottom_right.x ), float( glyph_vert_bottom_right.y ) );
-				glyph_info.horisontal_advance				= float( hori_advance );
-				glyph_info.vertical_advance					= float( vert_advance );
-
-				face.glyph_infos[ glyph_index ]				= glyph_info;
-			}
-		}
-
 		// Create character map and get fallback character
 		{
 			FT_ULong		charcode				= {};
 			FT_UInt			gindex					= {};
 			FT_ULong		fallback_glyph_index	= {};
 
+			std::vector<std::pair<uint32_t, uint32_t>> character_glyph_pairs;
+			character_glyph_pairs.reserve( face.face->num_glyphs );
+
 			charcode				= FT_Get_First_Char( face.face, &gindex );
 			fallback_glyph_index	= gindex;
 			while( gindex != 0 ) {
-				face.charmap[ uint32_t( charcode ) ] = uint32_t( gindex );
+				character_glyph_pairs.push_back( { uint32_t( charcode ), uint32_t( gindex ) } );
 
 				charcode = FT_Get_Next_Char( face.face, charcode, &gindex );
 			}
+			if( use_atlas_cache ) {
+				face_character_glyph_pairs[ face_index ]	= character_glyph_pairs;
+			}
+			face.charmap.Build( std::move( character_glyph_pairs ) );
 
 			if( auto f = FT_Get_Char_Index( face.face, FT_ULong( fallback_character ) ) ) {
 				fallback_glyph_index	= f;
@@ -583,29 +569,75 @@ bool vk2d::vk2d_internal::FontResourceImpl::MTLoad(
 
 			face.fallback_glyph_index	= fallback_glyph_index;
 		}
+
+		// Line metrics and kerning, these need the face so they're done
+		// now while we still have it.
+		{
+			auto & size_metrics		= face.face->size->metrics;
+			face.ascender			= float( double( size_metrics.ascender ) * glyph_size_bitmap_size_ratio );
+			face.descender			= float( double( -size_metrics.descender ) * glyph_size_bitmap_size_ratio );
+			face.line_height		= float( double( size_metrics.height ) * glyph_size_bitmap_size_ratio );
+			BuildKerningTable( uint32_t( face_index ) );
+		}
+
+		if( use_dynamic_glyph_cache ) {
+			// Only rasterize the fallback glyph and preloaded characters now,
+			// everything else is rasterized when it's first used.
+			face.glyph_rasterized.resize( face.face->num_glyphs );
+			if( !RasterizeGlyph( uint32_t( face_index ), face.fallback_glyph_index ) ) return false;
+			for( auto c : preload_characters ) {
+				auto glyph_index = face.charmap.Find( c );
+				if( glyph_index == 0 ) continue;
+				if( face.glyph_rasterized[ glyph_index ] ) continue;
+				if( !RasterizeGlyph( uint32_t( face_index ), glyph_index ) ) return false;
+			}
+		} else {
+			auto & glyph_heights = face_glyph_heights[ face_index ];
+			std::stable_sort(
+				glyph_heights.begin(),
+				glyph_heights.end(),
+				[]( const std::pair<uint32_t, uint32_t> & a, const std::pair<uint32_t, uint32_t> & b )
+				{
+					return a.first > b.first;
+				}
+			);
+			for( auto & g : glyph_heights ) {
+				glyphs_to_rasterize.push_back( { uint32_t( face_index ), g.second } );
+			}
+		}
 	}
 
-	// Destroy font faces, we don't need them anymore.
-	for( auto & f : face_infos ) {
-		FT_Done_Face( f.face );
-		f.face		= nullptr;
+	if( !use_dynamic_glyph_cache ) {
+		// Rendering is spread over loader threads, packing is done here in
+		// order so the atlas layout doesn't depend on thread timing.
+		std::vector<RasterizedGlyph> rasterized_glyphs;
+		if( !RasterizeGlyphsInParallel( loader_thread_resource, glyphs_to_rasterize, rasterized_glyphs ) ) return false;
+		for( size_t i = 0; i < glyphs_to_rasterize.size(); ++i ) {
+			if( !AddRasterizedGlyph( glyphs_to_rasterize[ i ].first, glyphs_to_rasterize[ i ].second, rasterized_glyphs[ i ] ) ) return false;
+			rasterized_glyphs[ i ].coverage		= {};
+		}
 	}
 
-	// Everything is baked into the atlas, create texture resource to store it.
-	{
-		std::vector<const std::vector<Color8>*>		texture_data_array( atlas_textures.size() );
-		for( size_t i = 0; i < atlas_textures.size(); ++i ) {
-			texture_data_array[ i ]		= &atlas_textures[ i ]->data;
+	// Destroy font faces, we don't need them anymore. Dynamic glyph
+	// cache keeps them around to rasterize more glyphs later.
+	if( !use_dynamic_glyph_cache ) {
+		for( auto & f : face_infos ) {
+			FT_Done_Face( f.face );
+			f.face		= nullptr;
 		}
+		font_file_data	= {};
+	}
 
-		texture_resource = resource_manager->CreateArrayTextureResource(
-			glm::uvec2( atlas_size, atlas_size ),
-			texture_data_array,
-			my_interface
-		);
-		if( !texture_resource ) {
-			instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, cannot create texture resource for font!" );
-			return false;
+	// Everything is baked into the atlas, create texture resource to store it.
+	texture_resource = CreateTextureResourceFromAtlas();
+	if( !texture_resource ) {
+		instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, cannot create texture resource for font!" );
+		return false;
+	}
+
+	if( use_atlas_cache ) {
+		if( !SaveToAtlasCache( atlas_cache_file_path, atlas_cache_key, face_character_glyph_pairs ) ) {
+			instance->Report( ReportSeverity::WARNING, "Cannot write font atlas cache file: " + atlas_cache_file_path.string() );
 		}
 	}
 
@@ -617,15 +649,20 @@ void vk2d::vk2d_internal::FontResourceImpl::MTUnload(
 )
 {
 	// Make sure font faces are destroyed.
-	for( auto f : face_infos ) {
+	for( auto & f : face_infos ) {
 		FT_Done_Face( f.face );
 	}
 	face_infos.clear();
+	font_file_data		= {};
 
+	{
+		std::lock_guard<std::mutex> lock_guard( text_mesh_cache_mutex );
+		text_mesh_cache.clear();
+	}
 }
 
 vk2d::Rect2f vk2d::vk2d_internal::FontResourceImpl::CalculateRenderedSize(
-	std::string_view	text,
+	const Text		&	text,
 	float				kerning,
 	glm::vec2		scale,
 	bool				vertical,
@@ -667,27 +704,34 @@ vk2d::Rect2f vk2d::vk2d_internal::FontResourceImpl::CalculateRenderedSize(
 		ret.top_left.y			= first_gi->vertical_coords.top_left.y;
 		ret.bottom_right.y		= advance + last_gi->vertical_coords.bottom_right.y;
 	} else {
-		// Horisontal text
-		// First letter sets defaults
-		auto first_gi			= GetGlyphInfo( font_face, text[ 0 ] );
-		ret.top_left.y			= first_gi->horisontal_coords.top_left.y;
-		ret.bottom_right.y		= first_gi->horisontal_coords.bottom_right.y;
-		if( std::size( text ) > 1 ) {
-			advance				+= first_gi->horisontal_advance;
-		}
-		for( size_t i = 1; i < std::size( text ) - 1; ++i ) {
-			// Middle letters are spaced by "advance" value
-			auto gi				= GetGlyphInfo( font_face, text[ i ] );
-			ret.top_left.y		= std::min( ret.top_left.y, gi->horisontal_coords.top_left.y );
-			ret.bottom_right.y	= std::max( ret.bottom_right.y, gi->horisontal_coords.bottom_right.y );
-			advance				+= kerning + gi->horisontal_advance;
+		// Horisontal text goes through text layout so that font kerning
+		// and newlines are measured the same way they're generated.
+		TextLayoutSettings settings {};
+		settings.kerning		= kerning;
+		settings.scale			= scale;
+		settings.font_face		= font_face;
+
+		std::vector<TextGlyphPlacement>		glyph_placements;
+		std::vector<TextLineMetrics>		line_metrics;
+		LayoutText( text, settings, glyph_placements, line_metrics );
+		if( glyph_placements.empty() ) return {};
+
+		auto GlyphArea =[ scale ]( const TextGlyphPlacement & p )
+		{
+			return Rect2f(
+				p.glyph_info->horisontal_coords.top_left * scale + p.position,
+				p.glyph_info->horisontal_coords.bottom_right * scale + p.position
+			);
+		};
+		ret = GlyphArea( glyph_placements[ 0 ] );
+		for( auto & p : glyph_placements ) {
+			auto area			= GlyphArea( p );
+			ret.top_left.x		= std::min( ret.top_left.x, area.top_left.x );
+			ret.top_left.y		= std::min( ret.top_left.y, area.top_left.y );
+			ret.bottom_right.x	= std::max( ret.bottom_right.x, area.bottom_right.x );
+			ret.bottom_right.y	= std::max( ret.bottom_right.y, area.bottom_right.y );
 		}
-		// Need to get the size of the last letter, not the "advance"
-		auto last_gi			= GetGlyphInfo( font_face, text.back() );
-		ret.top_left.y			= std::min( ret.top_left.y, last_gi->horisontal_coords.top_left.y );
-		ret.bottom_right.y		= std::max( ret.bottom_right.y, last_gi->horisontal_coords.bottom_right.y );
-		ret.top_left.x			= first_gi->horisontal_coords.top_left.x;
-		ret.bottom_right.x		= advance + last_gi->horisontal_coords.bottom_right.x;
+		return ret;
 	}
 
 	ret.top_left		*= scale;
@@ -705,9 +749,344 @@ bool vk2d::vk2d_internal::FontResourceImpl::FaceExists(
 	return false;
 }
 
+void vk2d::vk2d_internal::FontResourceImpl::LayoutText(
+	const Text							&	text,
+	const TextLayoutSettings			&	settings,
+	std::vector<TextGlyphPlacement>		&	out_glyph_placements,
+	std::vector<TextLineMetrics>		&	out_line_metrics
+)
+{
+	out_glyph_placements.clear();
+	out_line_metrics.clear();
+	if( !FaceExists( settings.font_face ) ) return;
+
+	auto &	face_info			= face_infos[ settings.font_face ];
+	auto	scale				= settings.scale;
+	auto	max_width			= settings.max_width;
+	auto	use_kerning			= settings.use_font_kerning && !face_info.kerning_pairs.empty();
+
+	out_glyph_placements.reserve( std::size( text ) );
+
+	// First glyph placement of each line, used for alignment at the end.
+	std::vector<size_t> line_first_glyphs;
+
+	uint32_t	line_first_character	= 0;
+	size_t		line_first_glyph		= 0;
+	float		pen_x					= 0.0f;
+	float		line_width				= 0.0f;		// Right edge of the last non-space glyph.
+	uint32_t	previous_glyph_index	= 0;		// 0 if there is no previous glyph to kern with.
+
+	// Last location where the line can be wrapped, right after a space.
+	bool		has_break				= false;
+	uint32_t	break_character			= 0;
+	size_t		break_glyph				= 0;
+	float		break_pen_x				= 0.0f;
+	float		break_line_width		= 0.0f;
+
+	auto FinishLine =[ & ](
+		uint32_t		end_character,
+		float			width
+		)
+	{
+		TextLineMetrics line {};
+		line.first_character	= line_first_character;
+		line.character_count	= end_character - line_first_character;
+		line.width				= width;
+		out_line_metrics.push_back( line );
+		line_first_glyphs.push_back( line_first_glyph );
+	};
+	auto StartLine =[ & ](
+		uint32_t		first_character
+		)
+	{
+		line_first_character	= first_character;
+		line_first_glyph		= std::size( out_glyph_placements );
+		pen_x					= 0.0f;
+		line_width				= 0.0f;
+		previous_glyph_index	= 0;
+		has_break				= false;
+	};
+
+	for( uint32_t i = 0; i < uint32_t( std::size( text ) ); ++i ) {
+		auto c = text[ i ];
+		if( c == U'\n' ) {
+			FinishLine( i, line_width );
+			StartLine( i + 1 );
+			continue;
+		}
+		if( c == U'\r' ) continue;
+
+		auto	gi				= GetGlyphInfo( settings.font_face, uint32_t( c ) );
+		auto	is_space		= c == U' ' || c == U'\t';
+		auto	x				= pen_x;
+		if( use_kerning && previous_glyph_index ) {
+			x					+= GetKerning( settings.font_face, previous_glyph_index, gi->glyph_index ) * scale.x;
+		}
+		auto	right			= x + gi->horisontal_coords.bottom_right.x * scale.x;
+
+		if( max_width > 0.0f && !is_space && right > max_width && std::size( out_glyph_placements ) > line_first_glyph ) {
+			if( has_break ) {
+				// Move the current word to the next line. Only the word is
+				// moved so every glyph is moved at most once.
+				FinishLine( break_character, break_line_width );
+				for( size_t g = break_glyph; g < std::size( out_glyph_placements ); ++g ) {
+					out_glyph_placements[ g ].position.x	-= break_pen_x;
+				}
+				line_first_character	= break_character;
+				line_first_glyph		= break_glyph;
+				pen_x					-= break_pen_x;
+				line_width				= std::max( line_width - break_pen_x, 0.0f );
+				x						-= break_pen_x;
+				right					-= break_pen_x;
+				has_break				= false;
+			}
+			if( right > max_width && std::size( out_glyph_placements ) > line_first_glyph ) {
+				// Word doesn't fit on a line by itself, break it here.
+				FinishLine( i, line_width );
+				StartLine( i );
+				x						= 0.0f;
+				right					= gi->horisontal_coords.bottom_right.x * scale.x;
+			}
+		}
+
+		out_glyph_placements.push_back( { gi, glm::vec2( x, 0.0f ) } );
+		pen_x					= x + ( gi->horisontal_advance + settings.kerning ) * scale.x;
+		previous_glyph_index	= gi->glyph_index;
+
+		if( is_space ) {
+			has_break			= true;
+			break_character		= i + 1;
+			break_glyph			= std::size( out_glyph_placements );
+			break_pen_x			= pen_x;
+			break_line_width	= line_width;
+		} else {
+			line_width			= std::max( line_width, right );
+		}
+	}
+	FinishLine( uint32_t( std::size( text ) ), line_width );
+
+	// Alignment and line placement.
+	auto layout_width = max_width;
+	if( layout_width <= 0.0f ) {
+		for( auto & l : out_line_metrics ) {
+			layout_width = std::max( layout_width, l.width );
+		}
+	}
+	auto alignment_factor = 0.0f;
+	if( settings.alignment == TextAlignment::CENTER )	alignment_factor = 0.5f;
+	if( settings.alignment == TextAlignment::RIGHT )	alignment_factor = 1.0f;
+
+	auto line_advance = face_info.line_height * settings.line_spacing * scale.y;
+	for( size_t l = 0; l < std::size( out_line_metrics ); ++l ) {
+		auto &	line			= out_line_metrics[ l ];
+		auto	offset			= glm::vec2( ( layout_width - line.width ) * alignment_factor, line_advance * float( l ) );
+
+		line.baseline_origin	= offset;
+		line.area				= {
+			offset.x,
+			offset.y - face_info.ascender * scale.y,
+			offset.x + line.width,
+			offset.y + face_info.descender * scale.y
+		};
+
+		auto glyph_end = l + 1 < std::size( line_first_glyphs ) ? line_first_glyphs[ l + 1 ] : std::size( out_glyph_placements );
+		for( size_t g = line_first_glyphs[ l ]; g < glyph_end; ++g ) {
+			out_glyph_placements[ g ].position	+= offset;
+		}
+	}
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::LayoutTextForDrawing(
+	const Text							&	text,
+	float									kerning,
+	glm::vec2								scale,
+	bool									vertical,
+	uint32_t								font_face,
+	uint32_t								layer_count,
+	std::vector<TextGlyphPlacement>		&	out_glyph_placements,
+	std::vector<TextLineMetrics>		&	out_line_metrics
+)
+{
+	out_glyph_placements.clear();
+	if( !FaceExists( font_face ) ) return;
+
+	if( vertical ) {
+		out_glyph_placements.reserve( std::size( text ) );
+		auto location = glm::vec2( 0.0f, 0.0f );
+		for( auto c : text ) {
+			auto gi = GetGlyphInfo( font_face, uint32_t( c ) );
+			out_glyph_placements.push_back( { gi, location } );
+			location.y	+= ( gi->vertical_advance + kerning ) * scale.y;
+		}
+	} else {
+		TextLayoutSettings settings {};
+		settings.kerning		= kerning;
+		settings.scale			= scale;
+		settings.font_face		= font_face;
+		LayoutText( text, settings, out_glyph_placements, out_line_metrics );
+	}
+
+	// With dynamic glyph cache, glyphs rasterized into a new atlas layer
+	// are not in the font texture until the next upload, skip those.
+	out_glyph_placements.erase(
+		std::remove_if(
+			out_glyph_placements.begin(),
+			out_glyph_placements.end(),
+			[ layer_count ]( const TextGlyphPlacement & p )
+			{
+				return p.glyph_info->atlas_index >= layer_count;
+			}
+		),
+		out_glyph_placements.end()
+	);
+}
+
+const void * vk2d::vk2d_internal::FontResourceImpl::GetGlyphTableKey(
+	uint32_t		font_face
+) const
+{
+	return &face_infos[ font_face ];
+}
+
+uint32_t vk2d::vk2d_internal::FontResourceImpl::AddGlyphTableEntries(
+	uint32_t									font_face,
+	const std::vector<TextGlyphPlacement>	&	glyph_placements,
+	uint64_t								&	out_generation
+)
+{
+	auto & face_info		= face_infos[ font_face ];
+	auto glyph_infos		= face_info.glyph_infos.data();
+
+	// Generation is also changed by the dynamic glyph cache while
+	// holding this mutex.
+	std::unique_lock<std::mutex> lock( glyph_cache_mutex, std::defer_lock );
+	if( use_dynamic_glyph_cache ) lock.lock();
+
+	if( face_info.glyph_table_indices.empty() ) {
+		face_info.glyph_table_indices.resize( face_info.glyph_infos.size(), UINT32_MAX );
+	}
+
+	for( auto & p : glyph_placements ) {
+		auto glyph_index	= uint32_t( p.glyph_info - glyph_infos );
+		auto & table_index	= face_info.glyph_table_indices[ glyph_index ];
+		if( table_index != UINT32_MAX ) continue;
+
+		table_index			= uint32_t( face_info.glyph_table_glyphs.size() );
+		face_info.glyph_table_glyphs.push_back( glyph_index );
+		++face_info.glyph_table_generation;
+	}
+
+	out_generation			= face_info.glyph_table_generation;
+	return uint32_t( face_info.glyph_table_glyphs.size() );
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::WriteGlyphTable(
+	uint32_t		font_face,
+	uint32_t		glyph_count,
+	float		*	out_table
+)
+{
+	auto & face_info	= face_infos[ font_face ];
+	assert( glyph_count <= face_info.glyph_table_glyphs.size() );
+
+	// Glyph infos are written by the dynamic glyph cache while holding
+	// this mutex.
+	std::unique_lock<std::mutex> lock( glyph_cache_mutex, std::defer_lock );
+	if( use_dynamic_glyph_cache ) lock.lock();
+
+	for( uint32_t i = 0; i < glyph_count; ++i ) {
+		auto & gi		= face_info.glyph_infos[ face_info.glyph_table_glyphs[ i ] ];
+		out_table[ 0 ]	= gi.uv_coords.top_left.x;
+		out_table[ 1 ]	= gi.uv_coords.top_left.y;
+		out_table[ 2 ]	= gi.uv_coords.bottom_right.x;
+		out_table[ 3 ]	= gi.uv_coords.bottom_right.y;
+		out_table[ 4 ]	= gi.horisontal_coords.top_left.x;
+		out_table[ 5 ]	= gi.horisontal_coords.top_left.y;
+		out_table[ 6 ]	= gi.horisontal_coords.bottom_right.x;
+		out_table[ 7 ]	= gi.horisontal_coords.bottom_right.y;
+		out_table[ 8 ]	= gi.vertical_coords.top_left.x;
+		out_table[ 9 ]	= gi.vertical_coords.top_left.y;
+		out_table[ 10 ]	= gi.vertical_coords.bottom_right.x;
+		out_table[ 11 ]	= gi.vertical_coords.bottom_right.y;
+		out_table		+= GLYPH_TABLE_FLOATS_PER_GLYPH;
+	}
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::WriteGlyphInstances(
+	uint32_t									font_face,
+	const std::vector<TextGlyphPlacement>	&	glyph_placements,
+	const Colorf							&	color,
+	GlyphInstance							*	out_instances
+) const
+{
+	auto & face_info	= face_infos[ font_face ];
+	auto glyph_infos	= face_info.glyph_infos.data();
+
+	auto ToUnorm8 =[]( float value ) -> uint32_t
+	{
+		return uint32_t( std::clamp( value, 0.0f, 1.0f ) * 255.0f + 0.5f );
+	};
+	uint32_t packed_color =
+		ToUnorm8( color.r ) |
+		ToUnorm8( color.g ) << 8 |
+		ToUnorm8( color.b ) << 16 |
+		ToUnorm8( color.a ) << 24;
+
+	for( auto & p : glyph_placements ) {
+		auto glyph_table_index	= face_info.glyph_table_indices[ p.glyph_info - glyph_infos ];
+		assert( glyph_table_index <= 0xFFFF && p.glyph_info->atlas_index <= 0xFFFF );
+
+		out_instances->position	= p.position;
+		out_instances->glyph	= glyph_table_index | p.glyph_info->atlas_index << 16;
+		out_instances->color	= packed_color;
+		++out_instances;
+	}
+}
+
+float vk2d::vk2d_internal::FontResourceImpl::GetKerning(
+	uint32_t		font_face,
+	uint32_t		left_glyph_index,
+	uint32_t		right_glyph_index
+) const
+{
+	auto & kerning_pairs	= face_infos[ font_face ].kerning_pairs;
+	auto key				= uint64_t( left_glyph_index ) << 32 | uint64_t( right_glyph_index );
+	auto it = std::lower_bound(
+		kerning_pairs.begin(),
+		kerning_pairs.end(),
+		key,
+		[]( const std::pair<uint64_t, float> & p, uint64_t k )
+		{
+			return p.first < k;
+		}
+	);
+	if( it != kerning_pairs.end() && it->first == key ) return it->second;
+	return 0.0f;
+}
+
 vk2d::TextureResource *vk2d::vk2d_internal::FontResourceImpl::GetTextureResource()
 {
 	if( GetStatus() == ResourceStatus::LOADED ) {
+		if( use_dynamic_glyph_cache ) {
+			// Keep using the previous texture resource generation until
+			// the newer one has finished uploading.
+			std::lock_guard<std::mutex> lock_guard( glyph_cache_mutex );
+			if( pending_texture_resource ) {
+				auto pending_status = pending_texture_resource->GetStatus();
+				if( pending_status == ResourceStatus::LOADED ) {
+					retired_texture_resources.push_back( texture_resource );
+					texture_resource			= pending_texture_resource;
+					pending_texture_resource	= nullptr;
+
+					// Cached meshes refer to the replaced texture.
+					std::lock_guard<std::mutex> text_mesh_cache_lock( text_mesh_cache_mutex );
+					text_mesh_cache.clear();
+				} else if( pending_status == ResourceStatus::FAILED_TO_LOAD ) {
+					resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot upload new glyphs to font texture!" );
+					pending_texture_resource	= nullptr;
+				}
+			}
+		}
 		return texture_resource;
 	}
 	return {};
@@ -716,162 +1095,873 @@ vk2d::TextureResource *vk2d::vk2d_internal::FontResourceImpl::GetTextureResource
 const vk2d::vk2d_internal::GlyphInfo *vk2d::vk2d_internal::FontResourceImpl::GetGlyphInfo(
 	uint32_t		font_face,
 	uint32_t		character
-) const
+)
 {
 	auto & face_info	= face_infos[ font_face ];
-	auto & charmap		= face_info.charmap;
-	auto glyph_it		= charmap.find( character );
-	auto glyph_index	= uint32_t( 0 );
-	if( glyph_it != charmap.end() ) {
-		glyph_index		= glyph_it->second;
-	} else {
+	auto glyph_index	= face_info.charmap.Find( character );
+	if( glyph_index == 0 ) {
 		glyph_index		= face_info.fallback_glyph_index;
 	}
+
+	if( use_dynamic_glyph_cache ) {
+		// Glyph info is only written once under this mutex, it's safe to
+		// read it without locking after the rasterized flag is seen set.
+		std::lock_guard<std::mutex> lock_guard( glyph_cache_mutex );
+		if( !face_info.glyph_rasterized[ glyph_index ] ) {
+			if( !RasterizeGlyph( font_face, glyph_index ) ) {
+				// Do not retry every time, the fallback glyph is always rasterized.
+				face_info.glyph_infos[ glyph_index ]		= face_info.glyph_infos[ face_info.fallback_glyph_index ];
+				face_info.glyph_rasterized[ glyph_index ]	= true;
+			}
+		}
+	}
+
 	return &face_info.glyph_infos[ glyph_index ];
 }
 
+void vk2d::vk2d_internal::FontResourceImpl::FlushPendingGlyphs()
+{
+	if( !use_dynamic_glyph_cache ) return;
+	if( GetStatus() != ResourceStatus::LOADED ) return;
+
+	std::lock_guard<std::mutex> lock_guard( glyph_cache_mutex );
+
+	// Only one generation is uploaded at a time, glyphs added meanwhile
+	// are copied into it once it has replaced the current one.
+	if( pending_texture_resource ) return;
+	if( atlas_textures.size() <= texture_resource->GetLayerCount() ) return;
+
+	auto new_texture_resource = CreateTextureResourceFromAtlas();
+	if( !new_texture_resource ) {
+		resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource for new font glyphs!" );
+		return;
+	}
+	pending_texture_resource	= new_texture_resource;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::CmdUploadPendingGlyphs(
+	VkCommandBuffer								command_buffer,
+	std::vector<CompleteBufferResource>		&	out_staging_buffers,
+	std::vector<TextureResource*>			&	out_retired_texture_resources
+)
+{
+	if( !use_dynamic_glyph_cache ) return true;
+	if( GetStatus() != ResourceStatus::LOADED ) return true;
+
+	std::lock_guard<std::mutex> lock_guard( glyph_cache_mutex );
+
+	// Caller destroys replaced generations, destroying the font must not
+	// destroy them a second time.
+	for( auto t : retired_texture_resources ) {
+		if( ReleaseSubresource( t ) ) {
+			out_retired_texture_resources.push_back( t );
+		}
+	}
+	retired_texture_resources.clear();
+
+	if( pending_texture_resource ) return true;
+	if( pending_atlas_regions.empty() ) return true;
+
+	// Regions in layers the texture doesn't have yet are left for the
+	// next texture generation.
+	auto texture_layer_count	= texture_resource->GetLayerCount();
+	auto first_layer			= UINT32_MAX;
+	auto last_layer				= uint32_t( 0 );
+
+	std::vector<uint8_t>			staging_data;
+	std::vector<VkBufferImageCopy>	copy_regions;
+	std::vector<PendingAtlasRegion>	remaining_regions;
+	for( auto & r : pending_atlas_regions ) {
+		if( r.atlas_index >= texture_layer_count ) {
+			remaining_regions.push_back( r );
+			continue;
+		}
+
+		auto & atlas_data		= atlas_textures[ r.atlas_index ]->data;
+		auto region_size		= r.location.bottom_right - r.location.top_left;
+
+		// Buffer offsets must be multiples of 4.
+		auto buffer_offset		= ( staging_data.size() + 3 ) & ~size_t( 3 );
+		staging_data.resize( buffer_offset + size_t( region_size.x ) * region_size.y );
+		for( uint32_t y = 0; y < region_size.y; ++y ) {
+			std::memcpy(
+				staging_data.data() + buffer_offset + size_t( y ) * region_size.x,
+				atlas_data.data() + size_t( r.location.top_left.y + y ) * atlas_size + r.location.top_left.x,
+				region_size.x
+			);
+		}
+
+		VkBufferImageCopy copy_region {};
+		copy_region.bufferOffset					= VkDeviceSize( buffer_offset );
+		copy_region.bufferRowLength					= 0;
+		copy_region.bufferImageHeight				= 0;
+		copy_region.imageSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		copy_region.imageSubresource.mipLevel		= 0;
+		copy_region.imageSubresource.baseArrayLayer	= r.atlas_index;
+		copy_region.imageSubresource.layerCount		= 1;
+		copy_region.imageOffset						= { int32_t( r.location.top_left.x ), int32_t( r.location.top_left.y ), 0 };
+		copy_region.imageExtent						= { region_size.x, region_size.y, 1 };
+		copy_regions.push_back( copy_region );
+
+		first_layer				= std::min( first_layer, r.atlas_index );
+		last_layer				= std::max( last_layer, r.atlas_index );
+	}
+	pending_atlas_regions		= std::move( remaining_regions );
+	if( copy_regions.empty() ) return true;
+
+	auto staging_buffer = resource_manager->GetInstance()->GetDeviceMemoryPool()->CreateCompleteHostBufferResourceWithData(
+		staging_data,
+		VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+	);
+	if( staging_buffer != VK_SUCCESS ) {
+		resource_manager->GetInstance()->Report( staging_buffer.result, "Internal error: Cannot create staging buffer for new font glyphs!" );
+		return false;
+	}
+
+	texture_resource->impl->CmdUpdateLayers(
+		command_buffer,
+		staging_buffer.buffer,
+		copy_regions,
+		first_layer,
+		last_layer - first_layer + 1
+	);
+	out_staging_buffers.push_back( staging_buffer );
+
+	return true;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::IsDynamicGlyphCacheEnabled() const
+{
+	return use_dynamic_glyph_cache;
+}
+
+vk2d::GlyphAtlasType vk2d::vk2d_internal::FontResourceImpl::GetGlyphAtlasType() const
+{
+	return glyph_atlas_type;
+}
+
+float vk2d::vk2d_internal::FontResourceImpl::GetSignedDistanceFieldSpread() const
+{
+	if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+		return float( FONT_SIGNED_DISTANCE_FIELD_SPREAD );
+	}
+	return 0.0f;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::GetCachedTextMesh(
+	const Text			&	text,
+	float					kerning,
+	glm::vec2				scale,
+	bool					vertical,
+	uint32_t				font_face,
+	TextureResource		*	texture,
+	Mesh				&	out_mesh
+)
+{
+	auto key = CalculateTextMeshCacheKey( text, kerning, scale, vertical, font_face );
+
+	std::lock_guard<std::mutex> lock_guard( text_mesh_cache_mutex );
+	auto it = text_mesh_cache.find( key );
+	if( it == text_mesh_cache.end() ) return false;
+
+	auto & entry = it->second;
+	if( entry.texture != texture ||
+		entry.font_face != font_face ||
+		entry.vertical != vertical ||
+		entry.kerning != kerning ||
+		entry.scale != scale ||
+		!( entry.text == text ) ) {
+		return false;
+	}
+
+	entry.last_use		= ++text_mesh_cache_use_counter;
+	out_mesh			= entry.mesh;
+	return true;
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::AddCachedTextMesh(
+	const Text			&	text,
+	float					kerning,
+	glm::vec2				scale,
+	bool					vertical,
+	uint32_t				font_face,
+	TextureResource		*	texture,
+	const Mesh			&	mesh
+)
+{
+	auto key = CalculateTextMeshCacheKey( text, kerning, scale, vertical, font_face );
+
+	std::lock_guard<std::mutex> lock_guard( text_mesh_cache_mutex );
+
+	// Drop everything not used during the last half of the cache
+	// capacity worth of lookups, this always removes at least half.
+	if( text_mesh_cache.size() >= FONT_TEXT_MESH_CACHE_MAX_ENTRY_COUNT ) {
+		auto oldest_kept = text_mesh_cache_use_counter - FONT_TEXT_MESH_CACHE_MAX_ENTRY_COUNT / 2;
+		std::erase_if( text_mesh_cache, [ oldest_kept ]( auto & e )
+			{
+				return e.second.last_use <= oldest_kept;
+			}
+		);
+	}
+
+	// Hash collisions simply replace the older entry.
+	auto & entry		= text_mesh_cache[ key ];
+	entry.text			= text;
+	entry.kerning		= kerning;
+	entry.scale			= scale;
+	entry.vertical		= vertical;
+	entry.font_face		= font_face;
+	entry.texture		= texture;
+	entry.last_use		= ++text_mesh_cache_use_counter;
+	entry.mesh			= mesh;
+}
+
+vk2d::FontAtlasStatistics vk2d::vk2d_internal::FontResourceImpl::GetAtlasStatistics()
+{
+	if( GetStatus() != ResourceStatus::LOADED ) return {};
+
+	auto CollectStatistics = [ this ]() -> FontAtlasStatistics
+	{
+		FontAtlasStatistics ret {};
+		ret.atlas_size				= atlas_size;
+		ret.atlas_layer_count		= uint32_t( atlas_textures.size() );
+		ret.glyph_count				= rasterized_glyph_count;
+		ret.glyph_texel_count		= glyph_texel_count;
+		ret.total_texel_count		= uint64_t( atlas_size ) * uint64_t( atlas_size ) * uint64_t( atlas_textures.size() );
+		if( ret.total_texel_count ) {
+			ret.occupancy			= float( double( ret.glyph_texel_count ) / double( ret.total_texel_count ) );
+		}
+		return ret;
+	};
+
+	if( use_dynamic_glyph_cache ) {
+		std::lock_guard<std::mutex> lock_guard( glyph_cache_mutex );
+		return CollectStatistics();
+	}
+	return CollectStatistics();
+}
+
 bool vk2d::vk2d_internal::FontResourceImpl::IsGood() const
 {
 	return is_good;
 }
 
+FT_Face vk2d::vk2d_internal::FontResourceImpl::CreateFace(
+	FT_Library		library,
+	uint32_t		face_index
+) const
+{
+	if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+		// Spread is a FreeType library wide property, every signed distance
+		// field font sets the same value so this is safe to do per font.
+		// "sdf" renders outline glyphs, "bsdf" renders bitmap glyphs.
+		FT_Int spread = FT_Int( FONT_SIGNED_DISTANCE_FIELD_SPREAD );
+		FT_Property_Set( library, "sdf", "spread", &spread );
+		FT_Property_Set( library, "bsdf", "spread", &spread );
+	}
+
+	FT_Face face {};
+	auto ft_error = FT_New_Memory_Face(
+		library,
+		font_file_data.data(),
+		FT_Long( font_file_data.size() ),
+		FT_Long( face_index ),
+		&face
+	);
+	if( ft_error ) return nullptr;
+
+	ft_error = FT_Set_Pixel_Sizes(
+		face,
+		0,
+		glyph_texel_size
+	);
+	if( ft_error ) {
+		FT_Done_Face( face );
+		return nullptr;
+	}
+
+	return face;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::RenderGlyph(
+	FT_Face					face,
+	uint32_t				glyph_index,
+	RasterizedGlyph		&	out_rasterized_glyph
+) const
+{
+	auto	instance	= resource_manager->GetInstance();
+
+	assert( face );
+
+	{
+		auto ft_load_error = FT_Load_Glyph( face, glyph_index, FT_LOAD_DEFAULT );
+		if( ft_load_error ) {
+			instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, cannot load glyph!" );
+			return false;
+		}
+	}
+	{
+		auto render_mode = use_alpha ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO;
+		if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+			render_mode = FT_RENDER_MODE_SDF;
+		}
+		auto ft_render_error = FT_Render_Glyph( face->glyph, render_mode );
+		if( ft_render_error ) {
+			instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, cannot render glyph!" );
+			return false;
+		}
+	}
+	auto	ft_glyph	= face->glyph;
+	auto &	ft_bitmap	= ft_glyph->bitmap;
+
+	// Atlas stores coverage only, texture sampling expands it to white with
+	// coverage as alpha, see TextureFormat::R8_UNORM.
+	std::vector<uint8_t> final_glyph_pixels( size_t( ft_bitmap.rows ) * size_t( ft_bitmap.width ) );
+
+	switch( ft_bitmap.pixel_mode ) {
+		case FT_PIXEL_MODE_MONO:
+		{
+			for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
+				for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
+					auto	texel_pos	= y * ft_bitmap.width + x;
+					auto	src_bit		= 7 - x % 8;
+					auto	src_byte	= ft_bitmap.buffer[ ( y * ft_bitmap.pitch ) + ( x / 8 ) ];
+
+					final_glyph_pixels[ texel_pos ]	= uint8_t( ( ( src_byte >> src_bit ) & 1 ) * 255 );
+				}
+			}
+		}
+		break;
+
+		case FT_PIXEL_MODE_GRAY:
+		{
+			for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
+				for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
+					auto	texel_pos	= y * ft_bitmap.width + x;
+
+					final_glyph_pixels[ texel_pos ]	= ft_bitmap.buffer[ texel_pos ];
+				}
+			}
+		}
+		break;
+
+		case FT_PIXEL_MODE_BGRA:
+		{
+			for( uint32_t y = 0; y < ft_bitmap.rows; ++y ) {
+				for( uint32_t x = 0; x < ft_bitmap.width; ++x ) {
+					auto	texel_pos	= y * ft_bitmap.width + x;
+
+					// Glyphs are not loaded with FT_LOAD_COLOR so this
+					// only happens with unusual bitmap fonts, keep the shape.
+					final_glyph_pixels[ texel_pos ]	= ft_bitmap.buffer[ texel_pos * 4 + 3 ];
+				}
+			}
+		}
+		break;
+
+		default:
+			// Unsupported
+			instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load font, Unsupported pixel format!" );
+			return false;
+			break;
+	}
+
+	out_rasterized_glyph.size				= glm::uvec2( uint32_t( ft_bitmap.width ), uint32_t( ft_bitmap.rows ) );
+	out_rasterized_glyph.bitmap_offset		= glm::ivec2( ft_glyph->bitmap_left, ft_glyph->bitmap_top );
+	out_rasterized_glyph.metrics			= ft_glyph->metrics;
+	out_rasterized_glyph.coverage			= std::move( final_glyph_pixels );
+
+	return true;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::RasterizeGlyph(
+	uint32_t		face_index,
+	uint32_t		glyph_index
+)
+{
+	auto & face		= face_infos[ face_index ];
+
+	assert( face.face );
+	assert( size_t( glyph_index ) < face.glyph_infos.size() );
+
+	RasterizedGlyph rasterized_glyph;
+	if( !RenderGlyph( face.face, glyph_index, rasterized_glyph ) ) return false;
+
+	return AddRasterizedGlyph( face_index, glyph_index, rasterized_glyph );
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::RasterizeGlyphsInParallel(
+	ThreadLoaderResource								*	loader_thread_resource,
+	const std::vector<std::pair<uint32_t, uint32_t>>	&	glyphs,
+	std::vector<RasterizedGlyph>						&	out_rasterized_glyphs
+)
+{
+	auto job				= std::make_shared<FontGlyphRasterizationJob>();
+	job->font				= this;
+	job->glyphs				= glyphs;
+	job->rasterized_glyphs.resize( glyphs.size() );
+
+	// Helpers are queued behind whatever the other loader threads are doing.
+	// If they don't get to it in time this thread has already rendered
+	// every range and the helpers exit without doing anything.
+	auto range_count		= ( glyphs.size() + FONT_GLYPH_RASTERIZATION_RANGE_SIZE - 1 ) / FONT_GLYPH_RASTERIZATION_RANGE_SIZE;
+	auto thread_pool		= resource_manager->GetThreadPool();
+	size_t helper_count		= 0;
+	for( auto t : resource_manager->GetLoaderThreads() ) {
+		if( helper_count + 1 >= range_count ) break;
+		if( t == loader_thread_resource->GetThreadIndex() ) continue;
+
+		thread_pool->ScheduleTask(
+			std::make_unique<FontGlyphRasterizationTask>( job ),
+			{ t }
+		);
+		++helper_count;
+	}
+
+	// This thread uses the faces it already has.
+	std::vector<FT_Face> faces( face_infos.size() );
+	for( size_t i = 0; i < face_infos.size(); ++i ) {
+		faces[ i ]			= face_infos[ i ].face;
+	}
+	RasterizeFontGlyphRanges( *job, loader_thread_resource->GetFreeTypeInstance(), faces );
+
+	{
+		std::unique_lock<std::mutex> unique_lock( job->helper_mutex );
+		job->helpers_finished.wait( unique_lock, [ &job ]()
+			{
+				return job->active_helper_count == 0;
+			}
+		);
+	}
+
+	if( job->failed ) return false;
+
+	out_rasterized_glyphs	= std::move( job->rasterized_glyphs );
+	return true;
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::AddRasterizedGlyph(
+	uint32_t					face_index,
+	uint32_t					glyph_index,
+	const RasterizedGlyph	&	rasterized_glyph
+)
+{
+	auto	instance	= resource_manager->GetInstance();
+	auto &	face		= face_infos[ face_index ];
+
+	assert( size_t( glyph_index ) < face.glyph_infos.size() );
+
+	// Attach rendered glyph to final texture atlas.
+	auto atlas_location			= AttachGlyphToAtlas(
+		rasterized_glyph.size,
+		glyph_atlas_padding,
+		rasterized_glyph.coverage
+	);
+	if( !atlas_location.atlas_ptr ) {
+		instance->Report(
+			ReportSeverity::NON_CRITICAL_ERROR,
+			"Internal error: Cannot create font, cannot copy glyph image to font texture atlas!"
+		);
+		return false;
+	}
+
+	// Create glyph info structure for the glyph
+	{
+		Rect2f uv_coords		= {
+			float( atlas_location.location.top_left.x ) / float( atlas_size ),
+			float( atlas_location.location.top_left.y ) / float( atlas_size ),
+			float( atlas_location.location.bottom_right.x ) / float( atlas_size ),
+			float( atlas_location.location.bottom_right.y ) / float( atlas_size )
+		};
+
+		auto & metrics								= rasterized_glyph.metrics;
+		auto glyph_size								= glm::dvec2( metrics.width, metrics.height ) * glyph_size_bitmap_size_ratio;
+		auto glyph_hori_top_left					= glm::dvec2( metrics.horiBearingX, -metrics.horiBearingY ) * glyph_size_bitmap_size_ratio;
+		auto glyph_hori_bottom_right				= glyph_hori_top_left + glyph_size;
+		auto glyph_vert_top_left					= glm::dvec2( metrics.vertBearingX, metrics.vertBearingY ) * glyph_size_bitmap_size_ratio;
+		auto glyph_vert_bottom_right				= glyph_vert_top_left + glyph_size;
+		auto hori_advance							= metrics.horiAdvance * glyph_size_bitmap_size_ratio;
+		auto vert_advance							= metrics.vertAdvance * glyph_size_bitmap_size_ratio;
+
+		if( glyph_atlas_type == GlyphAtlasType::SIGNED_DISTANCE_FIELD ) {
+			// Signed distance field extends past the glyph outline by the spread
+			// amount, quad must cover the whole bitmap to map texels 1:1.
+			auto spread								= double( FONT_SIGNED_DISTANCE_FIELD_SPREAD );
+			glyph_size								= glm::dvec2( rasterized_glyph.size );
+			glyph_hori_top_left						= glm::dvec2( double( rasterized_glyph.bitmap_offset.x ), -double( rasterized_glyph.bitmap_offset.y ) );
+			glyph_hori_bottom_right					= glyph_hori_top_left + glyph_size;
+			glyph_vert_top_left						-= glm::dvec2( spread, spread );
+			glyph_vert_bottom_right					= glyph_vert_top_left + glyph_size;
+		}
+
+		GlyphInfo glyph_info {};
+		glyph_info.face_index						= uint32_t( face_index );
+		glyph_info.glyph_index						= glyph_index;
+		glyph_info.atlas_index						= atlas_location.atlas_index;
+		glyph_info.uv_coords						= uv_coords;
+		glyph_info.horisontal_coords.top_left		= glm::vec2( float( glyph_hori_top_left.x ), float( glyph_hori_top_left.y ) );
+		glyph_info.horisontal_coords.bottom_right	= glm::vec2( float( glyph_hori_bottom_right.x ), float( glyph_hori_bottom_right.y ) );
+		glyph_info.vertical_coords.top_left			= glm::vec2( float( glyph_vert_top_left.x ), float( glyph_vert_top_left.y ) );
+		glyph_info.vertical_coords.bottom_right		= glm::vec2( float( glyph_vert_bottom_right.x ), float( glyph_vert_bottom_right.y ) );
+		glyph_info.horisontal_advance				= float( hori_advance );
+		glyph_info.vertical_advance					= float( vert_advance );
+
+		face.glyph_infos[ glyph_index ]				= glyph_info;
+
+		// Glyph tables pushed earlier in the frame may have the old glyph info.
+		if( glyph_index < face.glyph_table_indices.size() && face.glyph_table_indices[ glyph_index ] != UINT32_MAX ) {
+			++face.glyph_table_generation;
+		}
+	}
+
+	if( use_dynamic_glyph_cache ) {
+		face.glyph_rasterized[ glyph_index ]		= true;
+		if( rasterized_glyph.size.x && rasterized_glyph.size.y ) {
+			pending_atlas_regions.push_back( { atlas_location.atlas_index, atlas_location.location } );
+		}
+	}
+
+	return true;
+}
+
+size_t vk2d::vk2d_internal::FontResourceImpl::CalculateTextMeshCacheKey(
+	const Text			&	text,
+	float					kerning,
+	glm::vec2				scale,
+	bool					vertical,
+	uint32_t				font_face
+) const
+{
+	auto Combine =[]( size_t seed, size_t value )
+	{
+		return seed ^ ( value + 0x9e3779b9 + ( seed << 6 ) + ( seed >> 2 ) );
+	};
+	auto key = text.Hash();
+	key = Combine( key, std::hash<float>()( kerning ) );
+	key = Combine( key, std::hash<float>()( scale.x ) );
+	key = Combine( key, std::hash<float>()( scale.y ) );
+	key = Combine( key, size_t( font_face ) << 1 | size_t( vertical ) );
+	return key;
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::BuildKerningTable(
+	uint32_t		face_index
+)
+{
+	auto & face = face_infos[ face_index ];
+	face.kerning_pairs.clear();
+
+	assert( face.face );
+	if( !FT_HAS_KERNING( face.face ) ) return;
+
+	std::vector<uint32_t> glyph_indices;
+	for( uint32_t c = FONT_KERNING_TABLE_FIRST_CHARACTER; c <= FONT_KERNING_TABLE_LAST_CHARACTER; ++c ) {
+		if( auto glyph_index = face.charmap.Find( c ) ) {
+			glyph_indices.push_back( glyph_index );
+		}
+	}
+	std::sort( glyph_indices.begin(), glyph_indices.end() );
+	glyph_indices.erase( std::unique( glyph_indices.begin(), glyph_indices.end() ), glyph_indices.end() );
+
+	// Looped in sorted order so kerning pairs come out sorted.
+	for( auto left : glyph_indices ) {
+		for( auto right : glyph_indices ) {
+			FT_Vector delta {};
+			if( FT_Get_Kerning( face.face, left, right, FT_KERNING_DEFAULT, &delta ) ) continue;
+			if( delta.x == 0 ) continue;
+			face.kerning_pairs.push_back( {
+				uint64_t( left ) << 32 | uint64_t( right ),
+				float( double( delta.x ) * glyph_size_bitmap_size_ratio )
+			} );
+		}
+	}
+	face.kerning_pairs.shrink_to_fit();
+}
+
+vk2d::TextureResource * vk2d::vk2d_internal::FontResourceImpl::CreateTextureResourceFromAtlas()
+{
+	std::vector<const std::vector<uint8_t>*>	texture_data_array( atlas_textures.size() );
+	for( size_t i = 0; i < atlas_textures.size(); ++i ) {
+		texture_data_array[ i ]		= &atlas_textures[ i ]->data;
+	}
+
+	// Texture resource copies the texture data so the atlas can keep
+	// changing after this.
+	auto new_texture_resource = resource_manager->CreateArrayTextureResource(
+		glm::uvec2( atlas_size, atlas_size ),
+		TextureFormat::R8_UNORM,
+		texture_data_array,
+		my_interface
+	);
+	if( new_texture_resource ) {
+		pending_atlas_regions.clear();
+	}
+	return new_texture_resource;
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::LoadFromAtlasCache(
+	FontAtlasCacheData								&&	cache_data,
+	std::vector<std::vector<uint8_t>>				&&	cache_atlas_layers
+)
+{
+	atlas_size						= cache_data.atlas_size;
+	glyph_size_bitmap_size_ratio	= cache_data.glyph_size_bitmap_size_ratio;
+	rasterized_glyph_count			= cache_data.glyph_count;
+	glyph_texel_count				= cache_data.glyph_texel_count;
+
+	assert( !face_infos.size() );
+	face_infos.resize( cache_data.faces.size() );
+	for( size_t i = 0; i < cache_data.faces.size(); ++i ) {
+		auto & src						= cache_data.faces[ i ];
+		auto & dst						= face_infos[ i ];
+		dst.glyph_infos					= std::move( src.glyph_infos );
+		dst.fallback_glyph_index		= src.fallback_glyph_index;
+		dst.ascender					= src.ascender;
+		dst.descender					= src.descender;
+		dst.line_height					= src.line_height;
+		dst.kerning_pairs				= std::move( src.kerning_pairs );
+		dst.charmap.Build( std::move( src.character_glyph_pairs ) );
+	}
+
+	// Atlas is never packed further without the dynamic glyph cache so the
+	// skyline is left empty.
+	atlas_textures.clear();
+	for( auto & layer : cache_atlas_layers ) {
+		auto atlas_texture			= std::make_unique<AtlasTexture>();
+		atlas_texture->data			= std::move( layer );
+		atlas_texture->index		= uint32_t( atlas_textures.size() );
+		atlas_textures.push_back( std::move( atlas_texture ) );
+	}
+}
+
+bool vk2d::vk2d_internal::FontResourceImpl::SaveToAtlasCache(
+	const std::filesystem::path									&	cache_file_path,
+	const FontAtlasCacheKey										&	cache_key,
+	const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>	&	face_character_glyph_pairs
+)
+{
+	assert( face_character_glyph_pairs.size() == face_infos.size() );
+
+	FontAtlasCacheData cache_data;
+	cache_data.atlas_size						= atlas_size;
+	cache_data.glyph_size_bitmap_size_ratio		= glyph_size_bitmap_size_ratio;
+	cache_data.glyph_count						= rasterized_glyph_count;
+	cache_data.glyph_texel_count				= glyph_texel_count;
+	cache_data.faces.resize( face_infos.size() );
+	for( size_t i = 0; i < face_infos.size(); ++i ) {
+		auto & src						= face_infos[ i ];
+		auto & dst						= cache_data.faces[ i ];
+		dst.glyph_infos					= src.glyph_infos;
+		dst.fallback_glyph_index		= src.fallback_glyph_index;
+		dst.ascender					= src.ascender;
+		dst.descender					= src.descender;
+		dst.line_height					= src.line_height;
+		dst.kerning_pairs				= src.kerning_pairs;
+		dst.character_glyph_pairs		= face_character_glyph_pairs[ i ];
+	}
+
+	std::vector<const std::vector<uint8_t>*> atlas_layers( atlas_textures.size() );
+	for( size_t i = 0; i < atlas_textures.size(); ++i ) {
+		atlas_layers[ i ]		= &atlas_textures[ i ]->data;
+	}
+
+	return WriteFontAtlasCache(
+		cache_file_path,
+		cache_key,
+		cache_data,
+		atlas_layers
+	);
+}
+
+uint32_t vk2d::vk2d_internal::FontResourceImpl::ChooseAtlasSize(
+	uint64_t			estimated_glyph_area,
+	uint32_t			largest_glyph_dimension,
+	uint32_t			min_texture_size,
+	uint32_t			max_texture_size
+) const
+{
+	// Try every power of two size that fits the largest glyph and pick the
+	// one that needs the least texels in total. Small sizes need many layers
+	// and large sizes waste space on the last layer.
+	uint32_t	best_size		= max_texture_size;
+	uint64_t	best_texels		= UINT64_MAX;
+	auto		first_size		= uint64_t( RoundToCeilingPowerOfTwo( std::max( min_texture_size, largest_glyph_dimension ) ) );
+	for( auto size = first_size; size <= uint64_t( max_texture_size ); size *= 2 ) {
+		auto layer_capacity		= double( size * size ) * FONT_ATLAS_EXPECTED_OCCUPANCY;
+		auto layer_count		= std::max( uint64_t( std::ceil( double( estimated_glyph_area ) / layer_capacity ) ), uint64_t( 1 ) );
+		if( layer_count > FONT_ATLAS_MAX_PREFERRED_LAYER_COUNT ) continue;
+
+		// On ties prefer the larger size, fewer layers pack better.
+		auto texels				= layer_count * size * size;
+		if( texels <= best_texels ) {
+			best_texels			= texels;
+			best_size			= uint32_t( size );
+		}
+	}
+	return best_size;
+}
+
 vk2d::vk2d_internal::FontResourceImpl::AtlasTexture *vk2d::vk2d_internal::FontResourceImpl::CreateNewAtlasTexture()
 {
 	auto new_atlas_texture			= std::make_unique<FontResourceImpl::AtlasTexture>();
 
 	new_atlas_texture->data.resize( size_t( atlas_size ) * size_t( atlas_size ) );
 	new_atlas_texture->index		= uint32_t( atlas_textures.size() );
-	std::memset( new_atlas_texture->data.data(), 0, new_atlas_texture->data.size() * sizeof( Color8 ) );
+	std::memset( new_atlas_texture->data.data(), 0, new_atlas_texture->data.size() );
+
+	// Glyph cells are padded on the top left, right and bottom edges of the
+	// atlas are left out so the last glyphs get padding there too.
+	auto usable_size				= atlas_size > glyph_atlas_padding ? atlas_size - glyph_atlas_padding : 0;
+	new_atlas_texture->skyline.push_back( { 0, 0, usable_size } );
 
 	auto new_atlas_texture_ptr		= new_atlas_texture.get();
 	atlas_textures.push_back( std::move( new_atlas_texture ) );
 	return new_atlas_texture_ptr;
 }
 
+bool vk2d::vk2d_internal::FontResourceImpl::FindSkylineLocation(
+	const AtlasTexture		&	atlas_texture,
+	glm::uvec2					size,
+	size_t					&	out_node_index,
+	glm::uvec2				&	out_location
+) const
+{
+	auto & skyline			= atlas_texture.skyline;
+	auto usable_size		= atlas_size > glyph_atlas_padding ? atlas_size - glyph_atlas_padding : 0;
+
+	bool		found		= false;
+	uint32_t	best_y		= UINT32_MAX;
+	uint32_t	best_width	= UINT32_MAX;
+	for( size_t i = 0; i < skyline.size(); ++i ) {
+		auto x = skyline[ i ].x;
+		if( x + size.x > usable_size ) break;
+
+		// Rectangle rests on the highest node it spans over.
+		uint32_t	y				= 0;
+		uint32_t	width_left		= size.x;
+		for( size_t n = i; width_left > 0; ++n ) {
+			assert( n < skyline.size() );
+			y				= std::max( y, skyline[ n ].y );
+			width_left		-= std::min( width_left, skyline[ n ].width );
+		}
+		if( y + size.y > usable_size ) continue;
+
+		// Lowest position wins, on ties prefer the narrower node to leave
+		// less unusable space next to the rectangle.
+		if( y < best_y || ( y == best_y && skyline[ i ].width < best_width ) ) {
+			found			= true;
+			best_y			= y;
+			best_width		= skyline[ i ].width;
+			out_node_index	= i;
+			out_location	= { x, y };
+		}
+	}
+	return found;
+}
+
+void vk2d::vk2d_internal::FontResourceImpl::AddSkylineLevel(
+	AtlasTexture			&	atlas_texture,
+	size_t						node_index,
+	glm::uvec2					location,
+	glm::uvec2					size
+)
+{
+	auto & skyline = atlas_texture.skyline;
+	skyline.insert( skyline.begin() + node_index, { location.x, location.y + size.y, size.x } );
+
+	// Trim or remove nodes that are now under the new node.
+	for( size_t i = node_index + 1; i < skyline.size(); ) {
+		auto previous_end	= skyline[ i - 1 ].x + skyline[ i - 1 ].width;
+		if( skyline[ i ].x >= previous_end ) break;
+
+		auto shrink			= previous_end - skyline[ i ].x;
+		if( skyline[ i ].width <= shrink ) {
+			skyline.erase( skyline.begin() + i );
+			continue;
+		}
+		skyline[ i ].x		+= shrink;
+		skyline[ i ].width	-= shrink;
+		break;
+	}
+
+	// Merge neighbouring nodes at the same height.
+	for( size_t i = 0; i + 1 < skyline.size(); ) {
+		if( skyline[ i ].y == skyline[ i + 1 ].y ) {
+			skyline[ i ].width += skyline[ i + 1 ].width;
+			skyline.erase( skyline.begin() + i + 1 );
+		} else {
+			++i;
+		}
+	}
+}
+
 vk2d::vk2d_internal::FontResourceImpl::AtlasLocation vk2d::vk2d_internal::FontResourceImpl::ReserveSpaceForGlyphFromAtlasTextures(
-	FT_GlyphSlot		glyph,
+	glm::uvec2			glyph_size,
 	uint32_t			glyph_atlas_padding
 )
 {
-	assert( current_atlas_texture );
+	auto cell_size		= glyph_size + glm::uvec2( glyph_atlas_padding, glyph_atlas_padding );
 
-	auto FindLocationInAtlasTexture =[](
-		FontResourceImpl::AtlasTexture		*	atlas_texture,
-		FT_GlyphSlot											glyph,
-		uint32_t												atlas_size,
-		uint32_t												glyph_atlas_padding
-		) ->vk2d::vk2d_internal::FontResourceImpl::AtlasLocation
+	auto ReserveFromAtlasTexture =[ this, glyph_size, cell_size, glyph_atlas_padding ](
+		AtlasTexture		*	atlas_texture
+		) -> AtlasLocation
 	{
-		uint32_t glyph_width		= uint32_t( glyph->bitmap.width )	+ glyph_atlas_padding;
-		uint32_t glyph_height		= uint32_t( glyph->bitmap.rows )	+ glyph_atlas_padding;
-
-		// Find space in the current atlas texture.
-		if( atlas_texture->previous_row_height + glyph_height + glyph_atlas_padding < atlas_size ) {
-			// Fits height wise.
-
-			if( atlas_texture->current_write_location + glyph_width + glyph_atlas_padding < atlas_size ) {
-				// Fits width wise, fits completely.
-
-				FontResourceImpl::AtlasLocation new_glyph_location {};
-				new_glyph_location.atlas_ptr				= atlas_texture;
-				new_glyph_location.atlas_index				= atlas_texture->index;
-				new_glyph_location.location.top_left		= {
-					atlas_texture->current_write_location	+ glyph_atlas_padding,
-					atlas_texture->previous_row_height		+ glyph_atlas_padding
-				};
-				new_glyph_location.location.bottom_right	=
-					new_glyph_location.location.top_left	+
-					glm::uvec2( uint32_t( glyph->bitmap.width ), uint32_t( glyph->bitmap.rows ) );
-
-				// update current row height and write locations before returning the result.
-				atlas_texture->current_row_height			= std::max( atlas_texture->current_row_height, glyph_height );
-				atlas_texture->current_write_location		+= glyph_width;
-
-				return new_glyph_location;
-			}
-
-			// Does not fit width wise, go to the next row.
-			atlas_texture->previous_row_height				+= atlas_texture->current_row_height;
-			atlas_texture->current_row_height				= 0;
-			atlas_texture->current_write_location			= 0;
-
-			// Check height again.
-			if( atlas_texture->previous_row_height + glyph_height + glyph_atlas_padding < atlas_size ) {
-				// Fits height wise.
-
-				if( atlas_texture->current_write_location + glyph_width + glyph_atlas_padding < atlas_size ) {
-					// Fits width wise.
-
-					FontResourceImpl::AtlasLocation new_glyph_location {};
-					new_glyph_location.atlas_ptr				= atlas_texture;
-					new_glyph_location.atlas_index				= atlas_texture->index;
-					new_glyph_location.location.top_left		= {
-						atlas_texture->current_write_location	+ glyph_atlas_padding,
-						atlas_texture->previous_row_height		+ glyph_atlas_padding
-					};
-					new_glyph_location.location.bottom_right	=
-						new_glyph_location.location.top_left	+
-						glm::uvec2( uint32_t( glyph->bitmap.width ), uint32_t( glyph->bitmap.rows ) );
-
-					// update current row height and write locations before returning the result.
-					atlas_texture->current_row_height		= std::max( atlas_texture->current_row_height, glyph_height );
-					atlas_texture->current_write_location	+= glyph_width;
-
-					return new_glyph_location;
-				}
+		size_t		node_index		= {};
+		glm::uvec2	cell_location	= {};
+		if( !FindSkylineLocation( *atlas_texture, cell_size, node_index, cell_location ) ) return {};
 
-				// Does not fit width wise to a new row, this would only happen if a single
-				// face glyph is too large to fit into a single atlas. This is an error.
-				assert( 0 && "Glyph too big" );
-				return {};
-			}
+		AddSkylineLevel( *atlas_texture, node_index, cell_location, cell_size );
 
-			// Does not fit to a new row, need a new atlas texture
-			return {};
-		}
+		AtlasLocation new_glyph_location {};
+		new_glyph_location.atlas_ptr				= atlas_texture;
+		new_glyph_location.atlas_index				= atlas_texture->index;
+		new_glyph_location.location.top_left		= cell_location + glm::uvec2( glyph_atlas_padding, glyph_atlas_padding );
+		new_glyph_location.location.bottom_right	= new_glyph_location.location.top_left + glyph_size;
 
-		// Does not fit at all, need a new atlas texture.
-		return {};
+		rasterized_glyph_count						+= 1;
+		glyph_texel_count							+= uint64_t( glyph_size.x ) * uint64_t( glyph_size.y );
+		return new_glyph_location;
 	};
 
-	auto new_location = FindLocationInAtlasTexture(
-		current_atlas_texture,
-		glyph,
-		atlas_size,
-		glyph_atlas_padding
-	);
-	if( !new_location.atlas_ptr ) {
-		// Not enough space found, create new atlas and try again.
+	if( glyph_size.x == 0 || glyph_size.y == 0 ) {
+		// Empty glyphs, eg. space, take no atlas space.
+		assert( atlas_textures.size() );
+		AtlasLocation new_glyph_location {};
+		new_glyph_location.atlas_ptr				= atlas_textures[ 0 ].get();
+		new_glyph_location.atlas_index				= 0;
+		new_glyph_location.location.top_left		= glm::uvec2( glyph_atlas_padding, glyph_atlas_padding );
+		new_glyph_location.location.bottom_right	= new_glyph_location.location.top_left + glyph_size;
+		rasterized_glyph_count						+= 1;
+		return new_glyph_location;
+	}
 
-		current_atlas_texture = CreateNewAtlasTexture();
-		if( !current_atlas_texture ) {
-			// Failed to create new atlas texture.
-			resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, cannot create new atlas texture for font!" );
-			return {};
-		}
+	// Earlier atlas textures often still have gaps that fit small glyphs.
+	for( auto & atlas_texture : atlas_textures ) {
+		auto new_location = ReserveFromAtlasTexture( atlas_texture.get() );
+		if( new_location.atlas_ptr ) return new_location;
+	}
 
-		// Got new atlas texture, retry finding space in it.
-		new_location	= FindLocationInAtlasTexture(
-			current_atlas_texture,
-			glyph,
-			atlas_size,
-			glyph_atlas_padding
-		);
-		if( !new_location.atlas_ptr ) {
-			// Still could not find enough space, a single font face glyph is too large
-			// to fit entire atlas, this should not happen so we raise an error.
-			resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, a single glyph wont fit into a new atlas." );
-			return {};
-		}
+	// Not enough space found, create new atlas and try again.
+	auto new_atlas_texture = CreateNewAtlasTexture();
+	if( !new_atlas_texture ) {
+		// Failed to create new atlas texture.
+		resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, cannot create new atlas texture for font!" );
+		return {};
+	}
 
-		return new_location;
+	auto new_location = ReserveFromAtlasTexture( new_atlas_texture );
+	if( !new_location.atlas_ptr ) {
+		// Still could not find enough space, a single font face glyph is too large
+		// to fit entire atlas, this should not happen so we raise an error.
+		resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create font, a single glyph wont fit into a new atlas." );
+		return {};
 	}
 	return new_location;
 }
 
 void vk2d::vk2d_internal::FontResourceImpl::CopyGlyphTextureToAtlasLocation(
 	AtlasLocation							atlas_location,
-	const std::vector<Color8>		&	converted_texture_data )
+	const std::vector<uint8_t>		&	converted_texture_data )
 {
 	assert( atlas_location.atlas_ptr );
 
@@ -880,21 +1970,21 @@ void vk2d::vk2d_internal::FontResourceImpl::CopyGlyphTextureToAtlasLocation(
 	glm::uvec2 location	= atlas_location.location.top_left;
 
 	for( uint32_t gy = 0; gy < glyph_height; ++gy ) {
-		for( uint32_t gx = 0; gx < glyph_width; ++gx ) {
-			auto ax		= location.x + gx;
-			auto ay		= location.y + gy;
-			atlas_location.atlas_ptr->data[ ay * atlas_size + ax ]	= converted_texture_data[ gy * glyph_width + gx ];
-		}
+		std::memcpy(
+			atlas_location.atlas_ptr->data.data() + size_t( location.y + gy ) * atlas_size + location.x,
+			converted_texture_data.data() + size_t( gy ) * glyph_width,
+			glyph_width
+		);
 	}
 }
 
 vk2d::vk2d_internal::FontResourceImpl::AtlasLocation vk2d::vk2d_internal::FontResourceImpl::AttachGlyphToAtlas(
-	FT_GlyphSlot							glyph,
+	glm::uvec2								glyph_size,
 	uint32_t								glyph_atlas_padding,
-	const std::vector<Color8>			&	converted_texture_data )
+	const std::vector<uint8_t>			&	converted_texture_data )
 {
 	auto atlas_location = ReserveSpaceForGlyphFromAtlasTextures(
-		glyph,
+		glyph_size,
 		glyph_atlas_padding
 	);
 	if( atlas_location.atlas_ptr ) {
@@ -915,6 +2005,92 @@ vk2d::vk2d_internal::FontResourceImpl::AtlasLocation vk2d::vk2d_internal::FontRe
 
 
 
+void vk2d::vk2d_internal::CharacterMap::Build(
+	std::vector<std::pair<uint32_t, uint32_t>>		character_glyph_pairs
+)
+{
+	std::sort(
+		character_glyph_pairs.begin(),
+		character_glyph_pairs.end()
+	);
+
+	// First page is the shared empty page.
+	page_directory.fill( 0 );
+	page_data.assign( CHARACTER_MAP_PAGE_SIZE, 0 );
+	extended_characters.clear();
+
+	for( auto & p : character_glyph_pairs ) {
+		if( p.first >= CHARACTER_MAP_DIRECT_CHARACTER_COUNT ) {
+			extended_characters.push_back( p );
+			continue;
+		}
+		auto & page_offset = page_directory[ p.first >> CHARACTER_MAP_PAGE_BITS ];
+		if( page_offset == 0 ) {
+			page_offset = uint32_t( page_data.size() );
+			page_data.resize( page_data.size() + CHARACTER_MAP_PAGE_SIZE, 0 );
+		}
+		page_data[ page_offset + ( p.first & CHARACTER_MAP_PAGE_MASK ) ] = p.second;
+	}
+
+	page_data.shrink_to_fit();
+	extended_characters.shrink_to_fit();
+}
+
+void vk2d::vk2d_internal::RasterizeFontGlyphRanges(
+	FontGlyphRasterizationJob		&	job,
+	FT_Library							library,
+	std::vector<FT_Face>			&	faces
+)
+{
+	while( !job.failed ) {
+		auto first_glyph	= job.next_glyph.fetch_add( FONT_GLYPH_RASTERIZATION_RANGE_SIZE );
+		if( first_glyph >= job.glyphs.size() ) return;
+		auto last_glyph		= std::min( first_glyph + FONT_GLYPH_RASTERIZATION_RANGE_SIZE, job.glyphs.size() );
+
+		for( size_t i = first_glyph; i < last_glyph; ++i ) {
+			auto face_index		= job.glyphs[ i ].first;
+			if( face_index >= faces.size() ) faces.resize( size_t( face_index ) + 1 );
+			if( !faces[ face_index ] ) {
+				faces[ face_index ]	= job.font->CreateFace( library, face_index );
+				if( !faces[ face_index ] ) {
+					job.failed		= true;
+					return;
+				}
+			}
+			if( !job.font->RenderGlyph( faces[ face_index ], job.glyphs[ i ].second, job.rasterized_glyphs[ i ] ) ) {
+				job.failed			= true;
+				return;
+			}
+		}
+	}
+}
+
+void vk2d::vk2d_internal::FontGlyphRasterizationTask::operator()(
+	ThreadPrivateResource		*	thread_resource
+)
+{
+	auto loader_thread_resource		= static_cast<ThreadLoaderResource*>( thread_resource );
+
+	// Registered before claiming any glyphs, the loading thread waits for
+	// every helper that might have claimed something.
+	{
+		std::lock_guard<std::mutex> lock_guard( job->helper_mutex );
+		++job->active_helper_count;
+	}
+
+	std::vector<FT_Face> faces;
+	RasterizeFontGlyphRanges( *job, loader_thread_resource->GetFreeTypeInstance(), faces );
+	for( auto f : faces ) {
+		if( f ) FT_Done_Face( f );
+	}
+
+	{
+		std::lock_guard<std::mutex> lock_guard( job->helper_mutex );
+		--job->active_helper_count;
+	}
+	job->helpers_finished.notify_all();
+}
+
 uint32_t vk2d::vk2d_internal::RoundToCeilingPowerOfTwo( uint32_t value )
 {
 	value--;
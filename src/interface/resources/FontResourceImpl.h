@@ -4,11 +4,19 @@
 
 #include "types/Rect2.hpp"
 #include "types/Color.hpp"
+#include "types/GlyphAtlasType.h"
+#include "types/Text.h"
+#include "types/TextLayout.h"
+#include "types/Mesh.h"
+
+#include "system/VulkanMemoryManagement.h"
 
 #include "interface/resources/ResourceImplBase.h"
+#include "interface/resources/FontResource.h"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
 
 namespace vk2d {
 
@@ -19,11 +27,83 @@ namespace vk2d_internal {
 
 class ResourceManagerImpl;
 class ThreadPrivateResource;
+class ThreadLoaderResource;
+struct GlyphInstance;
+struct FontAtlasCacheKey;
+struct FontAtlasCacheData;
+
+
+
+// How far away from glyph edges the signed distance field is stored, in
+// atlas texels. FreeType allows values from 2 to 32.
+constexpr uint32_t FONT_SIGNED_DISTANCE_FIELD_SPREAD		= 8;
+
+// Maximum amount of text meshes kept in the text mesh cache per font.
+constexpr size_t FONT_TEXT_MESH_CACHE_MAX_ENTRY_COUNT		= 512;
+
+// Kerning pairs are precomputed at load time for characters in this range,
+// Basic Latin, Latin-1 Supplement and Latin Extended-A. Font faces may not
+// be available later so pairs outside of this range are not kerned.
+constexpr uint32_t FONT_KERNING_TABLE_FIRST_CHARACTER		= 0x0020;
+constexpr uint32_t FONT_KERNING_TABLE_LAST_CHARACTER		= 0x017F;
+
+// Atlas size is chosen so that glyphs fit into at most this many atlas
+// layers at the expected packing occupancy, whichever uses least memory.
+constexpr uint32_t FONT_ATLAS_MAX_PREFERRED_LAYER_COUNT		= 4;
+constexpr double FONT_ATLAS_EXPECTED_OCCUPANCY				= 0.85;
+
+// Glyphs are rendered in ranges of this many glyphs. Idle loader threads
+// help the thread loading the font by taking ranges of their own.
+constexpr size_t FONT_GLYPH_RASTERIZATION_RANGE_SIZE		= 64;
+
+
+
+// Maps characters to glyph indices. Basic multilingual plane is looked up
+// directly from 256 character pages, pages without any characters share a
+// single empty page. Characters outside of it are binary searched from a
+// sorted list. Glyph index 0 means the character is not in the font.
+class CharacterMap {
+public:
+	void												Build(
+		std::vector<std::pair<uint32_t, uint32_t>>		character_glyph_pairs );
+
+	inline uint32_t										Find(
+		uint32_t										character ) const
+	{
+		assert( !page_data.empty() );
+		if( character < CHARACTER_MAP_DIRECT_CHARACTER_COUNT ) {
+			auto page_offset = page_directory[ character >> CHARACTER_MAP_PAGE_BITS ];
+			return page_data[ page_offset + ( character & CHARACTER_MAP_PAGE_MASK ) ];
+		}
+		auto it = std::lower_bound(
+			extended_characters.begin(),
+			extended_characters.end(),
+			character,
+			[]( const std::pair<uint32_t, uint32_t> & p, uint32_t c )
+			{
+				return p.first < c;
+			}
+		);
+		if( it != extended_characters.end() && it->first == character ) return it->second;
+		return 0;
+	}
+
+private:
+	static constexpr uint32_t							CHARACTER_MAP_PAGE_BITS				= 8;
+	static constexpr uint32_t							CHARACTER_MAP_PAGE_SIZE				= 1 << CHARACTER_MAP_PAGE_BITS;
+	static constexpr uint32_t							CHARACTER_MAP_PAGE_MASK				= CHARACTER_MAP_PAGE_SIZE - 1;
+	static constexpr uint32_t							CHARACTER_MAP_DIRECT_CHARACTER_COUNT	= 0x10000;
+
+	std::array<uint32_t, CHARACTER_MAP_DIRECT_CHARACTER_COUNT / CHARACTER_MAP_PAGE_SIZE>	page_directory	= {};	// Offset to page_data, 0 is the shared empty page.
+	std::vector<uint32_t>								page_data							= {};
+	std::vector<std::pair<uint32_t, uint32_t>>			extended_characters					= {};	// Sorted by character.
+};
 
 
 
 struct GlyphInfo {
 	uint32_t	face_index			= {};
+	uint32_t	glyph_index			= {};
 	uint32_t	atlas_index			= {};
 	Rect2f		uv_coords			= {};
 	Rect2f		horisontal_coords	= {};
@@ -32,6 +112,21 @@ struct GlyphInfo {
 	float		vertical_advance	= {};
 };
 
+// Glyph rendered by FreeType that's not yet placed into the atlas.
+struct RasterizedGlyph {
+	glm::uvec2				size			= {};
+	glm::ivec2				bitmap_offset	= {};	// FreeType bitmap_left and bitmap_top.
+	FT_Glyph_Metrics		metrics			= {};
+	std::vector<uint8_t>	coverage		= {};	// One byte per texel.
+};
+
+// Glyph position produced by text layout, position is the scaled pen
+// position on the baseline relative to the layout origin.
+struct TextGlyphPlacement {
+	const GlyphInfo	*	glyph_info		= {};
+	glm::vec2			position		= {};
+};
+
 
 
 class FontResourceImpl:
@@ -47,7 +142,11 @@ public:
 		uint32_t										glyph_texel_size,
 		bool											use_alpha,
 		uint32_t										fallback_character,
-		uint32_t										glyph_atlas_padding );
+		uint32_t										glyph_atlas_padding,
+		bool											use_dynamic_glyph_cache,
+		const std::vector<uint32_t>					&	preload_characters,
+		GlyphAtlasType									glyph_atlas_type,
+		const std::filesystem::path					&	atlas_cache_directory );
 
 	~FontResourceImpl();
 
@@ -66,7 +165,7 @@ public:
 		ThreadPrivateResource						*	thread_resource );
 
 	Rect2f												CalculateRenderedSize(
-		std::string_view								text,
+		const Text									&	text,
 		float											kerning								= 0.0f,
 		glm::vec2										scale								= glm::vec2( 1.0f, 1.0f ),
 		bool											vertical							= false,
@@ -76,49 +175,262 @@ public:
 	bool												FaceExists(
 		uint32_t										font_face ) const;
 
+	// Lays out horisontal text into lines in a single pass. Glyph positions
+	// and line metrics are relative to origin {0, 0}.
+	void												LayoutText(
+		const Text									&	text,
+		const TextLayoutSettings					&	settings,
+		std::vector<TextGlyphPlacement>				&	out_glyph_placements,
+		std::vector<TextLineMetrics>				&	out_line_metrics );
+
+	// Lays out single or multi-line text for drawing it as glyph
+	// instances. Glyphs not yet in a texture with layer_count layers are
+	// left out. Storage of the out vectors is reused between calls.
+	void												LayoutTextForDrawing(
+		const Text									&	text,
+		float											kerning,
+		glm::vec2										scale,
+		bool											vertical,
+		uint32_t										font_face,
+		uint32_t										layer_count,
+		std::vector<TextGlyphPlacement>				&	out_glyph_placements,
+		std::vector<TextLineMetrics>				&	out_line_metrics );
+
+	// Glyph table for the glyph instance vertex shader, see
+	// GlyphInstance. Table only has entries for glyphs that have been
+	// drawn, in the order they were first drawn, and is shared by every
+	// text drawn with the same font face within a frame.
+	const void										*	GetGlyphTableKey(
+		uint32_t										font_face ) const;
+
+	// Adds glyph table entries for glyph placements that don't have one
+	// yet. Returns the amount of glyph table entries, out_generation
+	// changes whenever entries are added or their glyph info changes and
+	// a table pushed earlier in the frame can no longer be used.
+	uint32_t											AddGlyphTableEntries(
+		uint32_t										font_face,
+		const std::vector<TextGlyphPlacement>		&	glyph_placements,
+		uint64_t									&	out_generation );
+
+	// Writes glyph_count glyph table entries, GLYPH_TABLE_FLOATS_PER_GLYPH
+	// floats each.
+	void												WriteGlyphTable(
+		uint32_t										font_face,
+		uint32_t										glyph_count,
+		float										*	out_table );
+
+	// Writes one glyph instance per glyph placement. Glyph placements must
+	// be laid out with scale { 1.0, 1.0 }, scale is applied in the shader,
+	// and have glyph table entries, see AddGlyphTableEntries().
+	void												WriteGlyphInstances(
+		uint32_t										font_face,
+		const std::vector<TextGlyphPlacement>		&	glyph_placements,
+		const Colorf								&	color,
+		GlyphInstance								*	out_instances ) const;
+
+	// Kerning adjustment between two glyphs, unscaled.
+	float												GetKerning(
+		uint32_t										font_face,
+		uint32_t										left_glyph_index,
+		uint32_t										right_glyph_index ) const;
+
 	TextureResource									*	GetTextureResource();
 
+	// In dynamic glyph cache mode, glyphs are rasterized into the atlas
+	// the first time they're requested here. Newly rasterized glyphs
+	// become visible after the next CmdUploadPendingGlyphs() or
+	// FlushPendingGlyphs() upload is done.
 	const GlyphInfo									*	GetGlyphInfo(
 		uint32_t										font_face,
-		uint32_t										character ) const;
+		uint32_t										character );
+
+	// Creates a new texture resource generation from the atlas if the
+	// atlas has grown layers the current texture doesn't have. Called at
+	// frame boundaries from the main thread, no-op if dynamic glyph cache
+	// is not used.
+	void												FlushPendingGlyphs();
+
+	// Records copies of glyphs added to the existing texture layers since
+	// the previous call into the current texture. Called from the main
+	// thread, staging buffers must be kept alive until the command buffer
+	// has finished executing. Texture resource generations replaced since
+	// the previous call are no longer subresources of this font, they must
+	// be destroyed once the command buffer has finished executing.
+	bool												CmdUploadPendingGlyphs(
+		VkCommandBuffer									command_buffer,
+		std::vector<CompleteBufferResource>			&	out_staging_buffers,
+		std::vector<TextureResource*>				&	out_retired_texture_resources );
+
+	bool												IsDynamicGlyphCacheEnabled() const;
+
+	GlyphAtlasType										GetGlyphAtlasType() const;
+
+	// Distance in atlas texels that the signed distance field covers
+	// on both sides of glyph edges, 0.0 if the font uses bitmap glyphs.
+	float												GetSignedDistanceFieldSpread() const;
+
+	// Text mesh cache, the same labels are usually generated every frame.
+	// Meshes are stored at origin {0, 0} and are only returned while the
+	// font texture resource is the one they were generated with.
+	bool												GetCachedTextMesh(
+		const Text									&	text,
+		float											kerning,
+		glm::vec2										scale,
+		bool											vertical,
+		uint32_t										font_face,
+		TextureResource								*	texture,
+		Mesh										&	out_mesh );
+
+	void												AddCachedTextMesh(
+		const Text									&	text,
+		float											kerning,
+		glm::vec2										scale,
+		bool											vertical,
+		uint32_t										font_face,
+		TextureResource								*	texture,
+		const Mesh									&	mesh );
+
+	FontAtlasStatistics									GetAtlasStatistics();
+
+	// Creates a new face from the font file data and sets it to the glyph
+	// texel size. FreeType faces are not thread safe so every thread must
+	// use its own faces and FreeType library. Returns nullptr on error.
+	FT_Face												CreateFace(
+		FT_Library										library,
+		uint32_t										face_index ) const;
+
+	// Renders a glyph into coverage bytes. Doesn't touch the atlas or glyph
+	// infos so any thread can call this with its own face.
+	bool												RenderGlyph(
+		FT_Face											face,
+		uint32_t										glyph_index,
+		RasterizedGlyph								&	out_rasterized_glyph ) const;
 
 	bool												IsGood() const;
 
 private:
+	// Top edge segment of the packed area in an atlas texture. Skyline
+	// nodes are sorted by x and together span the whole atlas width.
+	struct SkylineNode {
+		uint32_t										x									= {};
+		uint32_t										y									= {};
+		uint32_t										width								= {};
+	};
 	struct AtlasTexture {
-		std::vector<Color8>								data								= {};
+		std::vector<uint8_t>							data								= {};	// Glyph coverage, one byte per texel.
 		uint32_t										index								= {};
-		uint32_t										previous_row_height					= {};
-		uint32_t										current_row_height					= {};
-		uint32_t										current_write_location				= {};
+		std::vector<SkylineNode>						skyline								= {};
 	};
 	struct AtlasLocation {
 		AtlasTexture								*	atlas_ptr							= {};
 		uint32_t										atlas_index							= {};
 		Rect2u											location							= {};
 	};
+	struct PendingAtlasRegion {
+		uint32_t										atlas_index							= {};
+		Rect2u											location							= {};
+	};
 	struct FaceInfo {
 		FT_Face											face								= {};
 		std::vector<GlyphInfo>							glyph_infos							= {};
-		std::map<int32_t, int32_t>						charmap								= {};	// link character to a GlyphInfo vector
+		CharacterMap									charmap								= {};	// Link character to a GlyphInfo vector.
+		std::vector<bool>								glyph_rasterized					= {};	// Only used with dynamic glyph cache.
 		uint32_t										fallback_glyph_index				= {};
+		float											ascender							= {};	// Distance from baseline to top of the line, positive.
+		float											descender							= {};	// Distance from baseline to bottom of the line, positive.
+		float											line_height							= {};	// Distance between baselines.
+		std::vector<std::pair<uint64_t, float>>			kerning_pairs						= {};	// Sorted by left glyph index << 32 | right glyph index.
+		std::vector<uint32_t>							glyph_table_indices					= {};	// Glyph table entry per glyph index, UINT32_MAX if none.
+		std::vector<uint32_t>							glyph_table_glyphs					= {};	// Glyph index per glyph table entry.
+		uint64_t										glyph_table_generation				= {};
+	};
+	struct TextMeshCacheEntry {
+		Text											text								= {};
+		float											kerning								= {};
+		glm::vec2										scale								= {};
+		bool											vertical							= {};
+		uint32_t										font_face							= {};
+		TextureResource								*	texture								= {};
+		uint64_t										last_use							= {};
+		Mesh											mesh								= {};
 	};
 
+	size_t												CalculateTextMeshCacheKey(
+		const Text									&	text,
+		float											kerning,
+		glm::vec2										scale,
+		bool											vertical,
+		uint32_t										font_face ) const;
+
+	bool												RasterizeGlyph(
+		uint32_t										face_index,
+		uint32_t										glyph_index );
+
+	// Renders glyphs, { face index, glyph index }, using idle loader
+	// threads as well. Results are in the same order as the glyphs.
+	bool												RasterizeGlyphsInParallel(
+		ThreadLoaderResource						*	loader_thread_resource,
+		const std::vector<std::pair<uint32_t, uint32_t>>	&	glyphs,
+		std::vector<RasterizedGlyph>				&	out_rasterized_glyphs );
+
+	// Places a rendered glyph into the atlas and creates its glyph info.
+	bool												AddRasterizedGlyph(
+		uint32_t										face_index,
+		uint32_t										glyph_index,
+		const RasterizedGlyph						&	rasterized_glyph );
+
+	// Restores glyphs and atlas textures from a font atlas cache file.
+	void												LoadFromAtlasCache(
+		FontAtlasCacheData							&&	cache_data,
+		std::vector<std::vector<uint8_t>>			&&	cache_atlas_layers );
+
+	bool												SaveToAtlasCache(
+		const std::filesystem::path					&	cache_file_path,
+		const FontAtlasCacheKey						&	cache_key,
+		const std::vector<std::vector<std::pair<uint32_t, uint32_t>>>	&	face_character_glyph_pairs );
+
+	// Picks the atlas size that fits the estimated glyph area into the
+	// least memory using at most FONT_ATLAS_MAX_PREFERRED_LAYER_COUNT layers.
+	uint32_t											ChooseAtlasSize(
+		uint64_t										estimated_glyph_area,
+		uint32_t										largest_glyph_dimension,
+		uint32_t										min_texture_size,
+		uint32_t										max_texture_size ) const;
+
+	void												BuildKerningTable(
+		uint32_t										face_index );
+
+	TextureResource									*	CreateTextureResourceFromAtlas();
+
 	AtlasTexture									*	CreateNewAtlasTexture();
 
+	// Skyline bottom-left packing, finds the lowest position where the
+	// rectangle fits. Returns false if it doesn't fit into this atlas.
+	bool												FindSkylineLocation(
+		const AtlasTexture							&	atlas_texture,
+		glm::uvec2										size,
+		size_t										&	out_node_index,
+		glm::uvec2									&	out_location ) const;
+
+	void												AddSkylineLevel(
+		AtlasTexture								&	atlas_texture,
+		size_t											node_index,
+		glm::uvec2										location,
+		glm::uvec2										size );
+
 	AtlasLocation										ReserveSpaceForGlyphFromAtlasTextures(
-		FT_GlyphSlot									glyph,
+		glm::uvec2										glyph_size,
 		uint32_t										glyph_atlas_padding );
 
 	void												CopyGlyphTextureToAtlasLocation(
 		AtlasLocation									atlas_location,
-		const std::vector<Color8>					&	converted_texture_data );
+		const std::vector<uint8_t>					&	converted_texture_data );
 
 	// Does everything.
 	AtlasLocation										AttachGlyphToAtlas(
-		FT_GlyphSlot									glyph,
+		glm::uvec2										glyph_size,
 		uint32_t										glyph_atlas_padding,
-		const std::vector<Color8>					&	converted_texture_data );
+		const std::vector<uint8_t>					&	converted_texture_data );
 
 	FontResource									*	my_interface						= {};
 	ResourceManagerImpl								*	resource_manager					= {};
@@ -127,15 +439,35 @@ private:
 	uint32_t											glyph_texel_size					= {};
 	uint32_t											glyph_atlas_padding					= {};
 	uint32_t											fallback_character					= {};
+	bool												use_dynamic_glyph_cache				= {};
+	std::vector<uint32_t>								preload_characters					= {};
+	GlyphAtlasType										glyph_atlas_type					= {};
+	std::filesystem::path								atlas_cache_directory				= {};
 
 	uint32_t											atlas_size							= {};
+	double												glyph_size_bitmap_size_ratio		= {};
 
-	AtlasTexture									*	current_atlas_texture				= {};
 	std::vector<std::unique_ptr<AtlasTexture>>			atlas_textures						= {};
+	uint64_t											rasterized_glyph_count				= {};
+	uint64_t											glyph_texel_count					= {};
 	std::vector<FaceInfo>								face_infos							= {};
+	std::vector<uint8_t>								font_file_data						= {};	// Every FT_Face refers to this, must outlive them.
 
 	TextureResource									*	texture_resource					= {};
 
+	// Dynamic glyph cache. New glyphs are copied into the current texture,
+	// a new texture resource generation is only created when the atlas
+	// grows layers. Older generations are handed over for destruction by
+	// CmdUploadPendingGlyphs() once they have been replaced.
+	std::mutex											glyph_cache_mutex					= {};
+	std::vector<PendingAtlasRegion>						pending_atlas_regions				= {};	// Added since the current texture generation was created.
+	TextureResource									*	pending_texture_resource			= {};
+	std::vector<TextureResource*>						retired_texture_resources			= {};	// Replaced, may still be used by recorded command buffers.
+
+	std::mutex											text_mesh_cache_mutex				= {};
+	std::map<size_t, TextMeshCacheEntry>				text_mesh_cache						= {};
+	uint64_t											text_mesh_cache_use_counter			= {};
+
 	bool												is_good								= {};
 };
 
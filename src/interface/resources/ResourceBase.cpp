@@ -177,3 +177,16 @@ bool vk2d::vk2d_internal::ResourceImplBase::IsSubResource() const
 {
 	return !!parent_resource;
 }
+
+bool vk2d::vk2d_internal::ResourceImplBase::ReleaseSubresource(
+	ResourceBase		*	subresource
+)
+{
+	std::lock_guard<std::mutex> lock_guard( subresources_mutex );
+
+	auto it = std::find( subresources.begin(), subresources.end(), subresource );
+	if( it == subresources.end() ) return false;
+
+	subresources.erase( it );
+	return true;
+}
@@ -106,6 +106,13 @@ protected:
 	// true then resource manager should not delete this resource directly.
 	bool													IsSubResource() const;
 
+	// Internal use only.
+	// Removes a subresource from this resource without destroying it, the
+	// caller becomes responsible for destroying it with the resource manager.
+	// Returns false if subresource is not a subresource of this resource.
+	bool													ReleaseSubresource(
+		ResourceBase									*	subresource );
+
 	Fence													load_function_run_fence;
 	std::atomic<ResourceStatus>								status								= {};
 	ResourceBase										*	my_interface						= {};
@@ -14,6 +14,7 @@
 #include "interface/resources/TextureResource.h"
 
 #include "interface/resources/FontResource.h"
+#include "interface/resources/FontResourceImpl.h"
 
 
 
@@ -87,6 +88,20 @@ VK2D_API vk2d::TextureResource * vk2d::ResourceManager::CreateArrayTextureResour
 	);
 }
 
+VK2D_API vk2d::TextureResource * vk2d::ResourceManager::CreateArrayTextureResource(
+	glm::uvec2											size,
+	TextureFormat										format,
+	const std::vector<const std::vector<uint8_t>*>	&	texels_listing
+)
+{
+	return impl->CreateArrayTextureResource(
+		size,
+		format,
+		texels_listing,
+		nullptr
+	);
+}
+
 VK2D_API vk2d::TextureResource * vk2d::ResourceManager::LoadArrayTextureResource(
 	const std::vector<std::filesystem::path>		&	file_path_listing
 )
@@ -102,7 +117,11 @@ VK2D_API vk2d::FontResource * vk2d::ResourceManager::LoadFontResource(
 	uint32_t							glyph_texel_size,
 	bool								use_alpha,
 	uint32_t							fallback_character,
-	uint32_t							glyph_atlas_padding
+	uint32_t							glyph_atlas_padding,
+	bool								use_dynamic_glyph_cache,
+	const std::vector<uint32_t>		&	preload_characters,
+	GlyphAtlasType						glyph_atlas_type,
+	const std::filesystem::path		&	atlas_cache_directory
 )
 {
 	return impl->LoadFontResource(
@@ -111,7 +130,11 @@ VK2D_API vk2d::FontResource * vk2d::ResourceManager::LoadFontResource(
 		glyph_texel_size,
 		use_alpha,
 		fallback_character,
-		glyph_atlas_padding
+		glyph_atlas_padding,
+		use_dynamic_glyph_cache,
+		preload_characters,
+		glyph_atlas_type,
+		atlas_cache_directory
 	);
 }
 
@@ -211,6 +234,11 @@ vk2d::vk2d_internal::ResourceManagerImpl::ResourceManagerImpl(
 
 vk2d::vk2d_internal::ResourceManagerImpl::~ResourceManagerImpl()
 {
+	{
+		std::lock_guard<std::mutex> dynamic_glyph_cache_fonts_lock( dynamic_glyph_cache_fonts_mutex );
+		dynamic_glyph_cache_fonts.clear();
+	}
+
 	// Wait for all resources to finish loading, giving time to finish.
 	while( true ) {
 		bool all_resources_status_determined = true;
@@ -348,13 +376,45 @@ vk2d::TextureResource * vk2d::vk2d_internal::ResourceManagerImpl::CreateArrayTex
 	return AttachResource( std::move( resource ) );
 }
 
+vk2d::TextureResource * vk2d::vk2d_internal::ResourceManagerImpl::CreateArrayTextureResource(
+	glm::uvec2											size,
+	TextureFormat										format,
+	const std::vector<const std::vector<uint8_t>*>	&	texture_data_listings,
+	ResourceBase									*	parent_resource )
+{
+	std::lock_guard<std::recursive_mutex>		resources_lock( resources_mutex );
+
+	auto resource		=
+		std::unique_ptr<TextureResource>(
+			new TextureResource(
+				this,
+				SelectLoaderThread(),
+				parent_resource,
+				size,
+				format,
+				texture_data_listings
+			)
+			);
+	if( !resource || !resource->IsGood() ) {
+		// Could not create resource.
+		GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource handle!" );
+		return nullptr;
+	}
+
+	return AttachResource( std::move( resource ) );
+}
+
 vk2d::FontResource * vk2d::vk2d_internal::ResourceManagerImpl::LoadFontResource(
 	const std::filesystem::path			&	file_path,
 	ResourceBase					*	parent_resource,
 	uint32_t								glyph_texel_size,
 	bool									use_alpha,
 	uint32_t								fallback_character,
-	uint32_t								glyph_atlas_padding
+	uint32_t								glyph_atlas_padding,
+	bool									use_dynamic_glyph_cache,
+	const std::vector<uint32_t>			&	preload_characters,
+	GlyphAtlasType							glyph_atlas_type,
+	const std::filesystem::path			&	atlas_cache_directory
 )
 {
 	std::lock_guard<std::recursive_mutex>		resources_lock( resources_mutex );
@@ -369,7 +429,11 @@ vk2d::FontResource * vk2d::vk2d_internal::ResourceManagerImpl::LoadFontResource(
 				glyph_texel_size,
 				use_alpha,
 				fallback_character,
-				glyph_atlas_padding
+				glyph_atlas_padding,
+				use_dynamic_glyph_cache,
+				preload_characters,
+				glyph_atlas_type,
+				atlas_cache_directory
 			)
 			);
 	if( !resource || !resource->IsGood() ) {
@@ -378,6 +442,11 @@ vk2d::FontResource * vk2d::vk2d_internal::ResourceManagerImpl::LoadFontResource(
 		return nullptr;
 	}
 
+	if( use_dynamic_glyph_cache ) {
+		std::lock_guard<std::mutex> dynamic_glyph_cache_fonts_lock( dynamic_glyph_cache_fonts_mutex );
+		dynamic_glyph_cache_fonts.push_back( resource->impl.get() );
+	}
+
 	return AttachResource( std::move( resource ) );
 }
 
@@ -387,6 +456,15 @@ void vk2d::vk2d_internal::ResourceManagerImpl::DestroyResource(
 {
 	if( !resource ) return;
 
+	// Stop flushing glyphs before anything else, flushing creates subresources.
+	{
+		std::lock_guard<std::mutex> dynamic_glyph_cache_fonts_lock( dynamic_glyph_cache_fonts_mutex );
+		std::erase_if(
+			dynamic_glyph_cache_fonts,
+			[ resource ]( FontResourceImpl * font ) { return static_cast<ResourceImplBase*>( font ) == resource->resource_impl; }
+		);
+	}
+
 	// We'll have to wait until the resource is definitely loaded, or encountered an error.
 	resource->resource_impl->WaitUntilLoaded();
 	resource->resource_impl->DestroySubresources();
@@ -407,6 +485,29 @@ void vk2d::vk2d_internal::ResourceManagerImpl::DestroyResource(
 	}
 }
 
+void vk2d::vk2d_internal::ResourceManagerImpl::FlushPendingFontGlyphs()
+{
+	std::lock_guard<std::mutex> dynamic_glyph_cache_fonts_lock( dynamic_glyph_cache_fonts_mutex );
+	for( auto font : dynamic_glyph_cache_fonts ) {
+		font->FlushPendingGlyphs();
+	}
+}
+
+bool vk2d::vk2d_internal::ResourceManagerImpl::CmdUploadPendingFontGlyphs(
+	VkCommandBuffer								command_buffer,
+	std::vector<CompleteBufferResource>		&	out_staging_buffers,
+	std::vector<TextureResource*>			&	out_retired_texture_resources
+)
+{
+	std::lock_guard<std::mutex> dynamic_glyph_cache_fonts_lock( dynamic_glyph_cache_fonts_mutex );
+	for( auto font : dynamic_glyph_cache_fonts ) {
+		if( !font->CmdUploadPendingGlyphs( command_buffer, out_staging_buffers, out_retired_texture_resources ) ) {
+			return false;
+		}
+	}
+	return true;
+}
+
 vk2d::vk2d_internal::InstanceImpl * vk2d::vk2d_internal::ResourceManagerImpl::GetInstance() const
 {
 	return instance;
@@ -3,8 +3,11 @@
 #include "core/SourceCommon.h"
 
 #include "system/ThreadPool.h"
+#include "system/VulkanMemoryManagement.h"
 
 #include "types/Color.hpp"
+#include "types/GlyphAtlasType.h"
+#include "types/TextureFormat.h"
 
 namespace vk2d {
 
@@ -19,6 +22,7 @@ class InstanceImpl;
 class ResourceManagerImpl;
 class ThreadPool;
 class ResourceImplBase;
+class FontResourceImpl;
 
 
 
@@ -82,17 +86,40 @@ public:
 		const std::vector<const std::vector<Color8>*>	&	texture_data_listings,
 		ResourceBase									*	parent_resource );
 
+	TextureResource										*	CreateArrayTextureResource(
+		glm::uvec2											size,
+		TextureFormat										format,
+		const std::vector<const std::vector<uint8_t>*>	&	texture_data_listings,
+		ResourceBase									*	parent_resource );
+
 	FontResource										*	LoadFontResource(
 		const std::filesystem::path						&	file_path,
 		ResourceBase									*	parent_resource,
 		uint32_t											glyph_texel_size,
 		bool												use_alpha,
 		uint32_t											fallback_character,
-		uint32_t											glyph_atlas_padding );
+		uint32_t											glyph_atlas_padding,
+		bool												use_dynamic_glyph_cache,
+		const std::vector<uint32_t>						&	preload_characters,
+		GlyphAtlasType										glyph_atlas_type,
+		const std::filesystem::path						&	atlas_cache_directory );
 
 	void													DestroyResource(
 		ResourceBase									*	resource );
 
+	// Uploads glyphs added to dynamic glyph cache fonts since the previous call.
+	// Called at frame boundaries from the main thread.
+	void													FlushPendingFontGlyphs();
+
+	// Records copies of glyphs added to dynamic glyph cache fonts since the
+	// previous call. Called from the main thread. Staging buffers and font
+	// textures replaced since the previous call must be destroyed once the
+	// command buffer has finished executing.
+	bool													CmdUploadPendingFontGlyphs(
+		VkCommandBuffer										command_buffer,
+		std::vector<CompleteBufferResource>				&	out_staging_buffers,
+		std::vector<TextureResource*>					&	out_retired_texture_resources );
+
 	InstanceImpl										*	GetInstance() const;
 	ThreadPool											*	GetThreadPool() const;
 	const std::vector<uint32_t>							&	GetLoaderThreads() const;
@@ -144,6 +171,9 @@ private:
 	std::recursive_mutex									resources_mutex						= {};
 	std::list<std::unique_ptr<ResourceBase>>				resources							= {};
 
+	std::mutex												dynamic_glyph_cache_fonts_mutex		= {};
+	std::vector<FontResourceImpl*>							dynamic_glyph_cache_fonts			= {};
+
 	bool													is_good								= {};
 };
 
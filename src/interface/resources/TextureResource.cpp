@@ -4,6 +4,7 @@
 #include "system/ThreadPrivateResources.h"
 #include "system/DescriptorSet.h"
 #include "system/CommonTools.h"
+#include "system/MipmapGeneration.h"
 #include "system/ImageFormatConverter.hpp"
 
 #include "interface/Instance.h"
@@ -19,6 +20,67 @@
 
 
 
+namespace vk2d {
+namespace vk2d_internal {
+
+VkFormat GetVulkanFormat( TextureFormat format )
+{
+	switch( format ) {
+		case TextureFormat::R8G8B8A8_UNORM:		return VK_FORMAT_R8G8B8A8_UNORM;
+		case TextureFormat::R8G8_UNORM:			return VK_FORMAT_R8G8_UNORM;
+		case TextureFormat::R8_UNORM:			return VK_FORMAT_R8_UNORM;
+		default:
+			assert( 0 && "Unknown texture format" );
+			return VK_FORMAT_R8G8B8A8_UNORM;
+	}
+}
+
+uint32_t GetTexelByteSize( TextureFormat format )
+{
+	switch( format ) {
+		case TextureFormat::R8G8B8A8_UNORM:		return 4;
+		case TextureFormat::R8G8_UNORM:			return 2;
+		case TextureFormat::R8_UNORM:			return 1;
+		default:
+			assert( 0 && "Unknown texture format" );
+			return 4;
+	}
+}
+
+// Formats with less than 4 channels are expanded to RGBA in the image view
+// so shaders can sample every texture the same way.
+VkComponentMapping GetComponentMapping( TextureFormat format )
+{
+	switch( format ) {
+		case TextureFormat::R8G8_UNORM:
+			return {
+				VK_COMPONENT_SWIZZLE_R,
+				VK_COMPONENT_SWIZZLE_R,
+				VK_COMPONENT_SWIZZLE_R,
+				VK_COMPONENT_SWIZZLE_G
+			};
+		case TextureFormat::R8_UNORM:
+			return {
+				VK_COMPONENT_SWIZZLE_ONE,
+				VK_COMPONENT_SWIZZLE_ONE,
+				VK_COMPONENT_SWIZZLE_ONE,
+				VK_COMPONENT_SWIZZLE_R
+			};
+		default:
+			return {
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY
+			};
+	}
+}
+
+} // vk2d_internal
+} // vk2d
+
+
+
 
 
 
@@ -87,6 +149,34 @@ VK2D_API vk2d::TextureResource::TextureResource(
 	texture_impl	= impl.get();
 }
 
+VK2D_API vk2d::TextureResource::TextureResource(
+	vk2d_internal::ResourceManagerImpl				*	resource_manager,
+	uint32_t											loader_thread,
+	ResourceBase									*	parent_resource,
+	glm::uvec2											size,
+	TextureFormat										format,
+	const std::vector<const std::vector<uint8_t>*>	&	texels_listing
+)
+{
+	impl = std::make_unique<vk2d_internal::TextureResourceImpl>(
+		this,
+		resource_manager,
+		loader_thread,
+		nullptr,
+		size,
+		format,
+		texels_listing
+	);
+	if( !impl || !impl->IsGood() ) {
+		impl	= nullptr;
+		resource_manager->GetInstance()->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource implementation!" );
+		return;
+	}
+
+	resource_impl	= impl.get();
+	texture_impl	= impl.get();
+}
+
 VK2D_API vk2d::TextureResource::~TextureResource()
 {}
 
@@ -190,6 +280,41 @@ vk2d::vk2d_internal::TextureResourceImpl::TextureResourceImpl(
 	this->resource_manager			= resource_manager;
 
 	this->extent				= { size.x, size.y };
+	this->texture_format		= TextureFormat::R8G8B8A8_UNORM;
+	this->texture_data.resize( texels.size() );
+	for( size_t i = 0; i < texels.size(); ++i ) {
+		auto & src				= *( texels[ i ] );
+		this->texture_data[ i ].resize( src.size() * sizeof( Color8 ) );
+		std::memcpy( this->texture_data[ i ].data(), src.data(), src.size() * sizeof( Color8 ) );
+	}
+
+	is_good						= true;
+}
+
+vk2d::vk2d_internal::TextureResourceImpl::TextureResourceImpl(
+	TextureResource									*	my_interface,
+	ResourceManagerImpl								*	resource_manager,
+	uint32_t											loader_thread,
+	ResourceBase									*	parent_resource,
+	glm::uvec2											size,
+	TextureFormat										format,
+	const std::vector<const std::vector<uint8_t>*>	&	texels
+) :
+	ResourceImplBase(
+		my_interface,
+		loader_thread,
+		resource_manager,
+		parent_resource
+	)
+{
+	assert( my_interface );
+	assert( resource_manager );
+
+	this->my_interface				= my_interface;
+	this->resource_manager			= resource_manager;
+
+	this->extent				= { size.x, size.y };
+	this->texture_format		= format;
 	this->texture_data.resize( texels.size() );
 	for( size_t i = 0; i < texels.size(); ++i ) {
 		this->texture_data[ i ]	= *( texels[ i ] );
@@ -230,12 +355,49 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 
 	auto instance		= resource_manager->GetInstance();
 
+	auto vk_format		= GetVulkanFormat( texture_format );
+	auto texel_size		= GetTexelByteSize( texture_format );
+
 	auto primary_render_queue_family_index		= instance->GetPrimaryRenderQueue().GetQueueFamilyIndex();
 	auto secondary_render_queue_family_index	= instance->GetSecondaryRenderQueue().GetQueueFamilyIndex();
 	auto primary_transfer_queue_family_index	= instance->GetPrimaryTransferQueue().GetQueueFamilyIndex();
 
 	bool is_primary_render_needed				= secondary_render_queue_family_index != primary_render_queue_family_index;
 
+	// Texel data is written directly into the loader thread's persistently mapped staging
+	// arena, a dedicated staging buffer is only created if the arena can't fit the data.
+	auto staging_buffer_arena					= loader_thread_resource->GetStagingBufferArena();
+	auto staging_alignment						= std::max(
+		memory_pool->GetPhysicalDeviceProperties().limits.optimalBufferCopyOffsetAlignment,
+		VkDeviceSize( texel_size )
+	);
+	auto CreateStagingLocation =[ this, staging_buffer_arena, staging_alignment, memory_pool, instance ](
+		const void			*	data,
+		VkDeviceSize			byte_size
+		) -> bool
+	{
+		auto allocation = staging_buffer_arena->Allocate( byte_size, staging_alignment );
+		if( allocation.IsValid() ) {
+			std::memcpy( allocation.mapped_data, data, byte_size );
+			staging_locations.push_back( { allocation.buffer, allocation.offset } );
+			staging_allocations.push_back( allocation );
+			return true;
+		}
+
+		auto staging_buffer = memory_pool->CreateCompleteHostBufferResourceWithData(
+			reinterpret_cast<const uint8_t*>( data ),
+			byte_size,
+			VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+		);
+		if( staging_buffer != VK_SUCCESS ) {
+			instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource staging buffer!" );
+			return false;
+		}
+		staging_locations.push_back( { staging_buffer.buffer, 0 } );
+		staging_buffers.push_back( std::move( staging_buffer ) );
+		return true;
+	};
+
 	if( IsFromFile() ) {
 		// 1. Load and process images from files.
 
@@ -271,21 +433,16 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				}
 			}
 
-			// 2. Create staging buffer, we'll also need memory pool for this.
+			// 2. Copy to staging memory.
 
-			auto staging_buffer = memory_pool->CreateCompleteHostBufferResourceWithData(
+			auto is_staged = CreateStagingLocation(
 				stbi_image_data,
-				VkDeviceSize( image_size_x ) * VkDeviceSize( image_size_y ) * VkDeviceSize( image_channel_count ),
-				VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+				VkDeviceSize( image_size_x ) * VkDeviceSize( image_size_y ) * VkDeviceSize( image_channel_count )
 			);
 
 			stbi_image_free( stbi_image_data );
 
-			if( staging_buffer != VK_SUCCESS ) {
-				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource staging buffer!" );
-				return false;
-			}
-			staging_buffers.push_back( std::move( staging_buffer ) );
+			if( !is_staged ) return false;
 
 			// Set image extent so we'll know it later
 			extent				= { uint32_t( image_size_x ), uint32_t( image_size_y ) };
@@ -301,27 +458,22 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 			// Image extent already set by resource manager, we can just use it.
 			image_info.x		= extent.width;
 			image_info.y		= extent.height;
-			image_info.channels	= 4;
+			image_info.channels	= texel_size;
 
-			if( texture_data[ i ].size() < size_t( image_info.x ) * size_t( image_info.y ) ) {
+			if( texture_data[ i ].size() < size_t( image_info.x ) * size_t( image_info.y ) * size_t( texel_size ) ) {
 				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Cannot create texture: Texture data too small for texture" );
 				return false;
 			}
 
-			auto staging_buffer = memory_pool->CreateCompleteHostBufferResourceWithData(
-				texture_data[ i ],
-				VK_BUFFER_USAGE_TRANSFER_SRC_BIT
+			auto is_staged = CreateStagingLocation(
+				texture_data[ i ].data(),
+				VkDeviceSize( image_info.x ) * VkDeviceSize( image_info.y ) * VkDeviceSize( texel_size )
 			);
-
-			if( staging_buffer != VK_SUCCESS ) {
-				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource staging buffer!" );
-				return false;
-			}
-			staging_buffers.push_back( std::move( staging_buffer ) );
+			if( !is_staged ) return false;
 		}
 	}
 
-	image_layer_count		= uint32_t( staging_buffers.size() );
+	image_layer_count		= uint32_t( staging_locations.size() );
 	if( !image_layer_count ) {
 		instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot load texture, nothing to do!" );
 		return false;
@@ -331,19 +483,31 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 	auto mipmap_levels = GenerateMipSizes(
 		glm::uvec2( image_info.x, image_info.y )
 	);
+	mip_level_count		= uint32_t( mipmap_levels.size() );
+
+	// Mipmaps are generated with compute shaders in the secondary render queue
+	// if possible, otherwise they're blitted one mip level at a time.
+	bool use_compute_mipmap_generation	= std::size( mipmap_levels ) > 1 && IsComputeMipmapGenerationSupported(
+		instance,
+		vk_format,
+		instance->GetSecondaryRenderQueue()
+	);
 	{
 		VkImageCreateInfo image_create_info {};
 		image_create_info.sType						= VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
 		image_create_info.pNext						= nullptr;
 		image_create_info.flags						= 0;
 		image_create_info.imageType					= VK_IMAGE_TYPE_2D;
-		image_create_info.format					= VK_FORMAT_R8G8B8A8_UNORM;
+		image_create_info.format					= vk_format;
 		image_create_info.extent					= { image_info.x, image_info.y, 1 };
 		image_create_info.mipLevels					= uint32_t( mipmap_levels.size() );
 		image_create_info.arrayLayers				= image_layer_count;
 		image_create_info.samples					= VK_SAMPLE_COUNT_1_BIT;
 		image_create_info.tiling					= VK_IMAGE_TILING_OPTIMAL;
 		image_create_info.usage						= VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+		if( use_compute_mipmap_generation ) {
+			image_create_info.usage					|= VK_IMAGE_USAGE_STORAGE_BIT;
+		}
 		image_create_info.sharingMode				= VK_SHARING_MODE_EXCLUSIVE;
 		image_create_info.queueFamilyIndexCount		= 0;
 		image_create_info.pQueueFamilyIndices		= nullptr;
@@ -355,13 +519,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 		image_view_create_info.flags				= 0;
 		image_view_create_info.image				= VK_NULL_HANDLE;	// CreateCompleteImageResource() will replace this with proper image handle
 		image_view_create_info.viewType				= VK_IMAGE_VIEW_TYPE_2D_ARRAY;
-		image_view_create_info.format				= VK_FORMAT_R8G8B8A8_UNORM;
-		image_view_create_info.components			= {
-			VK_COMPONENT_SWIZZLE_IDENTITY,
-			VK_COMPONENT_SWIZZLE_IDENTITY,
-			VK_COMPONENT_SWIZZLE_IDENTITY,
-			VK_COMPONENT_SWIZZLE_IDENTITY
-		};
+		image_view_create_info.format				= vk_format;
+		image_view_create_info.components			= GetComponentMapping( texture_format );
 		image_view_create_info.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
 		image_view_create_info.subresourceRange.baseMipLevel	= 0;
 		image_view_create_info.subresourceRange.levelCount		= image_create_info.mipLevels;
@@ -377,6 +536,20 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 			instance->Report( image.result, "Internal error: Cannot create texture resource image!" );
 			return false;
 		}
+
+		if( use_compute_mipmap_generation ) {
+			mip_level_views = CreateMipLevelImageViews(
+				instance,
+				image.image,
+				vk_format,
+				uint32_t( std::size( mipmap_levels ) ),
+				image_layer_count
+			);
+			if( std::empty( mip_level_views ) ) {
+				instance->Report( ReportSeverity::NON_CRITICAL_ERROR, "Internal error: Cannot create texture resource mip level image views!" );
+				return false;
+			}
+		}
 	}
 
 	// 4. Allocate a command buffer from thread resources
@@ -486,6 +659,16 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 	// 5. Record commands to upload image into the GPU.
 	// This gets very memory barrier heavy because of all the image layout transitions and
 	// individually blitting mip levels from previously blitted mip level.
+	//
+	// Uploads are always recorded into the transfer queue so that heavy streaming can run on
+	// a dedicated transfer engine, parallel to rendering, if the hardware has one. Mipmaps are
+	// then generated in the secondary render queue, with compute shaders if supported, or by
+	// blitting which requires graphics capabilities.
+	// If the queues come from different families, image ownership is released from the
+	// source family and acquired by the destination family with matching barriers, the
+	// semaphores between the submissions guarantee the release happens before the acquire.
+	bool is_transfer_to_secondary_handover_needed	= primary_transfer_queue_family_index != secondary_render_queue_family_index;
+	bool is_secondary_to_primary_handover_needed	= is_primary_render_needed;
 	{
 		// 5.1 Record transfer commands.
 		{
@@ -495,7 +678,7 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				image_memory_barrier.pNext								= nullptr;
 				image_memory_barrier.srcAccessMask						= 0;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
+				image_memory_barrier.dstAccessMask						= VK_ACCESS_TRANSFER_WRITE_BIT;
 				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_UNDEFINED;
 				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 				image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
@@ -508,8 +691,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 				vkCmdPipelineBarrier(
 					vk_primary_transfer_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+					VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+					VK_PIPELINE_STAGE_TRANSFER_BIT,
 					0,
 					0, nullptr,
 					0, nullptr,
@@ -520,7 +703,7 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 			// Copy to mip level 0, all layers
 			for( uint32_t i = 0; i < image_layer_count; ++i ) {
 				VkBufferImageCopy copy_region {};
-				copy_region.bufferOffset					= 0;
+				copy_region.bufferOffset					= staging_locations[ i ].second;
 				copy_region.bufferRowLength					= 0;
 				copy_region.bufferImageHeight				= 0;
 				copy_region.imageSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
@@ -531,7 +714,7 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				copy_region.imageExtent						= { image_info.x, image_info.y, 1 };
 				vkCmdCopyBufferToImage(
 					vk_primary_transfer_command_buffer,
-					staging_buffers[ i ].buffer,
+					staging_locations[ i ].first,
 					image.image,
 					VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
 					1,
@@ -540,17 +723,20 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 			}
 		}
 
-		// We might need to change image queue family ownership
-		if( primary_transfer_queue_family_index != secondary_render_queue_family_index ) {
+		// We might need to change image queue family ownership from transfer to secondary render.
+		if( is_transfer_to_secondary_handover_needed ) {
 			// Ownership is transferred by writing the same pipeline barrier twice to
 			// two different command buffers from two different families and setting
 			// srcQueueFamilyIndex dstQueueFamilyIndex members to appropriate families.
+			// Release half only needs to make the copy writes available, acquire half
+			// only needs to make them visible to the blits. Layouts must match exactly.
 			{
+				// Release.
 				VkImageMemoryBarrier image_memory_barrier {};
 				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				image_memory_barrier.pNext								= nullptr;
-				image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
+				image_memory_barrier.srcAccessMask						= VK_ACCESS_TRANSFER_WRITE_BIT;
+				image_memory_barrier.dstAccessMask						= 0;
 				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 				image_memory_barrier.srcQueueFamilyIndex				= primary_transfer_queue_family_index;
@@ -563,8 +749,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 				vkCmdPipelineBarrier(
 					vk_primary_transfer_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+					VK_PIPELINE_STAGE_TRANSFER_BIT,
+					VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
 					0,
 					0, nullptr,
 					0, nullptr,
@@ -572,11 +758,12 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				);
 			}
 			{
+				// Acquire.
 				VkImageMemoryBarrier image_memory_barrier {};
 				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				image_memory_barrier.pNext								= nullptr;
-				image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
+				image_memory_barrier.srcAccessMask						= 0;
+				image_memory_barrier.dstAccessMask						= VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT;
 				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 				image_memory_barrier.srcQueueFamilyIndex				= primary_transfer_queue_family_index;
@@ -589,8 +776,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 				vkCmdPipelineBarrier(
 					vk_secondary_render_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+					VK_PIPELINE_STAGE_TRANSFER_BIT,
+					VK_PIPELINE_STAGE_TRANSFER_BIT,
 					0,
 					0, nullptr,
 					0, nullptr,
@@ -601,33 +788,34 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 
 		// 6. Record commands to make mipmaps of the image in the GPU.
 		{
-			for( uint32_t current_mip_level = 1; current_mip_level < uint32_t( mipmap_levels.size() ); ++current_mip_level ) {
-				auto src_mip_level							= current_mip_level - 1;
-				auto dst_mip_level							= current_mip_level;
-				auto src_mipmap_extent						= mipmap_levels[ src_mip_level ];
-				auto dst_mipmap_extent						= mipmap_levels[ dst_mip_level ];
-
-				// Transition current image layout for current mipmap level from transfer dst optimal to transfer src optimal
+			// If the image is handed over to the primary render queue afterwards, shader reads
+			// happen there and the final transitions only need to chain into the release barrier.
+			VkPipelineStageFlags	shader_read_stage		= is_secondary_to_primary_handover_needed ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+			VkAccessFlags			shader_read_access		= is_secondary_to_primary_handover_needed ? 0 : VK_ACCESS_SHADER_READ_BIT;
+
+			if( use_compute_mipmap_generation ) {
+				// Compute shader generates several mip levels per dispatch, storage images
+				// need general layout. Mip level 0 is read, the rest are written.
 				{
 					VkImageMemoryBarrier image_memory_barrier {};
 					image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 					image_memory_barrier.pNext								= nullptr;
-					image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_WRITE_BIT;
-					image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
+					image_memory_barrier.srcAccessMask						= VK_ACCESS_TRANSFER_WRITE_BIT;
+					image_memory_barrier.dstAccessMask						= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
 					image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-					image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+					image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_GENERAL;
 					image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
 					image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
 					image_memory_barrier.image								= image.image;
 					image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-					image_memory_barrier.subresourceRange.baseMipLevel		= src_mip_level;
-					image_memory_barrier.subresourceRange.levelCount		= 1;
+					image_memory_barrier.subresourceRange.baseMipLevel		= 0;
+					image_memory_barrier.subresourceRange.levelCount		= uint32_t( mipmap_levels.size() );
 					image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
 					image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 					vkCmdPipelineBarrier(
 						vk_secondary_render_command_buffer,
-						VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-						VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+						VK_PIPELINE_STAGE_TRANSFER_BIT,
+						VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
 						0,
 						0, nullptr,
 						0, nullptr,
@@ -635,55 +823,156 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 					);
 				}
 
-				// Blit here
+				CmdGenerateMipmapsWithCompute(
+					instance,
+					vk_secondary_render_command_buffer,
+					mip_level_views,
+					mipmap_levels,
+					image_layer_count,
+					MipmapFilter::BOX
+				);
+
+				// 7. Make image available in a shader.
 				{
-					VkImageBlit blit_region {};
-					blit_region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-					blit_region.srcSubresource.mipLevel			= src_mip_level;
-					blit_region.srcSubresource.baseArrayLayer	= 0;
-					blit_region.srcSubresource.layerCount		= image_layer_count;
-					blit_region.srcOffsets[ 0 ]					= { 0, 0, 0 };
-					blit_region.srcOffsets[ 1 ]					= { int32_t( src_mipmap_extent.width ), int32_t( src_mipmap_extent.height ), 1 };
-					blit_region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-					blit_region.dstSubresource.mipLevel			= dst_mip_level;
-					blit_region.dstSubresource.baseArrayLayer	= 0;
-					blit_region.dstSubresource.layerCount		= image_layer_count;
-					blit_region.dstOffsets[ 0 ]					= { 0, 0, 0 };
-					blit_region.dstOffsets[ 1 ]					= { int32_t( dst_mipmap_extent.width ), int32_t( dst_mipmap_extent.height ), 1 };
-
-					vkCmdBlitImage(
+					VkImageMemoryBarrier image_memory_barrier {};
+					image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+					image_memory_barrier.pNext								= nullptr;
+					image_memory_barrier.srcAccessMask						= VK_ACCESS_SHADER_WRITE_BIT;
+					image_memory_barrier.dstAccessMask						= shader_read_access;
+					image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_GENERAL;
+					image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+					image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+					image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+					image_memory_barrier.image								= image.image;
+					image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+					image_memory_barrier.subresourceRange.baseMipLevel		= 0;
+					image_memory_barrier.subresourceRange.levelCount		= uint32_t( mipmap_levels.size() );
+					image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
+					image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
+					vkCmdPipelineBarrier(
 						vk_secondary_render_command_buffer,
-						image.image,
-						VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
-						image.image,
-						VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
-						1, &blit_region,
-						VK_FILTER_LINEAR
+						VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+						shader_read_stage,
+						0,
+						0, nullptr,
+						0, nullptr,
+						1, &image_memory_barrier
 					);
 				}
+			} else {
 
-				// 7. Make image available in a shader.
-				// Transition current image layout for current mipmap level from transfer src optimal to shader read only optimal
+				for( uint32_t current_mip_level = 1; current_mip_level < uint32_t( mipmap_levels.size() ); ++current_mip_level ) {
+					auto src_mip_level							= current_mip_level - 1;
+					auto dst_mip_level							= current_mip_level;
+					auto src_mipmap_extent						= mipmap_levels[ src_mip_level ];
+					auto dst_mipmap_extent						= mipmap_levels[ dst_mip_level ];
+
+					// Transition current image layout for current mipmap level from transfer dst optimal to transfer src optimal
+					{
+						VkImageMemoryBarrier image_memory_barrier {};
+						image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+						image_memory_barrier.pNext								= nullptr;
+						image_memory_barrier.srcAccessMask						= VK_ACCESS_TRANSFER_WRITE_BIT;
+						image_memory_barrier.dstAccessMask						= VK_ACCESS_TRANSFER_READ_BIT;
+						image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+						image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+						image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+						image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+						image_memory_barrier.image								= image.image;
+						image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+						image_memory_barrier.subresourceRange.baseMipLevel		= src_mip_level;
+						image_memory_barrier.subresourceRange.levelCount		= 1;
+						image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
+						image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
+						vkCmdPipelineBarrier(
+							vk_secondary_render_command_buffer,
+							VK_PIPELINE_STAGE_TRANSFER_BIT,
+							VK_PIPELINE_STAGE_TRANSFER_BIT,
+							0,
+							0, nullptr,
+							0, nullptr,
+							1, &image_memory_barrier
+						);
+					}
+
+					// Blit here
+					{
+						VkImageBlit blit_region {};
+						blit_region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+						blit_region.srcSubresource.mipLevel			= src_mip_level;
+						blit_region.srcSubresource.baseArrayLayer	= 0;
+						blit_region.srcSubresource.layerCount		= image_layer_count;
+						blit_region.srcOffsets[ 0 ]					= { 0, 0, 0 };
+						blit_region.srcOffsets[ 1 ]					= { int32_t( src_mipmap_extent.width ), int32_t( src_mipmap_extent.height ), 1 };
+						blit_region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+						blit_region.dstSubresource.mipLevel			= dst_mip_level;
+						blit_region.dstSubresource.baseArrayLayer	= 0;
+						blit_region.dstSubresource.layerCount		= image_layer_count;
+						blit_region.dstOffsets[ 0 ]					= { 0, 0, 0 };
+						blit_region.dstOffsets[ 1 ]					= { int32_t( dst_mipmap_extent.width ), int32_t( dst_mipmap_extent.height ), 1 };
+
+						vkCmdBlitImage(
+							vk_secondary_render_command_buffer,
+							image.image,
+							VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+							image.image,
+							VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+							1, &blit_region,
+							VK_FILTER_LINEAR
+						);
+					}
+
+					// 7. Make image available in a shader.
+					// Transition current image layout for current mipmap level from transfer src optimal to shader read only optimal
+					{
+						VkImageMemoryBarrier image_memory_barrier {};
+						image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+						image_memory_barrier.pNext								= nullptr;
+						image_memory_barrier.srcAccessMask						= 0;
+						image_memory_barrier.dstAccessMask						= shader_read_access;
+						image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+						image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+						image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+						image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+						image_memory_barrier.image								= image.image;
+						image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+						image_memory_barrier.subresourceRange.baseMipLevel		= src_mip_level;
+						image_memory_barrier.subresourceRange.levelCount		= 1;
+						image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
+						image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
+						vkCmdPipelineBarrier(
+							vk_secondary_render_command_buffer,
+							VK_PIPELINE_STAGE_TRANSFER_BIT,
+							shader_read_stage,
+							0,
+							0, nullptr,
+							0, nullptr,
+							1, &image_memory_barrier
+						);
+					}
+				}
+
+				// Lastly we'll transition current image layout for last mipmap level from transfer dst optimal to shader read only optimal
 				{
 					VkImageMemoryBarrier image_memory_barrier {};
 					image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 					image_memory_barrier.pNext								= nullptr;
-					image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-					image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-					image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+					image_memory_barrier.srcAccessMask						= VK_ACCESS_TRANSFER_WRITE_BIT;
+					image_memory_barrier.dstAccessMask						= shader_read_access;
+					image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
 					image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 					image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
 					image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
 					image_memory_barrier.image								= image.image;
 					image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-					image_memory_barrier.subresourceRange.baseMipLevel		= src_mip_level;
+					image_memory_barrier.subresourceRange.baseMipLevel		= uint32_t( mipmap_levels.size() - 1 );
 					image_memory_barrier.subresourceRange.levelCount		= 1;
 					image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
 					image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 					vkCmdPipelineBarrier(
 						vk_secondary_render_command_buffer,
-						VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-						VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+						VK_PIPELINE_STAGE_TRANSFER_BIT,
+						shader_read_stage,
 						0,
 						0, nullptr,
 						0, nullptr,
@@ -691,51 +980,23 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 					);
 				}
 			}
-
-			// Lastly we'll transition current image layout for last mipmap level from transfer src optimal to shader read only optimal
-			{
-				VkImageMemoryBarrier image_memory_barrier {};
-				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-				image_memory_barrier.pNext								= nullptr;
-				image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
-				image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
-				image_memory_barrier.image								= image.image;
-				image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
-				image_memory_barrier.subresourceRange.baseMipLevel		= uint32_t( mipmap_levels.size() - 1 );
-				image_memory_barrier.subresourceRange.levelCount		= 1;
-				image_memory_barrier.subresourceRange.baseArrayLayer	= 0;
-				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
-				vkCmdPipelineBarrier(
-					vk_secondary_render_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					0,
-					0, nullptr,
-					0, nullptr,
-					1, &image_memory_barrier
-				);
-			}
 		}
 
-		// We might need to change image queue family ownership
-		if( secondary_render_queue_family_index != primary_render_queue_family_index ) {
-			// Ownership is transferred by writing the same pipeline barrier twice to
-			// two different command buffers from two different families and setting
-			// srcQueueFamilyIndex dstQueueFamilyIndex members to appropriate families.
+		// We might need to change image queue family ownership from secondary render to primary render.
+		if( is_secondary_to_primary_handover_needed ) {
+			// Same as above, release in the secondary render queue and acquire in the
+			// primary render queue. All mip levels are in shader read only layout by now.
 			{
+				// Release.
 				VkImageMemoryBarrier image_memory_barrier {};
 				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				image_memory_barrier.pNext								= nullptr;
-				image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
+				image_memory_barrier.srcAccessMask						= 0;
+				image_memory_barrier.dstAccessMask						= 0;
 				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				image_memory_barrier.srcQueueFamilyIndex				= primary_transfer_queue_family_index;
-				image_memory_barrier.dstQueueFamilyIndex				= secondary_render_queue_family_index;
+				image_memory_barrier.srcQueueFamilyIndex				= secondary_render_queue_family_index;
+				image_memory_barrier.dstQueueFamilyIndex				= primary_render_queue_family_index;
 				image_memory_barrier.image								= image.image;
 				image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
 				image_memory_barrier.subresourceRange.baseMipLevel		= 0;
@@ -744,8 +1005,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 				vkCmdPipelineBarrier(
 					vk_secondary_render_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+					VK_PIPELINE_STAGE_TRANSFER_BIT,
+					VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
 					0,
 					0, nullptr,
 					0, nullptr,
@@ -753,15 +1014,16 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				);
 			}
 			{
+				// Acquire.
 				VkImageMemoryBarrier image_memory_barrier {};
 				image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
 				image_memory_barrier.pNext								= nullptr;
-				image_memory_barrier.srcAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-				image_memory_barrier.dstAccessMask						= VK_ACCESS_MEMORY_READ_BIT;
-				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
-				image_memory_barrier.srcQueueFamilyIndex				= primary_transfer_queue_family_index;
-				image_memory_barrier.dstQueueFamilyIndex				= secondary_render_queue_family_index;
+				image_memory_barrier.srcAccessMask						= 0;
+				image_memory_barrier.dstAccessMask						= VK_ACCESS_SHADER_READ_BIT;
+				image_memory_barrier.oldLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+				image_memory_barrier.newLayout							= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+				image_memory_barrier.srcQueueFamilyIndex				= secondary_render_queue_family_index;
+				image_memory_barrier.dstQueueFamilyIndex				= primary_render_queue_family_index;
 				image_memory_barrier.image								= image.image;
 				image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
 				image_memory_barrier.subresourceRange.baseMipLevel		= 0;
@@ -770,8 +1032,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 				image_memory_barrier.subresourceRange.layerCount		= image_layer_count;
 				vkCmdPipelineBarrier(
 					vk_primary_render_command_buffer,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
-					VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+					VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+					VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
 					0,
 					0, nullptr,
 					0, nullptr,
@@ -880,7 +1142,8 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 
 		// Submit blit command buffer
 		{
-			VkPipelineStageFlags wait_semaphore_dst	= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			// Blits and the ownership acquire barrier are the first things to touch the image.
+			VkPipelineStageFlags wait_semaphore_dst	= VK_PIPELINE_STAGE_TRANSFER_BIT;
 			VkSubmitInfo submit_info {};
 			submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
 			submit_info.pNext					= nullptr;
@@ -903,7 +1166,7 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 
 		// Submit primary render command buffer
 		if( is_primary_render_needed ) {
-			VkPipelineStageFlags wait_semaphore_dst	= VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			VkPipelineStageFlags wait_semaphore_dst	= VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
 			VkSubmitInfo submit_info {};
 			submit_info.sType					= VK_STRUCTURE_TYPE_SUBMIT_INFO;
 			submit_info.pNext					= nullptr;
@@ -925,6 +1188,11 @@ bool vk2d::vk2d_internal::TextureResourceImpl::MTLoad(
 		}
 	}
 
+	// Staging arena may reuse the memory on its own once the upload has finished.
+	for( auto & a : staging_allocations ) {
+		staging_buffer_arena->SetCompletionFence( a, vk_texture_complete_fence );
+	}
+
 	vk_image_layout		= VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 
 	return true;
@@ -946,6 +1214,14 @@ void vk2d::vk2d_internal::TextureResourceImpl::MTUnload(
 	// definitely be either or. MTUnload() does not ever get called before MTLoad().
 	WaitUntilLoaded( std::chrono::nanoseconds::max() );
 
+	for( auto & a : staging_allocations ) {
+		loader_thread_resource->GetStagingBufferArena()->Free( a );
+	}
+	staging_allocations.clear();
+	staging_locations.clear();
+
+	DestroyMipLevelImageViews( resource_manager->GetInstance(), mip_level_views );
+
 	vkDestroyFence(
 		loader_thread_resource->GetVulkanDevice(),
 		vk_texture_complete_fence,
@@ -1097,11 +1373,137 @@ uint32_t vk2d::vk2d_internal::TextureResourceImpl::GetLayerCount() const
 	return image_layer_count;
 }
 
+vk2d::TextureFormat vk2d::vk2d_internal::TextureResourceImpl::GetFormat() const
+{
+	return texture_format;
+}
+
 bool vk2d::vk2d_internal::TextureResourceImpl::IsTextureDataReady()
 {
 	return GetStatus() == ResourceStatus::LOADED;
 }
 
+void vk2d::vk2d_internal::TextureResourceImpl::CmdUpdateLayers(
+	VkCommandBuffer								command_buffer,
+	VkBuffer									staging_buffer,
+	const std::vector<VkBufferImageCopy>	&	copy_regions,
+	uint32_t									base_layer,
+	uint32_t									layer_count
+)
+{
+	assert( base_layer + layer_count <= image_layer_count );
+
+	auto CmdBarrier =[ this, command_buffer, base_layer, layer_count ](
+		uint32_t				base_mip_level,
+		uint32_t				level_count,
+		VkImageLayout			old_layout,
+		VkImageLayout			new_layout,
+		VkAccessFlags			src_access,
+		VkAccessFlags			dst_access,
+		VkPipelineStageFlags	src_stage,
+		VkPipelineStageFlags	dst_stage
+		)
+	{
+		VkImageMemoryBarrier image_memory_barrier {};
+		image_memory_barrier.sType								= VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+		image_memory_barrier.pNext								= nullptr;
+		image_memory_barrier.srcAccessMask						= src_access;
+		image_memory_barrier.dstAccessMask						= dst_access;
+		image_memory_barrier.oldLayout							= old_layout;
+		image_memory_barrier.newLayout							= new_layout;
+		image_memory_barrier.srcQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barrier.dstQueueFamilyIndex				= VK_QUEUE_FAMILY_IGNORED;
+		image_memory_barrier.image								= image.image;
+		image_memory_barrier.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		image_memory_barrier.subresourceRange.baseMipLevel		= base_mip_level;
+		image_memory_barrier.subresourceRange.levelCount		= level_count;
+		image_memory_barrier.subresourceRange.baseArrayLayer	= base_layer;
+		image_memory_barrier.subresourceRange.layerCount		= layer_count;
+		vkCmdPipelineBarrier(
+			command_buffer,
+			src_stage,
+			dst_stage,
+			0,
+			0, nullptr,
+			0, nullptr,
+			1, &image_memory_barrier
+		);
+	};
+
+	// Earlier frames may still be sampling the texture, only an execution
+	// dependency is needed before overwriting it.
+	CmdBarrier(
+		0, mip_level_count,
+		VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		0, VK_ACCESS_TRANSFER_WRITE_BIT,
+		VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT
+	);
+
+	vkCmdCopyBufferToImage(
+		command_buffer,
+		staging_buffer,
+		image.image,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		uint32_t( std::size( copy_regions ) ),
+		copy_regions.data()
+	);
+
+	// Whole layers are blitted, regions shrink to a few texels after
+	// a couple of mip levels anyway.
+	auto mipmap_levels = GenerateMipSizes(
+		glm::uvec2( extent.width, extent.height )
+	);
+	for( uint32_t dst_mip_level = 1; dst_mip_level < mip_level_count; ++dst_mip_level ) {
+		auto src_mip_level		= dst_mip_level - 1;
+		auto src_extent			= mipmap_levels[ src_mip_level ];
+		auto dst_extent			= mipmap_levels[ dst_mip_level ];
+
+		CmdBarrier(
+			src_mip_level, 1,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT
+		);
+
+		VkImageBlit blit_region {};
+		blit_region.srcSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		blit_region.srcSubresource.mipLevel			= src_mip_level;
+		blit_region.srcSubresource.baseArrayLayer	= base_layer;
+		blit_region.srcSubresource.layerCount		= layer_count;
+		blit_region.srcOffsets[ 0 ]					= { 0, 0, 0 };
+		blit_region.srcOffsets[ 1 ]					= { int32_t( src_extent.width ), int32_t( src_extent.height ), 1 };
+		blit_region.dstSubresource.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		blit_region.dstSubresource.mipLevel			= dst_mip_level;
+		blit_region.dstSubresource.baseArrayLayer	= base_layer;
+		blit_region.dstSubresource.layerCount		= layer_count;
+		blit_region.dstOffsets[ 0 ]					= { 0, 0, 0 };
+		blit_region.dstOffsets[ 1 ]					= { int32_t( dst_extent.width ), int32_t( dst_extent.height ), 1 };
+		vkCmdBlitImage(
+			command_buffer,
+			image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+			image.image,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			1, &blit_region,
+			VK_FILTER_LINEAR
+		);
+
+		CmdBarrier(
+			src_mip_level, 1,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			0, VK_ACCESS_SHADER_READ_BIT,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+		);
+	}
+
+	CmdBarrier(
+		mip_level_count - 1, 1,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
+	);
+}
+
 bool vk2d::vk2d_internal::TextureResourceImpl::IsGood() const
 {
 	return is_good;
@@ -1126,6 +1528,10 @@ public:
 	void operator()(
 		ThreadPrivateResource * thread_resource )
 	{
+		// Staging allocations must be returned before the fence they refer to is destroyed.
+		for( auto & a : texture->staging_allocations ) {
+			texture->loader_thread_resource->GetStagingBufferArena()->Free( a );
+		}
 
 		vkDestroyFence(
 			texture->resource_manager->GetVulkanDevice(),
@@ -1160,8 +1566,15 @@ public:
 			1, &texture->vk_primary_transfer_command_buffer
 		);
 
+		// Mip level views are only used for mipmap generation.
+		DestroyMipLevelImageViews(
+			texture->resource_manager->GetInstance(),
+			texture->mip_level_views
+		);
+
+		// Staging buffers were allocated from the loader thread's memory pool.
 		for( auto & sb : texture->staging_buffers ) {
-			texture->resource_manager->GetInstance()->GetDeviceMemoryPool()->FreeCompleteResource(
+			texture->loader_thread_resource->GetDeviceMemoryPool()->FreeCompleteResource(
 				sb
 			);
 		}
@@ -1173,6 +1586,8 @@ public:
 		texture->vk_secondary_render_command_buffer	= VK_NULL_HANDLE;
 		texture->vk_primary_transfer_command_buffer	= VK_NULL_HANDLE;
 		texture->staging_buffers.clear();
+		texture->staging_allocations.clear();
+		texture->staging_locations.clear();
 	}
 
 private:
@@ -3,6 +3,7 @@
 #include "core/SourceCommon.h"
 
 #include "types/Color.hpp"
+#include "types/TextureFormat.h"
 
 #include "system/VulkanMemoryManagement.h"
 
@@ -47,6 +48,15 @@ public:
 		glm::uvec2											size,
 		const std::vector<const std::vector<Color8>*>	&	texels );
 
+															TextureResourceImpl(
+		TextureResource									*	my_interface,
+		ResourceManagerImpl								*	resource_manager,
+		uint32_t											loader_thread,
+		ResourceBase									*	parent_resource,
+		glm::uvec2											size,
+		TextureFormat										format,
+		const std::vector<const std::vector<uint8_t>*>	&	texels );
+
 	bool													MTLoad(
 		ThreadPrivateResource							*	thread_resource );
 
@@ -67,9 +77,21 @@ public:
 
 	glm::uvec2												GetSize() const;
 	uint32_t												GetLayerCount() const;
+	TextureFormat											GetFormat() const;
 
 	bool													IsTextureDataReady();
 
+	// Records copies from a staging buffer into mip level 0 and regenerates
+	// mip levels of the layers by blitting. Texture must be loaded, commands
+	// must be recorded in the primary render queue outside of a render pass.
+	// Texture is in shader read only layout before and after.
+	void													CmdUpdateLayers(
+		VkCommandBuffer										command_buffer,
+		VkBuffer											staging_buffer,
+		const std::vector<VkBufferImageCopy>			&	copy_regions,
+		uint32_t											base_layer,
+		uint32_t											layer_count );
+
 	bool													IsGood() const;
 
 private:
@@ -80,12 +102,17 @@ private:
 	ThreadLoaderResource								*	loader_thread_resource						= {};
 
 	std::vector<CompleteBufferResource>						staging_buffers								= {};
+	std::vector<StagingBufferArenaAllocation>				staging_allocations							= {};
+	std::vector<std::pair<VkBuffer, VkDeviceSize>>			staging_locations							= {};	// Copy source buffer and offset per image layer.
 	CompleteImageResource									image										= {};
+	std::vector<VkImageView>								mip_level_views								= {};	// Per mip level views, only used during compute mipmap generation.
 	VkImageLayout											vk_image_layout								= {};
 
 	uint32_t												image_layer_count							= {};
+	uint32_t												mip_level_count								= {};
 	VkExtent2D												extent										= {};
-	std::vector<std::vector<Color8>>						texture_data								= {};
+	TextureFormat											texture_format								= TextureFormat::R8G8B8A8_UNORM;
+	std::vector<std::vector<uint8_t>>						texture_data								= {};	// Raw texels in texture_format, one vector per layer.
 
 	VkCommandBuffer											vk_primary_render_command_buffer			= {};
 	VkCommandBuffer											vk_secondary_render_command_buffer			= {};
@@ -3,6 +3,8 @@
 
 #include "system/CommonTools.h"
 
+#include <fstream>
+
 std::vector<VkExtent2D> vk2d::vk2d_internal::GenerateMipSizes(
 	glm::uvec2		full_size
 )
@@ -23,3 +25,23 @@ std::vector<VkExtent2D> vk2d::vk2d_internal::GenerateMipSizes(
 
 	return mipmap_levels;
 }
+
+bool vk2d::vk2d_internal::ReadBinaryFile(
+	const std::filesystem::path		&	file_path,
+	std::vector<uint8_t>			&	out_contents
+)
+{
+	std::ifstream file( file_path, std::ios::binary | std::ios::ate );
+	if( !file ) return false;
+
+	auto file_size = file.tellg();
+	if( file_size <= 0 ) return false;
+
+	out_contents.resize( size_t( file_size ) );
+	file.seekg( 0 );
+	if( !file.read( reinterpret_cast<char*>( out_contents.data() ), std::streamsize( out_contents.size() ) ) ) {
+		out_contents.clear();
+		return false;
+	}
+	return true;
+}
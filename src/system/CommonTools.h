@@ -11,6 +11,12 @@ namespace vk2d_internal {
 std::vector<VkExtent2D>				GenerateMipSizes(
 	glm::uvec2						full_size );
 
+// Reads the whole file into out_contents, returns false if the file
+// can't be read or is empty.
+bool								ReadBinaryFile(
+	const std::filesystem::path	&	file_path,
+	std::vector<uint8_t>		&	out_contents );
+
 
 
 } // vk2d_internal
@@ -54,79 +54,10 @@ vk2d::vk2d_internal::MeshBuffer::PushResult vk2d::vk2d_internal::MeshBuffer::Cmd
 
 	if( !reserve_result.success ) return {};
 
-	if( bound_index_buffer_block != reserve_result.index_block ) {
-		CmdInsertCommandBufferCheckpoint(
-			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::BIND_INDEX_BUFFER
-		);
-		vkCmdBindIndexBuffer(
-			command_buffer,
-			reserve_result.index_block->device_buffer.buffer,
-			0,
-			VK_INDEX_TYPE_UINT32
-		);
-		vkCmdBindDescriptorSets(
-			command_buffer,
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
-			instance->GetGraphicsPrimaryRenderPipelineLayout(),
-			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_INDEX_BUFFER_AS_STORAGE_BUFFER,
-			1, &reserve_result.index_block->descriptor_set.descriptorSet,
-			0, nullptr
-		);
-		bound_index_buffer_block	= reserve_result.index_block;
-	}
-	if( bound_vertex_buffer_block != reserve_result.vertex_block ) {
-		VkDeviceSize offset = 0;
-		CmdInsertCommandBufferCheckpoint(
-			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::BIND_VERTEX_BUFFER
-		);
-		vkCmdBindDescriptorSets(
-			command_buffer,
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
-			instance->GetGraphicsPrimaryRenderPipelineLayout(),
-			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_VERTEX_BUFFER_AS_STORAGE_BUFFER,
-			1, &reserve_result.vertex_block->descriptor_set.descriptorSet,
-			0, nullptr
-		);
-		bound_vertex_buffer_block	= reserve_result.vertex_block;
-	}
-	if( bound_texture_channel_weight_buffer_block != reserve_result.texture_channel_weight_block ) {
-
-		CmdInsertCommandBufferCheckpoint(
-			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::BIND_DESCRIPTOR_SET
-		);
-		vkCmdBindDescriptorSets(
-			command_buffer,
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
-			instance->GetGraphicsPrimaryRenderPipelineLayout(),
-			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_texture_channel_weights,
-			1, &reserve_result.texture_channel_weight_block->descriptor_set.descriptorSet,
-			0, nullptr
-		);
-		bound_texture_channel_weight_buffer_block	= reserve_result.texture_channel_weight_block;
-	}
-	if( bound_transformation_buffer_block != reserve_result.transformation_block ) {
-
-		CmdInsertCommandBufferCheckpoint(
-			command_buffer,
-			"MeshBuffer",
-			CommandBufferCheckpointType::BIND_DESCRIPTOR_SET
-		);
-		vkCmdBindDescriptorSets(
-			command_buffer,
-			VK_PIPELINE_BIND_POINT_GRAPHICS,
-			instance->GetGraphicsPrimaryRenderPipelineLayout(),
-			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_TRANSFORMATION,
-			1, &reserve_result.transformation_block->descriptor_set.descriptorSet,
-			0, nullptr
-		);
-		bound_transformation_buffer_block	= reserve_result.transformation_block;
-	}
+	CmdBindBlocksIfDifferent(
+		command_buffer,
+		reserve_result
+	);
 
 	{
 		auto & index_block_data				= reserve_result.index_block->host_data;
@@ -163,6 +94,104 @@ vk2d::vk2d_internal::MeshBuffer::PushResult vk2d::vk2d_internal::MeshBuffer::Cmd
 	return ret;
 }
 
+vk2d::vk2d_internal::MeshBuffer::PushResult vk2d::vk2d_internal::MeshBuffer::CmdPushInstances(
+	VkCommandBuffer							command_buffer,
+	uint32_t								instance_count,
+	uint32_t								instance_byte_size,
+	const void							*	table_key,
+	uint64_t								table_generation,
+	uint32_t								table_float_count,
+	void								*&	out_instance_data,
+	float								*&	out_table_data
+)
+{
+	assert( instance_byte_size && sizeof( Vertex ) % instance_byte_size == 0 );
+
+	out_instance_data					= nullptr;
+	out_table_data						= nullptr;
+
+	// Table is pushed only once per frame, or again if its contents changed
+	// or it needs to grow.
+	auto shared_table = std::find_if(
+		shared_tables.begin(),
+		shared_tables.end(),
+		[ table_key ]( const SharedTable & t )
+		{
+			return t.key == table_key;
+		}
+	);
+	if( shared_table == shared_tables.end() ||
+		shared_table->generation != table_generation ||
+		shared_table->float_count < table_float_count ) {
+		auto table_block				= FindTextureChannelBufferWithEnoughSpace( table_float_count );
+		if( !table_block ) {
+			instance->Report( ReportSeverity::CRITICAL_ERROR, "Internal error: Cannot reserve space for instance table in MeshBuffer, cannot find or create texture channel MeshBufferBlock with enough free space!" );
+			return {};
+		}
+		auto table_byte_offset			= table_block->ReserveSpace( table_float_count );
+
+		auto & table_block_data			= table_block->host_data;
+		auto table_offset				= table_block_data.size();
+		table_block_data.resize( table_offset + table_float_count );
+		out_table_data					= table_block_data.data() + table_offset;
+
+		if( shared_table == shared_tables.end() ) {
+			shared_table				= shared_tables.insert( shared_tables.end(), SharedTable {} );
+		}
+		shared_table->key				= table_key;
+		shared_table->generation		= table_generation;
+		shared_table->block				= table_block;
+		shared_table->offset			= uint32_t( table_byte_offset / sizeof( float ) );
+		shared_table->float_count		= table_float_count;
+
+		pushed_texture_channel_weight_count	+= table_float_count;
+	}
+
+	// Instances are packed into vertex sized slots.
+	auto instances_per_vertex			= uint32_t( sizeof( Vertex ) / instance_byte_size );
+	auto vertex_count					= ( instance_count + instances_per_vertex - 1 ) / instances_per_vertex;
+
+	auto reserve_result = ReserveSpaceForMesh(
+		0,
+		vertex_count,
+		0,
+		0
+	);
+
+	if( !reserve_result.success ) return {};
+
+	reserve_result.texture_channel_weight_block			= shared_table->block;
+	reserve_result.texture_channel_weight_size			= shared_table->float_count;
+	reserve_result.texture_channel_weight_byte_size		= VkDeviceSize( shared_table->float_count ) * sizeof( float );
+	reserve_result.texture_channel_weight_offset		= shared_table->offset;
+	reserve_result.texture_channel_weight_byte_offset	= VkDeviceSize( shared_table->offset ) * sizeof( float );
+
+	CmdBindBlocksIfDifferent(
+		command_buffer,
+		reserve_result
+	);
+
+	{
+		auto & vertex_block_data			= reserve_result.vertex_block->host_data;
+
+		// Host data has capacity for the whole block, this never reallocates.
+		auto vertex_offset					= vertex_block_data.size();
+		vertex_block_data.resize( vertex_offset + vertex_count );
+		out_instance_data					= vertex_block_data.data() + vertex_offset;
+	}
+
+	first_draw							= false;
+
+	MeshBuffer::PushResult ret {};
+	ret.location_info					= reserve_result;
+	ret.success							= true;
+
+	pushed_mesh_count					+= 1;
+	pushed_vertex_count					+= vertex_count;
+
+	return ret;
+}
+
 bool vk2d::vk2d_internal::MeshBuffer::CmdUploadMeshDataToGPU(
 	VkCommandBuffer command_buffer
 )
@@ -260,11 +289,17 @@ bool vk2d::vk2d_internal::MeshBuffer::CmdUploadMeshDataToGPU(
 	bound_vertex_buffer_block			= nullptr;
 	bound_texture_channel_weight_buffer_block	= nullptr;
 	bound_transformation_buffer_block	= nullptr;
+	shared_tables.clear();
 	first_draw							= true;
 
 	return true;
 }
 
+void vk2d::vk2d_internal::MeshBuffer::InvalidateBoundVertexBuffer()
+{
+	bound_vertex_buffer_block			= nullptr;
+}
+
 uint32_t vk2d::vk2d_internal::MeshBuffer::GetPushedMeshCount()
 {
 	return pushed_mesh_count;
@@ -290,6 +325,86 @@ uint32_t vk2d::vk2d_internal::MeshBuffer::GetTotalTransformationCount()
 	return pushed_transformation_count;
 }
 
+void vk2d::vk2d_internal::MeshBuffer::CmdBindBlocksIfDifferent(
+	VkCommandBuffer							command_buffer,
+	const MeshBlockLocationInfo			&	location_info
+)
+{
+	if( bound_index_buffer_block != location_info.index_block ) {
+		CmdInsertCommandBufferCheckpoint(
+			command_buffer,
+			"MeshBuffer",
+			CommandBufferCheckpointType::BIND_INDEX_BUFFER
+		);
+		vkCmdBindIndexBuffer(
+			command_buffer,
+			location_info.index_block->device_buffer.buffer,
+			0,
+			VK_INDEX_TYPE_UINT32
+		);
+		vkCmdBindDescriptorSets(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_INDEX_BUFFER_AS_STORAGE_BUFFER,
+			1, &location_info.index_block->descriptor_set.descriptorSet,
+			0, nullptr
+		);
+		bound_index_buffer_block	= location_info.index_block;
+	}
+	if( bound_vertex_buffer_block != location_info.vertex_block ) {
+		VkDeviceSize offset = 0;
+		CmdInsertCommandBufferCheckpoint(
+			command_buffer,
+			"MeshBuffer",
+			CommandBufferCheckpointType::BIND_VERTEX_BUFFER
+		);
+		vkCmdBindDescriptorSets(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_VERTEX_BUFFER_AS_STORAGE_BUFFER,
+			1, &location_info.vertex_block->descriptor_set.descriptorSet,
+			0, nullptr
+		);
+		bound_vertex_buffer_block	= location_info.vertex_block;
+	}
+	if( bound_texture_channel_weight_buffer_block != location_info.texture_channel_weight_block ) {
+
+		CmdInsertCommandBufferCheckpoint(
+			command_buffer,
+			"MeshBuffer",
+			CommandBufferCheckpointType::BIND_DESCRIPTOR_SET
+		);
+		vkCmdBindDescriptorSets(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_texture_channel_weights,
+			1, &location_info.texture_channel_weight_block->descriptor_set.descriptorSet,
+			0, nullptr
+		);
+		bound_texture_channel_weight_buffer_block	= location_info.texture_channel_weight_block;
+	}
+	if( bound_transformation_buffer_block != location_info.transformation_block ) {
+
+		CmdInsertCommandBufferCheckpoint(
+			command_buffer,
+			"MeshBuffer",
+			CommandBufferCheckpointType::BIND_DESCRIPTOR_SET
+		);
+		vkCmdBindDescriptorSets(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_GRAPHICS,
+			instance->GetGraphicsPrimaryRenderPipelineLayout(),
+			GRAPHICS_DESCRIPTOR_SET_ALLOCATION_TRANSFORMATION,
+			1, &location_info.transformation_block->descriptor_set.descriptorSet,
+			0, nullptr
+		);
+		bound_transformation_buffer_block	= location_info.transformation_block;
+	}
+}
+
 vk2d::vk2d_internal::MeshBuffer::MeshBlockLocationInfo vk2d::vk2d_internal::MeshBuffer::ReserveSpaceForMesh(
 	uint32_t		index_count,
 	uint32_t		vertex_count,
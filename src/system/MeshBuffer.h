@@ -94,9 +94,34 @@ public:
 		const std::vector<float>			&	new_texture_channel_weights,
 		const std::vector<glm::mat4>		&	new_transformations );
 
+	// Pushes per instance data for shaders that build their geometry from
+	// gl_InstanceIndex and gl_VertexIndex. Instance data is stored in the
+	// vertex buffer, draw non-indexed with first instance at
+	// location_info.vertex_offset * sizeof( Vertex ) / instance_byte_size.
+	// Instances can also read a table of floats that is shared by every
+	// draw with the same table_key this frame, it is placed in the texture
+	// channel weight buffer at location_info.texture_channel_weight_offset.
+	// out_table_data is nullptr if the table was already pushed this frame
+	// with the same table_generation and at least table_float_count floats,
+	// otherwise the caller must fill it. Instance data must be written to out_instance_data before the next
+	// push.
+	MeshBuffer::PushResult						CmdPushInstances(
+		VkCommandBuffer							command_buffer,
+		uint32_t								instance_count,
+		uint32_t								instance_byte_size,
+		const void							*	table_key,
+		uint64_t								table_generation,
+		uint32_t								table_float_count,
+		void								*&	out_instance_data,
+		float								*&	out_table_data );
+
 	bool										CmdUploadMeshDataToGPU(
 		VkCommandBuffer							command_buffer );
 
+	// Call after binding some other buffer to the vertex buffer descriptor
+	// set, the next push binds the vertex buffer again.
+	void										InvalidateBoundVertexBuffer();
+
 	// Gets the total amount of individual meshes that have been pushed so far.
 	uint32_t									GetPushedMeshCount();
 
@@ -113,6 +138,10 @@ public:
 	uint32_t									GetTotalTransformationCount();
 
 private:
+	void										CmdBindBlocksIfDifferent(
+		VkCommandBuffer							command_buffer,
+		const MeshBlockLocationInfo			&	location_info );
+
 	MeshBuffer::MeshBlockLocationInfo			ReserveSpaceForMesh(
 		uint32_t								index_count,
 		uint32_t								vertex_count,
@@ -197,6 +226,16 @@ private:
 	MeshBufferBlock<float>					*	bound_texture_channel_weight_buffer_block	= {};
 	MeshBufferBlock<glm::mat4>				*	bound_transformation_buffer_block			= {};
 
+	// Tables pushed by CmdPushInstances() this frame.
+	struct SharedTable {
+		const void							*	key											= {};
+		uint64_t								generation									= {};
+		MeshBufferBlock<float>				*	block										= {};
+		uint32_t								offset										= {};
+		uint32_t								float_count									= {};
+	};
+	std::vector<SharedTable>					shared_tables								= {};
+
 	IndexBufferBlocks							index_buffer_blocks							= {};
 	VertexBufferBlocks							vertex_buffer_blocks						= {};
 	TextureChannelBufferBlocks					texture_channel_weight_buffer_blocks		= {};
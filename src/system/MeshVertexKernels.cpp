@@ -0,0 +1,87 @@
+#include "core/SourceCommon.h"
+
+#include "types/MeshPrimitives.hpp"
+
+#include "system/MeshVertexKernels.h"
+#include "system/MeshVertexKernelsSimd.hpp"
+
+#if VK2D_MESH_VERTEX_KERNELS_X86 && defined( _MSC_VER )
+#include <intrin.h>
+#endif
+
+
+
+static_assert( sizeof( vk2d::Vertex ) == vk2d::vk2d_internal::MESH_VERTEX_FLOAT_STRIDE * sizeof( float ),
+	"Vertex size does not match mesh vertex kernels." );
+static_assert( offsetof( vk2d::Vertex, vertex_coords ) == vk2d::vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET * sizeof( float ),
+	"Vertex coords offset does not match mesh vertex kernels." );
+static_assert( offsetof( vk2d::Vertex, uv_coords ) == vk2d::vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET * sizeof( float ),
+	"Vertex uv coords offset does not match mesh vertex kernels." );
+static_assert( offsetof( vk2d::Vertex, color ) == vk2d::vk2d_internal::MESH_VERTEX_COLOR_FLOAT_OFFSET * sizeof( float ),
+	"Vertex color offset does not match mesh vertex kernels." );
+
+
+
+namespace vk2d {
+namespace vk2d_internal {
+
+namespace {
+
+#if VK2D_MESH_VERTEX_KERNELS_X86
+bool IsAVX2Supported()
+{
+#if defined( _MSC_VER )
+	int info[ 4 ] = {};
+	__cpuid( info, 0 );
+	if( info[ 0 ] < 7 ) return false;
+
+	// AVX must also be enabled by the OS for the YMM registers to be saved.
+	__cpuid( info, 1 );
+	bool osxsave	= ( info[ 2 ] & ( 1 << 27 ) ) != 0;
+	bool avx		= ( info[ 2 ] & ( 1 << 28 ) ) != 0;
+	if( !osxsave || !avx ) return false;
+	if( ( _xgetbv( 0 ) & 0x6 ) != 0x6 ) return false;
+
+	__cpuidex( info, 7, 0 );
+	return ( info[ 1 ] & ( 1 << 5 ) ) != 0;
+#else
+	return __builtin_cpu_supports( "avx2" );
+#endif
+}
+#endif
+
+MeshVertexKernels SelectMeshVertexKernels()
+{
+#if VK2D_MESH_VERTEX_KERNELS_X86
+	if( IsAVX2Supported() ) {
+		auto avx2_kernels = GetMeshVertexKernelsAVX2();
+		if( avx2_kernels ) return *avx2_kernels;
+	}
+	// SSE2 is part of every x86-64 CPU.
+	return CreateSimdMeshVertexKernels<SimdSSE2>( "SSE2" );
+#elif VK2D_MESH_VERTEX_KERNELS_NEON
+	// NEON is part of every ARMv8 CPU.
+	return CreateSimdMeshVertexKernels<SimdNEON>( "NEON" );
+#else
+	MeshVertexKernels kernels;
+	kernels.name				= "Scalar";
+	kernels.transform_points	= &TransformPointsScalar;
+	kernels.wave_points			= &WavePointsScalar;
+	kernels.color_gradient		= &ColorGradientScalar;
+	kernels.calculate_bounds	= &CalculateBoundsScalar;
+	return kernels;
+#endif
+}
+
+} // anonymous
+
+} // vk2d_internal
+} // vk2d
+
+
+
+const vk2d::vk2d_internal::MeshVertexKernels & vk2d::vk2d_internal::GetMeshVertexKernels()
+{
+	static const MeshVertexKernels kernels = SelectMeshVertexKernels();
+	return kernels;
+}
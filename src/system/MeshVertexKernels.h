@@ -0,0 +1,134 @@
+#pragma once
+
+// This header is also included by translation units compiled with extra
+// instruction set flags, it must not pull in anything with inline functions
+// that could be emitted there, so only plain C headers here.
+#include <stddef.h>
+#include <stdint.h>
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Mesh vertex kernels work directly on the interleaved vk2d::Vertex list as
+// floats. These must match the vk2d::Vertex layout, checked in MeshVertexKernels.cpp.
+constexpr size_t MESH_VERTEX_FLOAT_STRIDE						= 12;
+constexpr size_t MESH_VERTEX_COORDS_FLOAT_OFFSET				= 0;
+constexpr size_t MESH_VERTEX_UV_COORDS_FLOAT_OFFSET				= 2;
+constexpr size_t MESH_VERTEX_COLOR_FLOAT_OFFSET					= 4;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		2D affine transformation of points.
+///
+///				result = column_0 * point.x + column_1 * point.y + offset
+struct MeshPointTransform
+{
+	float											column_0[ 2 ]						= {};
+	float											column_1[ 2 ]						= {};
+	float											offset[ 2 ]							= {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Directional wave applied to points.
+///
+///				Points are first transformed to wave space, where the wave phase is
+///				phase + point.x * frequency[ 0 ] + point.y * frequency[ 1 ], and the point is moved by
+///				{ cos( phase ) * intensity[ 0 ], sin( phase ) * intensity[ 1 ] } before transforming back.
+struct MeshPointWave
+{
+	MeshPointTransform								to_wave_space						= {};
+	float											frequency[ 2 ]						= {};
+	float											phase								= {};
+	float											intensity[ 2 ]						= {};
+	MeshPointTransform								from_wave_space						= {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Linear color gradient applied to vertex colors.
+///
+///				Gradient position of a vertex is dot( vertex_coords - origin, gradient ) clamped to 0.0 - 1.0 range, where
+///				0.0 is color_1 and 1.0 is color_2.
+struct MeshColorGradient
+{
+	float											color_1[ 4 ]						= {};
+	float											color_2[ 4 ]						= {};
+	float											origin[ 2 ]							= {};
+	float											gradient[ 2 ]						= {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Axis aligned bounds of points.
+struct MeshPointBounds
+{
+	float											min[ 2 ]							= {};
+	float											max[ 2 ]							= {};
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Set of functions that modify mesh vertices, one set per supported instruction set.
+///
+///				Point kernels take a pointer to the first point, eg. vertex coords or uv coords of the first vertex, points
+///				are MESH_VERTEX_FLOAT_STRIDE floats apart. Vertex kernels take a pointer to the first vertex.
+struct MeshVertexKernels
+{
+	/// @brief		Name of the instruction set, for debugging and benchmarking.
+	const char									*	name								= {};
+
+	/// @brief		Apply affine transformation to points.
+	void										( *	transform_points )(
+		float									*	points,
+		size_t										count,
+		const MeshPointTransform				&	transform )							= {};
+
+	/// @brief		Apply directional wave to points.
+	void										( *	wave_points )(
+		float									*	points,
+		size_t										count,
+		const MeshPointWave						&	wave )								= {};
+
+	/// @brief		Set vertex colors from a linear gradient.
+	void										( *	color_gradient )(
+		float									*	vertices,
+		size_t										count,
+		const MeshColorGradient					&	gradient )							= {};
+
+	/// @brief		Calculate bounds of points, count must be larger than 0.
+	MeshPointBounds								( *	calculate_bounds )(
+		const float								*	points,
+		size_t										count )								= {};
+};
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get mesh vertex kernels for the best instruction set this CPU supports.
+///
+///				Selected once on first call.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @return		Mesh vertex kernels.
+const MeshVertexKernels							&	GetMeshVertexKernels();
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get AVX2 mesh vertex kernels.
+///
+///				Defined in MeshVertexKernelsAVX2.cpp which is the only file compiled with AVX2 enabled. Must only be called
+///				after checking that the CPU supports AVX2, use GetMeshVertexKernels() instead.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @return		AVX2 mesh vertex kernels or nullptr if the library was not compiled with AVX2 kernels.
+const MeshVertexKernels							*	GetMeshVertexKernelsAVX2();
+
+
+
+} // vk2d_internal
+
+} // vk2d
@@ -0,0 +1,70 @@
+// Compiled with AVX2 enabled and without the precompiled header, see CMakeLists.txt.
+// Only include MeshVertexKernelsSimd.hpp here, any inline function from other
+// headers could be merged with the non-AVX2 copy by the linker.
+#include "system/MeshVertexKernelsSimd.hpp"
+
+#if VK2D_MESH_VERTEX_KERNELS_X86 && defined( __AVX2__ )
+#include <immintrin.h>
+
+namespace vk2d {
+namespace vk2d_internal {
+
+namespace {
+
+struct SimdAVX2
+{
+	using F = __m256;
+	static constexpr size_t LANES = 8;
+
+	static F Splat( float v )						{ return _mm256_set1_ps( v ); }
+	static F SetPairs( float x, float y )			{ return _mm256_setr_ps( x, y, x, y, x, y, x, y ); }
+	static F Add( F a, F b )						{ return _mm256_add_ps( a, b ); }
+	static F Sub( F a, F b )						{ return _mm256_sub_ps( a, b ); }
+	static F Mul( F a, F b )						{ return _mm256_mul_ps( a, b ); }
+	static F Min( F a, F b )						{ return _mm256_min_ps( a, b ); }
+	static F Max( F a, F b )						{ return _mm256_max_ps( a, b ); }
+	static F SwapPairs( F v )						{ return _mm256_permute_ps( v, _MM_SHUFFLE( 2, 3, 0, 1 ) ); }
+	static F Round( F v )							{ return _mm256_round_ps( v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC ); }
+	static void Store( float * out, F v )			{ _mm256_storeu_ps( out, v ); }
+
+	static F LoadPairs( const float * p, size_t stride )
+	{
+		auto low	= SimdSSE2::LoadPairs( p, stride );
+		auto high	= SimdSSE2::LoadPairs( p + stride * 2, stride );
+		return _mm256_insertf128_ps( _mm256_castps128_ps256( low ), high, 1 );
+	}
+
+	static void StorePairs( float * p, size_t stride, F v )
+	{
+		SimdSSE2::StorePairs( p, stride, _mm256_castps256_ps128( v ) );
+		SimdSSE2::StorePairs( p + stride * 2, stride, _mm256_extractf128_ps( v, 1 ) );
+	}
+
+	static void LerpColor( float * color, const float * color_1, const float * color_2, float t )
+	{
+		SimdSSE2::LerpColor( color, color_1, color_2, t );
+	}
+};
+
+} // anonymous
+
+} // vk2d_internal
+} // vk2d
+
+
+
+const vk2d::vk2d_internal::MeshVertexKernels * vk2d::vk2d_internal::GetMeshVertexKernelsAVX2()
+{
+	// Not a global, everything in this file may only run after AVX2 support was checked.
+	static const MeshVertexKernels kernels = CreateSimdMeshVertexKernels<SimdAVX2>( "AVX2" );
+	return &kernels;
+}
+
+#else
+
+const vk2d::vk2d_internal::MeshVertexKernels * vk2d::vk2d_internal::GetMeshVertexKernelsAVX2()
+{
+	return nullptr;
+}
+
+#endif
@@ -0,0 +1,440 @@
+#pragma once
+
+// Shared implementation of the mesh vertex kernels, included by
+// MeshVertexKernels.cpp and MeshVertexKernelsAVX2.cpp. Everything here is in
+// an anonymous namespace on purpose: the same inline code is compiled with
+// different instruction set flags per translation unit and must never be
+// merged by the linker, otherwise the AVX2 copy could end up being called on
+// CPUs without AVX2. For the same reason only C math functions are used.
+
+#include "system/MeshVertexKernels.h"
+
+#include <math.h>
+
+#if defined( __x86_64__ ) || defined( _M_X64 ) || defined( __i386__ ) || defined( _M_IX86 )
+#define VK2D_MESH_VERTEX_KERNELS_X86 1
+#include <emmintrin.h>
+#elif defined( __aarch64__ ) || defined( _M_ARM64 )
+#define VK2D_MESH_VERTEX_KERNELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+namespace {
+
+
+
+////////////////////////////////////////////////////////////////
+// Scalar kernels, also used for leftover points of SIMD kernels.
+////////////////////////////////////////////////////////////////
+
+inline void ApplyPointTransformScalar(
+	const MeshPointTransform					&	transform,
+	float										&	x,
+	float										&	y
+)
+{
+	// Same operation order as the SIMD kernels so all paths give identical results.
+	float rx	= transform.column_0[ 0 ] * x + transform.column_1[ 0 ] * y + transform.offset[ 0 ];
+	float ry	= transform.column_1[ 1 ] * y + transform.column_0[ 1 ] * x + transform.offset[ 1 ];
+	x			= rx;
+	y			= ry;
+}
+
+inline void TransformPointsScalar(
+	float										*	points,
+	size_t											count,
+	const MeshPointTransform					&	transform
+)
+{
+	for( size_t i = 0; i < count; ++i ) {
+		auto p = points + i * MESH_VERTEX_FLOAT_STRIDE;
+		ApplyPointTransformScalar( transform, p[ 0 ], p[ 1 ] );
+	}
+}
+
+inline void WavePointsScalar(
+	float										*	points,
+	size_t											count,
+	const MeshPointWave							&	wave
+)
+{
+	for( size_t i = 0; i < count; ++i ) {
+		auto p = points + i * MESH_VERTEX_FLOAT_STRIDE;
+		float x = p[ 0 ];
+		float y = p[ 1 ];
+		ApplyPointTransformScalar( wave.to_wave_space, x, y );
+
+		float d = wave.phase + ( x * wave.frequency[ 0 ] + y * wave.frequency[ 1 ] );
+		x += cosf( d ) * wave.intensity[ 0 ];
+		y += sinf( d ) * wave.intensity[ 1 ];
+
+		ApplyPointTransformScalar( wave.from_wave_space, x, y );
+		p[ 0 ] = x;
+		p[ 1 ] = y;
+	}
+}
+
+inline void LerpColorScalar(
+	float										*	color,
+	const float									*	color_1,
+	const float									*	color_2,
+	float											t
+)
+{
+	for( size_t c = 0; c < 4; ++c ) {
+		color[ c ] = color_1[ c ] * ( 1.0f - t ) + color_2[ c ] * t;
+	}
+}
+
+inline void ColorGradientScalar(
+	float										*	vertices,
+	size_t											count,
+	const MeshColorGradient						&	gradient
+)
+{
+	for( size_t i = 0; i < count; ++i ) {
+		auto v = vertices + i * MESH_VERTEX_FLOAT_STRIDE;
+		auto p = v + MESH_VERTEX_COORDS_FLOAT_OFFSET;
+
+		float dx	= ( p[ 0 ] - gradient.origin[ 0 ] ) * gradient.gradient[ 0 ];
+		float dy	= ( p[ 1 ] - gradient.origin[ 1 ] ) * gradient.gradient[ 1 ];
+		float t		= dx + dy;
+		t			= t < 0.0f ? 0.0f : t;
+		t			= t > 1.0f ? 1.0f : t;
+
+		LerpColorScalar( v + MESH_VERTEX_COLOR_FLOAT_OFFSET, gradient.color_1, gradient.color_2, t );
+	}
+}
+
+inline void ExpandBoundsScalar(
+	MeshPointBounds								&	bounds,
+	const float									*	points,
+	size_t											count
+)
+{
+	for( size_t i = 0; i < count; ++i ) {
+		auto p = points + i * MESH_VERTEX_FLOAT_STRIDE;
+		for( size_t c = 0; c < 2; ++c ) {
+			bounds.min[ c ] = p[ c ] < bounds.min[ c ] ? p[ c ] : bounds.min[ c ];
+			bounds.max[ c ] = p[ c ] > bounds.max[ c ] ? p[ c ] : bounds.max[ c ];
+		}
+	}
+}
+
+inline MeshPointBounds CalculateBoundsScalar(
+	const float									*	points,
+	size_t											count
+)
+{
+	MeshPointBounds bounds;
+	bounds.min[ 0 ] = bounds.max[ 0 ] = points[ 0 ];
+	bounds.min[ 1 ] = bounds.max[ 1 ] = points[ 1 ];
+	ExpandBoundsScalar( bounds, points, count );
+	return bounds;
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// SIMD kernels.
+//
+// SimdT provides the instruction set. Each register holds
+// SimdT::LANES / 2 points as interleaved x, y pairs so the
+// interleaved vertex list can be processed without transposing.
+////////////////////////////////////////////////////////////////
+
+// Sine and cosine of every lane. Cody-Waite reduction to -pi/4 - pi/4 range
+// with Cephes polynomials, accurate to a few ulp for phases well below 2^22.
+template<typename SimdT>
+void SinCosSimd(
+	typename SimdT::F								x,
+	typename SimdT::F							&	out_sin,
+	typename SimdT::F							&	out_cos
+)
+{
+	using S = SimdT;
+
+	auto j		= S::Round( S::Mul( x, S::Splat( 0.636619772367581343f ) ) );
+	auto r		= S::Sub( x, S::Mul( j, S::Splat( 1.5703125f ) ) );
+	r			= S::Sub( r, S::Mul( j, S::Splat( 4.837512969970703125e-4f ) ) );
+	r			= S::Sub( r, S::Mul( j, S::Splat( 7.54978995489188216e-8f ) ) );
+
+	// Quadrant 0 - 3 and its bits as floats so that selecting and flipping
+	// signs can be done with plain arithmetic on every instruction set.
+	auto q		= S::Sub( j, S::Mul( S::Round( S::Sub( S::Mul( j, S::Splat( 0.25f ) ), S::Splat( 0.375f ) ) ), S::Splat( 4.0f ) ) );
+	auto high	= S::Round( S::Sub( S::Mul( q, S::Splat( 0.5f ) ), S::Splat( 0.25f ) ) );
+	auto odd	= S::Sub( q, S::Add( high, high ) );
+	auto even	= S::Sub( S::Splat( 1.0f ), odd );
+
+	auto z		= S::Mul( r, r );
+	auto ps		= S::Add( S::Mul( S::Mul( S::Add( S::Mul( S::Add( S::Mul( S::Splat( -1.9515295891e-4f ), z ), S::Splat( 8.3321608736e-3f ) ), z ), S::Splat( -1.6666654611e-1f ) ), z ), r ), r );
+	auto pc		= S::Add( S::Mul( S::Mul( S::Add( S::Mul( S::Add( S::Mul( S::Splat( 2.443315711809948e-5f ), z ), S::Splat( -1.388731625493765e-3f ) ), z ), S::Splat( 4.166664568298827e-2f ) ), z ), z ), S::Sub( S::Splat( 1.0f ), S::Mul( S::Splat( 0.5f ), z ) ) );
+
+	auto sin_sign	= S::Sub( S::Splat( 1.0f ), S::Add( high, high ) );
+	auto cos_flip	= S::Sub( S::Add( odd, high ), S::Mul( S::Splat( 2.0f ), S::Mul( odd, high ) ) );
+	auto cos_sign	= S::Sub( S::Splat( 1.0f ), S::Add( cos_flip, cos_flip ) );
+
+	out_sin		= S::Mul( S::Add( S::Mul( ps, even ), S::Mul( pc, odd ) ), sin_sign );
+	out_cos		= S::Mul( S::Add( S::Mul( pc, even ), S::Mul( ps, odd ) ), cos_sign );
+}
+
+template<typename SimdT>
+struct PointTransformSimd
+{
+	typename SimdT::F								a;
+	typename SimdT::F								b;
+	typename SimdT::F								offset;
+
+	PointTransformSimd(
+		const MeshPointTransform				&	transform
+	) :
+		a( SimdT::SetPairs( transform.column_0[ 0 ], transform.column_1[ 1 ] ) ),
+		b( SimdT::SetPairs( transform.column_1[ 0 ], transform.column_0[ 1 ] ) ),
+		offset( SimdT::SetPairs( transform.offset[ 0 ], transform.offset[ 1 ] ) )
+	{}
+
+	typename SimdT::F								Apply(
+		typename SimdT::F							v
+	) const
+	{
+		return SimdT::Add( SimdT::Add( SimdT::Mul( a, v ), SimdT::Mul( b, SimdT::SwapPairs( v ) ) ), offset );
+	}
+};
+
+template<typename SimdT>
+void TransformPointsSimd(
+	float										*	points,
+	size_t											count,
+	const MeshPointTransform					&	transform
+)
+{
+	constexpr size_t BLOCK = SimdT::LANES / 2;
+
+	PointTransformSimd<SimdT> t( transform );
+
+	size_t i = 0;
+	for( ; i + BLOCK <= count; i += BLOCK ) {
+		auto p = points + i * MESH_VERTEX_FLOAT_STRIDE;
+		SimdT::StorePairs( p, MESH_VERTEX_FLOAT_STRIDE, t.Apply( SimdT::LoadPairs( p, MESH_VERTEX_FLOAT_STRIDE ) ) );
+	}
+	TransformPointsScalar( points + i * MESH_VERTEX_FLOAT_STRIDE, count - i, transform );
+}
+
+template<typename SimdT>
+void WavePointsSimd(
+	float										*	points,
+	size_t											count,
+	const MeshPointWave							&	wave
+)
+{
+	using S = SimdT;
+	constexpr size_t BLOCK = S::LANES / 2;
+
+	PointTransformSimd<S> to_wave_space( wave.to_wave_space );
+	PointTransformSimd<S> from_wave_space( wave.from_wave_space );
+	auto frequency		= S::SetPairs( wave.frequency[ 0 ], wave.frequency[ 1 ] );
+	auto phase			= S::Splat( wave.phase );
+	auto intensity_x	= S::SetPairs( wave.intensity[ 0 ], 0.0f );
+	auto intensity_y	= S::SetPairs( 0.0f, wave.intensity[ 1 ] );
+
+	size_t i = 0;
+	for( ; i + BLOCK <= count; i += BLOCK ) {
+		auto p = points + i * MESH_VERTEX_FLOAT_STRIDE;
+		auto c = to_wave_space.Apply( S::LoadPairs( p, MESH_VERTEX_FLOAT_STRIDE ) );
+
+		// Both lanes of a point get the same phase.
+		auto f = S::Mul( c, frequency );
+		auto d = S::Add( phase, S::Add( f, S::SwapPairs( f ) ) );
+
+		typename S::F s, k;
+		SinCosSimd<S>( d, s, k );
+		c = S::Add( c, S::Add( S::Mul( k, intensity_x ), S::Mul( s, intensity_y ) ) );
+
+		S::StorePairs( p, MESH_VERTEX_FLOAT_STRIDE, from_wave_space.Apply( c ) );
+	}
+	WavePointsScalar( points + i * MESH_VERTEX_FLOAT_STRIDE, count - i, wave );
+}
+
+template<typename SimdT>
+void ColorGradientSimd(
+	float										*	vertices,
+	size_t											count,
+	const MeshColorGradient						&	gradient
+)
+{
+	using S = SimdT;
+	constexpr size_t BLOCK = S::LANES / 2;
+
+	auto origin		= S::SetPairs( gradient.origin[ 0 ], gradient.origin[ 1 ] );
+	auto direction	= S::SetPairs( gradient.gradient[ 0 ], gradient.gradient[ 1 ] );
+	auto zero		= S::Splat( 0.0f );
+	auto one		= S::Splat( 1.0f );
+
+	size_t i = 0;
+	for( ; i + BLOCK <= count; i += BLOCK ) {
+		auto v = vertices + i * MESH_VERTEX_FLOAT_STRIDE;
+		auto d = S::Mul( S::Sub( S::LoadPairs( v + MESH_VERTEX_COORDS_FLOAT_OFFSET, MESH_VERTEX_FLOAT_STRIDE ), origin ), direction );
+		auto t = S::Max( S::Min( S::Add( d, S::SwapPairs( d ) ), one ), zero );
+
+		float ts[ S::LANES ];
+		S::Store( ts, t );
+		for( size_t k = 0; k < BLOCK; ++k ) {
+			S::LerpColor( v + k * MESH_VERTEX_FLOAT_STRIDE + MESH_VERTEX_COLOR_FLOAT_OFFSET, gradient.color_1, gradient.color_2, ts[ k * 2 ] );
+		}
+	}
+	ColorGradientScalar( vertices + i * MESH_VERTEX_FLOAT_STRIDE, count - i, gradient );
+}
+
+template<typename SimdT>
+MeshPointBounds CalculateBoundsSimd(
+	const float									*	points,
+	size_t											count
+)
+{
+	using S = SimdT;
+	constexpr size_t BLOCK = S::LANES / 2;
+
+	if( count < BLOCK ) return CalculateBoundsScalar( points, count );
+
+	auto mn = S::LoadPairs( points, MESH_VERTEX_FLOAT_STRIDE );
+	auto mx = mn;
+
+	size_t i = BLOCK;
+	for( ; i + BLOCK <= count; i += BLOCK ) {
+		auto v = S::LoadPairs( points + i * MESH_VERTEX_FLOAT_STRIDE, MESH_VERTEX_FLOAT_STRIDE );
+		mn = S::Min( mn, v );
+		mx = S::Max( mx, v );
+	}
+
+	float mns[ S::LANES ];
+	float mxs[ S::LANES ];
+	S::Store( mns, mn );
+	S::Store( mxs, mx );
+
+	MeshPointBounds bounds;
+	bounds.min[ 0 ] = mns[ 0 ];
+	bounds.min[ 1 ] = mns[ 1 ];
+	bounds.max[ 0 ] = mxs[ 0 ];
+	bounds.max[ 1 ] = mxs[ 1 ];
+	for( size_t k = 2; k < S::LANES; k += 2 ) {
+		for( size_t c = 0; c < 2; ++c ) {
+			bounds.min[ c ] = mns[ k + c ] < bounds.min[ c ] ? mns[ k + c ] : bounds.min[ c ];
+			bounds.max[ c ] = mxs[ k + c ] > bounds.max[ c ] ? mxs[ k + c ] : bounds.max[ c ];
+		}
+	}
+	ExpandBoundsScalar( bounds, points + i * MESH_VERTEX_FLOAT_STRIDE, count - i );
+	return bounds;
+}
+
+template<typename SimdT>
+MeshVertexKernels CreateSimdMeshVertexKernels(
+	const char									*	name
+)
+{
+	MeshVertexKernels kernels;
+	kernels.name				= name;
+	kernels.transform_points	= &TransformPointsSimd<SimdT>;
+	kernels.wave_points			= &WavePointsSimd<SimdT>;
+	kernels.color_gradient		= &ColorGradientSimd<SimdT>;
+	kernels.calculate_bounds	= &CalculateBoundsSimd<SimdT>;
+	return kernels;
+}
+
+
+
+////////////////////////////////////////////////////////////////
+// Instruction sets available without extra compiler flags.
+////////////////////////////////////////////////////////////////
+
+#if VK2D_MESH_VERTEX_KERNELS_X86
+
+struct SimdSSE2
+{
+	using F = __m128;
+	static constexpr size_t LANES = 4;
+
+	static F Splat( float v )						{ return _mm_set1_ps( v ); }
+	static F SetPairs( float x, float y )			{ return _mm_setr_ps( x, y, x, y ); }
+	static F Add( F a, F b )						{ return _mm_add_ps( a, b ); }
+	static F Sub( F a, F b )						{ return _mm_sub_ps( a, b ); }
+	static F Mul( F a, F b )						{ return _mm_mul_ps( a, b ); }
+	static F Min( F a, F b )						{ return _mm_min_ps( a, b ); }
+	static F Max( F a, F b )						{ return _mm_max_ps( a, b ); }
+	static F SwapPairs( F v )						{ return _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) ); }
+	static F Round( F v )							{ return _mm_cvtepi32_ps( _mm_cvtps_epi32( v ) ); }
+	static void Store( float * out, F v )			{ _mm_storeu_ps( out, v ); }
+
+	static F LoadPairs( const float * p, size_t stride )
+	{
+		auto v = _mm_loadl_pi( _mm_setzero_ps(), reinterpret_cast<const __m64*>( p ) );
+		return _mm_loadh_pi( v, reinterpret_cast<const __m64*>( p + stride ) );
+	}
+
+	static void StorePairs( float * p, size_t stride, F v )
+	{
+		_mm_storel_pi( reinterpret_cast<__m64*>( p ), v );
+		_mm_storeh_pi( reinterpret_cast<__m64*>( p + stride ), v );
+	}
+
+	static void LerpColor( float * color, const float * color_1, const float * color_2, float t )
+	{
+		auto c = _mm_add_ps(
+			_mm_mul_ps( _mm_loadu_ps( color_1 ), _mm_set1_ps( 1.0f - t ) ),
+			_mm_mul_ps( _mm_loadu_ps( color_2 ), _mm_set1_ps( t ) )
+		);
+		_mm_storeu_ps( color, c );
+	}
+};
+
+#elif VK2D_MESH_VERTEX_KERNELS_NEON
+
+struct SimdNEON
+{
+	using F = float32x4_t;
+	static constexpr size_t LANES = 4;
+
+	static F Splat( float v )						{ return vdupq_n_f32( v ); }
+	static F SetPairs( float x, float y )			{ float v[ 4 ] = { x, y, x, y }; return vld1q_f32( v ); }
+	static F Add( F a, F b )						{ return vaddq_f32( a, b ); }
+	static F Sub( F a, F b )						{ return vsubq_f32( a, b ); }
+	static F Mul( F a, F b )						{ return vmulq_f32( a, b ); }
+	static F Min( F a, F b )						{ return vminq_f32( a, b ); }
+	static F Max( F a, F b )						{ return vmaxq_f32( a, b ); }
+	static F SwapPairs( F v )						{ return vrev64q_f32( v ); }
+	static F Round( F v )							{ return vrndnq_f32( v ); }
+	static void Store( float * out, F v )			{ vst1q_f32( out, v ); }
+
+	static F LoadPairs( const float * p, size_t stride )
+	{
+		return vcombine_f32( vld1_f32( p ), vld1_f32( p + stride ) );
+	}
+
+	static void StorePairs( float * p, size_t stride, F v )
+	{
+		vst1_f32( p, vget_low_f32( v ) );
+		vst1_f32( p + stride, vget_high_f32( v ) );
+	}
+
+	static void LerpColor( float * color, const float * color_1, const float * color_2, float t )
+	{
+		auto c = vaddq_f32(
+			vmulq_n_f32( vld1q_f32( color_1 ), 1.0f - t ),
+			vmulq_n_f32( vld1q_f32( color_2 ), t )
+		);
+		vst1q_f32( color, c );
+	}
+};
+
+#endif
+
+
+
+} // anonymous
+
+} // vk2d_internal
+
+} // vk2d
@@ -0,0 +1,285 @@
+
+#include "core/SourceCommon.h"
+
+#include "system/MipmapGeneration.h"
+#include "system/ShaderInterface.h"
+#include "system/QueueResolver.h"
+
+#include "interface/InstanceImpl.h"
+
+namespace vk2d {
+namespace vk2d_internal {
+
+constexpr uint32_t		MIPMAP_DOWNSAMPLE_TILE_SIZE						= 16;	// Must match shader work group size.
+constexpr uint32_t		MIPMAP_DOWNSAMPLE_MAX_LEVELS_PER_DISPATCH		= 4;	// Must match shader destination binding count.
+
+} // vk2d_internal
+} // vk2d
+
+
+
+bool vk2d::vk2d_internal::IsComputeMipmapGenerationSupported(
+	InstanceImpl					*	instance,
+	VkFormat							format,
+	const ResolvedQueue				&	queue
+)
+{
+	// Shader declares the storage images as rgba8, other formats would
+	// need their own shader variants.
+	if( format != VK_FORMAT_R8G8B8A8_UNORM ) return false;
+
+	if( !( queue.GetQueueFamilyProperties().queueFlags & VK_QUEUE_COMPUTE_BIT ) ) return false;
+
+	VkFormatProperties format_properties {};
+	vkGetPhysicalDeviceFormatProperties(
+		instance->GetVulkanPhysicalDevice(),
+		format,
+		&format_properties
+	);
+	return !!( format_properties.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT );
+}
+
+std::vector<VkImageView> vk2d::vk2d_internal::CreateMipLevelImageViews(
+	InstanceImpl					*	instance,
+	VkImage								image,
+	VkFormat							format,
+	uint32_t							mip_level_count,
+	uint32_t							layer_count
+)
+{
+	std::vector<VkImageView> mip_level_views;
+	mip_level_views.reserve( mip_level_count );
+
+	for( uint32_t i = 0; i < mip_level_count; ++i ) {
+		VkImageViewCreateInfo image_view_create_info {};
+		image_view_create_info.sType							= VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+		image_view_create_info.pNext							= nullptr;
+		image_view_create_info.flags							= 0;
+		image_view_create_info.image							= image;
+		image_view_create_info.viewType							= VK_IMAGE_VIEW_TYPE_2D_ARRAY;
+		image_view_create_info.format							= format;
+		image_view_create_info.components						= {
+			VK_COMPONENT_SWIZZLE_IDENTITY,
+			VK_COMPONENT_SWIZZLE_IDENTITY,
+			VK_COMPONENT_SWIZZLE_IDENTITY,
+			VK_COMPONENT_SWIZZLE_IDENTITY
+		};
+		image_view_create_info.subresourceRange.aspectMask		= VK_IMAGE_ASPECT_COLOR_BIT;
+		image_view_create_info.subresourceRange.baseMipLevel	= i;
+		image_view_create_info.subresourceRange.levelCount		= 1;
+		image_view_create_info.subresourceRange.baseArrayLayer	= 0;
+		image_view_create_info.subresourceRange.layerCount		= layer_count;
+
+		VkImageView view {};
+		auto result = vkCreateImageView(
+			instance->GetVulkanDevice(),
+			&image_view_create_info,
+			nullptr,
+			&view
+		);
+		if( result != VK_SUCCESS ) {
+			instance->Report( result, "Internal error: Cannot create mip level image view!" );
+			DestroyMipLevelImageViews( instance, mip_level_views );
+			return {};
+		}
+		mip_level_views.push_back( view );
+	}
+
+	return mip_level_views;
+}
+
+void vk2d::vk2d_internal::DestroyMipLevelImageViews(
+	InstanceImpl					*	instance,
+	std::vector<VkImageView>		&	mip_level_views
+)
+{
+	for( auto v : mip_level_views ) {
+		vkDestroyImageView(
+			instance->GetVulkanDevice(),
+			v,
+			nullptr
+		);
+	}
+	mip_level_views.clear();
+}
+
+void vk2d::vk2d_internal::CmdGenerateMipmapsWithCompute(
+	InstanceImpl					*	instance,
+	VkCommandBuffer						command_buffer,
+	const std::vector<VkImageView>	&	mip_level_views,
+	const std::vector<VkExtent2D>	&	mip_level_sizes,
+	uint32_t							layer_count,
+	MipmapFilter						filter
+)
+{
+	assert( instance );
+	assert( command_buffer );
+	assert( std::size( mip_level_views ) == std::size( mip_level_sizes ) );
+
+	auto mip_level_count		= uint32_t( std::size( mip_level_sizes ) );
+	if( mip_level_count < 2 ) return;
+
+	auto pipeline_layout		= instance->GetComputeMipmapDownsamplePipelineLayout();
+
+	vkCmdBindPipeline(
+		command_buffer,
+		VK_PIPELINE_BIND_POINT_COMPUTE,
+		instance->GetComputeMipmapDownsamplePipeline()
+	);
+
+	uint32_t source_level = 0;
+	while( source_level + 1 < mip_level_count ) {
+
+		// Shared memory chaining only works when each destination texel
+		// covers exactly 2x2 texels of the level above, so we only keep
+		// adding levels to this dispatch while level sizes are even.
+		// Kaiser samples outside of the tile so it's one level per dispatch.
+		uint32_t level_count = 1;
+		if( filter == MipmapFilter::BOX ) {
+			while( level_count < MIPMAP_DOWNSAMPLE_MAX_LEVELS_PER_DISPATCH &&
+				source_level + level_count + 1 < mip_level_count ) {
+				auto & chained_source = mip_level_sizes[ source_level + level_count ];
+				if( chained_source.width % 2 || chained_source.height % 2 ) break;
+				++level_count;
+			}
+		}
+
+		// Source and destinations. Destination bindings beyond level_count are
+		// not written by the shader but must still be valid, point them to the
+		// last destination.
+		std::array<VkDescriptorImageInfo, 1 + MIPMAP_DOWNSAMPLE_MAX_LEVELS_PER_DISPATCH> image_infos {};
+		for( uint32_t i = 0; i < std::size( image_infos ); ++i ) {
+			auto level = std::min( source_level + i, source_level + level_count );
+			image_infos[ i ].sampler		= VK_NULL_HANDLE;
+			image_infos[ i ].imageView		= mip_level_views[ level ];
+			image_infos[ i ].imageLayout	= VK_IMAGE_LAYOUT_GENERAL;
+		}
+
+		std::array<VkWriteDescriptorSet, 1 + MIPMAP_DOWNSAMPLE_MAX_LEVELS_PER_DISPATCH> descriptor_writes {};
+		for( uint32_t i = 0; i < std::size( descriptor_writes ); ++i ) {
+			descriptor_writes[ i ].sType			= VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptor_writes[ i ].pNext			= nullptr;
+			descriptor_writes[ i ].dstSet			= VK_NULL_HANDLE;	// Ignored when pushing descriptor set directly into the command buffer.
+			descriptor_writes[ i ].dstBinding		= i;
+			descriptor_writes[ i ].dstArrayElement	= 0;
+			descriptor_writes[ i ].descriptorCount	= 1;
+			descriptor_writes[ i ].descriptorType	= VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+			descriptor_writes[ i ].pImageInfo		= &image_infos[ i ];
+			descriptor_writes[ i ].pBufferInfo		= nullptr;
+			descriptor_writes[ i ].pTexelBufferView	= nullptr;
+		}
+
+		instance->VkFun_vkCmdPushDescriptorSetKHR(
+			command_buffer,
+			VK_PIPELINE_BIND_POINT_COMPUTE,
+			pipeline_layout,
+			0,
+			uint32_t( std::size( descriptor_writes ) ),
+			descriptor_writes.data()
+		);
+
+		ComputeMipmapDownsamplePushConstants push_constants {};
+		push_constants.source_size		= { mip_level_sizes[ source_level ].width, mip_level_sizes[ source_level ].height };
+		push_constants.level_count		= level_count;
+		push_constants.filter_type		= uint32_t( filter );
+
+		vkCmdPushConstants(
+			command_buffer,
+			pipeline_layout,
+			VK_SHADER_STAGE_COMPUTE_BIT,
+			0,
+			uint32_t( sizeof( ComputeMipmapDownsamplePushConstants ) ),
+			&push_constants
+		);
+
+		auto & first_destination = mip_level_sizes[ source_level + 1 ];
+		vkCmdDispatch(
+			command_buffer,
+			( first_destination.width + MIPMAP_DOWNSAMPLE_TILE_SIZE - 1 ) / MIPMAP_DOWNSAMPLE_TILE_SIZE,
+			( first_destination.height + MIPMAP_DOWNSAMPLE_TILE_SIZE - 1 ) / MIPMAP_DOWNSAMPLE_TILE_SIZE,
+			layer_count
+		);
+
+		source_level += level_count;
+
+		// Next dispatch reads the last level written by this one.
+		if( source_level + 1 < mip_level_count ) {
+			VkMemoryBarrier memory_barrier {};
+			memory_barrier.sType			= VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+			memory_barrier.pNext			= nullptr;
+			memory_barrier.srcAccessMask	= VK_ACCESS_SHADER_WRITE_BIT;
+			memory_barrier.dstAccessMask	= VK_ACCESS_SHADER_READ_BIT;
+
+			vkCmdPipelineBarrier(
+				command_buffer,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT,
+				0,
+				1, &memory_barrier,
+				0, nullptr,
+				0, nullptr
+			);
+		}
+	}
+}
+
+glm::vec2 vk2d::vk2d_internal::CalculateSurfacePixelsPerUnit(
+	RenderCoordinateSpace				coordinate_space,
+	glm::uvec2							surface_size
+)
+{
+	// Inverse of the coordinate scaling in CmdUpdateFrameData().
+	auto contained_minimum_dimension = float( std::min( surface_size.x, surface_size.y ) );
+
+	switch( coordinate_space ) {
+		case RenderCoordinateSpace::TEXEL_SPACE:
+		case RenderCoordinateSpace::TEXEL_SPACE_CENTERED:
+			return glm::vec2( 1.0f, 1.0f );
+		case RenderCoordinateSpace::NORMALIZED_SPACE:
+			return glm::vec2( contained_minimum_dimension );
+		case RenderCoordinateSpace::NORMALIZED_SPACE_CENTERED:
+			return glm::vec2( contained_minimum_dimension / 2.0f );
+		case RenderCoordinateSpace::LINEAR_SPACE:
+			return glm::vec2( surface_size ) / 2.0f;
+		default:
+			return glm::vec2( 1.0f, 1.0f );
+	}
+}
+
+bool vk2d::vk2d_internal::IsTextureMinified(
+	const std::vector<Vertex>		&	vertices,
+	const std::vector<glm::mat4>	&	transformations,
+	glm::uvec2							texture_size,
+	glm::vec2							surface_pixels_per_unit
+)
+{
+	if( std::empty( vertices ) ) return false;
+
+	glm::vec2 coords_min	= vertices[ 0 ].vertex_coords;
+	glm::vec2 coords_max	= vertices[ 0 ].vertex_coords;
+	glm::vec2 uv_min		= vertices[ 0 ].uv_coords;
+	glm::vec2 uv_max		= vertices[ 0 ].uv_coords;
+	for( auto & v : vertices ) {
+		coords_min			= glm::min( coords_min, v.vertex_coords );
+		coords_max			= glm::max( coords_max, v.vertex_coords );
+		uv_min				= glm::min( uv_min, v.uv_coords );
+		uv_max				= glm::max( uv_max, v.uv_coords );
+	}
+
+	// Scale of each axis is the length of the matching transformation column.
+	glm::vec2 scale			= glm::vec2( 1.0f, 1.0f );
+	if( std::size( transformations ) ) {
+		scale				= glm::vec2( std::numeric_limits<float>::max() );
+		for( auto & t : transformations ) {
+			scale			= glm::min( scale, glm::vec2( glm::length( glm::vec2( t[ 0 ] ) ), glm::length( glm::vec2( t[ 1 ] ) ) ) );
+		}
+	}
+
+	glm::vec2 pixel_extent	= ( coords_max - coords_min ) * scale * surface_pixels_per_unit;
+	glm::vec2 texel_extent	= ( uv_max - uv_min ) * glm::vec2( texture_size );
+
+	// Half a pixel of slack so that 1:1 draws are not counted as minified because of rounding.
+	return
+		pixel_extent.x + 0.5f < texel_extent.x ||
+		pixel_extent.y + 0.5f < texel_extent.y;
+}
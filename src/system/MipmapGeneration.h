@@ -0,0 +1,173 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+#include "types/MipmapFilter.h"
+#include "types/MeshPrimitives.hpp"
+#include "types/RenderCoordinateSpace.hpp"
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+class InstanceImpl;
+class ResolvedQueue;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Check if mipmaps can be generated with compute shaders.
+///
+///				Compute mipmap generation needs the image format to be usable as a storage image and the queue where the
+///				commands are recorded to must support compute. If this returns false mipmaps must be generated by blitting.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	instance
+///				Pointer to instance.
+///
+/// @param[in]	format
+///				Format of the image we wish to generate mipmaps for.
+///
+/// @param[in]	queue
+///				Queue where mipmap generation commands will be submitted to.
+///
+/// @return		true if compute mipmap generation can be used, false otherwise.
+bool												IsComputeMipmapGenerationSupported(
+	InstanceImpl								*	instance,
+	VkFormat										format,
+	const ResolvedQueue							&	queue );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Create one image view per mip level for compute mipmap generation.
+///
+///				Image must have been created with VK_IMAGE_USAGE_STORAGE_BIT. Views are 2D array views so that layered
+///				textures can be processed with a single dispatch per mip level batch.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	instance
+///				Pointer to instance.
+///
+/// @param[in]	image
+///				Image we wish to generate mipmaps for.
+///
+/// @param[in]	format
+///				Format of the image.
+///
+/// @param[in]	mip_level_count
+///				Amount of mip levels in the image, one view is created per mip level.
+///
+/// @param[in]	layer_count
+///				Amount of array layers in the image.
+///
+/// @return		List of image views, one per mip level, or empty list if something went wrong.
+std::vector<VkImageView>							CreateMipLevelImageViews(
+	InstanceImpl								*	instance,
+	VkImage											image,
+	VkFormat										format,
+	uint32_t										mip_level_count,
+	uint32_t										layer_count );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Destroy image views created with CreateMipLevelImageViews().
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	instance
+///				Pointer to instance.
+///
+/// @param[in]	mip_level_views
+///				Image views to destroy, list is cleared.
+void												DestroyMipLevelImageViews(
+	InstanceImpl								*	instance,
+	std::vector<VkImageView>					&	mip_level_views );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Record commands to generate mip levels 1 and up from mip level 0 with compute shaders.
+///
+///				Box filter generates up to 4 mip levels per dispatch using shared memory, Kaiser filter generates one mip level
+///				per dispatch. A memory barrier is recorded between dispatches, not between mip levels.
+///				<br>
+///				All mip levels must be in VK_IMAGE_LAYOUT_GENERAL and mip level 0 contents must be visible to compute shader
+///				reads before calling this. Caller is responsible for making the compute shader writes visible and transitioning
+///				the image to its final layout afterwards.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	instance
+///				Pointer to instance.
+///
+/// @param[in]	command_buffer
+///				Command buffer where to record the commands to. Must be in a queue that supports compute.
+///
+/// @param[in]	mip_level_views
+///				Image views, one per mip level, see CreateMipLevelImageViews().
+///
+/// @param[in]	mip_level_sizes
+///				Size of each mip level, see GenerateMipSizes().
+///
+/// @param[in]	layer_count
+///				Amount of array layers in the image, all layers are processed.
+///
+/// @param[in]	filter
+///				Filter to use when generating mip levels.
+void												CmdGenerateMipmapsWithCompute(
+	InstanceImpl								*	instance,
+	VkCommandBuffer									command_buffer,
+	const std::vector<VkImageView>				&	mip_level_views,
+	const std::vector<VkExtent2D>				&	mip_level_sizes,
+	uint32_t										layer_count,
+	MipmapFilter									filter );
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get how many surface pixels one coordinate unit covers.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	coordinate_space
+///				Coordinate space of the window or render target texture being drawn to.
+///
+/// @param[in]	surface_size
+///				Size of the window or render target texture being drawn to in pixels.
+///
+/// @return		Pixels per coordinate unit on both axes.
+glm::vec2											CalculateSurfacePixelsPerUnit(
+	RenderCoordinateSpace							coordinate_space,
+	glm::uvec2										surface_size );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Estimate if a draw shows a texture smaller than its texel size.
+///
+///				Compares the bounding box of the vertex coordinates to the bounding box of the UV coordinates on both axes. The
+///				smallest scale found in the transformations is used so that the result is true if any instance is shrunk. This
+///				is exact for axis aligned rectangles and an estimate for anything else.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	vertices
+///				Vertices of the draw.
+///
+/// @param[in]	transformations
+///				Per instance transformations of the draw, empty if the draw is not instanced.
+///
+/// @param[in]	texture_size
+///				Size of the texture in texels.
+///
+/// @param[in]	surface_pixels_per_unit
+///				See CalculateSurfacePixelsPerUnit().
+///
+/// @return		true if the texture is shrunk on either axis, false otherwise.
+bool												IsTextureMinified(
+	const std::vector<Vertex>					&	vertices,
+	const std::vector<glm::mat4>				&	transformations,
+	glm::uvec2										texture_size,
+	glm::vec2										surface_pixels_per_unit );
+
+
+
+} // vk2d_internal
+
+} // vk2d
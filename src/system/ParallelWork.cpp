@@ -0,0 +1,165 @@
+#include "core/SourceCommon.h"
+
+#include "system/ParallelWork.h"
+#include "system/ThreadPool.h"
+#include "system/ThreadPrivateResources.h"
+
+#include <shared_mutex>
+
+
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Shared by the thread calling ParallelForRanges() and the worker threads
+// helping it. Helpers may start only after all ranges were processed so
+// they must not touch work unless they registered before the job closed.
+struct ParallelWorkJob {
+	const std::function<void( size_t, size_t, size_t )>	*	work						= {};
+	size_t													item_count					= {};
+	size_t													range_size					= {};
+	size_t													range_count					= {};
+	std::atomic_size_t										next_range					= {};
+
+	std::mutex												helper_mutex;
+	std::condition_variable									helpers_finished;
+	uint32_t												active_helper_count			= {};
+	bool													closed						= {};
+};
+
+// Claims and processes ranges until there are none left.
+void ProcessParallelWorkRanges(
+	ParallelWorkJob										&	job
+)
+{
+	while( true ) {
+		auto range_index = job.next_range.fetch_add( 1 );
+		if( range_index >= job.range_count ) return;
+
+		auto begin	= range_index * job.range_size;
+		auto end	= std::min( begin + job.range_size, job.item_count );
+		( *job.work )( range_index, begin, end );
+	}
+}
+
+class ParallelWorkTask : public Task
+{
+public:
+	ParallelWorkTask(
+		std::shared_ptr<ParallelWorkJob>	job ) :
+		job( std::move( job ) )
+	{};
+
+	void operator()(
+		ThreadPrivateResource			*	thread_resource )
+	{
+		{
+			std::lock_guard<std::mutex> lock_guard( job->helper_mutex );
+			if( job->closed ) return;
+			++job->active_helper_count;
+		}
+
+		ProcessParallelWorkRanges( *job );
+
+		{
+			std::lock_guard<std::mutex> lock_guard( job->helper_mutex );
+			--job->active_helper_count;
+		}
+		job->helpers_finished.notify_all();
+	}
+
+private:
+	std::shared_ptr<ParallelWorkJob>		job					= {};
+};
+
+
+
+// Held shared while parallel work is in progress, exclusively when
+// creating or destroying the worker threads.
+std::shared_mutex							parallel_work_mutex;
+std::unique_ptr<ThreadPool>					parallel_work_thread_pool		= {};
+uint32_t									parallel_work_thread_count		= {};
+
+} // vk2d_internal
+
+} // vk2d
+
+
+
+bool vk2d::vk2d_internal::CreateParallelWorkThreads()
+{
+	std::unique_lock<std::shared_mutex> unique_lock( parallel_work_mutex );
+
+	assert( !parallel_work_thread_pool );
+
+	// Calling thread also does work, one less worker is needed.
+	uint32_t thread_count		= uint32_t( std::thread::hardware_concurrency() );
+	if( thread_count <= 1 ) return true;
+	--thread_count;
+
+	std::vector<std::unique_ptr<ThreadPrivateResource>> thread_resources;
+	for( uint32_t i = 0; i < thread_count; ++i ) {
+		thread_resources.push_back( std::make_unique<ThreadGeneralResource>() );
+	}
+
+	auto thread_pool = std::make_unique<ThreadPool>( std::move( thread_resources ) );
+	if( !thread_pool || !thread_pool->IsGood() ) return false;
+
+	parallel_work_thread_pool	= std::move( thread_pool );
+	parallel_work_thread_count	= thread_count;
+	return true;
+}
+
+void vk2d::vk2d_internal::DestroyParallelWorkThreads()
+{
+	std::unique_lock<std::shared_mutex> unique_lock( parallel_work_mutex );
+
+	parallel_work_thread_pool	= nullptr;
+	parallel_work_thread_count	= 0;
+}
+
+void vk2d::vk2d_internal::ParallelForRanges(
+	size_t																item_count,
+	size_t																range_size,
+	const std::function<void( size_t range_index, size_t begin, size_t end )>	&	work
+)
+{
+	assert( range_size > 0 );
+
+	auto range_count = GetParallelRangeCount( item_count, range_size );
+	if( range_count == 0 ) return;
+	if( range_count == 1 ) {
+		work( 0, 0, item_count );
+		return;
+	}
+
+	auto job			= std::make_shared<ParallelWorkJob>();
+	job->work			= &work;
+	job->item_count		= item_count;
+	job->range_size		= range_size;
+	job->range_count	= range_count;
+
+	std::shared_lock<std::shared_mutex> shared_lock( parallel_work_mutex );
+
+	// Helpers are queued behind whatever the worker threads are doing. If
+	// they don't get to it in time this thread has already processed every
+	// range and the helpers exit without doing anything.
+	if( parallel_work_thread_pool ) {
+		auto helper_count = std::min( size_t( parallel_work_thread_count ), range_count - 1 );
+		for( size_t i = 0; i < helper_count; ++i ) {
+			parallel_work_thread_pool->ScheduleTask( std::make_unique<ParallelWorkTask>( job ) );
+		}
+	}
+
+	ProcessParallelWorkRanges( *job );
+
+	std::unique_lock<std::mutex> unique_lock( job->helper_mutex );
+	job->closed = true;
+	job->helpers_finished.wait( unique_lock, [ &job ]()
+		{
+			return job->active_helper_count == 0;
+		} );
+}
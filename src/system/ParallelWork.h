@@ -0,0 +1,80 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+#include <functional>
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Create the worker threads shared by all parallel work, eg. large mesh operations.
+///
+///				Created with the first instance and destroyed with the last one. Without worker threads all parallel work
+///				runs on the calling thread.
+///
+/// @note		Multithreading: Main thread only, must be called while holding the instance globals mutex.
+///
+/// @return		true if successful, false otherwise.
+bool												CreateParallelWorkThreads();
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Destroy the worker threads created with CreateParallelWorkThreads().
+///
+///				Waits until all parallel work in progress has finished.
+///
+/// @note		Multithreading: Main thread only, must be called while holding the instance globals mutex.
+void												DestroyParallelWorkThreads();
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Split a range of items into fixed size ranges and process them on the worker threads and the calling thread.
+///
+///				Range boundaries only depend on item_count and range_size, never on the amount of threads, so work that
+///				processes each item independently gives the same result every time. If everything fits in a single range
+///				it is processed on the calling thread without involving the worker threads at all.
+///
+///				Returns when all ranges have been processed. Ranges may run in any order and at the same time, work must
+///				not touch items outside of its range.
+///
+/// @note		Multithreading: Any thread. Must not be called from inside work.
+///
+/// @param[in]	item_count
+///				Total amount of items.
+///
+/// @param[in]	range_size
+///				Maximum amount of items in a single range, must be larger than 0.
+///
+/// @param[in]	work
+///				Function that processes a range, called with range index, first item and one past the last item.
+void												ParallelForRanges(
+	size_t											item_count,
+	size_t											range_size,
+	const std::function<void( size_t range_index, size_t begin, size_t end )>	&	work );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get the amount of ranges ParallelForRanges() splits items into.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	item_count
+///				Total amount of items.
+///
+/// @param[in]	range_size
+///				Maximum amount of items in a single range, must be larger than 0.
+///
+/// @return		Amount of ranges.
+inline size_t										GetParallelRangeCount(
+	size_t											item_count,
+	size_t											range_size )
+{
+	return ( item_count + range_size - 1 ) / range_size;
+}
+
+
+
+} // vk2d_internal
+
+} // vk2d
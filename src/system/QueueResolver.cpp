@@ -118,6 +118,22 @@ VK2D_API vk2d::vk2d_internal::DeviceQueueResolver::DeviceQueueResolver(
 		i.based_on				= UINT32_MAX;
 	}
 
+	// Counts how many capabilities a family has on top of the ones requested. Families with
+	// fewer extra capabilities are preferred, this way a request for a transfer or a compute
+	// queue lands on a dedicated (asynchronous) engine when the hardware exposes one instead
+	// of taking yet another queue from the graphics family.
+	auto CountExtraCapabilities =[ this ](
+		uint32_t		family_index,
+		VkQueueFlags	requested
+		) -> uint32_t
+	{
+		VkQueueFlags capabilities	= family_properties[ family_index ].queueFlags & ( VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT );
+		VkQueueFlags extra			= capabilities & ~requested;
+		uint32_t count				= 0;
+		for( ; extra; extra &= extra - 1 ) ++count;
+		return count;
+	};
+
 	// find queue families for queue types and also check for available queue count in that family
 	for( uint32_t q=0; q < queueTypes.size(); ++q ) {
 		uint32_t family_candidate = UINT32_MAX;
@@ -127,10 +143,15 @@ VK2D_API vk2d::vk2d_internal::DeviceQueueResolver::DeviceQueueResolver(
 					if( family_candidate == UINT32_MAX ) {
 						// found initial candidate
 						family_candidate = f;
-					} else if( available_queues[ family_candidate ] &&
-						family_properties[ f ].queueCount < family_properties[ family_candidate ].queueCount ) {
-						// found a better candidate
-						family_candidate = f;
+					} else {
+						auto candidate_extra	= CountExtraCapabilities( family_candidate, queueTypes[ q ].first );
+						auto current_extra		= CountExtraCapabilities( f, queueTypes[ q ].first );
+						if( current_extra < candidate_extra ||
+							( current_extra == candidate_extra &&
+							family_properties[ f ].queueCount < family_properties[ family_candidate ].queueCount ) ) {
+							// found a better candidate
+							family_candidate = f;
+						}
 					}
 				}
 			}
@@ -35,31 +35,55 @@ struct RenderTargetTextureDependencyInfo
 
 
 
-/// @brief		Used to collect render information from render target texture when render is going to happen.
-/// @see		WindowImpl::EndRender().
-class RenderTargetTextureRenderCollector
+/// @brief		Render target texture renders that go into a single window frame submission.
+///
+///				Built by committing render target texture renders, see WindowImpl::EndRender(). Only renders that the window
+///				draws, directly or through other render target textures, are added to the graph, renders nobody draws are
+///				never submitted. A render is always added after the renders it depends on, Sort() then groups renders by
+///				dependency depth so that independent renders are next to each other.
+///				<br>
+///				All command buffers in the graph are submitted in a single batch, transfer command buffers first and render
+///				command buffers after them in graph order. Renders that depend on each other need no semaphores, every render
+///				target texture render ends with a pipeline barrier that makes the sampled image visible to fragment shaders
+///				of everything submitted after it. Semaphores are only waited for renders that were submitted earlier, for
+///				example by another window.
+class RenderTargetTextureRenderGraph
 {
 	friend WindowImpl;
 
 public:
-	struct Collection
+	struct Node
 	{
-		VkSubmitInfo		*	vk_transfer_submit_info			= {};
-		VkSubmitInfo		*	vk_render_submit_info			= {};
+		RenderTargetTextureImpl							*	render_target					= {};
+		uint32_t											swap_buffer_index				= {};
+		VkCommandBuffer										vk_transfer_command_buffer		= {};
+		VkCommandBuffer										vk_render_command_buffer		= {};
+		VkSemaphore											vk_render_complete_semaphore	= {};	// Timeline, signaled when the whole submission completes.
+		uint64_t											render_counter					= {};	// Value vk_render_complete_semaphore is signaled to.
+		uint32_t											depth							= {};	// 0 if this render does not depend on other renders in the graph.
 	};
 
-	void						Append(
-		VkSubmitInfo		*	transfer_submit_info,
-		VkSubmitInfo		*	render_submit_info
-	);
+	void													AddNode(
+		const RenderTargetTextureRenderGraph::Node		&	node );
 
-	RenderTargetTextureRenderCollector::Collection				&	operator[]( size_t index );
-	RenderTargetTextureRenderCollector::Collection				*	begin();
-	RenderTargetTextureRenderCollector::Collection				*	end();
-	size_t																			size();
+	// Dependency on a render that is not in the graph, the whole submission waits for it.
+	void													AddExternalDependency(
+		VkSemaphore											timeline_semaphore,
+		uint64_t											value );
+
+	// Returns nullptr if the render was not added to this graph.
+	const RenderTargetTextureRenderGraph::Node			*	FindNode(
+		const RenderTargetTextureDependencyInfo			&	dependency_info ) const;
+
+	// Orders nodes by depth, order within the same depth is kept.
+	void													Sort();
+
+	size_t													size() const;
 
 private:
-	std::vector<RenderTargetTextureRenderCollector::Collection>	collection;
+	std::vector<RenderTargetTextureRenderGraph::Node>		nodes;
+	std::vector<VkSemaphore>								external_wait_semaphores;
+	std::vector<uint64_t>									external_wait_semaphore_values;		// Used with external_wait_semaphores.
 };
 
 
@@ -5,39 +5,61 @@
 
 #include "interface/InstanceImpl.h"
 
-void vk2d::vk2d_internal::RenderTargetTextureRenderCollector::Append(
-	VkSubmitInfo	*	transfer_submit_info,
-	VkSubmitInfo	*	render_submit_info
+void vk2d::vk2d_internal::RenderTargetTextureRenderGraph::AddNode(
+	const RenderTargetTextureRenderGraph::Node		&	node
 )
 {
-	collection.push_back( RenderTargetTextureRenderCollector::Collection {
-		transfer_submit_info,
-		render_submit_info
-	} );
+	assert( !FindNode( { node.render_target, node.swap_buffer_index } ) );
+	nodes.push_back( node );
 }
 
-vk2d::vk2d_internal::RenderTargetTextureRenderCollector::Collection & vk2d::vk2d_internal::RenderTargetTextureRenderCollector::operator[](
-	size_t	index
+void vk2d::vk2d_internal::RenderTargetTextureRenderGraph::AddExternalDependency(
+	VkSemaphore				timeline_semaphore,
+	uint64_t				value
 )
 {
-	assert( index < std::size( collection ) );
-	return collection[ index ];
+	// Same render can be drawn by several render target textures in the graph.
+	for( size_t i = 0; i < std::size( external_wait_semaphores ); ++i ) {
+		if( external_wait_semaphores[ i ] == timeline_semaphore ) {
+			external_wait_semaphore_values[ i ] = std::max( external_wait_semaphore_values[ i ], value );
+			return;
+		}
+	}
+	external_wait_semaphores.push_back( timeline_semaphore );
+	external_wait_semaphore_values.push_back( value );
 }
 
-vk2d::vk2d_internal::RenderTargetTextureRenderCollector::Collection * vk2d::vk2d_internal::RenderTargetTextureRenderCollector::begin()
+const vk2d::vk2d_internal::RenderTargetTextureRenderGraph::Node * vk2d::vk2d_internal::RenderTargetTextureRenderGraph::FindNode(
+	const RenderTargetTextureDependencyInfo			&	dependency_info
+) const
 {
-	// TODO: Do proper iterator for RenderTargetTextureRenderCollector.
-	return collection.data();
+	auto it = std::find_if(
+		nodes.begin(),
+		nodes.end(),
+		[ &dependency_info ]( const RenderTargetTextureRenderGraph::Node & n )
+		{
+			return n.render_target == dependency_info.render_target && n.swap_buffer_index == dependency_info.swap_buffer_index;
+		} );
+	if( it == nodes.end() ) return nullptr;
+	return &*it;
 }
 
-vk2d::vk2d_internal::RenderTargetTextureRenderCollector::Collection * vk2d::vk2d_internal::RenderTargetTextureRenderCollector::end()
+void vk2d::vk2d_internal::RenderTargetTextureRenderGraph::Sort()
 {
-	return collection.data() + std::size( collection );
+	// Nodes were added after their dependencies so they are already in
+	// a valid order, stable sort keeps it valid within the same depth.
+	std::stable_sort(
+		nodes.begin(),
+		nodes.end(),
+		[]( const RenderTargetTextureRenderGraph::Node & a, const RenderTargetTextureRenderGraph::Node & b )
+		{
+			return a.depth < b.depth;
+		} );
 }
 
-size_t vk2d::vk2d_internal::RenderTargetTextureRenderCollector::size()
+size_t vk2d::vk2d_internal::RenderTargetTextureRenderGraph::size() const
 {
-	return collection.size();
+	return nodes.size();
 }
 
 vk2d::Multisamples vk2d::vk2d_internal::CheckSupportedMultisampleCount(
@@ -37,18 +37,195 @@ struct GraphicsPrimaryRenderPushConstants {
 	alignas( 4 )	uint32_t					texture_channel_weight_count	= {};	// Just the amount of texture channels.
 };
 
+// Signed distance field push constants are placed after the primary render
+// push constants in the same push constant range.
+constexpr uint32_t GRAPHICS_PRIMARY_RENDER_SIGNED_DISTANCE_FIELD_PUSH_CONSTANT_OFFSET	= 32;
+
+struct GraphicsSignedDistanceFieldPushConstants {
+	alignas( 16 )	glm::vec4					outline_color			= {};
+	alignas( 16 )	glm::vec4					shadow_color			= {};
+	alignas( 8 )	glm::vec2					shadow_offset			= {};	// In atlas texels.
+	alignas( 4 )	float						outline_width			= {};	// In atlas texels.
+	alignas( 4 )	float						shadow_softness			= {};	// In atlas texels.
+	alignas( 4 )	float						spread					= {};	// Distance field range on both sides of the edge in atlas texels.
+};
+
+// Glyph instance push constants are placed after the signed distance field
+// push constants so that instanced glyphs can use signed distance fields.
+constexpr uint32_t GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET		= 96;
+
+struct GraphicsGlyphInstancePushConstants {
+	alignas( 8 )	glm::vec2					origin					= {};	// Text origin.
+	alignas( 8 )	glm::vec2					scale					= {};	// Text scale.
+	alignas( 4 )	uint32_t					vertical				= {};	// 1 if vertical glyph rectangles are used.
+};
+
+// Per glyph record read by the glyph instance vertex shader, stored in the
+// vertex buffer in place of vertices.
+struct GlyphInstance {
+	alignas( 8 )	glm::vec2					position				= {};	// Unscaled pen position on the baseline relative to text origin.
+	alignas( 4 )	uint32_t					glyph					= {};	// Glyph table index in the lower 16 bits, atlas layer in the upper 16 bits.
+	alignas( 4 )	uint32_t					color					= {};	// RGBA, 8 bits per channel, red in the lowest bits.
+};
+
+// Glyph table is stored in the texture channel weights buffer. Entries are
+// UV rectangle, horisontal glyph rectangle and vertical glyph rectangle,
+// each as top left and bottom right corners.
+constexpr uint32_t GLYPH_TABLE_FLOATS_PER_GLYPH								= 12;
+
+// Shape instance push constants share space with glyph instance push
+// constants, they are never used by the same pipeline.
+constexpr uint32_t GRAPHICS_PRIMARY_RENDER_SHAPE_INSTANCE_PUSH_CONSTANT_OFFSET		= GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET;
+
+// Shape evaluated by the shape instance fragment shader.
+enum class ShapeInstanceType : uint32_t {
+	CIRCLE						= 0,
+	ROUNDED_RECTANGLE			= 1,
+	RING						= 2,
+};
+
+struct GraphicsShapeInstancePushConstants {
+	alignas( 8 )	glm::vec2					render_target_size		= {};	// Size of the render target in pixels.
+	alignas( 4 )	ShapeInstanceType			shape					= {};	// Shape of every instance in the draw.
+};
+
+// Per shape record read by the shape instance shaders, stored in the vertex
+// buffer in place of vertices.
+struct ShapeInstance {
+	alignas( 8 )	glm::vec2					center					= {};	// Center of the shape.
+	alignas( 8 )	glm::vec2					half_size				= {};	// Half of the width and height of the shape.
+	alignas( 4 )	float						parameter				= {};	// Corner radius for rounded rectangles, inner radius for rings.
+	alignas( 4 )	uint32_t					color					= {};	// RGBA, 8 bits per channel, red in the lowest bits.
+};
+
+// Polyline push constants share space with glyph instance push constants,
+// they are never used by the same pipeline.
+constexpr uint32_t GRAPHICS_PRIMARY_RENDER_POLYLINE_PUSH_CONSTANT_OFFSET			= GRAPHICS_PRIMARY_RENDER_GLYPH_INSTANCE_PUSH_CONSTANT_OFFSET;
+
+struct GraphicsPolylinePushConstants {
+	alignas( 8 )	glm::vec2					render_target_size		= {};	// Size of the render target in pixels.
+	alignas( 4 )	uint32_t					join					= {};	// Matches vk2d::PolylineJoin.
+	alignas( 4 )	uint32_t					cap						= {};	// Matches vk2d::PolylineCap.
+	alignas( 4 )	float						miter_limit				= {};	// Longest allowed miter relative to half of the line width.
+};
+
+// Polyline point flags.
+constexpr uint32_t POLYLINE_POINT_FLAG_FIRST								= 1 << 0;	// First point of a polyline, there is no previous point.
+constexpr uint32_t POLYLINE_POINT_FLAG_LAST									= 1 << 1;	// Last point of a polyline, there is no next point.
+constexpr uint32_t POLYLINE_POINT_FLAG_NEIGHBOUR_ONLY						= 1 << 2;	// Only used to join the neighbouring segment, segments to this point are not drawn.
+
+// Per point record read by the polyline shaders, stored in the vertex buffer
+// in place of vertices. Segment i is drawn between points i and i + 1 as
+// instance i, points of all polylines in a draw are packed back to back.
+struct PolylinePointInstance {
+	alignas( 8 )	glm::vec2					position				= {};	// Location of the point.
+	alignas( 4 )	float						width					= {};	// Line width at this point.
+	alignas( 4 )	uint32_t					color					= {};	// RGBA, 8 bits per channel, red in the lowest bits.
+	alignas( 4 )	uint32_t					flags					= {};	// POLYLINE_POINT_FLAG_* bits.
+};
+
 struct GraphicsBlurPushConstants
 {
 	alignas( 4 )	std::array<float, 4>		blur_info				= {};	// [ 0 ] = sigma, [ 1 ] = precomputed normalizer, [ 2 ] = initial coefficient, [ 3 ] = initial natural exponentation, 
 	alignas( 4 )	std::array<float, 2>		pixel_size				= {};	// Pixel size on a canvas considered ranging from 0 to 1.
 };
 
+struct ComputeMipmapDownsamplePushConstants
+{
+	alignas( 8 )	glm::uvec2					source_size				= {};	// Source mip level size in texels.
+	alignas( 4 )	uint32_t					level_count				= {};	// Amount of destination levels to generate in this dispatch, 1 to 4.
+	alignas( 4 )	uint32_t					filter_type				= {};	// 0 = box, 1 = Kaiser, matches vk2d::MipmapFilter.
+};
+
+// Compute blur processes runs of this many texels per work group and can
+// sample at most this many texels on each side of the center texel.
+constexpr uint32_t COMPUTE_BLUR_WORK_GROUP_SIZE								= 256;
+constexpr uint32_t COMPUTE_BLUR_MAX_RADIUS									= 256;
+
+struct ComputeBlurPushConstants
+{
+	alignas( 8 )	glm::uvec2					image_size				= {};	// Source and destination image size in texels.
+	alignas( 4 )	uint32_t					direction				= {};	// 0 = horisontal, 1 = vertical.
+	alignas( 4 )	uint32_t					blur_type				= {};	// Matches vk2d::BlurType.
+	alignas( 4 )	float						sigma					= {};	// Gaussian standard deviation in texels.
+	alignas( 4 )	uint32_t					radius					= {};	// Amount of texels sampled on each side of the center texel.
+};
+
+// Dual Kawase blur processes tiles of this size per work group.
+constexpr uint32_t COMPUTE_DUAL_KAWASE_WORK_GROUP_SIZE						= 16;
+
+struct ComputeDualKawasePushConstants
+{
+	alignas( 8 )	glm::uvec2					destination_size		= {};	// Destination mip level size in texels.
+	alignas( 8 )	glm::vec2					sample_offset			= {};	// Half a source texel in UV coordinates multiplied by the blur offset.
+};
+
+// Particle compute shaders process this many particles per work group.
+constexpr uint32_t PARTICLE_WORK_GROUP_SIZE									= 64;
+
+// Particle as stored in the particle buffer, written by the particle
+// compute shaders and read by the particle vertex shader.
+struct ParticleData {
+	alignas( 8 )	glm::vec2					position				= {};
+	alignas( 8 )	glm::vec2					velocity				= {};
+	alignas( 4 )	float						age						= {};	// Seconds since the particle was emitted.
+	alignas( 4 )	float						lifetime				= {};	// Particle is dead when age reaches lifetime.
+	alignas( 4 )	float						size_begin				= {};
+	alignas( 4 )	float						size_end				= {};
+	alignas( 4 )	uint32_t					color_begin				= {};	// RGBA, 8 bits per channel, red in the lowest bits.
+	alignas( 4 )	uint32_t					color_end				= {};	// RGBA, 8 bits per channel, red in the lowest bits.
+	alignas( 4 )	float						rotation				= {};
+	alignas( 4 )	float						angular_velocity		= {};
+};
+
+struct ComputeParticleEmitPushConstants
+{
+	alignas( 8 )	glm::vec2					position				= {};	// Center of the emitter.
+	alignas( 4 )	float						radius					= {};	// Particles are emitted inside a circle of this radius.
+	alignas( 4 )	float						direction				= {};	// Direction of the initial velocity in radians.
+	alignas( 4 )	float						spread					= {};	// Full angle in radians around direction the velocity can point at.
+	alignas( 4 )	float						speed_min				= {};
+	alignas( 4 )	float						speed_max				= {};
+	alignas( 4 )	float						lifetime_min			= {};
+	alignas( 4 )	float						lifetime_max			= {};
+	alignas( 4 )	float						size_begin				= {};
+	alignas( 4 )	float						size_end				= {};
+	alignas( 4 )	float						angular_velocity_min	= {};
+	alignas( 4 )	float						angular_velocity_max	= {};
+	alignas( 4 )	uint32_t					color_begin				= {};
+	alignas( 4 )	uint32_t					color_end				= {};
+	alignas( 4 )	uint32_t					first_index				= {};	// First particle slot to write to.
+	alignas( 4 )	uint32_t					count					= {};	// Amount of particles to emit.
+	alignas( 4 )	uint32_t					capacity				= {};	// Amount of particle slots in the particle buffer.
+	alignas( 4 )	uint32_t					seed					= {};	// Different for every emission.
+};
+
+struct ComputeParticleSimulatePushConstants
+{
+	alignas( 8 )	glm::vec2					gravity					= {};	// Acceleration applied to every particle.
+	alignas( 4 )	float						delta_time				= {};	// Time step in seconds.
+	alignas( 4 )	float						drag					= {};	// Velocity falls off by exp( -drag * delta_time ) every step.
+	alignas( 4 )	uint32_t					capacity				= {};	// Amount of particle slots in the particle buffer.
+};
+
 
 
 enum class GraphicsShaderProgramID {
 	SINGLE_TEXTURED,
 	SINGLE_TEXTURED_UV_BORDER_COLOR,
 
+	SIGNED_DISTANCE_FIELD,
+	SIGNED_DISTANCE_FIELD_WITH_EFFECTS,
+
+	GLYPH_INSTANCE,
+	GLYPH_INSTANCE_SIGNED_DISTANCE_FIELD,
+
+	SHAPE_INSTANCE,
+
+	POLYLINE,
+
+	PARTICLE,
+
 	MULTITEXTURED_TRIANGLE,
 	MULTITEXTURED_LINE,
 	MULTITEXTURED_POINT,
@@ -66,6 +243,13 @@ enum class GraphicsShaderProgramID {
 
 enum class ComputeShaderProgramID
 {
+	MIPMAP_DOWNSAMPLE,
+	RENDER_TARGET_BLUR,
+	RENDER_TARGET_DUAL_KAWASE_DOWNSAMPLE,
+	RENDER_TARGET_DUAL_KAWASE_UPSAMPLE,
+	PARTICLE_EMIT,
+	PARTICLE_SIMULATE,
+
 	SHADER_STAGE_ID_COUNT
 };
 
@@ -0,0 +1,150 @@
+#include "core/SourceCommon.h"
+
+#include "system/ShapeInstances.h"
+
+#include "types/MeshPrimitives.hpp"
+
+
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+// Instances are packed into vertex sized slots by MeshBuffer::CmdPushInstances().
+static_assert( sizeof( ShapeInstance ) == 24 );
+static_assert( sizeof( Vertex ) % sizeof( ShapeInstance ) == 0 );
+static_assert( sizeof( PolylinePointInstance ) == 24 );
+static_assert( sizeof( Vertex ) % sizeof( PolylinePointInstance ) == 0 );
+
+
+// Open polylines need 2 points, closed ones 3, fewer points are skipped.
+size_t GetPolylineDrawnPointCount(
+	const Polyline	&	polyline
+)
+{
+	auto point_count = std::size( polyline.points );
+	if( point_count < 2 ) return 0;
+	if( polyline.closed && point_count < 3 ) return 0;
+	return point_count;
+}
+
+} // vk2d_internal
+
+} // vk2d
+
+
+
+uint32_t vk2d::vk2d_internal::PackShapeColor(
+	const Colorf	&	color
+)
+{
+	auto ToUnorm8 =[]( float value ) -> uint32_t
+	{
+		return uint32_t( std::clamp( value, 0.0f, 1.0f ) * 255.0f + 0.5f );
+	};
+	return
+		ToUnorm8( color.r ) |
+		ToUnorm8( color.g ) << 8 |
+		ToUnorm8( color.b ) << 16 |
+		ToUnorm8( color.a ) << 24;
+}
+
+void vk2d::vk2d_internal::WriteShapeInstances(
+	const std::vector<CirclePrimitive>		&	circles,
+	ShapeInstance							*	out_instances
+)
+{
+	for( auto & c : circles ) {
+		auto radius					= std::max( c.radius, 0.0f );
+		out_instances->center		= c.center;
+		out_instances->half_size	= glm::vec2( radius, radius );
+		out_instances->parameter	= 0.0f;
+		out_instances->color		= PackShapeColor( c.color );
+		++out_instances;
+	}
+}
+
+void vk2d::vk2d_internal::WriteShapeInstances(
+	const std::vector<RoundedRectPrimitive>	&	rounded_rects,
+	ShapeInstance							*	out_instances
+)
+{
+	for( auto & r : rounded_rects ) {
+		// Area may be given in any corner order.
+		auto top_left				= glm::min( r.area.top_left, r.area.bottom_right );
+		auto bottom_right			= glm::max( r.area.top_left, r.area.bottom_right );
+		auto half_size				= ( bottom_right - top_left ) * 0.5f;
+		out_instances->center		= top_left + half_size;
+		out_instances->half_size	= half_size;
+		out_instances->parameter	= std::clamp( r.corner_radius, 0.0f, std::min( half_size.x, half_size.y ) );
+		out_instances->color		= PackShapeColor( r.color );
+		++out_instances;
+	}
+}
+
+void vk2d::vk2d_internal::WriteShapeInstances(
+	const std::vector<RingPrimitive>		&	rings,
+	ShapeInstance							*	out_instances
+)
+{
+	for( auto & r : rings ) {
+		auto outer_radius			= std::max( r.outer_radius, 0.0f );
+		out_instances->center		= r.center;
+		out_instances->half_size	= glm::vec2( outer_radius, outer_radius );
+		out_instances->parameter	= std::clamp( r.inner_radius, 0.0f, outer_radius );
+		out_instances->color		= PackShapeColor( r.color );
+		++out_instances;
+	}
+}
+
+uint32_t vk2d::vk2d_internal::CalculatePolylinePointInstanceCount(
+	const std::vector<Polyline>				&	polylines
+)
+{
+	size_t count = 0;
+	for( auto & p : polylines ) {
+		auto point_count = GetPolylineDrawnPointCount( p );
+		if( !point_count ) continue;
+
+		// Closed polylines repeat the first point and have a neighbour only
+		// point on both ends.
+		count += p.closed ? point_count + 3 : point_count;
+	}
+	return uint32_t( count );
+}
+
+void vk2d::vk2d_internal::WritePolylinePointInstances(
+	const std::vector<Polyline>				&	polylines,
+	PolylinePointInstance					*	out_instances
+)
+{
+	auto WritePoint =[ &out_instances ]( const PolylinePoint & point, uint32_t flags )
+	{
+		out_instances->position		= point.position;
+		out_instances->width		= std::max( point.width, 0.0f );
+		out_instances->color		= PackShapeColor( point.color );
+		out_instances->flags		= flags;
+		++out_instances;
+	};
+
+	for( auto & p : polylines ) {
+		auto point_count = GetPolylineDrawnPointCount( p );
+		if( !point_count ) continue;
+
+		auto & points = p.points;
+		if( p.closed ) {
+			WritePoint( points[ point_count - 1 ], POLYLINE_POINT_FLAG_FIRST | POLYLINE_POINT_FLAG_NEIGHBOUR_ONLY );
+			for( size_t i = 0; i < point_count; ++i ) {
+				WritePoint( points[ i ], 0 );
+			}
+			WritePoint( points[ 0 ], 0 );
+			WritePoint( points[ 1 ], POLYLINE_POINT_FLAG_LAST | POLYLINE_POINT_FLAG_NEIGHBOUR_ONLY );
+		} else {
+			WritePoint( points[ 0 ], POLYLINE_POINT_FLAG_FIRST );
+			for( size_t i = 1; i < point_count - 1; ++i ) {
+				WritePoint( points[ i ], 0 );
+			}
+			WritePoint( points[ point_count - 1 ], POLYLINE_POINT_FLAG_LAST );
+		}
+	}
+}
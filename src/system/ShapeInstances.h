@@ -0,0 +1,53 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+#include "system/ShaderInterface.h"
+
+#include "types/ShapePrimitives.h"
+#include "types/Polyline.h"
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Pack a color into RGBA, 8 bits per channel, red in the lowest bits. This
+// is the color format of instance records and particles, shaders unpack it
+// with unpackUnorm4x8().
+uint32_t											PackShapeColor(
+	const Colorf								&	color );
+
+// Write shape instances read by the shape instance shaders. Sizes are
+// clamped here so the shaders never see negative or overlapping radii.
+// out_instances must have room for one instance per shape.
+void												WriteShapeInstances(
+	const std::vector<CirclePrimitive>			&	circles,
+	ShapeInstance								*	out_instances );
+
+void												WriteShapeInstances(
+	const std::vector<RoundedRectPrimitive>		&	rounded_rects,
+	ShapeInstance								*	out_instances );
+
+void												WriteShapeInstances(
+	const std::vector<RingPrimitive>			&	rings,
+	ShapeInstance								*	out_instances );
+
+// Get the amount of points WritePolylinePointInstances() writes, closed
+// polylines need extra points to join the last segment to the first one.
+// Polylines that have too few points to draw are skipped.
+uint32_t											CalculatePolylinePointInstanceCount(
+	const std::vector<Polyline>					&	polylines );
+
+// Write polyline points read by the polyline shaders. out_instances must
+// have room for CalculatePolylinePointInstanceCount() points.
+void												WritePolylinePointInstances(
+	const std::vector<Polyline>					&	polylines,
+	PolylinePointInstance						*	out_instances );
+
+
+
+} // vk2d_internal
+
+} // vk2d
@@ -30,6 +30,11 @@ vk2d::vk2d_internal::DeviceMemoryPool * vk2d::vk2d_internal::ThreadLoaderResourc
 	return device_memory_pool.get();
 }
 
+vk2d::vk2d_internal::StagingBufferArena * vk2d::vk2d_internal::ThreadLoaderResource::GetStagingBufferArena() const
+{
+	return staging_buffer_arena.get();
+}
+
 vk2d::vk2d_internal::DescriptorAutoPool * vk2d::vk2d_internal::ThreadLoaderResource::GetDescriptorAutoPool() const
 {
 	return descriptor_auto_pool.get();
@@ -150,6 +155,21 @@ bool vk2d::vk2d_internal::ThreadLoaderResource::ThreadBegin()
 		}
 	}
 
+	// Staging buffer arena
+	{
+		staging_buffer_arena		= MakeStagingBufferArena(
+			instance->GetVulkanPhysicalDevice(),
+			device
+		);
+		if( !staging_buffer_arena ) {
+			std::stringstream ss;
+			ss << "Internal error: Cannot create staging buffer arena in thread: "
+				<< std::this_thread::get_id();
+			instance->Report( ReportSeverity::CRITICAL_ERROR, ss.str() );
+			return false;
+		}
+	}
+
 	// FreeType
 	{
 		auto ft_error = FT_Init_FreeType( &freetype_instance );
@@ -172,6 +192,7 @@ void vk2d::vk2d_internal::ThreadLoaderResource::ThreadEnd()
 	freetype_instance		= nullptr;
 
 	// De-initialize Vulkan stuff here
+	staging_buffer_arena	= nullptr;
 	device_memory_pool		= nullptr;
 	descriptor_auto_pool	= nullptr;
 
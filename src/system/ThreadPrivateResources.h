@@ -16,6 +16,7 @@ namespace vk2d_internal {
 class InstanceImpl;
 class DescriptorAutoPool;
 class DeviceMemoryPool;
+class StagingBufferArena;
 
 
 
@@ -30,6 +31,7 @@ public:
 	InstanceImpl							*	GetInstance() const;
 	VkDevice													GetVulkanDevice() const;
 	DeviceMemoryPool						*	GetDeviceMemoryPool() const;
+	StagingBufferArena						*	GetStagingBufferArena() const;
 	DescriptorAutoPool						*	GetDescriptorAutoPool() const;
 	VkCommandPool								GetPrimaryRenderCommandPool() const;
 	VkCommandPool								GetSecondaryRenderCommandPool() const;
@@ -45,6 +47,7 @@ private:
 	VkDevice									device								= {};
 	std::unique_ptr<DescriptorAutoPool>			descriptor_auto_pool				= {};
 	std::unique_ptr<DeviceMemoryPool>			device_memory_pool					= {};
+	std::unique_ptr<StagingBufferArena>			staging_buffer_arena				= {};
 
 	VkCommandPool								primary_render_command_pool			= {};
 	VkCommandPool								secondary_render_command_pool		= {};
@@ -0,0 +1,55 @@
+#include "core/SourceCommon.h"
+
+#include "system/UnitCircleTables.h"
+
+
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Tables are looked up without locking, the mutex is only
+// taken when a table for a new edge count is created.
+std::array<std::atomic<const glm::vec2*>, UNIT_CIRCLE_TABLE_MAX_EDGE_COUNT + 1>	unit_circle_tables		= {};
+std::mutex																			unit_circle_table_mutex;
+std::vector<std::unique_ptr<glm::vec2[]>>											unit_circle_table_storage;
+
+} // vk2d_internal
+
+} // vk2d
+
+
+
+const glm::vec2 * vk2d::vk2d_internal::GetUnitCircleTable(
+	float		edge_count
+)
+{
+	if( edge_count < 3.0f ) return nullptr;
+	if( edge_count > float( UNIT_CIRCLE_TABLE_MAX_EDGE_COUNT ) ) return nullptr;
+	if( edge_count != std::floor( edge_count ) ) return nullptr;
+
+	auto count = uint32_t( edge_count );
+	if( auto table = unit_circle_tables[ count ].load( std::memory_order_acquire ) ) {
+		return table;
+	}
+
+	std::lock_guard<std::mutex> lock_guard( unit_circle_table_mutex );
+
+	// Another thread may have created it while we were waiting.
+	if( auto table = unit_circle_tables[ count ].load( std::memory_order_acquire ) ) {
+		return table;
+	}
+
+	auto table = std::make_unique<glm::vec2[]>( count );
+	for( uint32_t i = 0; i < count; ++i ) {
+		auto angle	= RAD * double( i ) / double( count );
+		table[ i ]	= glm::vec2( float( std::cos( angle ) ), float( std::sin( angle ) ) );
+	}
+
+	auto ret = table.get();
+	unit_circle_table_storage.push_back( std::move( table ) );
+	unit_circle_tables[ count ].store( ret, std::memory_order_release );
+	return ret;
+}
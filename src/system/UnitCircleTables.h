@@ -0,0 +1,90 @@
+#pragma once
+
+#include "core/SourceCommon.h"
+
+namespace vk2d {
+
+namespace vk2d_internal {
+
+
+
+// Largest edge count that gets a cached unit circle table, tables for all
+// edge counts up to this take about 4 MiB in total.
+constexpr uint32_t UNIT_CIRCLE_TABLE_MAX_EDGE_COUNT			= 1024;
+
+
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Get cached unit circle points for an edge count.
+///
+///				Point i is { cos( i * RAD / edge_count ), sin( i * RAD / edge_count ) }. Tables are created on first use and
+///				never destroyed so the returned pointer stays valid for the lifetime of the program.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @param[in]	edge_count
+///				Amount of points around the circle.
+///
+/// @return		Pointer to edge_count points or nullptr if edge_count is not a whole number between 3 and
+///				UNIT_CIRCLE_TABLE_MAX_EDGE_COUNT.
+const glm::vec2									*	GetUnitCircleTable(
+	float											edge_count );
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief		Calls a function for consecutive unit circle points.
+///
+///				Uses a cached table when one is available, otherwise rotates the first point one step at a time in double
+///				precision. Either way there are no trigonometric function calls per point.
+///
+/// @note		Multithreading: Any thread.
+///
+/// @tparam		FunctionT
+///				Function called as function( size_t k, glm::vec2 point ) for k from 0 to count - 1.
+///
+/// @param[in]	edge_count
+///				Amount of points around the full circle, may be fractional.
+///
+/// @param[in]	first_index
+///				Index of the first point, point i is at angle i * RAD / edge_count.
+///
+/// @param[in]	count
+///				Amount of points to visit.
+///
+/// @param[in]	function
+///				Function receiving the points.
+template<typename FunctionT>
+void												ForEachUnitCirclePoint(
+	float											edge_count,
+	size_t											first_index,
+	size_t											count,
+	FunctionT									&&	function )
+{
+	if( auto table = GetUnitCircleTable( edge_count ) ) {
+		auto table_size		= size_t( edge_count );
+		auto i				= first_index % table_size;
+		for( size_t k = 0; k < count; ++k ) {
+			function( k, table[ i ] );
+			if( ++i == table_size ) i = 0;
+		}
+		return;
+	}
+
+	double step				= RAD / double( edge_count );
+	double step_cos			= std::cos( step );
+	double step_sin			= std::sin( step );
+	double x				= std::cos( step * double( first_index ) );
+	double y				= std::sin( step * double( first_index ) );
+	for( size_t k = 0; k < count; ++k ) {
+		function( k, glm::vec2( float( x ), float( y ) ) );
+		double nx			= x * step_cos - y * step_sin;
+		double ny			= x * step_sin + y * step_cos;
+		x					= nx;
+		y					= ny;
+	}
+}
+
+
+
+} // vk2d_internal
+
+} // vk2d
@@ -603,3 +603,246 @@ std::unique_ptr<vk2d::vk2d_internal::DeviceMemoryPool> vk2d::vk2d_internal::Make
 	}
 	return {};
 }
+
+
+
+vk2d::vk2d_internal::StagingBufferArena::StagingBufferArena(
+	VkPhysicalDevice				physicalDevice,
+	VkDevice						device,
+	VkDeviceSize					capacity
+)
+{
+	refDevice				= device;
+	this->capacity			= capacity;
+
+	VkBufferCreateInfo buffer_create_info {};
+	buffer_create_info.sType					= VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+	buffer_create_info.pNext					= nullptr;
+	buffer_create_info.flags					= 0;
+	buffer_create_info.size						= capacity;
+	buffer_create_info.usage					= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+	buffer_create_info.sharingMode				= VK_SHARING_MODE_EXCLUSIVE;
+	buffer_create_info.queueFamilyIndexCount	= 0;
+	buffer_create_info.pQueueFamilyIndices		= nullptr;
+	auto result = vkCreateBuffer(
+		refDevice,
+		&buffer_create_info,
+		nullptr,
+		&buffer
+	);
+	if( result != VK_SUCCESS ) {
+		return;
+	}
+
+	// Arena gets its own memory allocation instead of a block from the device memory pool,
+	// the whole allocation stays mapped for the lifetime of the arena and Vulkan does not
+	// allow mapping the same memory object twice.
+	VkPhysicalDeviceMemoryProperties memory_properties {};
+	vkGetPhysicalDeviceMemoryProperties(
+		physicalDevice,
+		&memory_properties
+	);
+	auto memory_requirements	= GetBufferMemoryRequirements( refDevice, buffer );
+	auto memory_type_index		= FindMemoryTypeIndex(
+		memory_properties,
+		memory_requirements,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+	);
+	if( memory_type_index == UINT32_MAX ) {
+		return;
+	}
+
+	VkMemoryAllocateInfo memory_allocate_info {};
+	memory_allocate_info.sType				= VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+	memory_allocate_info.pNext				= nullptr;
+	memory_allocate_info.allocationSize		= memory_requirements.size;
+	memory_allocate_info.memoryTypeIndex	= memory_type_index;
+	result = vkAllocateMemory(
+		refDevice,
+		&memory_allocate_info,
+		nullptr,
+		&memory
+	);
+	if( result != VK_SUCCESS ) {
+		return;
+	}
+
+	result = vkBindBufferMemory(
+		refDevice,
+		buffer,
+		memory,
+		0
+	);
+	if( result != VK_SUCCESS ) {
+		return;
+	}
+
+	void * mapped {};
+	result = vkMapMemory(
+		refDevice,
+		memory,
+		0,
+		VK_WHOLE_SIZE,
+		0,
+		&mapped
+	);
+	if( result != VK_SUCCESS ) {
+		return;
+	}
+	mapped_memory			= reinterpret_cast<uint8_t*>( mapped );
+
+	is_good					= true;
+}
+
+vk2d::vk2d_internal::StagingBufferArena::~StagingBufferArena()
+{
+	if( mapped_memory ) {
+		vkUnmapMemory(
+			refDevice,
+			memory
+		);
+	}
+	vkDestroyBuffer(
+		refDevice,
+		buffer,
+		nullptr
+	);
+	vkFreeMemory(
+		refDevice,
+		memory,
+		nullptr
+	);
+}
+
+vk2d::vk2d_internal::StagingBufferArenaAllocation vk2d::vk2d_internal::StagingBufferArena::Allocate(
+	VkDeviceSize				size,
+	VkDeviceSize				alignment
+)
+{
+	if( !is_good ) return {};
+	if( size == 0 || size > capacity ) return {};
+	if( alignment == 0 ) alignment = 1;
+
+	// Finds a location for the allocation, returns UINT64_MAX if there's no room.
+	// Free space is after head until capacity and from 0 until the oldest allocation
+	// when not wrapped around, or between head and the oldest allocation when wrapped.
+	auto FindLocation	=[ this, size, alignment ]() -> VkDeviceSize
+	{
+		if( allocations.empty() ) {
+			head	= 0;
+			return 0;
+		}
+
+		auto tail			= allocations.front().begin;
+		auto aligned_head	= ( ( head + alignment - 1 ) / alignment ) * alignment;
+		if( head > tail ) {
+			if( aligned_head + size <= capacity )	return aligned_head;
+			if( size <= tail )						return 0;
+		} else {
+			if( aligned_head + size <= tail )		return aligned_head;
+		}
+		return UINT64_MAX;
+	};
+
+	auto location = FindLocation();
+	if( location == UINT64_MAX ) {
+		ReclaimFinished( true );
+		location = FindLocation();
+		if( location == UINT64_MAX ) return {};
+	}
+
+	AllocationRecord record {};
+	record.id				= allocationIDCounter;
+	record.begin			= location;
+	record.end				= location + size;
+	allocations.push_back( record );
+	head					= record.end;
+	++allocationIDCounter;
+
+	StagingBufferArenaAllocation ret {};
+	ret.id					= record.id;
+	ret.buffer				= buffer;
+	ret.offset				= record.begin;
+	ret.size				= size;
+	ret.mapped_data			= mapped_memory + record.begin;
+	return ret;
+}
+
+void vk2d::vk2d_internal::StagingBufferArena::SetCompletionFence(
+	const StagingBufferArenaAllocation		&	allocation,
+	VkFence										fence
+)
+{
+	for( auto & a : allocations ) {
+		if( a.id == allocation.id ) {
+			a.completion_fence	= fence;
+			return;
+		}
+	}
+}
+
+void vk2d::vk2d_internal::StagingBufferArena::Free(
+	StagingBufferArenaAllocation			&	allocation
+)
+{
+	if( !allocation.IsValid() ) return;
+
+	// Allocation may have already been reclaimed if it's fence was signaled.
+	for( auto & a : allocations ) {
+		if( a.id == allocation.id ) {
+			a.is_freed			= true;
+			a.completion_fence	= VK_NULL_HANDLE;
+			break;
+		}
+	}
+	allocation	= {};
+
+	ReclaimFinished( false );
+}
+
+VkBuffer vk2d::vk2d_internal::StagingBufferArena::GetVulkanBuffer() const
+{
+	return buffer;
+}
+
+VkDeviceSize vk2d::vk2d_internal::StagingBufferArena::GetCapacity() const
+{
+	return capacity;
+}
+
+void vk2d::vk2d_internal::StagingBufferArena::ReclaimFinished(
+	bool			poll_fences
+)
+{
+	// Ring buffer, only the oldest allocations can be returned.
+	while( !allocations.empty() ) {
+		auto & front = allocations.front();
+		if( !front.is_freed ) {
+			if( !poll_fences || !front.completion_fence ) break;
+			if( vkGetFenceStatus( refDevice, front.completion_fence ) != VK_SUCCESS ) break;
+		}
+		allocations.pop_front();
+	}
+	if( allocations.empty() ) {
+		head	= 0;
+	}
+}
+
+
+
+std::unique_ptr<vk2d::vk2d_internal::StagingBufferArena> vk2d::vk2d_internal::MakeStagingBufferArena(
+	VkPhysicalDevice		physicalDevice,
+	VkDevice				device,
+	VkDeviceSize			capacity )
+{
+	auto staging_buffer_arena = std::unique_ptr<StagingBufferArena>(
+		new StagingBufferArena(
+			physicalDevice,
+			device,
+			capacity
+		) );
+	if( staging_buffer_arena->is_good ) {
+		return staging_buffer_arena;
+	}
+	return {};
+}
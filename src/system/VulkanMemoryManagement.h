@@ -363,6 +363,98 @@ std::unique_ptr<DeviceMemoryPool>						MakeDeviceMemoryPool(
 
 
 
+// Single sub-allocation from the staging buffer arena.
+struct StagingBufferArenaAllocation {
+	uint64_t										id									= UINT64_MAX;
+	VkBuffer										buffer								= VK_NULL_HANDLE;
+	VkDeviceSize									offset								= 0;
+	VkDeviceSize									size								= 0;
+	void										*	mapped_data							= nullptr;
+
+	inline bool										IsValid() const
+	{
+		return id != UINT64_MAX;
+	}
+};
+
+// Persistently mapped host visible ring buffer used as a transfer source when uploading
+// data to the GPU. Avoids creating, allocating, mapping and destroying a Vulkan buffer for
+// every upload. Allocations are reclaimed in order once they're freed or once the fence
+// they were associated with has been signaled.
+//
+// Not thread safe, each loader thread owns its own arena.
+class StagingBufferArena {
+	friend std::unique_ptr<StagingBufferArena>		MakeStagingBufferArena(
+		VkPhysicalDevice							physicalDevice,
+		VkDevice									device,
+		VkDeviceSize								capacity
+	);
+
+private:
+	struct AllocationRecord {
+		uint64_t									id									= UINT64_MAX;
+		VkDeviceSize								begin								= 0;
+		VkDeviceSize								end									= 0;
+		VkFence										completion_fence					= VK_NULL_HANDLE;
+		bool										is_freed							= false;
+	};
+
+	// Only accessible through MakeStagingBufferArena
+	StagingBufferArena(
+		VkPhysicalDevice							physicalDevice,
+		VkDevice									device,
+		VkDeviceSize								capacity );
+
+public:
+	~StagingBufferArena();
+
+	// Allocates space from the arena. Returns invalid allocation if there's not enough
+	// free space even after reclaiming finished allocations, caller should then fall
+	// back to creating a dedicated staging buffer.
+	StagingBufferArenaAllocation					Allocate(
+		VkDeviceSize								size,
+		VkDeviceSize								alignment );
+
+	// Associates a fence with the allocation, arena may reclaim the allocation on its own
+	// once the fence is signaled. Fence must be kept alive until the allocation is freed.
+	void											SetCompletionFence(
+		const StagingBufferArenaAllocation		&	allocation,
+		VkFence										fence );
+
+	// Returns allocation back to the arena. Allocation must not be in use by the GPU.
+	void											Free(
+		StagingBufferArenaAllocation			&	allocation );
+
+	VkBuffer										GetVulkanBuffer() const;
+	VkDeviceSize									GetCapacity() const;
+
+private:
+	void											ReclaimFinished(
+		bool										poll_fences );
+
+	VkDevice										refDevice							= {};
+	VkBuffer										buffer								= {};
+	VkDeviceMemory									memory								= {};
+	uint8_t										*	mapped_memory						= {};
+	VkDeviceSize									capacity							= {};
+
+	VkDeviceSize									head								= {};
+	std::deque<AllocationRecord>					allocations							= {};
+	uint64_t										allocationIDCounter					= {};
+
+	bool											is_good								= {};
+};
+
+
+
+std::unique_ptr<StagingBufferArena>					MakeStagingBufferArena(
+	VkPhysicalDevice									physicalDevice,
+	VkDevice											device,
+	VkDeviceSize										capacity							= VkDeviceSize( 1024 ) * 1024 * 32
+);
+
+
+
 } // vk2d_internal
 
 } // vk2d
@@ -13,11 +13,20 @@
 
 #include "types/Mesh.h"
 
+#include "system/MeshVertexKernels.h"
+#include "system/ParallelWork.h"
+#include "system/UnitCircleTables.h"
+
 
 
 namespace vk2d {
 namespace vk2d_internal {
 
+// Meshes larger than this are processed in ranges of this many vertices on
+// multiple threads. Multiple of the widest mesh vertex kernel block so that
+// range boundaries never change which vertices the kernels process together.
+constexpr size_t MESH_PARALLEL_RANGE_SIZE		= 16384;
+
 template<typename T>
 Rect2Base<T> CalculateAABBFromPointList(
 	const std::vector<glm::vec<2, T, glm::packed_highp>>		&	points
@@ -37,16 +46,100 @@ Rect2f CalculateAABBFromVertexList(
 	const std::vector<Vertex>			&	vertices
 )
 {
-	Rect2f ret { vertices[ 0 ].vertex_coords, vertices[ 0 ].vertex_coords };
-	for( auto p : vertices ) {
-		ret.top_left.x		= std::min( ret.top_left.x, p.vertex_coords.x );
-		ret.top_left.y		= std::min( ret.top_left.y, p.vertex_coords.y );
-		ret.bottom_right.x	= std::max( ret.bottom_right.x, p.vertex_coords.x );
-		ret.bottom_right.y	= std::max( ret.bottom_right.y, p.vertex_coords.y );
+	auto & kernels	= GetMeshVertexKernels();
+	auto points		= &vertices[ 0 ].vertex_coords.x;
+
+	// Bounds per range, combined in range order afterwards.
+	std::vector<MeshPointBounds> range_bounds( GetParallelRangeCount( std::size( vertices ), MESH_PARALLEL_RANGE_SIZE ) );
+	ParallelForRanges( std::size( vertices ), MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t range_index, size_t begin, size_t end )
+		{
+			range_bounds[ range_index ] = kernels.calculate_bounds( points + begin * MESH_VERTEX_FLOAT_STRIDE, end - begin );
+		} );
+
+	auto bounds = range_bounds[ 0 ];
+	for( auto & b : range_bounds ) {
+		bounds.min[ 0 ] = std::min( bounds.min[ 0 ], b.min[ 0 ] );
+		bounds.min[ 1 ] = std::min( bounds.min[ 1 ], b.min[ 1 ] );
+		bounds.max[ 0 ] = std::max( bounds.max[ 0 ], b.max[ 0 ] );
+		bounds.max[ 1 ] = std::max( bounds.max[ 1 ], b.max[ 1 ] );
 	}
+	return Rect2f(
+		bounds.min[ 0 ], bounds.min[ 1 ],
+		bounds.max[ 0 ], bounds.max[ 1 ]
+	);
+}
+
+// Point transform, result = matrix * point + offset.
+MeshPointTransform CreateMeshPointTransform(
+	const glm::mat2						&	matrix,
+	glm::vec2								offset
+)
+{
+	MeshPointTransform ret;
+	ret.column_0[ 0 ]	= matrix[ 0 ].x;
+	ret.column_0[ 1 ]	= matrix[ 0 ].y;
+	ret.column_1[ 0 ]	= matrix[ 1 ].x;
+	ret.column_1[ 1 ]	= matrix[ 1 ].y;
+	ret.offset[ 0 ]		= offset.x;
+	ret.offset[ 1 ]		= offset.y;
 	return ret;
 }
 
+// Applies matrix to vertex coords or uv coords around origin, then moves them.
+void TransformMeshPoints(
+	std::vector<Vertex>					&	vertices,
+	size_t									float_offset,
+	const glm::mat2						&	matrix,
+	glm::vec2								origin,
+	glm::vec2								movement
+)
+{
+	if( vertices.empty() ) return;
+
+	auto & kernels	= GetMeshVertexKernels();
+	auto points		= &vertices[ 0 ].vertex_coords.x + float_offset;
+	auto transform	= CreateMeshPointTransform( matrix, origin - matrix * origin + movement );
+
+	ParallelForRanges( std::size( vertices ), MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			kernels.transform_points( points + begin * MESH_VERTEX_FLOAT_STRIDE, end - begin, transform );
+		} );
+}
+
+// Directional wave for vertex coords or uv coords, frequency is per wave space unit.
+void WaveMeshPoints(
+	std::vector<Vertex>					&	vertices,
+	size_t									float_offset,
+	float									direction_radians,
+	glm::vec2								frequency,
+	float									phase,
+	glm::vec2								intensity,
+	glm::vec2								origin
+)
+{
+	if( vertices.empty() ) return;
+
+	auto forward_rotation_matrix	= CreateRotationMatrix2( direction_radians );
+	auto backward_rotation_matrix	= glm::transpose( forward_rotation_matrix );
+
+	MeshPointWave wave;
+	wave.to_wave_space		= CreateMeshPointTransform( backward_rotation_matrix, -( backward_rotation_matrix * origin ) );
+	wave.frequency[ 0 ]		= frequency.x;
+	wave.frequency[ 1 ]		= frequency.y;
+	wave.phase				= phase;
+	wave.intensity[ 0 ]		= intensity.x;
+	wave.intensity[ 1 ]		= intensity.y;
+	wave.from_wave_space	= CreateMeshPointTransform( forward_rotation_matrix, origin );
+
+	auto & kernels	= GetMeshVertexKernels();
+	auto points		= &vertices[ 0 ].vertex_coords.x + float_offset;
+
+	ParallelForRanges( std::size( vertices ), MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			kernels.wave_points( points + begin * MESH_VERTEX_FLOAT_STRIDE, end - begin, wave );
+		} );
+}
+
 inline Vertex CreateDefaultValueVertex()
 {
 	Vertex v;
@@ -67,6 +160,92 @@ inline void ClearVerticesToDefaultValues(
 	}
 }
 
+// Appends a single textured glyph quad, coords are scaled and then moved to location.
+void AppendGlyphBox(
+	std::vector<Vertex>				&	vertices,
+	std::vector<uint32_t>			&	indices,
+	Rect2f							&	aabb,
+	glm::vec2							location,
+	const Rect2f					&	coords,
+	const Rect2f					&	uv_coords,
+	uint32_t							texture_channel,
+	glm::vec2							scale
+)
+{
+	auto vertex_offset		= vertices.size();
+	auto index_offset		= indices.size();
+
+	auto tcoords			= coords;
+	tcoords.top_left		*= scale;
+	tcoords.bottom_right	*= scale;
+	tcoords					+= location;
+
+	aabb.top_left.x			= std::min( aabb.top_left.x, tcoords.top_left.x );
+	aabb.top_left.y			= std::min( aabb.top_left.y, tcoords.top_left.y );
+	aabb.bottom_right.x		= std::max( aabb.bottom_right.x, tcoords.bottom_right.x );
+	aabb.bottom_right.y		= std::max( aabb.bottom_right.y, tcoords.bottom_right.y );
+
+	vertices.resize( vertex_offset + 4 );
+	vertices[ vertex_offset + 0 ].vertex_coords			= glm::vec2( tcoords.top_left.x, tcoords.top_left.y );
+	vertices[ vertex_offset + 0 ].uv_coords				= glm::vec2( uv_coords.top_left.x, uv_coords.top_left.y );
+	vertices[ vertex_offset + 0 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+	vertices[ vertex_offset + 0 ].point_size			= 1;
+	vertices[ vertex_offset + 0 ].single_texture_layer	= texture_channel;
+
+	vertices[ vertex_offset + 1 ].vertex_coords			= glm::vec2( tcoords.bottom_right.x, tcoords.top_left.y );
+	vertices[ vertex_offset + 1 ].uv_coords				= glm::vec2( uv_coords.bottom_right.x, uv_coords.top_left.y );
+	vertices[ vertex_offset + 1 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+	vertices[ vertex_offset + 1 ].point_size			= 1;
+	vertices[ vertex_offset + 1 ].single_texture_layer	= texture_channel;
+
+	vertices[ vertex_offset + 2 ].vertex_coords			= glm::vec2( tcoords.top_left.x, tcoords.bottom_right.y );
+	vertices[ vertex_offset + 2 ].uv_coords				= glm::vec2( uv_coords.top_left.x, uv_coords.bottom_right.y );
+	vertices[ vertex_offset + 2 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+	vertices[ vertex_offset + 2 ].point_size			= 1;
+	vertices[ vertex_offset + 2 ].single_texture_layer	= texture_channel;
+
+	vertices[ vertex_offset + 3 ].vertex_coords			= glm::vec2( tcoords.bottom_right.x, tcoords.bottom_right.y );
+	vertices[ vertex_offset + 3 ].uv_coords				= glm::vec2( uv_coords.bottom_right.x, uv_coords.bottom_right.y );
+	vertices[ vertex_offset + 3 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
+	vertices[ vertex_offset + 3 ].point_size			= 1;
+	vertices[ vertex_offset + 3 ].single_texture_layer	= texture_channel;
+
+	indices.resize( index_offset + 6 );
+	indices[ index_offset + 0 ]	= uint32_t( vertex_offset + 0 );
+	indices[ index_offset + 1 ]	= uint32_t( vertex_offset + 2 );
+	indices[ index_offset + 2 ]	= uint32_t( vertex_offset + 1 );
+	indices[ index_offset + 3 ]	= uint32_t( vertex_offset + 1 );
+	indices[ index_offset + 4 ]	= uint32_t( vertex_offset + 2 );
+	indices[ index_offset + 5 ]	= uint32_t( vertex_offset + 3 );
+}
+
+// Appends quads for horisontal text layout glyphs. Glyphs on atlas layers
+// not yet in the font texture are skipped.
+void AppendGlyphPlacements(
+	std::vector<Vertex>						&	vertices,
+	std::vector<uint32_t>					&	indices,
+	Rect2f									&	aabb,
+	const std::vector<TextGlyphPlacement>	&	glyph_placements,
+	glm::vec2									scale,
+	uint32_t									layer_count
+)
+{
+	if( glyph_placements.empty() ) return;
+
+	// First glyph sets defaults.
+	{
+		auto & p			= glyph_placements[ 0 ];
+		aabb.top_left		= p.glyph_info->horisontal_coords.top_left * scale + p.position;
+		aabb.bottom_right	= p.glyph_info->horisontal_coords.bottom_right * scale + p.position;
+	}
+	for( auto & p : glyph_placements ) {
+		auto gi = p.glyph_info;
+		if( gi->atlas_index < layer_count ) {
+			AppendGlyphBox( vertices, indices, aabb, p.position, gi->horisontal_coords, gi->uv_coords, gi->atlas_index, scale );
+		}
+	}
+}
+
 } // vk2d_internal
 } // vk2d
 
@@ -75,9 +254,7 @@ inline void ClearVerticesToDefaultValues(
 VK2D_API void vk2d::Mesh::Translate(
 	const glm::vec2			movement )
 {
-	for( auto & i : vertices ) {
-		i.vertex_coords		+= movement;
-	}
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET, glm::mat2( 1.0f ), {}, movement );
 }
 
 VK2D_API void vk2d::Mesh::Rotate(
@@ -86,11 +263,7 @@ VK2D_API void vk2d::Mesh::Rotate(
 {
 	auto rotation_matrix	= CreateRotationMatrix2( rotation_amount_radians );
 
-	for( auto & i : vertices ) {
-		i.vertex_coords		-= origin;
-		i.vertex_coords		= rotation_matrix * i.vertex_coords;
-		i.vertex_coords		+= origin;
-	}
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET, rotation_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::Scale(
@@ -98,11 +271,11 @@ VK2D_API void vk2d::Mesh::Scale(
 	glm::vec2				origin
 )
 {
-	for( auto & i : vertices ) {
-		i.vertex_coords		-= origin;
-		i.vertex_coords		*= scaling_amount;
-		i.vertex_coords		+= origin;
-	}
+	auto scale_matrix		= glm::mat2(
+		scaling_amount.x, 0.0f,
+		0.0f, scaling_amount.y
+	);
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET, scale_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::Scew(
@@ -110,12 +283,12 @@ VK2D_API void vk2d::Mesh::Scew(
 	glm::vec2				origin
 )
 {
-	for( auto & i : vertices ) {
-		auto c = i.vertex_coords - origin;
-		i.vertex_coords.x	= c.y * scew_amount.x + c.x;
-		i.vertex_coords.y	= c.x * scew_amount.y + c.y;
-		i.vertex_coords		+= origin;
-	}
+	// Matrix input has flipped column and row order.
+	auto scew_matrix		= glm::mat2(
+		1.0f, scew_amount.y,
+		scew_amount.x, 1.0f
+	);
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET, scew_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::DirectionalWave(
@@ -128,41 +301,22 @@ VK2D_API void vk2d::Mesh::DirectionalWave(
 {
 	auto size	= aabb.bottom_right - aabb.top_left;
 
-	glm::vec2	dir {
-		std::cos( direction_radians ),
-		std::sin( direction_radians )
-	};
-	// Matrix input has flipped column and row order.
-	auto forward_rotation_matrix = glm::mat2(
-		+dir.x, +dir.y,
-		-dir.y, +dir.x
-	);
-	auto backward_rotation_matrix = glm::mat2(
-		+dir.x, -dir.y,
-		+dir.y, +dir.x
+	vk2d_internal::WaveMeshPoints(
+		vertices,
+		vk2d_internal::MESH_VERTEX_COORDS_FLOAT_OFFSET,
+		direction_radians,
+		float( frequency * RAD / 2.0 ) / size,
+		float( animation / RAD ),
+		intensity,
+		origin
 	);
-
-	for( auto & i : vertices ) {
-		auto c		= i.vertex_coords - origin;
-		c			= backward_rotation_matrix * c;
-
-		auto d		= float( animation / RAD ) + float( frequency * ( ( c.x / size.x + c.y / size.y ) / 2.0f ) * RAD );
-		i.vertex_coords		= {
-			std::cos( d ) * intensity.x + c.x,
-			std::sin( d ) * intensity.y + c.y };
-
-		i.vertex_coords		= forward_rotation_matrix * i.vertex_coords;
-		i.vertex_coords		+= origin;
-	}
 }
 
 VK2D_API void vk2d::Mesh::TranslateUV(
 	const glm::vec2			movement
 )
 {
-	for( auto & i : vertices ) {
-		i.uv_coords		+= movement;
-	}
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET, glm::mat2( 1.0f ), {}, movement );
 }
 
 VK2D_API void vk2d::Mesh::RotateUV(
@@ -172,11 +326,7 @@ VK2D_API void vk2d::Mesh::RotateUV(
 {
 	auto rotation_matrix	= CreateRotationMatrix2( rotation_amount_radians );
 
-	for( auto & i : vertices ) {
-		i.uv_coords		-= origin;
-		i.uv_coords		= rotation_matrix * i.uv_coords;
-		i.uv_coords		+= origin;
-	}
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET, rotation_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::ScaleUV(
@@ -184,11 +334,11 @@ VK2D_API void vk2d::Mesh::ScaleUV(
 	glm::vec2				origin
 )
 {
-	for( auto & i : vertices ) {
-		i.uv_coords		-= origin;
-		i.uv_coords		*= scaling_amount;
-		i.uv_coords		+= origin;
-	}
+	auto scale_matrix		= glm::mat2(
+		scaling_amount.x, 0.0f,
+		0.0f, scaling_amount.y
+	);
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET, scale_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::ScewUV(
@@ -196,12 +346,12 @@ VK2D_API void vk2d::Mesh::ScewUV(
 	glm::vec2				origin
 )
 {
-	for( auto & i : vertices ) {
-		auto c = i.uv_coords - origin;
-		i.uv_coords.x	= c.y * scew_amount.x + c.x;
-		i.uv_coords.y	= c.x * scew_amount.y + c.y;
-		i.uv_coords		+= origin;
-	}
+	// Matrix input has flipped column and row order.
+	auto scew_matrix		= glm::mat2(
+		1.0f, scew_amount.y,
+		scew_amount.x, 1.0f
+	);
+	vk2d_internal::TransformMeshPoints( vertices, vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET, scew_matrix, origin, {} );
 }
 
 VK2D_API void vk2d::Mesh::DirectionalWaveUV(
@@ -212,40 +362,26 @@ VK2D_API void vk2d::Mesh::DirectionalWaveUV(
 	glm::vec2				origin
 )
 {
-	glm::vec2	dir {
-		std::cos( direction_radians ),
-		std::sin( direction_radians )
-	};
-	// Matrix input has flipped column and row order.
-	auto forward_rotation_matrix = glm::mat2(
-		+dir.x, +dir.y,
-		-dir.y, +dir.x
+	vk2d_internal::WaveMeshPoints(
+		vertices,
+		vk2d_internal::MESH_VERTEX_UV_COORDS_FLOAT_OFFSET,
+		direction_radians,
+		glm::vec2( float( frequency * RAD / 2.0 ) ),
+		float( animation / RAD ),
+		intensity,
+		origin
 	);
-	auto backward_rotation_matrix = glm::mat2(
-		+dir.x, -dir.y,
-		+dir.y, +dir.x
-	);
-
-	for( auto & i : vertices ) {
-		auto c				= i.uv_coords - origin;
-		c					= backward_rotation_matrix * c;
-
-		auto d				= float( animation / RAD ) + float( frequency * ( ( c.x + c.y ) / 2.0f ) * RAD );
-		i.uv_coords			= {
-			std::cos( d ) * intensity.x + c.x,
-			std::sin( d ) * intensity.y + c.y };
-
-		i.uv_coords			= forward_rotation_matrix * i.uv_coords;
-		i.uv_coords			+= origin;
-	}
 }
 
 VK2D_API void vk2d::Mesh::SetVertexColor(
 	Colorf				new_color )
 {
-	for( auto & v : vertices ) {
-		v.color		= new_color;
-	}
+	vk2d_internal::ParallelForRanges( std::size( vertices ), vk2d_internal::MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			for( size_t i = begin; i < end; ++i ) {
+				vertices[ i ].color		= new_color;
+			}
+		} );
 }
 
 VK2D_API void vk2d::Mesh::SetVertexColorGradient(
@@ -265,48 +401,44 @@ VK2D_API void vk2d::Mesh::SetVertexColorGradient(
 		coord_dir					= { 1.0f, 0.0f };
 	}
 
-	// Matrix input has flipped column and row order.
-	auto forward_rotation_matrix = glm::mat2(
-		+coord_dir.x, +coord_dir.y,
-		-coord_dir.y, +coord_dir.x
-	);
-	auto backward_rotation_matrix = glm::mat2(
-		+coord_dir.x, -coord_dir.y,
-		+coord_dir.y, +coord_dir.x
-	);
-	auto coord_linearilized = backward_rotation_matrix * ( coord_dir * coord_lenght );
+	if( vertices.empty() ) return;
 
-	for( auto & v : vertices ) {
-		auto c = v.vertex_coords - coord_1;
-
-		c = backward_rotation_matrix * c;
-		auto cx = c.x / coord_linearilized.x;
-
-		if( cx < 0.0f )			v.color = color_1;
-		else if( cx > 1.0f )	v.color = color_2;
-		else {
-			auto g = Colorf(
-				color_1.r * ( 1.0f - cx ) + color_2.r * cx,
-				color_1.g * ( 1.0f - cx ) + color_2.g * cx,
-				color_1.b * ( 1.0f - cx ) + color_2.b * cx,
-				color_1.a * ( 1.0f - cx ) + color_2.a * cx
-			);
-			v.color		= g;
-			//v.color = { 0, 1, 0, 1 };
-		}
-		c = forward_rotation_matrix * c;
+	auto gradient			= coord_dir / coord_lenght;
 
-		v.vertex_coords = c + coord_1;
-	}
+	vk2d_internal::MeshColorGradient kernel_gradient;
+	kernel_gradient.color_1[ 0 ]	= color_1.r;
+	kernel_gradient.color_1[ 1 ]	= color_1.g;
+	kernel_gradient.color_1[ 2 ]	= color_1.b;
+	kernel_gradient.color_1[ 3 ]	= color_1.a;
+	kernel_gradient.color_2[ 0 ]	= color_2.r;
+	kernel_gradient.color_2[ 1 ]	= color_2.g;
+	kernel_gradient.color_2[ 2 ]	= color_2.b;
+	kernel_gradient.color_2[ 3 ]	= color_2.a;
+	kernel_gradient.origin[ 0 ]		= coord_1.x;
+	kernel_gradient.origin[ 1 ]		= coord_1.y;
+	kernel_gradient.gradient[ 0 ]	= gradient.x;
+	kernel_gradient.gradient[ 1 ]	= gradient.y;
+
+	auto & kernels	= vk2d_internal::GetMeshVertexKernels();
+	auto points		= &vertices[ 0 ].vertex_coords.x;
+
+	vk2d_internal::ParallelForRanges( std::size( vertices ), vk2d_internal::MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			kernels.color_gradient( points + begin * vk2d_internal::MESH_VERTEX_FLOAT_STRIDE, end - begin, kernel_gradient );
+		} );
 }
 
 VK2D_API void vk2d::Mesh::RecalculateUVsToBoundingBox()
 {
 	auto size = aabb.bottom_right - aabb.top_left;
-	for( auto & v : vertices ) {
-		auto vp = v.vertex_coords - aabb.top_left;
-		v.uv_coords		= vp / size;
-	}
+	vk2d_internal::ParallelForRanges( std::size( vertices ), vk2d_internal::MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			for( size_t i = begin; i < end; ++i ) {
+				auto & v		= vertices[ i ];
+				auto vp			= v.vertex_coords - aabb.top_left;
+				v.uv_coords		= vp / size;
+			}
+		} );
 }
 
 VK2D_API void vk2d::Mesh::SetTexture(
@@ -323,13 +455,23 @@ VK2D_API void vk2d::Mesh::SetSampler(
 	sampler		= sampler_pointer;
 }
 
+VK2D_API void vk2d::Mesh::SetSignedDistanceFieldEffects(
+	const SignedDistanceFieldEffects & effects
+)
+{
+	signed_distance_field_effects	= effects;
+}
+
 VK2D_API void vk2d::Mesh::SetPointSize(
 	float point_size
 )
 {
-	for( auto & v : vertices ) {
-		v.point_size = point_size;
-	}
+	vk2d_internal::ParallelForRanges( std::size( vertices ), vk2d_internal::MESH_PARALLEL_RANGE_SIZE, [ & ]( size_t, size_t begin, size_t end )
+		{
+			for( size_t i = begin; i < end; ++i ) {
+				vertices[ i ].point_size = point_size;
+			}
+		} );
 }
 
 VK2D_API void vk2d::Mesh::SetLineWidth(
@@ -564,9 +706,6 @@ VK2D_API vk2d::Mesh vk2d::GenerateEllipseMesh(
 	float center_to_edge_x		= area.bottom_right.x - center_point.x;
 	float center_to_edge_y		= area.bottom_right.y - center_point.y;
 
-	float rotation_step			= 0.0f;
-	float rotation_step_size	= float( RAD / edge_count );
-
 	uint32_t edge_count_integer	= uint32_t( std::ceil( edge_count ) );
 
 	Mesh ret;
@@ -574,17 +713,12 @@ VK2D_API vk2d::Mesh vk2d::GenerateEllipseMesh(
 	ret.vertices.resize( edge_count_integer );
 	vk2d_internal::ClearVerticesToDefaultValues( ret.vertices );
 
-	for( uint32_t i = 0; i < edge_count_integer; ++i ) {
-		ret.vertices[ i ].vertex_coords		= {
-			std::cos( rotation_step ) * center_to_edge_x + center_point.x,
-			std::sin( rotation_step ) * center_to_edge_y + center_point.y
-		};
-		ret.vertices[ i ].uv_coords			= {
-			std::cos( rotation_step ) * 0.5f + 0.5f,
-			std::sin( rotation_step ) * 0.5f + 0.5f
-		};
-		rotation_step					+= rotation_step_size;
-	}
+	glm::vec2 center_to_edge	= { center_to_edge_x, center_to_edge_y };
+	vk2d_internal::ForEachUnitCirclePoint( edge_count, 0, edge_count_integer, [ & ]( size_t i, glm::vec2 p )
+		{
+			ret.vertices[ i ].vertex_coords		= p * center_to_edge + center_point;
+			ret.vertices[ i ].uv_coords			= p * 0.5f + 0.5f;
+		} );
 
 	if( filled ) {
 		// Draw filled polygons
@@ -686,39 +820,28 @@ VK2D_API vk2d::Mesh vk2d::GenerateEllipsePieMesh(
 
 	// Intermediate vertices.
 	{
-		// First half, from begin angle to 0 angle
-		for( uint32_t i = intermediate_point_begin + 1; i < intermediate_point_end + 1; ++i ) {
-			if( double( rotation_step_size ) * i > RAD ) break;
-
+		glm::vec2 center_to_edge	= { center_to_edge_x, center_to_edge_y };
+		auto PushEdgeVertex			= [ & ]( size_t, glm::vec2 p )
+		{
 			auto v = vk2d_internal::CreateDefaultValueVertex();
-			v.vertex_coords		= {
-				std::cos( rotation_step_size * i ) * center_to_edge_x + center_point.x,
-				std::sin( rotation_step_size * i ) * center_to_edge_y + center_point.y
-			};
-			v.uv_coords			= {
-				std::cos( rotation_step_size * i ) * 0.5f + 0.5f,
-				std::sin( rotation_step_size * i ) * 0.5f + 0.5f
-			};
+			v.vertex_coords		= p * center_to_edge + center_point;
+			v.uv_coords			= p * 0.5f + 0.5f;
 			ret.vertices.push_back( v );
+		};
+
+		// First half, from begin angle to 0 angle
+		auto first_half_end		= intermediate_point_end;
+		while( first_half_end > intermediate_point_begin && double( rotation_step_size ) * first_half_end > RAD ) {
+			--first_half_end;
 		}
+		vk2d_internal::ForEachUnitCirclePoint( edge_count, size_t( intermediate_point_begin ) + 1, first_half_end - intermediate_point_begin, PushEdgeVertex );
 
 		// Second half, from 0 angle to end angle
-		float rotation_step		= 0.0f;
-		while( rotation_step	< end_angle_radians - RAD ) {
-
-			auto v = vk2d_internal::CreateDefaultValueVertex();
-			v.vertex_coords		= {
-				std::cos( rotation_step ) * center_to_edge_x + center_point.x,
-				std::sin( rotation_step ) * center_to_edge_y + center_point.y
-			};
-			v.uv_coords			= {
-				std::cos( rotation_step ) * 0.5f + 0.5f,
-				std::sin( rotation_step ) * 0.5f + 0.5f
-			};
-			ret.vertices.push_back( v );
-
-			rotation_step		+= rotation_step_size;
+		size_t second_half_count	= 0;
+		for( float rotation_step = 0.0f; rotation_step < end_angle_radians - RAD; rotation_step += rotation_step_size ) {
+			++second_half_count;
 		}
+		vk2d_internal::ForEachUnitCirclePoint( edge_count, 0, second_half_count, PushEdgeVertex );
 	}
 
 	// End vertex.
@@ -1041,47 +1164,52 @@ VK2D_API vk2d::Mesh vk2d::GenerateLatticeMesh(
 	glm::vec2 vertex_spacing	= mesh_size / ( subdivisions + glm::vec2( 1.0f, 1.0f ) );
 	glm::vec2 uv_spacing		= glm::vec2( 1.0f, 1.0f ) / ( subdivisions + glm::vec2( 1.0f, 1.0f ) );
 
-	ret.vertices.resize( total_vertex_count );
-	vk2d_internal::ClearVerticesToDefaultValues( ret.vertices );
+	// Lattice is generated in ranges of rows on multiple threads.
+	auto row_range_size			= std::max( size_t( 1 ), vk2d_internal::MESH_PARALLEL_RANGE_SIZE / vertex_count_x );
 
-	for( size_t y = 0; y < vertex_count_y - 1; ++y ) {
-		for( size_t x = 0; x < vertex_count_x - 1; ++x ) {
-			auto & v		= ret.vertices[ y * vertex_count_x + x ];
-			v.vertex_coords	= { vertex_spacing.x * x + area.top_left.x, vertex_spacing.y * y + area.top_left.y };
-			v.uv_coords		= { uv_spacing.x * x, uv_spacing.y * y };
-		}
-		auto & v			= ret.vertices[ y * vertex_count_x + vertex_count_x - 1 ];
-		v.vertex_coords		= { area.bottom_right.x, vertex_spacing.y * y + area.top_left.y };
-		v.uv_coords			= { 1.0f, uv_spacing.y * y };
-	}
-	for( size_t x = 0; x < vertex_count_x - 1; ++x ) {
-		auto & v		= ret.vertices[ size_t( vertex_count_y - 1 ) * vertex_count_x + x ];
-		v.vertex_coords	= { vertex_spacing.x * x + area.top_left.x, area.bottom_right.y };
-		v.uv_coords		= { uv_spacing.x * x, 1.0f };
-	}
-	auto & v			= ret.vertices[ size_t( vertex_count_y - 1 ) * vertex_count_x + vertex_count_x - 1 ];
-	v.vertex_coords		= { area.bottom_right.x, area.bottom_right.y };
-	v.uv_coords			= { 1.0f, 1.0f };
+	ret.vertices.resize( total_vertex_count );
+	vk2d_internal::ParallelForRanges( vertex_count_y, row_range_size, [ & ]( size_t, size_t row_begin, size_t row_end )
+		{
+			for( size_t y = row_begin; y < row_end; ++y ) {
+				auto row			= ret.vertices.data() + y * vertex_count_x;
+				float coord_y		= y < vertex_count_y - 1 ? vertex_spacing.y * y + area.top_left.y : area.bottom_right.y;
+				float uv_y			= y < vertex_count_y - 1 ? uv_spacing.y * y : 1.0f;
+				for( size_t x = 0; x < vertex_count_x - 1; ++x ) {
+					auto & v		= row[ x ];
+					v				= vk2d_internal::CreateDefaultValueVertex();
+					v.vertex_coords	= { vertex_spacing.x * x + area.top_left.x, coord_y };
+					v.uv_coords		= { uv_spacing.x * x, uv_y };
+				}
+				auto & v			= row[ vertex_count_x - 1 ];
+				v					= vk2d_internal::CreateDefaultValueVertex();
+				v.vertex_coords		= { area.bottom_right.x, coord_y };
+				v.uv_coords			= { 1.0f, uv_y };
+			}
+		} );
 
 	if( filled ) {
 		// Draw solid mesh with polygons.
 
-		auto reserved_size = ( vertex_count_x - 1 ) * ( vertex_count_y - 1 ) * 2 * 3;
-		ret.indices.reserve( reserved_size );
-		for( size_t y = 1; y < vertex_count_y; ++y ) {
-			for( size_t x = 1; x < vertex_count_x; ++x ) {
-				auto tl		= uint32_t( ( y - 1 ) * vertex_count_x + x - 1	);	// top left vertex.
-				auto tr		= uint32_t( ( y - 1 ) * vertex_count_x + x );		// top right vertex.
-				auto bl		= uint32_t( ( y - 0 ) * vertex_count_x + x - 1 );	// bottom left vertex.
-				auto br		= uint32_t( ( y - 0 ) * vertex_count_x + x );		// bottom right vertex.
-				ret.indices.push_back( tl );	// First triangle.
-				ret.indices.push_back( bl );
-				ret.indices.push_back( tr );
-				ret.indices.push_back( tr );	// Second triangle.
-				ret.indices.push_back( bl );
-				ret.indices.push_back( br );
-			}
-		}
+		auto indices_per_row = size_t( vertex_count_x - 1 ) * 2 * 3;
+		ret.indices.resize( indices_per_row * ( vertex_count_y - 1 ) );
+		vk2d_internal::ParallelForRanges( vertex_count_y - 1, row_range_size, [ & ]( size_t, size_t row_begin, size_t row_end )
+			{
+				for( size_t y = row_begin + 1; y < row_end + 1; ++y ) {
+					auto i = ret.indices.data() + ( y - 1 ) * indices_per_row;
+					for( size_t x = 1; x < vertex_count_x; ++x ) {
+						auto tl		= uint32_t( ( y - 1 ) * vertex_count_x + x - 1	);	// top left vertex.
+						auto tr		= uint32_t( ( y - 1 ) * vertex_count_x + x );		// top right vertex.
+						auto bl		= uint32_t( ( y - 0 ) * vertex_count_x + x - 1 );	// bottom left vertex.
+						auto br		= uint32_t( ( y - 0 ) * vertex_count_x + x );		// bottom right vertex.
+						*i++ = tl;		// First triangle.
+						*i++ = bl;
+						*i++ = tr;
+						*i++ = tr;		// Second triangle.
+						*i++ = bl;
+						*i++ = br;
+					}
+				}
+			} );
 
 		ret.generated				= true;
 		ret.generated_mesh_type		= MeshType::TRIANGLE_FILLED;
@@ -1090,24 +1218,28 @@ VK2D_API vk2d::Mesh vk2d::GenerateLatticeMesh(
 	} else {
 		// Draw lattice lines.
 
-		auto reserved_size = ( vertex_count_x - 1 ) * ( vertex_count_y - 1 ) * 4 * 2;
-		ret.indices.reserve( reserved_size );
-		for( size_t y = 1; y < vertex_count_y; ++y ) {
-			for( size_t x = 1; x < vertex_count_x; ++x ) {
-				auto tl		= uint32_t( ( y - 1 ) * vertex_count_x + x - 1 );	// top left vertex.
-				auto tr		= uint32_t( ( y - 1 ) * vertex_count_x + x );		// top right vertex.
-				auto bl		= uint32_t( ( y - 0 ) * vertex_count_x + x - 1 );	// bottom left vertex.
-				auto br		= uint32_t( ( y - 0 ) * vertex_count_x + x );		// bottom right vertex.
-				ret.indices.push_back( tl );	// First line.
-				ret.indices.push_back( bl );
-				ret.indices.push_back( bl );	// Second line.
-				ret.indices.push_back( br );
-				ret.indices.push_back( br );	// Third line.
-				ret.indices.push_back( tr );
-				ret.indices.push_back( tr );	// Fourth line.
-				ret.indices.push_back( tl );
-			}
-		}
+		auto indices_per_row = size_t( vertex_count_x - 1 ) * 4 * 2;
+		ret.indices.resize( indices_per_row * ( vertex_count_y - 1 ) );
+		vk2d_internal::ParallelForRanges( vertex_count_y - 1, row_range_size, [ & ]( size_t, size_t row_begin, size_t row_end )
+			{
+				for( size_t y = row_begin + 1; y < row_end + 1; ++y ) {
+					auto i = ret.indices.data() + ( y - 1 ) * indices_per_row;
+					for( size_t x = 1; x < vertex_count_x; ++x ) {
+						auto tl		= uint32_t( ( y - 1 ) * vertex_count_x + x - 1 );	// top left vertex.
+						auto tr		= uint32_t( ( y - 1 ) * vertex_count_x + x );		// top right vertex.
+						auto bl		= uint32_t( ( y - 0 ) * vertex_count_x + x - 1 );	// bottom left vertex.
+						auto br		= uint32_t( ( y - 0 ) * vertex_count_x + x );		// bottom right vertex.
+						*i++ = tl;		// First line.
+						*i++ = bl;
+						*i++ = bl;		// Second line.
+						*i++ = br;
+						*i++ = br;		// Third line.
+						*i++ = tr;
+						*i++ = tr;		// Fourth line.
+						*i++ = tl;
+					}
+				}
+			} );
 
 		ret.generated				= true;
 		ret.generated_mesh_type		= MeshType::LINE;
@@ -1120,7 +1252,7 @@ VK2D_API vk2d::Mesh vk2d::GenerateLatticeMesh(
 VK2D_API vk2d::Mesh vk2d::GenerateTextMesh(
 	FontResource	*	font,
 	glm::vec2			origin,
-	std::string			text,
+	const Text		&	text,
 	float				kerning,
 	glm::vec2			scale,
 	bool				vertical,
@@ -1138,68 +1270,34 @@ VK2D_API vk2d::Mesh vk2d::GenerateTextMesh(
 		if( fi->GetStatus() == ResourceStatus::UNDETERMINED ) return {};
 	}
 	if( !fi->FaceExists( font_face ) ) return {};
-	
+
+	// With dynamic glyph cache, glyphs rasterized into a new atlas layer
+	// are not in the font texture until the next upload, skip those.
+	auto texture		= fi->GetTextureResource();
+	auto layer_count	= texture ? texture->GetLayerCount() : UINT32_MAX;
+
 	Mesh ret;
-	ret.vertices.reserve( text.size() * 4 );
-	ret.indices.reserve( text.size() * 6 );
 
-	auto AppendBox =[ &ret, scale ](
-		const glm::vec2	&	location,
-		const Rect2f		&	coords,
-		const Rect2f		&	uv_coords,
-		uint32_t					texture_channel
-		)
+	// Meshes are generated and cached at origin {0, 0}, then moved to origin.
+	auto MoveToOrigin =[ &ret, origin ]()
 	{
-		auto vertex_offset		= ret.vertices.size();
-		auto index_offset		= ret.indices.size();
-
-		auto tcoords			= coords;
-		tcoords.top_left		*= scale;
-		tcoords.bottom_right	*= scale;
-		tcoords					+= location;
-
-		ret.aabb.top_left.x		= std::min( ret.aabb.top_left.x, tcoords.top_left.x );
-		ret.aabb.top_left.y		= std::min( ret.aabb.top_left.y, tcoords.top_left.y );
-		ret.aabb.bottom_right.x	= std::max( ret.aabb.bottom_right.x, tcoords.bottom_right.x );
-		ret.aabb.bottom_right.y	= std::max( ret.aabb.bottom_right.y, tcoords.bottom_right.y );
-
-		ret.vertices.resize( vertex_offset + 4 );
-		ret.vertices[ vertex_offset + 0 ].vertex_coords			= glm::vec2( tcoords.top_left.x, tcoords.top_left.y );
-		ret.vertices[ vertex_offset + 0 ].uv_coords				= glm::vec2( uv_coords.top_left.x, uv_coords.top_left.y );
-		ret.vertices[ vertex_offset + 0 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
-		ret.vertices[ vertex_offset + 0 ].point_size			= 1;
-		ret.vertices[ vertex_offset + 0 ].single_texture_layer	= texture_channel;
-
-		ret.vertices[ vertex_offset + 1 ].vertex_coords			= glm::vec2( tcoords.bottom_right.x, tcoords.top_left.y );
-		ret.vertices[ vertex_offset + 1 ].uv_coords				= glm::vec2( uv_coords.bottom_right.x, uv_coords.top_left.y );
-		ret.vertices[ vertex_offset + 1 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
-		ret.vertices[ vertex_offset + 1 ].point_size			= 1;
-		ret.vertices[ vertex_offset + 1 ].single_texture_layer	= texture_channel;
-
-		ret.vertices[ vertex_offset + 2 ].vertex_coords			= glm::vec2( tcoords.top_left.x, tcoords.bottom_right.y );
-		ret.vertices[ vertex_offset + 2 ].uv_coords				= glm::vec2( uv_coords.top_left.x, uv_coords.bottom_right.y );
-		ret.vertices[ vertex_offset + 2 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
-		ret.vertices[ vertex_offset + 2 ].point_size			= 1;
-		ret.vertices[ vertex_offset + 2 ].single_texture_layer	= texture_channel;
-
-		ret.vertices[ vertex_offset + 3 ].vertex_coords			= glm::vec2( tcoords.bottom_right.x, tcoords.bottom_right.y );
-		ret.vertices[ vertex_offset + 3 ].uv_coords				= glm::vec2( uv_coords.bottom_right.x, uv_coords.bottom_right.y );
-		ret.vertices[ vertex_offset + 3 ].color					= Colorf( 1.0f, 1.0f, 1.0f, 1.0f );
-		ret.vertices[ vertex_offset + 3 ].point_size			= 1;
-		ret.vertices[ vertex_offset + 3 ].single_texture_layer	= texture_channel;
-
-		ret.indices.resize( index_offset + 6 );
-		ret.indices[ index_offset + 0 ]	= uint32_t( vertex_offset + 0 );
-		ret.indices[ index_offset + 1 ]	= uint32_t( vertex_offset + 2 );
-		ret.indices[ index_offset + 2 ]	= uint32_t( vertex_offset + 1 );
-		ret.indices[ index_offset + 3 ]	= uint32_t( vertex_offset + 1 );
-		ret.indices[ index_offset + 4 ]	= uint32_t( vertex_offset + 2 );
-		ret.indices[ index_offset + 5 ]	= uint32_t( vertex_offset + 3 );
+		if( origin != glm::vec2( 0.0f, 0.0f ) ) {
+			ret.Translate( origin );
+			ret.aabb	+= origin;
+		}
 	};
 
-	auto location	= origin;
+	if( texture && fi->GetCachedTextMesh( text, kerning, scale, vertical, font_face, texture, ret ) ) {
+		MoveToOrigin();
+		return ret;
+	}
+
+	ret.vertices.reserve( text.size() * 4 );
+	ret.indices.reserve( text.size() * 6 );
+
 	if( vertical ) {
 		// Writing vertical text
+		auto location	= glm::vec2( 0.0f, 0.0f );
 		{
 			auto gi = fi->GetGlyphInfo( font_face, text[ 0 ] );
 			ret.aabb.top_left		= gi->vertical_coords.top_left * scale + location;
@@ -1207,23 +1305,87 @@ VK2D_API vk2d::Mesh vk2d::GenerateTextMesh(
 		}
 		for( auto c : text ) {
 			auto gi = fi->GetGlyphInfo( font_face, c );
-			AppendBox( location, gi->vertical_coords, gi->uv_coords, gi->atlas_index );
+			if( gi->atlas_index < layer_count ) {
+				vk2d_internal::AppendGlyphBox( ret.vertices, ret.indices, ret.aabb, location, gi->vertical_coords, gi->uv_coords, gi->atlas_index, scale );
+			}
 			location.y	+= ( gi->vertical_advance + kerning ) * scale.y;
 		}
 	} else {
 		// Writing horisontal text
-		{
-			auto gi = fi->GetGlyphInfo( font_face, text[ 0 ] );
-			ret.aabb.top_left		= gi->horisontal_coords.top_left * scale + location;
-			ret.aabb.bottom_right	= gi->horisontal_coords.bottom_right * scale + location;
-		}
-		for( auto c : text ) {
-			auto gi = fi->GetGlyphInfo( font_face, c );
-			AppendBox( location, gi->horisontal_coords, gi->uv_coords, gi->atlas_index );
-			location.x	+= ( gi->horisontal_advance + kerning ) * scale.x;
+		TextLayoutSettings settings {};
+		settings.kerning		= kerning;
+		settings.scale			= scale;
+		settings.font_face		= font_face;
+
+		std::vector<vk2d_internal::TextGlyphPlacement>	glyph_placements;
+		std::vector<TextLineMetrics>					line_metrics;
+		fi->LayoutText( text, settings, glyph_placements, line_metrics );
+
+		vk2d_internal::AppendGlyphPlacements( ret.vertices, ret.indices, ret.aabb, glyph_placements, scale, layer_count );
+	}
+
+	ret.SetTexture( texture );
+	ret.signed_distance_field_spread	= fi->GetSignedDistanceFieldSpread();
+
+	// Without a texture the font is not ready yet, the mesh would be
+	// generated again next time anyways.
+	if( texture ) {
+		fi->AddCachedTextMesh( text, kerning, scale, vertical, font_face, texture, ret );
+	}
+
+	MoveToOrigin();
+	return ret;
+}
+
+VK2D_API vk2d::Mesh vk2d::GenerateTextLayoutMesh(
+	FontResource					*	font,
+	glm::vec2							origin,
+	const Text						&	text,
+	const TextLayoutSettings		&	settings,
+	std::vector<TextLineMetrics>	*	out_line_metrics,
+	bool								wait_for_resource_load
+)
+{
+	if( out_line_metrics ) out_line_metrics->clear();
+	if( std::size( text ) <= 0 ) return {};
+	if( !font ) return {};
+	if( !font->impl.get() ) return {};
+	auto fi = font->impl.get();
+	if( wait_for_resource_load ) {
+		fi->WaitUntilLoaded( std::chrono::nanoseconds::max() );
+	} else {
+		if( fi->GetStatus() == ResourceStatus::UNDETERMINED ) return {};
+	}
+	if( !fi->FaceExists( settings.font_face ) ) return {};
+
+	auto texture		= fi->GetTextureResource();
+	auto layer_count	= texture ? texture->GetLayerCount() : UINT32_MAX;
+
+	std::vector<vk2d_internal::TextGlyphPlacement>	glyph_placements;
+	std::vector<TextLineMetrics>					line_metrics;
+	fi->LayoutText( text, settings, glyph_placements, line_metrics );
+
+	Mesh ret;
+	ret.vertices.reserve( glyph_placements.size() * 4 );
+	ret.indices.reserve( glyph_placements.size() * 6 );
+
+	vk2d_internal::AppendGlyphPlacements( ret.vertices, ret.indices, ret.aabb, glyph_placements, settings.scale, layer_count );
+
+	ret.SetTexture( texture );
+	ret.signed_distance_field_spread	= fi->GetSignedDistanceFieldSpread();
+
+	if( origin != glm::vec2( 0.0f, 0.0f ) ) {
+		ret.Translate( origin );
+		ret.aabb	+= origin;
+	}
+
+	if( out_line_metrics ) {
+		for( auto & l : line_metrics ) {
+			l.baseline_origin	+= origin;
+			l.area				+= origin;
 		}
+		*out_line_metrics = std::move( line_metrics );
 	}
 
-	ret.SetTexture( fi->GetTextureResource() );
 	return ret;
 }
@@ -1,40 +1,174 @@
-
 #include "core/SourceCommon.h"
 
 #include "types/Text.h"
 
 
 
-VK2D_API vk2d::Text::Text(
-	const char			*	str
+namespace vk2d {
+namespace vk2d_internal {
+
+constexpr char32_t		UNICODE_REPLACEMENT_CHARACTER		= 0xFFFD;
+constexpr char32_t		UNICODE_MAX_CODE_POINT				= 0x10FFFF;
+
+bool IsUnicodeSurrogate( char32_t c )
+{
+	return c >= 0xD800 && c <= 0xDFFF;
+}
+
+// Decodes a single UTF-8 sequence starting at "position" and advances
+// "position" past it. Invalid, overlong and truncated sequences decode to
+// a replacement character and consume a single byte.
+char32_t DecodeUTF8CodePoint(
+	std::string_view		str,
+	size_t				&	position
 )
 {
-	auto str_size = std::strlen( str );
-	if( str_size > 0 ) {
-		Resize( str_size );
-		for( size_t i = 0; i < str_size; i++ )
-		{
-			str_data[ i ] = str[ i ];
+	auto lead = uint8_t( str[ position ] );
+	if( lead < 0x80 ) {
+		++position;
+		return char32_t( lead );
+	}
+
+	size_t		sequence_length		= {};
+	char32_t	minimum				= {};
+	char32_t	code_point			= {};
+	if( ( lead & 0xE0 ) == 0xC0 ) {
+		sequence_length		= 2;
+		minimum				= 0x80;
+		code_point			= lead & 0x1F;
+	} else if( ( lead & 0xF0 ) == 0xE0 ) {
+		sequence_length		= 3;
+		minimum				= 0x800;
+		code_point			= lead & 0x0F;
+	} else if( ( lead & 0xF8 ) == 0xF0 ) {
+		sequence_length		= 4;
+		minimum				= 0x10000;
+		code_point			= lead & 0x07;
+	} else {
+		++position;
+		return UNICODE_REPLACEMENT_CHARACTER;
+	}
+
+	if( position + sequence_length > std::size( str ) ) {
+		++position;
+		return UNICODE_REPLACEMENT_CHARACTER;
+	}
+	for( size_t i = 1; i < sequence_length; ++i ) {
+		auto continuation = uint8_t( str[ position + i ] );
+		if( ( continuation & 0xC0 ) != 0x80 ) {
+			++position;
+			return UNICODE_REPLACEMENT_CHARACTER;
 		}
-		str_data[ str_size ] = '\0';
+		code_point = ( code_point << 6 ) | ( continuation & 0x3F );
+	}
+	if( code_point < minimum || code_point > UNICODE_MAX_CODE_POINT || IsUnicodeSurrogate( code_point ) ) {
+		++position;
+		return UNICODE_REPLACEMENT_CHARACTER;
+	}
+
+	position += sequence_length;
+	return code_point;
+}
+
+void EncodeUTF8CodePoint(
+	std::string				&	str,
+	char32_t					code_point
+)
+{
+	if( code_point > UNICODE_MAX_CODE_POINT || IsUnicodeSurrogate( code_point ) ) {
+		code_point = UNICODE_REPLACEMENT_CHARACTER;
+	}
+	if( code_point < 0x80 ) {
+		str.push_back( char( code_point ) );
+	} else if( code_point < 0x800 ) {
+		str.push_back( char( 0xC0 | ( code_point >> 6 ) ) );
+		str.push_back( char( 0x80 | ( code_point & 0x3F ) ) );
+	} else if( code_point < 0x10000 ) {
+		str.push_back( char( 0xE0 | ( code_point >> 12 ) ) );
+		str.push_back( char( 0x80 | ( ( code_point >> 6 ) & 0x3F ) ) );
+		str.push_back( char( 0x80 | ( code_point & 0x3F ) ) );
+	} else {
+		str.push_back( char( 0xF0 | ( code_point >> 18 ) ) );
+		str.push_back( char( 0x80 | ( ( code_point >> 12 ) & 0x3F ) ) );
+		str.push_back( char( 0x80 | ( ( code_point >> 6 ) & 0x3F ) ) );
+		str.push_back( char( 0x80 | ( code_point & 0x3F ) ) );
 	}
 }
 
+} // vk2d_internal
+} // vk2d
+
+
+
 VK2D_API vk2d::Text::Text(
-	const wchar_t		*	str
+	std::string_view		str
 )
 {
-	auto str_size = std::wcslen( str );
-	if( str_size > 0 ) {
-		Resize( str_size );
-		for( size_t i = 0; i < str_size; i++ )
-		{
-			str_data[ i ] = str[ i ];
-		}
-		str_data[ str_size ] = '\0';
+	FromUTF8( str );
+}
+
+VK2D_API vk2d::Text::Text(
+	std::u8string_view		str
+)
+{
+	FromUTF8( std::string_view( reinterpret_cast<const char*>( str.data() ), str.size() ) );
+}
+
+VK2D_API vk2d::Text::Text(
+	std::u16string_view		str
+)
+{
+	FromUTF16( str );
+}
+
+VK2D_API vk2d::Text::Text(
+	std::u32string_view		str
+)
+{
+	FromUTF32( str );
+}
+
+VK2D_API vk2d::Text::Text(
+	std::wstring_view		str
+)
+{
+	if constexpr( sizeof( wchar_t ) == sizeof( char16_t ) ) {
+		FromUTF16( std::u16string_view( reinterpret_cast<const char16_t*>( str.data() ), str.size() ) );
+	} else {
+		FromUTF32( std::u32string_view( reinterpret_cast<const char32_t*>( str.data() ), str.size() ) );
 	}
 }
 
+VK2D_API vk2d::Text::Text(
+	const char			*	str
+) :
+	Text( std::string_view( str ) )
+{}
+
+VK2D_API vk2d::Text::Text(
+	const char8_t		*	str
+) :
+	Text( std::u8string_view( str ) )
+{}
+
+VK2D_API vk2d::Text::Text(
+	const char16_t		*	str
+) :
+	Text( std::u16string_view( str ) )
+{}
+
+VK2D_API vk2d::Text::Text(
+	const char32_t		*	str
+) :
+	Text( std::u32string_view( str ) )
+{}
+
+VK2D_API vk2d::Text::Text(
+	const wchar_t		*	str
+) :
+	Text( std::wstring_view( str ) )
+{}
+
 VK2D_API vk2d::Text::Text(
 	const Text	&	other
 )
@@ -58,7 +192,9 @@ VK2D_API vk2d::Text & vk2d::Text::operator=(
 	const Text	&	other
 )
 {
-	CopyOther( other );
+	if( this != &other ) {
+		CopyOther( other );
+	}
 	return *this;
 }
 
@@ -70,18 +206,114 @@ VK2D_API vk2d::Text & vk2d::Text::operator=(
 	return *this;
 }
 
+VK2D_API bool vk2d::Text::operator==(
+	const Text	&	other
+) const
+{
+	if( str_size != other.str_size ) return false;
+	return std::equal( begin(), end(), other.begin() );
+}
+
+VK2D_API char32_t & vk2d::Text::operator[](
+	size_t		index
+)
+{
+	assert( index < str_size );
+	return str_data[ index ];
+}
+
+VK2D_API const char32_t & vk2d::Text::operator[](
+	size_t		index
+) const
+{
+	assert( index < str_size );
+	return str_data[ index ];
+}
+
 
 
 VK2D_API void vk2d::Text::FromUTF8(
-	std::string		str )
+	std::string_view		str
+)
+{
+	Clear();
+	// Decoded text never has more code points than there are bytes.
+	Reserve( std::size( str ) );
+
+	size_t position = 0;
+	while( position < std::size( str ) ) {
+		PushBack( vk2d_internal::DecodeUTF8CodePoint( str, position ) );
+	}
+}
+
+VK2D_API void vk2d::Text::FromUTF16(
+	std::u16string_view		str
+)
+{
+	Clear();
+	Reserve( std::size( str ) );
+
+	for( size_t i = 0; i < std::size( str ); ++i ) {
+		char32_t c = str[ i ];
+		if( c >= 0xD800 && c <= 0xDBFF && i + 1 < std::size( str ) ) {
+			char32_t low = str[ i + 1 ];
+			if( low >= 0xDC00 && low <= 0xDFFF ) {
+				PushBack( 0x10000 + ( ( c - 0xD800 ) << 10 ) + ( low - 0xDC00 ) );
+				++i;
+				continue;
+			}
+		}
+		PushBack( vk2d_internal::IsUnicodeSurrogate( c ) ? vk2d_internal::UNICODE_REPLACEMENT_CHARACTER : c );
+	}
+}
+
+VK2D_API void vk2d::Text::FromUTF32(
+	std::u32string_view		str
+)
+{
+	Resize( std::size( str ) );
+	if( str_size ) {
+		std::copy( str.begin(), str.end(), str_data );
+		str_data[ str_size ] = U'\0';
+	}
+}
+
+VK2D_API std::string vk2d::Text::ToUTF8() const
+{
+	std::string ret;
+	ret.reserve( str_size );
+	for( auto c : *this ) {
+		vk2d_internal::EncodeUTF8CodePoint( ret, c );
+	}
+	return ret;
+}
+
+VK2D_API std::u32string vk2d::Text::ToUTF32() const
 {
-	// TODO...
+	return std::u32string( begin(), end() );
 }
 
-VK2D_API std::string vk2d::Text::ToUTF8()
+VK2D_API void vk2d::Text::PushBack(
+	char32_t		character
+)
+{
+	if( str_size + 1 > str_capacity ) {
+		Reserve( std::max( str_capacity * 2, size_t( 16 ) ) );
+	}
+	str_data[ str_size ]		= character;
+	++str_size;
+	str_data[ str_size ]		= U'\0';
+}
+
+VK2D_API size_t vk2d::Text::Hash() const
 {
-	// TODO...
-	return {};
+	// FNV-1a over code points.
+	uint64_t hash = 14695981039346656037ULL;
+	for( auto c : *this ) {
+		hash ^= uint64_t( c );
+		hash *= 1099511628211ULL;
+	}
+	return size_t( hash );
 }
 
 VK2D_API void vk2d::Text::Reserve(
@@ -90,15 +322,14 @@ VK2D_API void vk2d::Text::Reserve(
 {
 	auto alloc_size = new_capacity + 1;
 	if( str_capacity < new_capacity ) {
-		auto new_str = new int32_t[ alloc_size ];
-		if( !new_str ) return;
+		auto new_str = new char32_t[ alloc_size ];
 		if( str_data ) {
 			std::memcpy( new_str, str_data, str_size * sizeof( *new_str ) );
-			new_str[ str_size ] = '\0';
 			Deallocate();
 		}
-		str_data		= new_str;
-		str_capacity	= new_capacity;
+		new_str[ str_size ]	= U'\0';
+		str_data			= new_str;
+		str_capacity		= new_capacity;
 	}
 }
 
@@ -109,39 +340,79 @@ VK2D_API void vk2d::Text::Resize(
 	Reserve( new_size );
 	if( str_data ) {
 		str_size = new_size;
+		str_data[ str_size ] = U'\0';
 	} else {
 		str_size = 0;
 	}
 }
 
-VK2D_API size_t vk2d::Text::size()
+VK2D_API void vk2d::Text::Clear()
+{
+	str_size = 0;
+	if( str_data ) {
+		str_data[ 0 ] = U'\0';
+	}
+}
+
+VK2D_API size_t vk2d::Text::size() const
 {
 	return str_size;
 }
 
-VK2D_API int32_t * vk2d::Text::data()
+VK2D_API bool vk2d::Text::empty() const
+{
+	return str_size == 0;
+}
+
+VK2D_API char32_t * vk2d::Text::data()
+{
+	return str_data;
+}
+
+VK2D_API const char32_t * vk2d::Text::data() const
+{
+	return str_data;
+}
+
+VK2D_API char32_t * vk2d::Text::begin()
+{
+	return str_data;
+}
+
+VK2D_API const char32_t * vk2d::Text::begin() const
 {
 	return str_data;
 }
 
-VK2D_API int32_t * vk2d::Text::begin()
+VK2D_API char32_t * vk2d::Text::end()
+{
+	return str_data + str_size;
+}
+
+VK2D_API const char32_t * vk2d::Text::end() const
+{
+	return str_data + str_size;
+}
+
+VK2D_API char32_t & vk2d::Text::back()
 {
-	return &str_data[ 0 ];
+	assert( str_size );
+	return str_data[ str_size - 1 ];
 }
 
-VK2D_API int32_t * vk2d::Text::end()
+VK2D_API const char32_t & vk2d::Text::back() const
 {
-	return &str_data[ str_size ];
+	assert( str_size );
+	return str_data[ str_size - 1 ];
 }
 
 VK2D_API void vk2d::Text::CopyOther( const Text & other )
 {
 	Resize( other.str_size );
-	for( size_t i = 0; i < other.str_size; ++i ) {
-		str_data[ i ] = other.str_data[ i ];
+	if( str_size ) {
+		std::copy( other.begin(), other.end(), str_data );
+		str_data[ str_size ] = U'\0';
 	}
-	str_size = other.str_size;
-	str_data[ str_size ] = '\0';
 }
 
 VK2D_API void vk2d::Text::MoveOther( Text && other )
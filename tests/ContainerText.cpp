@@ -0,0 +1,130 @@
+
+#include <types/Text.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace vk2d;
+
+
+
+template<typename T>
+std::ostream& operator<<( std::ostream & os, const std::vector<T> & v )
+{
+	auto vs = std::size( v );
+	if( vs ) {
+		os << "[";
+		for( size_t i = 0; i < vs - 1; ++i ) {
+			os << uint32_t( v[ i ] ) << ", ";
+		}
+		os << uint32_t( v.back() ) << "]";
+	} else {
+		os << "[]";
+	}
+	return os;
+}
+
+
+
+template<typename LambdaT, typename ReturnT>
+void Test( LambdaT && lambda, ReturnT expected_return )
+{
+	auto ret = lambda();
+	if( ret != expected_return ) {
+		cout << "Test: Lambda returned " << ret << ". Was expecting: " << expected_return;
+		exit( -1 );
+	}
+}
+
+vector<char32_t> ToVector( const Text & text )
+{
+	return vector<char32_t>( text.begin(), text.end() );
+}
+
+
+
+int main()
+{
+	cout << "Testing vk2d::Text container class.\n\n";
+
+	{
+		cout << "Construction:\n";
+
+		Test( []()
+			{
+				Text a;
+				Text b {};
+				Text c = "";
+				Text d = std::string();
+				return vector<size_t> { size( a ), size( b ), size( c ), size( d ) };
+			}, vector<size_t>{ 0, 0, 0, 0 }
+		);
+		Test( []()
+			{
+				Text a = "abc";
+				Text b = std::string( "abc" );
+				Text c = L"abc";
+				Text d = u"abc";
+				Text e = U"abc";
+				return vector<bool> { a == b, a == c, a == d, a == e };
+			}, vector<bool>{ true, true, true, true }
+		);
+	}
+
+	{
+		cout << "UTF-8 decoding:\n";
+
+		Test( []()
+			{
+				// a, a with diaeresis, euro sign, grinning face.
+				return ToVector( Text( "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80" ) );
+			}, vector<char32_t>{ 0x61, 0xE4, 0x20AC, 0x1F600 }
+		);
+		Test( []()
+			{
+				// Stray continuation byte, truncated sequence, overlong encoding.
+				return ToVector( Text( "\x80" "a\xE2\x82" "\xC0\xAF" ) );
+			}, vector<char32_t>{ 0xFFFD, 0x61, 0xFFFD, 0xFFFD, 0xFFFD, 0xFFFD }
+		);
+		Test( []()
+			{
+				std::string str = "a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80";
+				return Text( str ).ToUTF8() == str;
+			}, true
+		);
+	}
+
+	{
+		cout << "UTF-16 decoding:\n";
+
+		Test( []()
+			{
+				return ToVector( Text( u"a\U0001F600" ) );
+			}, vector<char32_t>{ 0x61, 0x1F600 }
+		);
+	}
+
+	{
+		cout << "Copy, move and hash:\n";
+
+		Test( []()
+			{
+				Text a = "abc";
+				Text b = a;
+				Text c = std::move( b );
+				a.PushBack( U'd' );
+				return vector<size_t> { size( a ), size( b ), size( c ) };
+			}, vector<size_t>{ 4, 0, 3 }
+		);
+		Test( []()
+			{
+				return Text( "\xC3\xA4" ).Hash() == Text( U"ä" ).Hash();
+			}, true
+		);
+	}
+
+	cout << "\n";
+
+	return 0;
+}
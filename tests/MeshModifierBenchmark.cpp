@@ -0,0 +1,195 @@
+#include <types/Mesh.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+using namespace vk2d;
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double RAD = PI * 2.0;
+
+
+
+// Mesh vertex modifiers are vectorized, this compares them against plain
+// scalar loops on a large lattice mesh, checks that the results match and
+// prints the speedup. Only mismatching results fail the test, timings vary
+// too much between machines.
+
+
+
+constexpr uint32_t	ITERATIONS			= 20;
+constexpr float		TOLERANCE			= 0.01f;
+
+
+
+// Reference implementations, same math as the modifiers one vertex at a time.
+namespace reference {
+
+void Rotate( vector<Vertex> & vertices, float rotation, glm::vec2 origin )
+{
+	auto x = std::cos( rotation );
+	auto y = std::sin( rotation );
+	auto m = glm::mat2( +x, +y, -y, +x );
+	for( auto & v : vertices ) {
+		v.vertex_coords = m * ( v.vertex_coords - origin ) + origin;
+	}
+}
+
+void Scew( vector<Vertex> & vertices, glm::vec2 scew, glm::vec2 origin )
+{
+	for( auto & v : vertices ) {
+		auto c = v.vertex_coords - origin;
+		v.vertex_coords = glm::vec2( c.y * scew.x + c.x, c.x * scew.y + c.y ) + origin;
+	}
+}
+
+void DirectionalWave( vector<Vertex> & vertices, Rect2f aabb, float direction, float frequency, float animation, glm::vec2 intensity, glm::vec2 origin )
+{
+	auto size	= aabb.bottom_right - aabb.top_left;
+	auto x		= std::cos( direction );
+	auto y		= std::sin( direction );
+	auto f		= glm::mat2( +x, +y, -y, +x );
+	auto b		= glm::mat2( +x, -y, +y, +x );
+	for( auto & v : vertices ) {
+		auto c = b * ( v.vertex_coords - origin );
+		auto d = float( animation / RAD ) + float( frequency * ( ( c.x / size.x + c.y / size.y ) / 2.0f ) * RAD );
+		v.vertex_coords = f * glm::vec2( std::cos( d ) * intensity.x + c.x, std::sin( d ) * intensity.y + c.y ) + origin;
+	}
+}
+
+void SetVertexColorGradient( vector<Vertex> & vertices, Colorf color_1, Colorf color_2, glm::vec2 coord_1, glm::vec2 coord_2 )
+{
+	auto dir = coord_2 - coord_1;
+	auto len2 = dir.x * dir.x + dir.y * dir.y;
+	for( auto & v : vertices ) {
+		auto c = v.vertex_coords - coord_1;
+		auto t = std::clamp( ( c.x * dir.x + c.y * dir.y ) / len2, 0.0f, 1.0f );
+		v.color = Colorf(
+			color_1.r * ( 1.0f - t ) + color_2.r * t,
+			color_1.g * ( 1.0f - t ) + color_2.g * t,
+			color_1.b * ( 1.0f - t ) + color_2.b * t,
+			color_1.a * ( 1.0f - t ) + color_2.a * t
+		);
+	}
+}
+
+Rect2f AABB( const vector<Vertex> & vertices )
+{
+	Rect2f ret { vertices[ 0 ].vertex_coords, vertices[ 0 ].vertex_coords };
+	for( auto & v : vertices ) {
+		ret.top_left		= glm::min( ret.top_left, v.vertex_coords );
+		ret.bottom_right	= glm::max( ret.bottom_right, v.vertex_coords );
+	}
+	return ret;
+}
+
+} // reference
+
+
+
+double TimeMilliseconds( const function<void()> & f )
+{
+	auto start = chrono::steady_clock::now();
+	for( uint32_t i = 0; i < ITERATIONS; ++i ) {
+		f();
+	}
+	return chrono::duration<double, milli>( chrono::steady_clock::now() - start ).count() / ITERATIONS;
+}
+
+bool Compare( const vector<Vertex> & a, const vector<Vertex> & b )
+{
+	if( size( a ) != size( b ) ) return false;
+	for( size_t i = 0; i < size( a ); ++i ) {
+		if( glm::any( glm::greaterThan( glm::abs( a[ i ].vertex_coords - b[ i ].vertex_coords ), glm::vec2( TOLERANCE ) ) ) ) return false;
+		if( std::abs( a[ i ].color.r - b[ i ].color.r ) > TOLERANCE ) return false;
+		if( std::abs( a[ i ].color.g - b[ i ].color.g ) > TOLERANCE ) return false;
+		if( std::abs( a[ i ].color.b - b[ i ].color.b ) > TOLERANCE ) return false;
+		if( std::abs( a[ i ].color.a - b[ i ].color.a ) > TOLERANCE ) return false;
+	}
+	return true;
+}
+
+void Benchmark( const char * name, const Mesh & source, const function<void( Mesh & )> & modifier, const function<void( vector<Vertex> & )> & reference_modifier )
+{
+	// One pass on copies to compare results.
+	{
+		auto mesh = source;
+		auto reference_vertices = source.vertices;
+		modifier( mesh );
+		reference_modifier( reference_vertices );
+		if( !Compare( mesh.vertices, reference_vertices ) ) {
+			cout << "Test: " << name << " result does not match the reference.";
+			exit( -1 );
+		}
+	}
+
+	auto mesh = source;
+	auto reference_vertices = source.vertices;
+	auto time			= TimeMilliseconds( [ & ]() { modifier( mesh ); } );
+	auto reference_time	= TimeMilliseconds( [ & ]() { reference_modifier( reference_vertices ); } );
+
+	cout << setw( 24 ) << left << name
+		<< fixed << setprecision( 3 )
+		<< setw( 12 ) << right << reference_time << " ms"
+		<< setw( 12 ) << right << time << " ms"
+		<< setw( 10 ) << right << setprecision( 2 ) << reference_time / time << "x\n";
+}
+
+
+
+int main()
+{
+	auto mesh = GenerateLatticeMesh( { -500.0f, -500.0f, 500.0f, 500.0f }, { 499.0f, 499.0f } );
+
+	cout << "Mesh modifiers, " << size( mesh.vertices ) << " vertices, " << ITERATIONS << " iterations:\n";
+	cout << setw( 24 ) << left << "" << setw( 15 ) << right << "scalar" << setw( 15 ) << right << "vectorized" << setw( 11 ) << right << "speedup" << "\n";
+
+	Benchmark( "Translate", mesh,
+		[]( Mesh & m ) { m.Translate( { 1.5f, -2.5f } ); },
+		[]( vector<Vertex> & v ) { for( auto & i : v ) i.vertex_coords += glm::vec2( 1.5f, -2.5f ); }
+	);
+	Benchmark( "Rotate", mesh,
+		[]( Mesh & m ) { m.Rotate( 0.1f, { 10.0f, 20.0f } ); },
+		[]( vector<Vertex> & v ) { reference::Rotate( v, 0.1f, { 10.0f, 20.0f } ); }
+	);
+	Benchmark( "Scale", mesh,
+		[]( Mesh & m ) { m.Scale( { 1.01f, 0.99f }, { 10.0f, 20.0f } ); },
+		[]( vector<Vertex> & v ) { for( auto & i : v ) i.vertex_coords = ( i.vertex_coords - glm::vec2( 10.0f, 20.0f ) ) * glm::vec2( 1.01f, 0.99f ) + glm::vec2( 10.0f, 20.0f ); }
+	);
+	Benchmark( "Scew", mesh,
+		[]( Mesh & m ) { m.Scew( { 0.01f, -0.02f }, { 10.0f, 20.0f } ); },
+		[]( vector<Vertex> & v ) { reference::Scew( v, { 0.01f, -0.02f }, { 10.0f, 20.0f } ); }
+	);
+	Benchmark( "DirectionalWave", mesh,
+		[]( Mesh & m ) { m.DirectionalWave( 0.5f, 3.0f, 1.25f, { 4.0f, 6.0f }, { 10.0f, 20.0f } ); },
+		[ aabb = mesh.aabb ]( vector<Vertex> & v ) { reference::DirectionalWave( v, aabb, 0.5f, 3.0f, 1.25f, { 4.0f, 6.0f }, { 10.0f, 20.0f } ); }
+	);
+	Benchmark( "SetVertexColorGradient", mesh,
+		[]( Mesh & m ) { m.SetVertexColorGradient( { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f, 0.5f }, { -300.0f, -200.0f }, { 300.0f, 250.0f } ); },
+		[]( vector<Vertex> & v ) { reference::SetVertexColorGradient( v, { 1.0f, 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f, 1.0f, 0.5f }, { -300.0f, -200.0f }, { 300.0f, 250.0f } ); }
+	);
+
+	// AABB only reads vertices, compare it separately.
+	{
+		auto expected = reference::AABB( mesh.vertices );
+		auto result = mesh.RecalculateAABBFromVertices();
+		if( result.top_left != expected.top_left || result.bottom_right != expected.bottom_right ) {
+			cout << "Test: RecalculateAABBFromVertices result does not match the reference.";
+			exit( -1 );
+		}
+		Benchmark( "RecalculateAABB", mesh,
+			[]( Mesh & m ) { m.RecalculateAABBFromVertices(); },
+			[]( vector<Vertex> & v ) { volatile auto r = reference::AABB( v ).top_left.x; (void)r; }
+		);
+	}
+
+	cout << "\n";
+
+	return 0;
+}
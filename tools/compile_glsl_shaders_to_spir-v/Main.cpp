@@ -125,7 +125,7 @@ int main( int argc, char * argv[] )
 	}
 
 	// Create header file that includes every shader
-	auto include_file_path = glsl_location / "Spir-V" / "IncludeAllShaders.h";
+	auto include_file_path = glsl_location / "spir-v" / "IncludeAllShaders.h";
 	auto include_file = ofstream( include_file_path );
 	include_file << "#pragma once\n\n";
 	for( auto & e : file_entries ) {
@@ -210,7 +210,7 @@ FileEntry GetGLSLFileEntryForEntrypoint( fs::path path, string entrypoint )
 	file_entry.source_file			= path;
 	file_entry.destination_file		= path;
 	file_entry.destination_file.remove_filename();
-	file_entry.destination_file		/= fs::path( "Spir-V" ) / entrypoint;
+	file_entry.destination_file		/= fs::path( "spir-v" ) / entrypoint;
 	file_entry.destination_file		+= path.extension();
 	file_entry.destination_file		+= ".spv.h";
 